@@ -8,6 +8,7 @@
 #include "driver/dedic_gpio.h"
 #include "driver/timer.h"
 #include "esp_log.h"
+#include "esp_timer.h"
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
@@ -25,6 +26,16 @@
 #define ISR_PERIOD_MS 1
 #define DEBOUNCE_HIST_LEN 5
 
+//==============================================================================
+// Structs
+//==============================================================================
+
+typedef struct
+{
+    uint32_t state; ///< The state of all the buttons
+    int64_t time;   ///< When the state was first read, before debouncing
+} btnIsrEvt_t;
+
 //==============================================================================
 // Prototypes
 //==============================================================================
@@ -44,6 +55,9 @@ static xQueueHandle gpio_evt_queue = NULL;
 // The current state of the buttons
 static uint32_t buttonStates = 0;
 
+// A task to notify when a button event is queued
+static TaskHandle_t notifyTask = NULL;
+
 //==============================================================================
 // Functions
 //==============================================================================
@@ -109,7 +123,7 @@ void initButtons(timer_group_t group_num, timer_idx_t timer_num, uint8_t numButt
     buttonStates = dedic_gpio_bundle_read_in(bundle);
 
     // create a queue to handle polling GPIO from ISR
-    gpio_evt_queue = xQueueCreate(64, sizeof(uint32_t));
+    gpio_evt_queue = xQueueCreate(64, sizeof(btnIsrEvt_t));
 
     // Initialize the timer
     timer_config_t config =
@@ -183,7 +197,18 @@ static bool IRAM_ATTR btn_timer_isr_cb(void* args __attribute__((unused)))
     // Only queue changes
     if(lastEvt != evt)
     {
-        xQueueSendFromISR(gpio_evt_queue, &evt, &high_task_awoken);
+        // The change was first read when the debounce history started
+        btnIsrEvt_t isrEvt =
+        {
+            .state = evt,
+            .time = esp_timer_get_time() - ((DEBOUNCE_HIST_LEN - 1) * ISR_PERIOD_MS * 1000),
+        };
+        xQueueSendFromISR(gpio_evt_queue, &isrEvt, &high_task_awoken);
+        // Wake up whoever is waiting for buttons
+        if(NULL != notifyTask)
+        {
+            vTaskNotifyGiveFromISR(notifyTask, &high_task_awoken);
+        }
         // save the event
         lastEvt = evt;
     }
@@ -191,6 +216,17 @@ static bool IRAM_ATTR btn_timer_isr_cb(void* args __attribute__((unused)))
     return high_task_awoken == pdTRUE;
 }
 
+/**
+ * @brief Set a task to notify with vTaskNotifyGiveFromISR() whenever a button
+ * event is queued, so the task can block until there is something to do
+ *
+ * @param task The task to notify, or NULL to not notify anything
+ */
+void setButtonNotifyTask(TaskHandle_t task)
+{
+    notifyTask = task;
+}
+
 /**
  * @brief Service the queue of button events that caused interrupts
  * This only reutrns a single event, even if there are multiple in the queue
@@ -202,12 +238,12 @@ static bool IRAM_ATTR btn_timer_isr_cb(void* args __attribute__((unused)))
 bool checkButtonQueue(buttonEvt_t* evt)
 {
     // Check if there's an event to dequeue from the ISR
-    uint32_t gpio_evt;
+    btnIsrEvt_t gpio_evt;
     while (xQueueReceive(gpio_evt_queue, &gpio_evt, 0))
     {
         // Save the old state, set the new state
         uint32_t oldButtonStates = buttonStates;
-        buttonStates = gpio_evt;
+        buttonStates = gpio_evt.state;
         // If there was a change
         if(oldButtonStates != buttonStates)
         {
@@ -215,6 +251,7 @@ bool checkButtonQueue(buttonEvt_t* evt)
             evt->button = oldButtonStates ^ buttonStates;
             evt->down = (buttonStates > oldButtonStates);
             evt->state = buttonStates;
+            evt->time = gpio_evt.time;
 
             // Debug print
             // ESP_LOGE("BTN", "Bit 0x%02x was %s, buttonStates is %02x",
@@ -4,6 +4,8 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include "hal/timer_types.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
 
 typedef enum
 {
@@ -32,10 +34,12 @@ typedef struct
     uint16_t state;
     buttonBit_t button;
     bool down;
+    int64_t time; ///< When the change was first read, from esp_timer_get_time()
 } buttonEvt_t;
 
 void initButtons(timer_group_t group_num, timer_idx_t timer_num, uint8_t numButtons, ...);
 void deinitButtons(void);
 bool checkButtonQueue(buttonEvt_t*);
+void setButtonNotifyTask(TaskHandle_t task);
 
 #endif
\ No newline at end of file
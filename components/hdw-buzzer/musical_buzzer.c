@@ -5,6 +5,7 @@
 #include "esp_log.h"
 #include "esp_timer.h"
 #include "musical_buzzer.h"
+#include "song_cursor.h"
 
 //==============================================================================
 // Defines
@@ -26,8 +27,7 @@
 
 typedef struct
 {
-    const song_t* song;
-    uint32_t note_index;
+    songCursor_t cursor;
     int64_t start_time;
 } buzzerTrack_t;
 
@@ -180,17 +180,21 @@ void buzzer_play_bgm(const song_t* song)
         return;
     }
 
-    bzr.bgm.song = song;
-    bzr.bgm.note_index = 0;
+    // Stop the timer so the ISR doesn't read the cursor while it's reset
+    timer_pause(bzr.noteCheckGroupNum, bzr.noteCheckTimerNum);
+
+    songCursorStart(&bzr.bgm.cursor, song);
     bzr.bgm.start_time = esp_timer_get_time();
 
     // If there is no current SFX
-    if(NULL == bzr.sfx.song)
+    if(NULL == bzr.sfx.cursor.song)
     {
         // Start playing BGM
-        playNote(bzr.bgm.song->notes[0].note);
-        timer_start(bzr.noteCheckGroupNum, bzr.noteCheckTimerNum);
+        playNote(bzr.bgm.cursor.note.note);
     }
+
+    // Restart the timer, which also keeps any current SFX playing
+    timer_start(bzr.noteCheckGroupNum, bzr.noteCheckTimerNum);
 }
 
 /**
@@ -207,12 +211,14 @@ void buzzer_play_sfx(const song_t* song)
         return;
     }
 
-    bzr.sfx.song = song;
-    bzr.sfx.note_index = 0;
+    // Stop the timer so the ISR doesn't read the cursor while it's reset
+    timer_pause(bzr.noteCheckGroupNum, bzr.noteCheckTimerNum);
+
+    songCursorStart(&bzr.sfx.cursor, song);
     bzr.sfx.start_time = esp_timer_get_time();
 
     // Always play SFX
-    playNote(bzr.sfx.song->notes[0].note);
+    playNote(bzr.sfx.cursor.note.note);
     timer_start(bzr.noteCheckGroupNum, bzr.noteCheckTimerNum);
 }
 
@@ -228,12 +234,10 @@ void buzzer_stop(void)
     stopNote();
 
     // Clear internal variables
-    bzr.bgm.note_index = 0;
-    bzr.bgm.song = NULL;
+    songCursorStop(&bzr.bgm.cursor);
     bzr.bgm.start_time = 0;
 
-    bzr.sfx.note_index = 0;
-    bzr.sfx.song = NULL;
+    songCursorStop(&bzr.sfx.cursor);
     bzr.sfx.start_time = 0;
 }
 
@@ -303,10 +307,10 @@ static bool IRAM_ATTR buzzer_check_next_note_isr(void * ptr)
     bool bgmIsActive = buzzer_track_check_next_note(&bzr.bgm, !sfxIsActive, cTime);
 
     // If nothing is playing, but there is BGM (i.e. SFX finished)
-    if((false == sfxIsActive) && (false == bgmIsActive) && (NULL != bzr.bgm.song))
+    if((false == sfxIsActive) && (false == bgmIsActive) && (NULL != bzr.bgm.cursor.song))
     {
         // Immediately start playing BGM to get back on track faster
-        playNote(bzr.bgm.song->notes[bzr.bgm.note_index].note);
+        playNote(bzr.bgm.cursor.note.note);
     }
     return false;
 }
@@ -325,29 +329,21 @@ static bool IRAM_ATTR buzzer_check_next_note_isr(void * ptr)
  */
 static bool IRAM_ATTR buzzer_track_check_next_note(buzzerTrack_t* track, bool isActive, int64_t cTime)
 {
-    // Check if there is a song and there are still notes
-    if((NULL != track->song) && (track->note_index < track->song->numNotes))
+    // Check if there is a song
+    if(NULL != track->cursor.song)
     {
         // Check if it's time to play the next note
-        if (cTime - track->start_time >= (1000 * track->song->notes[track->note_index].timeMs))
+        if (cTime - track->start_time >= (1000 * track->cursor.note.timeMs))
         {
-            // Move to the next note
-            track->note_index++;
+            // Move to the next note, looping if we should. Encoded songs are
+            // decoded one note at a time here
             track->start_time = cTime;
-
-            // Loop if we should
-            if(track->song->shouldLoop && (track->note_index == track->song->numNotes))
-            {
-                track->note_index = track->song->loopStartNote;
-            }
-
-            // If there is a note
-            if(track->note_index < track->song->numNotes)
+            if(songCursorNext(&track->cursor))
             {
                 if(isActive)
                 {
                     // Set the note to be played
-                    playNote(track->song->notes[track->note_index].note);
+                    playNote(track->cursor.note.note);
                 }
             }
             else
@@ -358,10 +354,8 @@ static bool IRAM_ATTR buzzer_track_check_next_note(buzzerTrack_t* track, bool is
                     stopNote();
                 }
 
-                // Clear track data
+                // Clear track data, the cursor already let go of the song
                 track->start_time = 0;
-                track->note_index = 0;
-                track->song = NULL;
                 // Track isn't active
                 return false;
             }
@@ -160,6 +160,8 @@ typedef struct
     uint32_t shouldLoop;
     uint32_t numNotes;
     uint32_t loopStartNote;
+    const uint8_t* encoded;   /*!< Encoded notes from loadSong(), or NULL if notes[] is used */
+    uint32_t loopStartOffset; /*!< The offset of loopStartNote in encoded */
     musicalNote_t notes[];
 } song_t;
 
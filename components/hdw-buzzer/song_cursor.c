@@ -0,0 +1,150 @@
+//==============================================================================
+// Includes
+//==============================================================================
+
+#include <stddef.h>
+
+#include "esp_attr.h"
+#include "song_cursor.h"
+
+//==============================================================================
+// Variables
+//==============================================================================
+
+/// Frequencies of encoded pitches, starting at SONG_FIRST_PITCH
+static const DRAM_ATTR uint16_t songPitchFrequencies[SONG_LAST_PITCH - SONG_FIRST_PITCH + 1] =
+{
+    C_0, C_SHARP_0, D_0, D_SHARP_0, E_0, F_0, F_SHARP_0, G_0, G_SHARP_0, A_0, A_SHARP_0, B_0,
+    C_1, C_SHARP_1, D_1, D_SHARP_1, E_1, F_1, F_SHARP_1, G_1, G_SHARP_1, A_1, A_SHARP_1, B_1,
+    C_2, C_SHARP_2, D_2, D_SHARP_2, E_2, F_2, F_SHARP_2, G_2, G_SHARP_2, A_2, A_SHARP_2, B_2,
+    C_3, C_SHARP_3, D_3, D_SHARP_3, E_3, F_3, F_SHARP_3, G_3, G_SHARP_3, A_3, A_SHARP_3, B_3,
+    C_4, C_SHARP_4, D_4, D_SHARP_4, E_4, F_4, F_SHARP_4, G_4, G_SHARP_4, A_4, A_SHARP_4, B_4,
+    C_5, C_SHARP_5, D_5, D_SHARP_5, E_5, F_5, F_SHARP_5, G_5, G_SHARP_5, A_5, A_SHARP_5, B_5,
+    C_6, C_SHARP_6, D_6, D_SHARP_6, E_6, F_6, F_SHARP_6, G_6, G_SHARP_6, A_6, A_SHARP_6, B_6,
+    C_7, C_SHARP_7, D_7, D_SHARP_7, E_7, F_7, F_SHARP_7, G_7, G_SHARP_7, A_7, A_SHARP_7, B_7,
+    C_8, C_SHARP_8, D_8, D_SHARP_8, E_8, F_8, F_SHARP_8, G_8, G_SHARP_8, A_8, A_SHARP_8, B_8,
+    C_9, C_SHARP_9, D_9, D_SHARP_9, E_9, F_9, F_SHARP_9, G_9, G_SHARP_9, A_9, A_SHARP_9, B_9,
+    C_10, C_SHARP_10, D_10, D_SHARP_10, E_10, F_10, F_SHARP_10, G_10, G_SHARP_10, A_10, A_SHARP_10, B_10,
+};
+
+//==============================================================================
+// Function Prototypes
+//==============================================================================
+
+static void songCursorRead(songCursor_t* cursor);
+
+//==============================================================================
+// Functions
+//==============================================================================
+
+/**
+ * @brief Point a cursor at the first note of a song
+ *
+ * @param cursor The cursor to start
+ * @param song The song to read. May be a song_t with notes[] or one from
+ *             loadSong() with encoded notes
+ */
+void IRAM_ATTR songCursorStart(songCursor_t* cursor, const song_t* song)
+{
+    cursor->song = song;
+    cursor->noteIdx = 0;
+    cursor->nextOffset = SONG_HEADER_SIZE;
+    if(NULL != song->encoded)
+    {
+        // Skip over the varints in the header
+        songDecodeVarint(song->encoded, &cursor->nextOffset);
+        songDecodeVarint(song->encoded, &cursor->nextOffset);
+    }
+    songCursorRead(cursor);
+}
+
+/**
+ * @brief Move a cursor to the next note in its song, looping if the song loops.
+ * This has IRAM_ATTR because it is called from the note check interrupt
+ *
+ * @param cursor The cursor to advance
+ * @return true if cursor->note is the next note,
+ *         false if the song is over and the cursor was stopped
+ */
+bool IRAM_ATTR songCursorNext(songCursor_t* cursor)
+{
+    cursor->noteIdx++;
+
+    // Loop if we should
+    if(cursor->song->shouldLoop && (cursor->noteIdx == cursor->song->numNotes))
+    {
+        cursor->noteIdx = cursor->song->loopStartNote;
+        cursor->nextOffset = cursor->song->loopStartOffset;
+    }
+
+    if(cursor->noteIdx < cursor->song->numNotes)
+    {
+        songCursorRead(cursor);
+        return true;
+    }
+
+    songCursorStop(cursor);
+    return false;
+}
+
+/**
+ * @brief Detach a cursor from its song
+ *
+ * @param cursor The cursor to stop
+ */
+void IRAM_ATTR songCursorStop(songCursor_t* cursor)
+{
+    cursor->song = NULL;
+    cursor->noteIdx = 0;
+    cursor->nextOffset = 0;
+    cursor->note.note = SILENCE;
+    cursor->note.timeMs = 0;
+}
+
+/**
+ * @brief Read a varint from a byte stream
+ *
+ * @param data The bytes to read from
+ * @param offset The offset to read at, advanced past the varint
+ * @return The value of the varint
+ */
+uint32_t IRAM_ATTR songDecodeVarint(const uint8_t* data, uint32_t* offset)
+{
+    uint32_t value = 0;
+    uint32_t shift = 0;
+    uint8_t byte;
+    do
+    {
+        byte = data[(*offset)++];
+        value |= (uint32_t)(byte & 0x7F) << shift;
+        shift += 7;
+    } while((byte & 0x80) && (shift < 32));
+    return value;
+}
+
+/**
+ * @brief Load the note at cursor->noteIdx into cursor->note. Encoded notes are
+ * read from cursor->nextOffset, which must be where that note starts
+ *
+ * @param cursor The cursor to read a note for
+ */
+static void IRAM_ATTR songCursorRead(songCursor_t* cursor)
+{
+    if(NULL == cursor->song->encoded)
+    {
+        cursor->note = cursor->song->notes[cursor->noteIdx];
+        return;
+    }
+
+    const uint8_t* data = cursor->song->encoded;
+    uint8_t pitch = data[cursor->nextOffset++];
+    if(pitch >= SONG_FIRST_PITCH && pitch <= SONG_LAST_PITCH)
+    {
+        cursor->note.note = songPitchFrequencies[pitch - SONG_FIRST_PITCH];
+    }
+    else
+    {
+        cursor->note.note = SILENCE;
+    }
+    cursor->note.timeMs = songDecodeVarint(data, &cursor->nextOffset);
+}
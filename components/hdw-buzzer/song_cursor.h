@@ -0,0 +1,55 @@
+#ifndef _SONG_CURSOR_H_
+#define _SONG_CURSOR_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "musical_buzzer.h"
+
+/*
+ * Encoded songs are a header followed by a stream of notes. All multi-byte
+ * numbers are varints, seven bits per byte, least significant group first, with
+ * the high bit set on every byte but the last.
+ *
+ * Header:
+ *   'S' 'N' 'G' SONG_VERSION
+ *   flags (SONG_FLAG_*)
+ *   varint numNotes
+ *   varint loopStartNote
+ *
+ * Each note:
+ *   pitch, 0 for SILENCE or a MIDI note number from SONG_FIRST_PITCH to SONG_LAST_PITCH
+ *   varint timeMs
+ */
+
+#define SONG_MAGIC       "SNG"
+#define SONG_VERSION     1
+#define SONG_HEADER_SIZE 5
+
+#define SONG_FLAG_LOOP   0x01
+
+/// The longest varint songDecodeVarint() reads, enough for 32 bits
+#define SONG_VARINT_MAX_LEN 5
+
+#define SONG_FIRST_PITCH 12  // C_0
+#define SONG_LAST_PITCH  143 // B_10
+
+/**
+ * @brief A read position in a song, either in a song_t's notes[] or in its
+ * encoded note stream
+ */
+typedef struct
+{
+    const song_t* song;  /*!< The song being read, NULL if there is none */
+    uint32_t noteIdx;    /*!< The index of the current note */
+    uint32_t nextOffset; /*!< The offset of the note after this one in song->encoded */
+    musicalNote_t note;  /*!< The current note */
+} songCursor_t;
+
+void songCursorStart(songCursor_t* cursor, const song_t* song);
+bool songCursorNext(songCursor_t* cursor);
+void songCursorStop(songCursor_t* cursor);
+
+uint32_t songDecodeVarint(const uint8_t* data, uint32_t* offset);
+
+#endif
@@ -70,6 +70,9 @@ struct {
     uint32_t uartNum;
     wifiMode_t mode;
 
+    // A task to notify when a packet is queued
+    TaskHandle_t notifyTask;
+
     // A ringbuffer for esp-now serial communication
     char ringBuf[ESP_NOW_SERIAL_RINGBUF_SIZE];
     int16_t rBufHead;
@@ -388,9 +391,36 @@ void espNowRecvCb(const uint8_t* mac_addr, const uint8_t* data, int data_len)
 
         // Queue this packet
         xQueueSendFromISR(en.esp_now_queue, &packet, NULL);
+
+        // Wake up whoever is waiting for packets
+        if(NULL != en.notifyTask)
+        {
+            xTaskNotifyGive(en.notifyTask);
+        }
     }
 }
 
+/**
+ * Set a task to notify with xTaskNotifyGive() whenever a received packet is
+ * queued, so the task can block until there is something to do. Packets
+ * received over serial are not notified, they must be polled for
+ *
+ * @param task The task to notify, or NULL to not notify anything
+ */
+void espNowSetNotifyTask(TaskHandle_t task)
+{
+    en.notifyTask = task;
+}
+
+/**
+ * @return true if ESP-NOW is communicating over serial, which must be polled,
+ *         false if it is using wifi
+ */
+bool espNowIsSerial(void)
+{
+    return en.isSerial;
+}
+
 /**
  * Check the ESP NOW receive queue. If there are any received packets, send
  * them to hostEspNowRecvCb()
@@ -604,7 +634,9 @@ void espNowSendCb(const uint8_t* mac_addr, esp_now_send_status_t status)
 }
 
 /**
- * This function is automatically called to de-initialize ESP-NOW
+ * This function is automatically called to de-initialize ESP-NOW. It is also
+ * called when softly switching between swadge modes, so it leaves everything in
+ * a state where espNowInit() may be called again
  */
 void espNowDeinit(void)
 {
@@ -618,7 +650,18 @@ void espNowDeinit(void)
         esp_now_unregister_send_cb();
         esp_now_del_peer( espNowBroadcastMac );
         esp_now_deinit();
-        esp_wifi_stop();
-        esp_wifi_deinit();
     }
+
+    // Wifi is initialized for both wireless and serial communication
+    esp_wifi_stop();
+    esp_wifi_deinit();
+
+    // Free the RX queue so that ESP-NOW may be initialized again
+    if(NULL != en.esp_now_queue)
+    {
+        vQueueDelete(en.esp_now_queue);
+        en.esp_now_queue = NULL;
+    }
+    en.rBufHead = 0;
+    en.rBufTail = 0;
 }
@@ -17,6 +17,8 @@
 #include <esp_now.h>
 #include <hal/gpio_types.h>
 #include <driver/uart.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
 
 //==============================================================================
 // Types
@@ -64,5 +66,7 @@ void espNowUseSerial(bool crossoverPins);
 
 void espNowSend(const char* data, uint8_t len);
 void checkEspNowRxQueue(void);
+void espNowSetNotifyTask(TaskHandle_t task);
+bool espNowIsSerial(void);
 
 #endif /* USER_ESPNOWUTILS_H_ */
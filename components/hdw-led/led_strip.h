@@ -55,15 +55,16 @@ struct led_strip_s
     * @brief Refresh memory colors to LEDs
     *
     * @param strip: LED strip
-    * @param timeout_ms: timeout value for refreshing task
+    * @param timeout_ms: how long to wait for the previous refresh to finish sending
     *
     * @return
-    *      - ESP_OK: Refresh successfully
-    *      - ESP_ERR_TIMEOUT: Refresh failed because of timeout
+    *      - ESP_OK: Refresh started successfully
+    *      - ESP_ERR_TIMEOUT: Refresh failed because the previous one was still sending
     *      - ESP_FAIL: Refresh failed because some other error occurred
     *
     * @note:
     *      After updating the LED colors in the memory, a following invocation of this API is needed to flush colors to strip.
+    *      Colors are sent in the background, this doesn't wait for them to finish.
     */
     esp_err_t (*refresh)(led_strip_t* strip, uint32_t timeout_ms);
 
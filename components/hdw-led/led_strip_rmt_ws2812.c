@@ -38,17 +38,20 @@ static const char* TAG = "ws2812";
 #define WS2812_T1L_NS (350)
 #define WS2812_RESET_US (280)
 
-static uint32_t ws2812_t0h_ticks = 0;
-static uint32_t ws2812_t1h_ticks = 0;
-static uint32_t ws2812_t0l_ticks = 0;
-static uint32_t ws2812_t1l_ticks = 0;
+/**
+ * RMT items for every 4-bit value, MSB first. The adapter runs in the RMT ISR
+ * for every byte sent, so it copies these instead of testing each bit
+ */
+static DRAM_ATTR rmt_item32_t ws2812_nibble_items[16][4];
 
 typedef struct
 {
     led_strip_t parent;
     rmt_channel_t rmt_channel;
     uint32_t strip_len;
-    uint8_t buffer[0];
+    uint8_t* front;    // Being sent by the RMT, don't touch until it's done
+    uint8_t* back;     // Written by set_pixel(), swapped to the front by refresh()
+    uint8_t buffer[0]; // Storage for both buffers
 } ws2812_t;
 
 /**
@@ -72,28 +75,25 @@ static void IRAM_ATTR ws2812_rmt_adapter(const void* src, rmt_item32_t* dest, si
         *item_num = 0;
         return;
     }
-    const rmt_item32_t bit0 = {{{ ws2812_t0h_ticks, 1, ws2812_t0l_ticks, 0 }}}; //Logical 0
-    const rmt_item32_t bit1 = {{{ ws2812_t1h_ticks, 1, ws2812_t1l_ticks, 0 }}}; //Logical 1
     size_t size = 0;
     size_t num = 0;
-    uint8_t* psrc = (uint8_t*)src;
+    const uint8_t* psrc = (const uint8_t*)src;
     rmt_item32_t* pdest = dest;
     while (size < src_size && num < wanted_num)
     {
-        for (int i = 0; i < 8; i++)
-        {
-            // MSB first
-            if (*psrc & (1 << (7 - i)))
-            {
-                pdest->val =  bit1.val;
-            }
-            else
-            {
-                pdest->val =  bit0.val;
-            }
-            num++;
-            pdest++;
-        }
+        // MSB first, a nibble at a time
+        const rmt_item32_t* hi = ws2812_nibble_items[*psrc >> 4];
+        const rmt_item32_t* lo = ws2812_nibble_items[*psrc & 0x0F];
+        pdest[0].val = hi[0].val;
+        pdest[1].val = hi[1].val;
+        pdest[2].val = hi[2].val;
+        pdest[3].val = hi[3].val;
+        pdest[4].val = lo[0].val;
+        pdest[5].val = lo[1].val;
+        pdest[6].val = lo[2].val;
+        pdest[7].val = lo[3].val;
+        num += 8;
+        pdest += 8;
         size++;
         psrc++;
     }
@@ -108,9 +108,9 @@ static esp_err_t ws2812_set_pixel(led_strip_t* strip, uint32_t index, uint32_t r
     STRIP_CHECK(index < ws2812->strip_len, "index out of the maximum number of leds", err, ESP_ERR_INVALID_ARG);
     uint32_t start = index * 3;
     // In thr order of GRB
-    ws2812->buffer[start + 0] = green & 0xFF;
-    ws2812->buffer[start + 1] = red & 0xFF;
-    ws2812->buffer[start + 2] = blue & 0xFF;
+    ws2812->back[start + 0] = green & 0xFF;
+    ws2812->back[start + 1] = red & 0xFF;
+    ws2812->back[start + 2] = blue & 0xFF;
     return ESP_OK;
 err:
     return ret;
@@ -120,9 +120,24 @@ static esp_err_t ws2812_refresh(led_strip_t* strip, uint32_t timeout_ms)
 {
     esp_err_t ret = ESP_OK;
     ws2812_t* ws2812 = __containerof(strip, ws2812_t, parent);
-    STRIP_CHECK(rmt_write_sample(ws2812->rmt_channel, ws2812->buffer, ws2812->strip_len * 3, true) == ESP_OK,
+
+    // The front buffer is read while it's sent, so the last refresh must finish first
+    ret = rmt_wait_tx_done(ws2812->rmt_channel, pdMS_TO_TICKS(timeout_ms));
+    if (ret != ESP_OK)
+    {
+        return ret;
+    }
+
+    // Swap buffers, then copy so pixels which aren't set again keep their color
+    uint8_t* sending = ws2812->back;
+    ws2812->back = ws2812->front;
+    ws2812->front = sending;
+    memcpy(ws2812->back, ws2812->front, ws2812->strip_len * 3);
+
+    // Don't wait, the RMT sends the front buffer in the background
+    STRIP_CHECK(rmt_write_sample(ws2812->rmt_channel, ws2812->front, ws2812->strip_len * 3, false) == ESP_OK,
                 "transmit RMT samples failed", err, ESP_FAIL);
-    return rmt_wait_tx_done(ws2812->rmt_channel, pdMS_TO_TICKS(timeout_ms));
+    return ESP_OK;
 err:
     return ret;
 }
@@ -131,7 +146,7 @@ static esp_err_t ws2812_clear(led_strip_t* strip, uint32_t timeout_ms)
 {
     ws2812_t* ws2812 = __containerof(strip, ws2812_t, parent);
     // Write zero to turn off all leds
-    memset(ws2812->buffer, 0, ws2812->strip_len * 3);
+    memset(ws2812->back, 0, ws2812->strip_len * 3);
     return ws2812_refresh(strip, timeout_ms);
 }
 
@@ -147,8 +162,8 @@ led_strip_t* led_strip_new_rmt_ws2812(const led_strip_config_t* config)
     led_strip_t* ret = NULL;
     STRIP_CHECK(config, "configuration can't be null", err, NULL);
 
-    // 24 bits per led
-    uint32_t ws2812_size = sizeof(ws2812_t) + config->max_leds * 3;
+    // 24 bits per led, double buffered
+    uint32_t ws2812_size = sizeof(ws2812_t) + config->max_leds * 3 * 2;
     ws2812_t* ws2812 = calloc(1, ws2812_size);
     STRIP_CHECK(ws2812, "request memory for ws2812 failed", err, NULL);
 
@@ -157,16 +172,25 @@ led_strip_t* led_strip_new_rmt_ws2812(const led_strip_config_t* config)
                 "get rmt counter clock failed", err, NULL);
     // ns -> ticks
     float ratio = (float)counter_clk_hz / 1e9;
-    ws2812_t0h_ticks = (uint32_t)(ratio * WS2812_T0H_NS);
-    ws2812_t0l_ticks = (uint32_t)(ratio * WS2812_T0L_NS);
-    ws2812_t1h_ticks = (uint32_t)(ratio * WS2812_T1H_NS);
-    ws2812_t1l_ticks = (uint32_t)(ratio * WS2812_T1L_NS);
+    const rmt_item32_t bit0 = {{{ (uint32_t)(ratio * WS2812_T0H_NS), 1, (uint32_t)(ratio * WS2812_T0L_NS), 0 }}}; //Logical 0
+    const rmt_item32_t bit1 = {{{ (uint32_t)(ratio * WS2812_T1H_NS), 1, (uint32_t)(ratio * WS2812_T1L_NS), 0 }}}; //Logical 1
+
+    // Build the items for each nibble
+    for (int nibble = 0; nibble < 16; nibble++)
+    {
+        for (int i = 0; i < 4; i++)
+        {
+            ws2812_nibble_items[nibble][i].val = (nibble & (0x08 >> i)) ? bit1.val : bit0.val;
+        }
+    }
 
     // set ws2812 to rmt adapter
     rmt_translator_init((rmt_channel_t)config->dev, ws2812_rmt_adapter);
 
     ws2812->rmt_channel = (rmt_channel_t)config->dev;
     ws2812->strip_len = config->max_leds;
+    ws2812->front = ws2812->buffer;
+    ws2812->back = ws2812->buffer + config->max_leds * 3;
 
     ws2812->parent.set_pixel = ws2812_set_pixel;
     ws2812->parent.refresh = ws2812_refresh;
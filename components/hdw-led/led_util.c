@@ -19,6 +19,9 @@ led_strip_t* ledStrip = NULL;
 uint16_t maxNumLeds = 0;
 uint8_t ledBrightness = 0;
 
+/// Set when colors were set but couldn't be sent yet
+static bool ledsPending = false;
+
 //==============================================================================
 // Functions
 //==============================================================================
@@ -77,6 +80,21 @@ void setLeds(led_t* leds, uint8_t numLeds)
                             leds[i].b >> ledBrightness);
     }
 
-    // Push the data to the strip
-    ledStrip->refresh(ledStrip, 100);
+    // Send the colors without waiting. If the last colors are still being
+    // sent, these are sent by flushLeds() instead
+    ledsPending = true;
+    flushLeds();
+}
+
+/**
+ * @brief Send the colors from the last setLeds() if they couldn't be sent
+ * then. If setLeds() was called multiple times in between, only the latest
+ * colors are sent. This should be called periodically
+ */
+void flushLeds(void)
+{
+    if(ledsPending && (ESP_OK == ledStrip->refresh(ledStrip, 0)))
+    {
+        ledsPending = false;
+    }
 }
@@ -2,8 +2,12 @@
 // Includes
 //==============================================================================
 
+#include <stdlib.h>
+#include <string.h>
+
 #include "esp_err.h"
 #include "esp_log.h"
+#include "esp_timer.h"
 #include "nvs_flash.h"
 #include "nvs.h"
 
@@ -17,6 +21,47 @@
 #define CONFIG_LOG_MAXIMUM_LEVEL 2
 #endif
 
+#if defined(CONFIG_NVS_WRITE_BACK)
+/// The most writes which are held in RAM before they are all committed
+#define NVS_WRITE_BACK_ENTRIES 16
+/// Marks a cached key which was erased
+#define NVS_TYPE_ERASED NVS_TYPE_ANY
+
+//==============================================================================
+// Structs
+//==============================================================================
+
+/**
+ * @brief A write which hasn't been committed to flash yet
+ */
+typedef struct
+{
+    char key[NVS_KEY_NAME_MAX_SIZE]; ///< The key written to
+    nvs_type_t type;                 ///< NVS_TYPE_I32, NVS_TYPE_BLOB or NVS_TYPE_ERASED
+    int32_t val;                     ///< The value, for NVS_TYPE_I32
+    void* blob;                      ///< A copy of the value, for NVS_TYPE_BLOB
+    size_t length;                   ///< The length of blob
+} nvsCacheEntry_t;
+
+//==============================================================================
+// Function Prototypes
+//==============================================================================
+
+static nvsCacheEntry_t* findNvsCacheEntry(const char* key);
+static bool cacheNvsWrite(const char* key, nvs_type_t type, int32_t val, const void* blob, size_t length);
+static void clearNvsCacheEntry(nvsCacheEntry_t* entry);
+
+//==============================================================================
+// Variables
+//==============================================================================
+
+/// Writes which haven't been committed yet, the first numCacheEntries are used
+static nvsCacheEntry_t nvsCache[NVS_WRITE_BACK_ENTRIES];
+static uint8_t numCacheEntries = 0;
+/// When the last write was cached
+static int64_t lastCachedWriteUs = 0;
+#endif
+
 //==============================================================================
 // Functions
 //==============================================================================
@@ -87,6 +132,15 @@ bool initNvs(bool firstTry)
  */
 bool eraseNvs(void)
 {
+#if defined(CONFIG_NVS_WRITE_BACK)
+    // Anything not committed yet would be erased anyway
+    for(uint8_t i = 0; i < numCacheEntries; i++)
+    {
+        clearNvsCacheEntry(&nvsCache[i]);
+    }
+    numCacheEntries = 0;
+#endif
+
     switch(nvs_flash_erase())
     {
         case ESP_OK:
@@ -112,6 +166,20 @@ bool eraseNvs(void)
  */
 bool readNvs32(const char* key, int32_t* outVal)
 {
+#if defined(CONFIG_NVS_WRITE_BACK)
+    // A write which isn't committed yet is newer than what's in flash
+    nvsCacheEntry_t* entry = findNvsCacheEntry(key);
+    if(NULL != entry)
+    {
+        if(NVS_TYPE_I32 != entry->type)
+        {
+            return false;
+        }
+        *outVal = entry->val;
+        return true;
+    }
+#endif
+
     nvs_handle_t handle;
     esp_err_t openErr = nvs_open(NVS_NAMESPACE_NAME, NVS_READONLY, &handle);
     switch(openErr)
@@ -166,6 +234,13 @@ bool readNvs32(const char* key, int32_t* outVal)
  */
 bool writeNvs32(const char* key, int32_t val)
 {
+#if defined(CONFIG_NVS_WRITE_BACK)
+    if(cacheNvsWrite(key, NVS_TYPE_I32, val, NULL, 0))
+    {
+        return true;
+    }
+#endif
+
     nvs_handle_t handle;
     esp_err_t openErr = nvs_open(NVS_NAMESPACE_NAME, NVS_READWRITE, &handle);
     switch(openErr)
@@ -225,6 +300,31 @@ bool writeNvs32(const char* key, int32_t val)
  */
 bool readNvsBlob(const char* key, void* out_value, size_t* length)
 {
+#if defined(CONFIG_NVS_WRITE_BACK)
+    // A write which isn't committed yet is newer than what's in flash
+    nvsCacheEntry_t* entry = findNvsCacheEntry(key);
+    if(NULL != entry)
+    {
+        if(NVS_TYPE_BLOB != entry->type)
+        {
+            return false;
+        }
+        if(NULL == out_value)
+        {
+            *length = entry->length;
+            return true;
+        }
+        if(*length < entry->length)
+        {
+            *length = entry->length;
+            return false;
+        }
+        memcpy(out_value, entry->blob, entry->length);
+        *length = entry->length;
+        return true;
+    }
+#endif
+
     nvs_handle_t handle;
     esp_err_t openErr = nvs_open(NVS_NAMESPACE_NAME, NVS_READONLY, &handle);
     switch(openErr)
@@ -280,6 +380,13 @@ bool readNvsBlob(const char* key, void* out_value, size_t* length)
  */
 bool writeNvsBlob(const char* key, const void* value, size_t length)
 {
+#if defined(CONFIG_NVS_WRITE_BACK)
+    if(cacheNvsWrite(key, NVS_TYPE_BLOB, 0, value, length))
+    {
+        return true;
+    }
+#endif
+
     nvs_handle_t handle;
     esp_err_t openErr = nvs_open(NVS_NAMESPACE_NAME, NVS_READWRITE, &handle);
     switch(openErr)
@@ -336,6 +443,13 @@ bool writeNvsBlob(const char* key, const void* value, size_t length)
  */
 bool eraseNvsKey(const char* key)
 {
+#if defined(CONFIG_NVS_WRITE_BACK)
+    if(cacheNvsWrite(key, NVS_TYPE_ERASED, 0, NULL, 0))
+    {
+        return true;
+    }
+#endif
+
     nvs_handle_t handle;
     esp_err_t openErr = nvs_open(NVS_NAMESPACE_NAME, NVS_READWRITE, &handle);
     switch(openErr)
@@ -392,6 +506,9 @@ bool eraseNvsKey(const char* key)
  */
 bool readNvsStats(nvs_stats_t* outStats)
 {
+    // The stats come from flash, so make sure it's up to date
+    flushNvs();
+
     esp_err_t readErr = nvs_get_stats(NULL, outStats);
 
     switch(readErr)
@@ -437,6 +554,7 @@ bool readAllNvsEntryInfos(nvs_stats_t* outStats, nvs_entry_info_t** outEntryInfo
         return false;
     }
 
+    // readNvsStats() flushed any cached writes, so every entry is in flash
     // Example of listing all the key-value pairs of any type under specified partition and namespace
     nvs_iterator_t it = nvs_entry_find(NVS_DEFAULT_PART_NAME, NULL, NVS_TYPE_ANY);
     size_t i = 0;
@@ -463,3 +581,186 @@ bool readAllNvsEntryInfos(nvs_stats_t* outStats, nvs_entry_info_t** outEntryInfo
     }
     return true;
 }
+
+/**
+ * @brief Commit every cached write to flash in one transaction. This is done
+ * automatically when a mode exits, when the cache is full, and by
+ * checkNvsWriteBack() once writes stop for a while. Call it to make sure
+ * something important is written right away.
+ *
+ * @return true if all writes were committed, or there were none,
+ *         false if any failed
+ */
+bool flushNvs(void)
+{
+#if defined(CONFIG_NVS_WRITE_BACK)
+    if(0 == numCacheEntries)
+    {
+        return true;
+    }
+
+    nvs_handle_t handle;
+    esp_err_t openErr = nvs_open(NVS_NAMESPACE_NAME, NVS_READWRITE, &handle);
+    if(ESP_OK != openErr)
+    {
+        // Keep the writes to try again later
+        ESP_LOGE("NVS", "%s openErr %s", __func__, esp_err_to_name(openErr));
+        return false;
+    }
+
+    bool allOk = true;
+    for(uint8_t i = 0; i < numCacheEntries; i++)
+    {
+        nvsCacheEntry_t* entry = &nvsCache[i];
+        esp_err_t writeErr;
+        switch(entry->type)
+        {
+            case NVS_TYPE_I32:
+            {
+                writeErr = nvs_set_i32(handle, entry->key, entry->val);
+                break;
+            }
+            case NVS_TYPE_BLOB:
+            {
+                writeErr = nvs_set_blob(handle, entry->key, entry->blob, entry->length);
+                break;
+            }
+            default:
+            case NVS_TYPE_ERASED:
+            {
+                writeErr = nvs_erase_key(handle, entry->key);
+                // It's fine if there was nothing to erase
+                if(ESP_ERR_NVS_NOT_FOUND == writeErr)
+                {
+                    writeErr = ESP_OK;
+                }
+                break;
+            }
+        }
+
+        if(ESP_OK != writeErr)
+        {
+            ESP_LOGE("NVS", "%s %s err %s", __func__, entry->key, esp_err_to_name(writeErr));
+            allOk = false;
+        }
+        clearNvsCacheEntry(entry);
+    }
+    numCacheEntries = 0;
+
+    // One commit for all of the writes
+    if(ESP_OK != nvs_commit(handle))
+    {
+        allOk = false;
+    }
+    nvs_close(handle);
+    return allOk;
+#else
+    return true;
+#endif
+}
+
+/**
+ * @brief Commit cached writes if there have been none for
+ * CONFIG_NVS_WRITE_BACK_IDLE_MS. This should be called from the main loop
+ */
+void checkNvsWriteBack(void)
+{
+#if defined(CONFIG_NVS_WRITE_BACK)
+    if((0 != numCacheEntries) &&
+            (esp_timer_get_time() - lastCachedWriteUs >= (CONFIG_NVS_WRITE_BACK_IDLE_MS * 1000LL)))
+    {
+        flushNvs();
+    }
+#endif
+}
+
+#if defined(CONFIG_NVS_WRITE_BACK)
+/**
+ * @brief Find the cached write for a key
+ *
+ * @param key The key to find
+ * @return The cached write, or NULL if the key has no write waiting
+ */
+static nvsCacheEntry_t* findNvsCacheEntry(const char* key)
+{
+    for(uint8_t i = 0; i < numCacheEntries; i++)
+    {
+        if(0 == strncmp(nvsCache[i].key, key, NVS_KEY_NAME_MAX_SIZE))
+        {
+            return &nvsCache[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Hold a write in RAM to be committed later, replacing any earlier write
+ * to the same key. If the cache is full, everything in it is committed first
+ *
+ * @param key The key to write
+ * @param type NVS_TYPE_I32, NVS_TYPE_BLOB or NVS_TYPE_ERASED
+ * @param val The value, for NVS_TYPE_I32
+ * @param blob The value, for NVS_TYPE_BLOB. It is copied
+ * @param length The length of blob
+ * @return true if the write was cached, false if it should be written
+ *         through to flash instead
+ */
+static bool cacheNvsWrite(const char* key, nvs_type_t type, int32_t val, const void* blob, size_t length)
+{
+    // Let NVS report bad keys
+    if(NULL == key || strlen(key) >= NVS_KEY_NAME_MAX_SIZE)
+    {
+        return false;
+    }
+
+    void* blobCopy = NULL;
+    if(NVS_TYPE_BLOB == type)
+    {
+        if(NULL == blob || NULL == (blobCopy = malloc(length > 0 ? length : 1)))
+        {
+            return false;
+        }
+        memcpy(blobCopy, blob, length);
+    }
+
+    nvsCacheEntry_t* entry = findNvsCacheEntry(key);
+    if(NULL == entry)
+    {
+        if(NVS_WRITE_BACK_ENTRIES == numCacheEntries)
+        {
+            flushNvs();
+        }
+        if(NVS_WRITE_BACK_ENTRIES == numCacheEntries)
+        {
+            // Couldn't flush, so don't hold more
+            free(blobCopy);
+            return false;
+        }
+        entry = &nvsCache[numCacheEntries++];
+        strncpy(entry->key, key, NVS_KEY_NAME_MAX_SIZE);
+    }
+    else
+    {
+        clearNvsCacheEntry(entry);
+    }
+
+    entry->type = type;
+    entry->val = val;
+    entry->blob = blobCopy;
+    entry->length = length;
+    lastCachedWriteUs = esp_timer_get_time();
+    return true;
+}
+
+/**
+ * @brief Free a cached write's copy of its value
+ *
+ * @param entry The cached write
+ */
+static void clearNvsCacheEntry(nvsCacheEntry_t* entry)
+{
+    free(entry->blob);
+    entry->blob = NULL;
+    entry->length = 0;
+}
+#endif
@@ -40,5 +40,7 @@ bool writeNvsBlob(const char* key, const void* value, size_t length);
 bool eraseNvsKey(const char* key);
 bool readNvsStats(nvs_stats_t* outStats);
 bool readAllNvsEntryInfos(nvs_stats_t* outStats, nvs_entry_info_t** outEntryInfos, size_t* numEntryInfos);
+bool flushNvs(void);
+void checkNvsWriteBack(void);
 
 #endif
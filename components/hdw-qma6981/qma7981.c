@@ -27,6 +27,7 @@
 #define QMA7981_REG_INT_STAT_0 0x0A
 #define QMA7981_REG_INT_STAT_1 0x0B
 #define QMA7981_REG_INT_STAT_4 0x0D
+#define QMA7981_REG_FIFO_STATUS 0x0E
 #define QMA7981_REG_RANGE 0x0F
 #define QMA7981_REG_BAND_WIDTH 0x10
 #define QMA7981_REG_PWR_MANAGE 0x11
@@ -42,6 +43,21 @@
 #define QMA7981_REG_INT_MAP_3 0x1C
 #define QMA7981_REG_SIG_STEP_TH 0x1D
 #define QMA7981_REG_STEP 0x1F
+#define QMA7981_REG_FIFO_WM 0x31
+#define QMA7981_REG_FIFO_CFG 0x3E
+#define QMA7981_REG_FIFO_DATA 0x3F
+
+/* FIFO_CFG values */
+#define QMA7981_FIFO_MODE_BYPASS 0x00
+#define QMA7981_FIFO_MODE_STREAM 0x80
+#define QMA7981_FIFO_EN_XYZ 0x07
+
+/* The number of frames waiting is the low bits of FIFO_STATUS */
+#define QMA7981_FIFO_COUNT_MASK 0x7F
+/* Each frame is the same six bytes as DX_L through DZ_H */
+#define QMA7981_FIFO_FRAME_SIZE 6
+/* The FIFO holds at most this many frames */
+#define QMA7981_FIFO_DEPTH 64
 
 static const char* TAG = "qma7981";
 static qma_range_t qma_range = QMA_RANGE_2G;
@@ -51,6 +67,7 @@ static qma_range_t qma_range = QMA_RANGE_2G;
 static esp_err_t qma7981_read_byte(uint8_t reg_addr, uint8_t* data);
 static esp_err_t qma7981_write_byte(uint8_t reg_addr, uint8_t data);
 static esp_err_t qma7981_read_bytes(uint8_t reg_addr, size_t data_len, uint8_t* data);
+static void qma7981_convert(const uint8_t* raw_data, int16_t* x, int16_t* y, int16_t* z);
 int16_t convertTwosComplement10bit(uint16_t in);
 
 /**
@@ -234,10 +251,8 @@ esp_err_t qma7981_get_acce_int(int16_t* x, int16_t* y, int16_t* z)
     // If the read was successsful
     if(ESP_OK == ret_val)
     {
-        // Convert the data to 12-bits, save it as the last known value
-        lastX =  convertTwosComplement10bit(((raw_data[0] >> 6 ) | (raw_data[1]) << 2) & 0x03FF);
-        lastY = -convertTwosComplement10bit(((raw_data[2] >> 6 ) | (raw_data[3]) << 2) & 0x03FF);
-        lastZ = -convertTwosComplement10bit(((raw_data[4] >> 6 ) | (raw_data[5]) << 2) & 0x03FF);
+        // Save it as the last known value
+        qma7981_convert(raw_data, &lastX, &lastY, &lastZ);
     }
 
     // Copy out the acceleration value
@@ -248,6 +263,98 @@ esp_err_t qma7981_get_acce_int(int16_t* x, int16_t* y, int16_t* z)
     return ret_val;
 }
 
+/**
+ * @brief Turn the FIFO on or off. In stream mode the sensor buffers samples at
+ * its own rate, and the oldest are dropped if the FIFO fills up. The output
+ * rate is lowered while the FIFO is on so that a frame's worth of samples is
+ * a few evenly spaced readings rather than dozens
+ *
+ * @param enable true to buffer samples in the FIFO, false to only keep the latest
+ * @return esp_err_t
+ */
+esp_err_t qma7981_set_fifo(bool enable)
+{
+    esp_err_t ret_val = ESP_OK;
+    if(enable)
+    {
+        ret_val |= qma7981_write_byte(QMA7981_REG_BAND_WIDTH, QMA_BANDWIDTH_128_HZ);
+        ret_val |= qma7981_write_byte(QMA7981_REG_FIFO_CFG, QMA7981_FIFO_MODE_STREAM | QMA7981_FIFO_EN_XYZ);
+    }
+    else
+    {
+        ret_val |= qma7981_write_byte(QMA7981_REG_FIFO_CFG, QMA7981_FIFO_MODE_BYPASS);
+        ret_val |= qma7981_write_byte(QMA7981_REG_BAND_WIDTH, QMA_BANDWIDTH_1024_HZ);
+    }
+    return ret_val;
+}
+
+/**
+ * @brief Read every sample waiting in the FIFO, oldest first, with one burst
+ * read. qma7981_set_fifo() must have turned the FIFO on
+ *
+ * @param xyz Written with X, Y, and Z for each sample, in the same format as
+ *            qma7981_get_acce_int(). Must have room for maxSamples * 3 values
+ * @param maxSamples The most samples to read. Any more are left in the FIFO
+ * @param numSamples Written with the number of samples read
+ * @return esp_err_t
+ */
+esp_err_t qma7981_get_acce_fifo(int16_t* xyz, uint8_t maxSamples, uint8_t* numSamples)
+{
+    *numSamples = 0;
+
+    // Find out how many samples are waiting
+    uint8_t status = 0;
+    esp_err_t ret_val = qma7981_read_byte(QMA7981_REG_FIFO_STATUS, &status);
+    if(ESP_OK != ret_val)
+    {
+        return ret_val;
+    }
+
+    uint8_t count = status & QMA7981_FIFO_COUNT_MASK;
+    if(count > maxSamples)
+    {
+        count = maxSamples;
+    }
+    if(count > QMA7981_FIFO_DEPTH)
+    {
+        count = QMA7981_FIFO_DEPTH;
+    }
+    if(0 == count)
+    {
+        return ESP_OK;
+    }
+
+    // Reading FIFO_DATA repeatedly pops a frame every six bytes
+    static uint8_t raw_data[QMA7981_FIFO_FRAME_SIZE * QMA7981_FIFO_DEPTH];
+    ret_val = qma7981_read_bytes(QMA7981_REG_FIFO_DATA, QMA7981_FIFO_FRAME_SIZE * count, raw_data);
+    if(ESP_OK != ret_val)
+    {
+        return ret_val;
+    }
+
+    for(uint8_t i = 0; i < count; i++)
+    {
+        qma7981_convert(&raw_data[QMA7981_FIFO_FRAME_SIZE * i], &xyz[3 * i], &xyz[(3 * i) + 1], &xyz[(3 * i) + 2]);
+    }
+    *numSamples = count;
+    return ESP_OK;
+}
+
+/**
+ * @brief Convert six bytes of acceleration data to 10 bit signed values
+ *
+ * @param raw_data The bytes read from DX_L through DZ_H, or one FIFO frame
+ * @param x
+ * @param y
+ * @param z
+ */
+static void qma7981_convert(const uint8_t* raw_data, int16_t* x, int16_t* y, int16_t* z)
+{
+    *x =  convertTwosComplement10bit(((raw_data[0] >> 6 ) | (raw_data[1]) << 2) & 0x03FF);
+    *y = -convertTwosComplement10bit(((raw_data[2] >> 6 ) | (raw_data[3]) << 2) & 0x03FF);
+    *z = -convertTwosComplement10bit(((raw_data[4] >> 6 ) | (raw_data[5]) << 2) & 0x03FF);
+}
+
 /**
  * @brief Helper function to convert a 10 bit 2's complement number to 16 bit
  *
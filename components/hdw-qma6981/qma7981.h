@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include <stdbool.h>
 #include <stdint.h>
 #include "esp_err.h"
 
@@ -68,6 +69,24 @@ esp_err_t qma7981_get_acce(float* x, float* y, float* z);
  */
 esp_err_t qma7981_get_acce_int(int16_t* x, int16_t* y, int16_t* z);
 
+/**
+ * @brief Turn the sensor's FIFO on or off
+ *
+ * @param enable
+ * @return esp_err_t
+ */
+esp_err_t qma7981_set_fifo(bool enable);
+
+/**
+ * @brief Read every sample waiting in the FIFO with one burst read
+ *
+ * @param xyz
+ * @param maxSamples
+ * @param numSamples
+ * @return esp_err_t
+ */
+esp_err_t qma7981_get_acce_fifo(int16_t* xyz, uint8_t maxSamples, uint8_t* numSamples);
+
 /**
  * @brief
  *
@@ -334,6 +334,92 @@ static uint16_t get_bits(heatshrink_decoder *hsd, uint8_t count) {
     return accumulator;
 }
 
+/* Top up the bit reservoir a byte at a time, until it holds more than 24 bits
+ * or the input runs out. Bits are taken from the top of the valid bits. */
+#define FAST_REFILL()                                   \
+    while ((bit_count <= 24) && (in < in_end)) {        \
+        bits = (bits << 8) | *in++;                     \
+        bit_count += 8;                                 \
+    }
+#define FAST_TAKE(COUNT) \
+    ((bits >> (bit_count -= (COUNT))) & ((1UL << (COUNT)) - 1))
+
+HSD_poll_res heatshrink_decode_buffer(const uint8_t *in_buf, size_t in_size,
+        uint8_t *out_buf, size_t out_buf_size, size_t *output_size,
+        uint8_t window_sz2, uint8_t lookahead_sz2) {
+    if (((in_buf == NULL) && (in_size > 0)) || (out_buf == NULL) || (output_size == NULL)) {
+        return HSDR_POLL_ERROR_NULL;
+    }
+    *output_size = 0;
+    if ((window_sz2 < HEATSHRINK_MIN_WINDOW_BITS) ||
+        (window_sz2 > HEATSHRINK_MAX_WINDOW_BITS) ||
+        (lookahead_sz2 < HEATSHRINK_MIN_LOOKAHEAD_BITS) ||
+        (lookahead_sz2 >= window_sz2)) {
+        return HSDR_POLL_ERROR_UNKNOWN;
+    }
+
+    const uint8_t *in = in_buf;
+    const uint8_t *in_end = in_buf + in_size;
+    uint8_t *out = out_buf;
+    uint8_t *out_end = out_buf + out_buf_size;
+    uint32_t bits = 0;
+    uint8_t bit_count = 0;
+
+    /* Like the streaming decoder, stop without output when a token is cut
+     * off, since that is the zero padding at the end of the last byte. */
+    while (out < out_end) {
+        FAST_REFILL();
+        if (bit_count < 1) { break; }
+
+        if (FAST_TAKE(1)) {
+            if (bit_count < 8) { break; }
+            *out++ = FAST_TAKE(8);
+            continue;
+        }
+
+        if (bit_count < window_sz2) { break; }
+        size_t offset = FAST_TAKE(window_sz2) + 1;
+        FAST_REFILL();
+        if (bit_count < lookahead_sz2) { break; }
+        size_t count = FAST_TAKE(lookahead_sz2) + 1;
+        LOG("-- emitting %zu bytes from -%zu bytes back\n", count, offset);
+
+        if (count > (size_t)(out_end - out)) { count = out_end - out; }
+
+        /* A fresh window is all zeros, so anything from before the start
+         * of the output is zero too */
+        size_t produced = out - out_buf;
+        if (offset > produced) {
+            size_t zeros = offset - produced;
+            if (zeros > count) { zeros = count; }
+            memset(out, 0, zeros);
+            out += zeros;
+            count -= zeros;
+            if (count == 0) { continue; }
+        }
+
+        /* Copy the run. It may overlap itself, repeating the last OFFSET
+         * bytes, so only copy it in one go if it doesn't */
+        const uint8_t *src = out - offset;
+        if (offset >= count) {
+            memcpy(out, src, count);
+            out += count;
+        } else if (offset == 1) {
+            memset(out, *src, count);
+            out += count;
+        } else {
+            while (count--) { *out++ = *src++; }
+        }
+    }
+
+    *output_size = out - out_buf;
+    /* Less than a byte left over is padding */
+    if ((out == out_end) && ((in < in_end) || (bit_count >= 8))) {
+        return HSDR_POLL_MORE;
+    }
+    return HSDR_POLL_EMPTY;
+}
+
 HSD_finish_res heatshrink_decoder_finish(heatshrink_decoder *hsd) {
     if (hsd == NULL) { return HSDR_FINISH_ERROR_NULL; }
     switch (hsd->state) {
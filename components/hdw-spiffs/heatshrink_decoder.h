@@ -92,6 +92,18 @@ HSD_sink_res heatshrink_decoder_sink(heatshrink_decoder *hsd,
 HSD_poll_res heatshrink_decoder_poll(heatshrink_decoder *hsd,
     uint8_t *out_buf, size_t out_buf_size, size_t *output_size);
 
+/* Decode a whole compressed stream which is already in memory, IN_SIZE bytes
+ * at IN_BUF, into OUT_BUF in one call. This needs no decoder or window buffer,
+ * because back-references are copied straight from the output, and it reads
+ * input a word at a time rather than a bit at a time. WINDOW_SZ2 and
+ * LOOKAHEAD_SZ2 must match the settings used when the data was compressed.
+ * At most OUT_BUF_SIZE bytes are written and *OUTPUT_SIZE is set to how many
+ * were. Returns HSDR_POLL_EMPTY when all input was decoded, HSDR_POLL_MORE if
+ * OUT_BUF filled first, or HSDR_POLL_ERROR_UNKNOWN for bad settings. */
+HSD_poll_res heatshrink_decode_buffer(const uint8_t *in_buf, size_t in_size,
+    uint8_t *out_buf, size_t out_buf_size, size_t *output_size,
+    uint8_t window_sz2, uint8_t lookahead_sz2);
+
 /* Notify the dencoder that the input stream is finished.
  * If the return value is HSDR_FINISH_MORE, there is still more output, so
  * call heatshrink_decoder_poll and repeat. */
@@ -0,0 +1,174 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "esp_log.h"
+#include "spiffs_manager.h"
+#include "heatshrink_decoder.h"
+#include "song_cursor.h"
+#include "spiffs_song.h"
+
+static bool checkVarint(const uint8_t* data, uint32_t len, uint32_t* offset, uint32_t* value);
+static bool checkSong(const uint8_t* data, uint32_t len, song_t* song);
+
+/**
+ * @brief Load an encoded song from ROM to RAM. SNGs placed in the spiffs_image
+ * folder before compilation will be automatically flashed to ROM. The notes
+ * stay encoded in RAM and are decoded one at a time while the song plays, so a
+ * note usually takes two or three bytes rather than eight
+ *
+ * @param name The filename of the SNG to load
+ * @return A song which may be passed to buzzer_play_bgm() or buzzer_play_sfx().
+ *         May be NULL if the load fails. Must be freed with freeSong() after
+ *         the buzzer is stopped
+ */
+song_t* loadSong(const char* name)
+{
+    // Read SNG from file
+    uint8_t* buf = NULL;
+    size_t sz;
+    if(!spiffsReadFile(name, &buf, &sz, true))
+    {
+        ESP_LOGE("SNG", "Failed to read %s", name);
+        return NULL;
+    }
+
+    if(sz < 4)
+    {
+        ESP_LOGE("SNG", "%s is too short", name);
+        free(buf);
+        return NULL;
+    }
+
+    // Pick out the decompresed size and create a space for it, right after the
+    // song_t so that one free() releases both
+    uint32_t decompressedSize = (buf[0] << 24) | (buf[1] << 16) | (buf[2] << 8) | (buf[3]);
+    song_t* song = calloc(1, sizeof(song_t) + decompressedSize);
+    if(NULL == song)
+    {
+        ESP_LOGE("SNG", "No memory for %s", name);
+        free(buf);
+        return NULL;
+    }
+    uint8_t* decompressedBuf = (uint8_t*)&song[1];
+
+    // The whole file is in RAM, so decode it in one go
+    size_t outputIdx = 0;
+    heatshrink_decode_buffer(&buf[4], sz - 4, decompressedBuf, decompressedSize, &outputIdx, 8, 4);
+    // Free the bytes read from the file
+    free(buf);
+
+    // Make sure the note check interrupt will never read past the end
+    if(outputIdx != decompressedSize || !checkSong(decompressedBuf, decompressedSize, song))
+    {
+        ESP_LOGE("SNG", "%s is not a valid song", name);
+        free(song);
+        return NULL;
+    }
+
+    song->encoded = decompressedBuf;
+    return song;
+}
+
+/**
+ * @brief Free a song from loadSong(). The buzzer must not be playing it
+ *
+ * @param song The song to free
+ */
+void freeSong(song_t* song)
+{
+    free(song);
+}
+
+/**
+ * @brief Read a varint without reading past the end of the data. The varint
+ * must be one songDecodeVarint() reads completely, i.e. at most
+ * SONG_VARINT_MAX_LEN bytes long with a value that fits in 32 bits
+ *
+ * @param data The encoded song
+ * @param len The length of the encoded song
+ * @param offset The offset to read at, advanced past the varint
+ * @param value Written with the value of the varint, may be NULL
+ * @return true if the varint was read, false if it ran off the end, is too
+ *         long, or is too large
+ */
+static bool checkVarint(const uint8_t* data, uint32_t len, uint32_t* offset, uint32_t* value)
+{
+    uint32_t start = *offset;
+    uint8_t numBytes = 0;
+    while(true)
+    {
+        if((*offset >= len) || (numBytes == SONG_VARINT_MAX_LEN))
+        {
+            return false;
+        }
+
+        uint8_t byte = data[(*offset)++];
+        numBytes++;
+
+        // Only the low four bits of the last byte fit in 32 bits
+        if((SONG_VARINT_MAX_LEN == numBytes) && (byte & 0x70))
+        {
+            return false;
+        }
+
+        if(!(byte & 0x80))
+        {
+            break;
+        }
+    }
+
+    if(NULL != value)
+    {
+        *value = songDecodeVarint(data, &start);
+    }
+    return true;
+}
+
+/**
+ * @brief Check that every note in an encoded song is in bounds, and fill in the
+ * song's header fields
+ *
+ * @param data The encoded song
+ * @param len The length of the encoded song
+ * @param song The song to fill in
+ * @return true if the song is valid, false if it is not
+ */
+static bool checkSong(const uint8_t* data, uint32_t len, song_t* song)
+{
+    if(len < SONG_HEADER_SIZE || 0 != memcmp(data, SONG_MAGIC, 3) || SONG_VERSION != data[3])
+    {
+        return false;
+    }
+
+    song->shouldLoop = (data[4] & SONG_FLAG_LOOP) ? 1 : 0;
+
+    uint32_t offset = SONG_HEADER_SIZE;
+    if(!checkVarint(data, len, &offset, &song->numNotes) ||
+            !checkVarint(data, len, &offset, &song->loopStartNote) ||
+            0 == song->numNotes || song->loopStartNote >= song->numNotes)
+    {
+        return false;
+    }
+
+    for(uint32_t i = 0; i < song->numNotes; i++)
+    {
+        if(i == song->loopStartNote)
+        {
+            song->loopStartOffset = offset;
+        }
+
+        // Each note is a pitch and a time
+        if(offset >= len)
+        {
+            return false;
+        }
+        offset++;
+        if(!checkVarint(data, len, &offset, NULL))
+        {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,9 @@
+#ifndef _SPIFFS_SONG_H_
+#define _SPIFFS_SONG_H_
+
+#include "musical_buzzer.h"
+
+song_t* loadSong(const char* name);
+void freeSong(song_t* song);
+
+#endif
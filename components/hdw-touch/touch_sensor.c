@@ -9,6 +9,7 @@
 #include "soc/rtc_periph.h"
 #include "soc/sens_periph.h"
 #include "esp_log.h"
+#include "esp_timer.h"
 #include "touch_sensor.h"
 
 static inline uint32_t getCycleCount()
@@ -29,6 +30,7 @@ typedef struct touch_msg
     touch_pad_t pad_num;
     uint32_t pad_status;
     uint32_t pad_val;
+    int64_t time;
 } touch_isr_event_t;
 
 //==============================================================================
@@ -41,6 +43,7 @@ static uint32_t tpState = 0;
 static int numTouchPadsKept;
 static touch_pad_t * touchPads;
 static int32_t * baseOffsets = 0;
+static TaskHandle_t notifyTask = NULL;
 
 
 //==============================================================================
@@ -173,15 +176,20 @@ void initTouchSensor(float touchPadSensitivity, bool denoiseEnable,
  */
 static void touchsensor_interrupt_cb(void* arg)
 {
-    int task_awoken = pdFALSE;
+    BaseType_t task_awoken = pdFALSE;
     touch_isr_event_t evt;
 
     evt.intr_mask = touch_pad_read_intr_status_mask();
     evt.pad_status = touch_pad_get_status();
     evt.pad_num = touch_pad_get_current_meas_channel();
+    evt.time = esp_timer_get_time();
     //touch_ll_filter_read_smooth(touch_pad_t touch_num, uint32_t *smooth_data)
 
     xQueueSendFromISR(touchEvtQueue, &evt, &task_awoken);
+    if (NULL != notifyTask)
+    {
+        vTaskNotifyGiveFromISR(notifyTask, &task_awoken);
+    }
     if (task_awoken == pdTRUE)
     {
         portYIELD_FROM_ISR();
@@ -318,6 +326,17 @@ int getTouchCentroid( int32_t * centerVal, int32_t * intensityVal )
     return 1;
 }
 
+/**
+ * @brief Set a task to notify with vTaskNotifyGiveFromISR() whenever a touch
+ * interrupt is queued, so the task can block until there is something to do
+ *
+ * @param task The task to notify, or NULL to not notify anything
+ */
+void setTouchNotifyTask(TaskHandle_t task)
+{
+    notifyTask = task;
+}
+
 /**
  * @brief Call this function periodically to check the touch pad interrupt queue
  *
@@ -373,6 +392,7 @@ bool checkTouchSensor(touch_event_t* evt)
 
     /* Save the whole state */
     evt->state = tpState;
+    evt->time = isrEvt.time;
 
     /* LUT the location */
     const uint8_t touchLoc[] =
@@ -417,3 +437,17 @@ bool checkTouchSensor(touch_event_t* evt)
     /* Return if something was touched or released */
     return true;
 }
+
+/**
+ * @brief Discard all queued touch events, keeping track of which pads are
+ * touched. checkTouchSensor() may return false before the queue is empty, so
+ * this checks the queue directly
+ */
+void drainTouchSensor(void)
+{
+    touch_event_t evt;
+    while(uxQueueMessagesWaiting(touchEvtQueue))
+    {
+        checkTouchSensor(&evt);
+    }
+}
@@ -6,6 +6,8 @@
 //==============================================================================
 
 #include <stdint.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
 #include "driver/touch_pad.h"
 
 //==============================================================================
@@ -18,6 +20,7 @@ typedef struct
     touch_pad_t pad;
     bool down;
     int16_t position;
+    int64_t time; ///< When the touch or release happened, from esp_timer_get_time()
 } touch_event_t;
 
 //==============================================================================
@@ -27,6 +30,8 @@ typedef struct
 void initTouchSensor(float touchPadSensitivity, bool denoiseEnable,
                      uint8_t numTouchPads, ...);
 bool checkTouchSensor(touch_event_t*);
+void drainTouchSensor(void);
+void setTouchNotifyTask(TaskHandle_t task);
 int getTouchRawValues( uint32_t * rawvalues, int maxPads );
 
 int getBaseTouchVals( int32_t * data, int count );
@@ -41,7 +41,7 @@ SRC_DIRS_RECURSIVE = emu/src main/display main/modes main/colorchord main/utils
 # This is a list of directories to scan for c files not recursively
 SRC_DIRS_FLAT = main
 # This is a list of files to compile directly. There's no scanning here
-SRC_FILES = components/hdw-spiffs/heatshrink_decoder.c components/hdw-spiffs/spiffs_json.c components/hdw-spiffs/spiffs_txt.c
+SRC_FILES = components/hdw-buzzer/song_cursor.c components/hdw-spiffs/heatshrink_decoder.c components/hdw-spiffs/spiffs_json.c components/hdw-spiffs/spiffs_song.c components/hdw-spiffs/spiffs_txt.c
 # This is all the source directories combined
 SRC_DIRS = $(shell $(FIND) $(SRC_DIRS_RECURSIVE) -type d) $(SRC_DIRS_FLAT)
 # This is all the source files combined
@@ -135,6 +135,7 @@ DEFINES_LIST = \
 	CONFIG_SWADGE_PROTOTYPE=1 \
 	CONFIG_TFT_MAX_BRIGHTNESS=200 \
 	CONFIG_TFT_MIN_BRIGHTNESS=10 \
+	CONFIG_GAMEPAD_REPORT_INTERVAL_US=1000 \
 	SOC_TIMER_GROUP_TIMERS_PER_GROUP=2 \
 	SOC_TIMER_GROUPS=2 \
 	GIT_SHA1=${GIT_HASH} \
@@ -186,6 +187,13 @@ LIBRARY_FLAGS = $(patsubst %, -L%, $(LIB_DIRS)) $(patsubst %, -l%, $(LIBS)) \
 	-static-libstdc++ \
 	-ggdb
 
+# Route the firmware's allocations through emu_alloc.c so memory use is counted
+LIBRARY_FLAGS += \
+	-Wl,--wrap=malloc \
+	-Wl,--wrap=calloc \
+	-Wl,--wrap=realloc \
+	-Wl,--wrap=free
+
 ifeq ($(HOST_OS),Linux)
 LIBRARY_FLAGS += \
 	-fsanitize=address \
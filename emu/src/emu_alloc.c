@@ -0,0 +1,779 @@
+/*
+ * The emulator links with -Wl,--wrap for malloc(), calloc(), realloc(), and
+ * free(), so every allocation made by firmware code lands here along with the
+ * heap_caps_*() functions. Each live allocation is remembered by pointer,
+ * which lets memory from heap_caps_malloc() be released with plain free() the
+ * same as on hardware. Pointers allocated somewhere this file can't see, like
+ * strdup() inside libc, are passed through without being counted.
+ */
+
+//==============================================================================
+// Includes
+//==============================================================================
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __linux__
+#include <execinfo.h>
+#endif
+
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+
+#include "emu_esp.h"
+#include "emu_alloc.h"
+
+//==============================================================================
+// Defines
+//==============================================================================
+
+/// The most modes which can have their memory usage counted
+#define MAX_ALLOC_OWNERS 32
+
+/// Owner index for allocations made while no mode was running
+#define OWNER_SYSTEM 0
+
+/// The most leaked allocations printed when a mode exits
+#define MAX_LEAKS_PRINTED 8
+
+/// Marks a table slot whose allocation was freed
+#define TOMBSTONE ((void*)1)
+
+/// The size of the table when the first allocation is made
+#define INITIAL_TABLE_SIZE 1024
+
+//==============================================================================
+// Structs
+//==============================================================================
+
+typedef struct
+{
+    void* ptr;     ///< The allocation, NULL if the slot is empty
+    size_t size;   ///< The number of bytes requested
+    void* caller;  ///< The address the allocation was made from
+    uint8_t heap;  ///< The emuHeap_t this is counted against
+    uint8_t owner; ///< Index into owners[]
+} emuAlloc_t;
+
+typedef struct
+{
+    const swadgeMode* mode;            ///< The mode, NULL for the system
+    size_t live[NUM_EMU_HEAPS];        ///< Bytes this mode has allocated right now
+    size_t peak[NUM_EMU_HEAPS];        ///< The most bytes this mode had allocated at once
+    size_t peakTotal[NUM_EMU_HEAPS];   ///< The most bytes allocated by anyone while this mode ran
+    size_t leaked[NUM_EMU_HEAPS];      ///< Bytes still allocated after the mode exited
+    uint32_t numAllocs;                ///< The number of allocations this mode made
+    uint32_t numFailed;                ///< Allocations refused because a limit was hit
+} emuAllocOwner_t;
+
+typedef struct
+{
+    size_t size;
+    void* caller;
+    uint8_t heap;
+} emuLeak_t;
+
+//==============================================================================
+// Function prototypes
+//==============================================================================
+
+// The real functions, provided by the linker
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t n, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+void __real_free(void* ptr);
+
+// What the firmware calls instead, through the linker
+void* __wrap_malloc(size_t size);
+void* __wrap_calloc(size_t n, size_t size);
+void* __wrap_realloc(void* ptr, size_t size);
+void __wrap_free(void* ptr);
+
+static void allocLock(void);
+static void allocUnlock(void);
+static emuAlloc_t* findAlloc(const void* ptr);
+static bool growTable(void);
+static void trackAlloc(void* ptr, size_t size, emuHeap_t heap, uint8_t owner, void* caller);
+static bool untrackAlloc(void* ptr, emuAlloc_t* removed);
+static bool reserve(emuHeap_t heap, size_t size);
+static void* allocTracked(size_t size, bool zero, emuHeap_t heap, void* caller);
+static void* reallocTracked(void* ptr, size_t size, int heap, void* caller);
+static void freeTracked(void* ptr);
+static emuHeap_t capsToHeap(uint32_t caps);
+static const char* ownerName(const emuAllocOwner_t* owner);
+static void printCaller(void* caller);
+
+//==============================================================================
+// Variables
+//==============================================================================
+
+static const char* heapNames[NUM_EMU_HEAPS] =
+{
+    [EMU_HEAP_INTERNAL] = "internal",
+    [EMU_HEAP_SPIRAM] = "SPIRAM",
+};
+
+/// Set while a thread is using the variables below. The sound thread allocates too
+static bool allocLocked = false;
+
+/// Open addressed table of every live allocation
+static emuAlloc_t* allocTable = NULL;
+/// The number of slots in allocTable, always a power of two
+static size_t allocTableSize = 0;
+/// The number of slots which are live or tombstones
+static size_t allocTableUsed = 0;
+
+static emuAllocOwner_t owners[MAX_ALLOC_OWNERS] = {0};
+static uint8_t numOwners = 1;
+static uint8_t currentOwner = OWNER_SYSTEM;
+
+static size_t liveBytes[NUM_EMU_HEAPS] = {0};
+static size_t peakBytes[NUM_EMU_HEAPS] = {0};
+/// 0 means no limit
+static size_t limitBytes[NUM_EMU_HEAPS] = {0};
+
+//==============================================================================
+// Wrapped libc functions
+//==============================================================================
+
+/**
+ * @brief Allocate memory, counted against internal RAM like it is on hardware
+ *
+ * @param size The number of bytes to allocate
+ * @return A pointer to the memory, or NULL if it couldn't be allocated
+ */
+void* __wrap_malloc(size_t size)
+{
+    return allocTracked(size, false, EMU_HEAP_INTERNAL, __builtin_return_address(0));
+}
+
+/**
+ * @brief Allocate zeroed memory, counted against internal RAM like it is on
+ * hardware
+ *
+ * @param n The number of elements to allocate
+ * @param size The size of each element
+ * @return A pointer to the memory, or NULL if it couldn't be allocated
+ */
+void* __wrap_calloc(size_t n, size_t size)
+{
+    if((0 != size) && (n > SIZE_MAX / size))
+    {
+        return NULL;
+    }
+    return allocTracked(n * size, true, EMU_HEAP_INTERNAL, __builtin_return_address(0));
+}
+
+/**
+ * @brief Resize memory. It stays counted against the heap it came from
+ *
+ * @param ptr The memory to resize, may be NULL
+ * @param size The new size
+ * @return A pointer to the memory, or NULL if it couldn't be allocated
+ */
+void* __wrap_realloc(void* ptr, size_t size)
+{
+    return reallocTracked(ptr, size, -1, __builtin_return_address(0));
+}
+
+/**
+ * @brief Free memory from any of the allocation functions
+ *
+ * @param ptr The memory to free, may be NULL
+ */
+void __wrap_free(void* ptr)
+{
+    freeTracked(ptr);
+}
+
+//==============================================================================
+// heap_caps functions
+//==============================================================================
+
+/**
+ * @brief Allocate a chunk of memory which has the given capabilities
+ *
+ * Equivalent semantics to libc malloc(), for capability-aware memory.
+ *
+ * In IDF, ``malloc(p)`` is equivalent to ``heap_caps_malloc(p, MALLOC_CAP_8BIT)``.
+ *
+ * @param size Size, in bytes, of the amount of memory to allocate
+ * @param caps        Bitwise OR of MALLOC_CAP_* flags indicating the type
+ *                    of memory to be returned
+ *
+ * @return A pointer to the memory allocated on success, NULL on failure
+ */
+void* heap_caps_malloc(size_t size, uint32_t caps)
+{
+    return allocTracked(size, false, capsToHeap(caps), __builtin_return_address(0));
+}
+
+/**
+ * @brief Allocate a chunk of memory which has the given capabilities. The initialized value in the memory is set to zero.
+ *
+ * Equivalent semantics to libc calloc(), for capability-aware memory.
+ *
+ * In IDF, ``calloc(p)`` is equivalent to ``heap_caps_calloc(p, MALLOC_CAP_8BIT)``.
+ *
+ * @param n    Number of continuing chunks of memory to allocate
+ * @param size Size, in bytes, of a chunk of memory to allocate
+ * @param caps        Bitwise OR of MALLOC_CAP_* flags indicating the type
+ *                    of memory to be returned
+ *
+ * @return A pointer to the memory allocated on success, NULL on failure
+ */
+void* heap_caps_calloc(size_t n, size_t size, uint32_t caps)
+{
+    if((0 != size) && (n > SIZE_MAX / size))
+    {
+        return NULL;
+    }
+    return allocTracked(n * size, true, capsToHeap(caps), __builtin_return_address(0));
+}
+
+/**
+ * @brief Reallocate memory previously allocated via heap_caps_malloc() or heap_caps_realloc().
+ *
+ * @param ptr Pointer to previously allocated memory, or NULL for a new allocation.
+ * @param size Size of the new buffer requested, or 0 to free the buffer.
+ * @param caps        Bitwise OR of MALLOC_CAP_* flags indicating the type
+ *                    of memory desired for the new allocation.
+ *
+ * @return Pointer to a new buffer of size 'size' with capabilities 'caps', or NULL if allocation failed.
+ */
+void* heap_caps_realloc(void* ptr, size_t size, uint32_t caps)
+{
+    return reallocTracked(ptr, size, capsToHeap(caps), __builtin_return_address(0));
+}
+
+/**
+ * @brief Free memory previously allocated via heap_caps_malloc() or heap_caps_realloc().
+ *
+ * @param ptr Pointer to memory previously returned from heap_caps_malloc() or heap_caps_realloc(). Can be NULL.
+ */
+void heap_caps_free(void* ptr)
+{
+    freeTracked(ptr);
+}
+
+//==============================================================================
+// Reporting functions
+//==============================================================================
+
+/**
+ * @brief Limit how much memory may be allocated from a heap at once. Past the
+ * limit allocations fail and return NULL, as they would on hardware
+ *
+ * @param heap The heap to limit
+ * @param bytes The most bytes which may be allocated, or 0 for no limit
+ */
+void emuAllocSetLimit(emuHeap_t heap, size_t bytes)
+{
+    limitBytes[heap] = bytes;
+}
+
+/**
+ * @brief Count allocations against a mode until emuAllocModeExit() is called.
+ * This should be called right before the mode's fnEnterMode()
+ *
+ * @param mode The mode which is starting
+ */
+void emuAllocModeEnter(const swadgeMode* mode)
+{
+    allocLock();
+
+    uint8_t idx;
+    for(idx = 1; idx < numOwners; idx++)
+    {
+        if(owners[idx].mode == mode)
+        {
+            break;
+        }
+    }
+
+    if(idx == numOwners)
+    {
+        if(numOwners < MAX_ALLOC_OWNERS)
+        {
+            owners[numOwners++].mode = mode;
+        }
+        else
+        {
+            // Out of room, count this mode as the system
+            idx = OWNER_SYSTEM;
+        }
+    }
+
+    currentOwner = idx;
+    for(uint8_t h = 0; h < NUM_EMU_HEAPS; h++)
+    {
+        if(liveBytes[h] > owners[idx].peakTotal[h])
+        {
+            owners[idx].peakTotal[h] = liveBytes[h];
+        }
+    }
+
+    allocUnlock();
+}
+
+/**
+ * @brief Report everything the current mode allocated and didn't free, then
+ * count allocations against the system again. This should be called after the
+ * mode's fnExitMode() and after the mode arena is reset
+ */
+void emuAllocModeExit(void)
+{
+    emuLeak_t leaks[MAX_LEAKS_PRINTED];
+    uint32_t numLeaks = 0;
+    size_t leakedBytes[NUM_EMU_HEAPS] = {0};
+
+    allocLock();
+
+    emuAllocOwner_t* owner = &owners[currentOwner];
+    if(OWNER_SYSTEM != currentOwner)
+    {
+        // Hand leaked allocations to the system so the next run starts clean
+        for(size_t i = 0; i < allocTableSize; i++)
+        {
+            emuAlloc_t* a = &allocTable[i];
+            if((NULL == a->ptr) || (TOMBSTONE == a->ptr) || (a->owner != currentOwner))
+            {
+                continue;
+            }
+
+            if(numLeaks < MAX_LEAKS_PRINTED)
+            {
+                leaks[numLeaks].size = a->size;
+                leaks[numLeaks].caller = a->caller;
+                leaks[numLeaks].heap = a->heap;
+            }
+            numLeaks++;
+
+            leakedBytes[a->heap] += a->size;
+            owner->live[a->heap] -= a->size;
+            owners[OWNER_SYSTEM].live[a->heap] += a->size;
+            a->owner = OWNER_SYSTEM;
+        }
+
+        for(uint8_t h = 0; h < NUM_EMU_HEAPS; h++)
+        {
+            owner->leaked[h] += leakedBytes[h];
+        }
+    }
+    currentOwner = OWNER_SYSTEM;
+
+    allocUnlock();
+
+    if(0 == numLeaks)
+    {
+        return;
+    }
+
+    // Print after unlocking, printing may allocate
+    ESP_LOGW("MEM", "%s leaked %d allocations, %d %s bytes and %d %s bytes",
+             ownerName(owner), numLeaks,
+             (int)leakedBytes[EMU_HEAP_INTERNAL], heapNames[EMU_HEAP_INTERNAL],
+             (int)leakedBytes[EMU_HEAP_SPIRAM], heapNames[EMU_HEAP_SPIRAM]);
+    for(uint32_t i = 0; i < numLeaks && i < MAX_LEAKS_PRINTED; i++)
+    {
+        fprintf(stderr, "MEM:   %8d %-8s bytes from ", (int)leaks[i].size, heapNames[leaks[i].heap]);
+        printCaller(leaks[i].caller);
+    }
+    if(numLeaks > MAX_LEAKS_PRINTED)
+    {
+        ESP_LOGW("MEM", "  ... and %d more", numLeaks - MAX_LEAKS_PRINTED);
+    }
+}
+
+/**
+ * @brief Print how much memory is allocated now, and the most each mode which
+ * has run used
+ */
+void emuAllocPrintSummary(void)
+{
+    emuAllocOwner_t snapshot[MAX_ALLOC_OWNERS];
+    size_t live[NUM_EMU_HEAPS];
+    size_t peak[NUM_EMU_HEAPS];
+
+    allocLock();
+    uint8_t numSnapshot = numOwners;
+    memcpy(snapshot, owners, sizeof(emuAllocOwner_t) * numSnapshot);
+    memcpy(live, liveBytes, sizeof(live));
+    memcpy(peak, peakBytes, sizeof(peak));
+    allocUnlock();
+
+    ESP_LOGI("MEM", "Memory now %d %s / %d %s bytes, peak %d / %d bytes",
+             (int)live[EMU_HEAP_INTERNAL], heapNames[EMU_HEAP_INTERNAL],
+             (int)live[EMU_HEAP_SPIRAM], heapNames[EMU_HEAP_SPIRAM],
+             (int)peak[EMU_HEAP_INTERNAL], (int)peak[EMU_HEAP_SPIRAM]);
+    ESP_LOGI("MEM", "%-20s %9s %9s %9s %9s %9s %9s %7s %6s", "",
+             "Own int", "Own SPI", "Total int", "Total SPI", "Leak int", "Leak SPI", "Allocs", "Failed");
+
+    for(uint8_t i = 0; i < numSnapshot; i++)
+    {
+        const emuAllocOwner_t* o = &snapshot[i];
+        ESP_LOGI("MEM", "%-20s %9d %9d %9d %9d %9d %9d %7d %6d", ownerName(o),
+                 (int)o->peak[EMU_HEAP_INTERNAL], (int)o->peak[EMU_HEAP_SPIRAM],
+                 (int)o->peakTotal[EMU_HEAP_INTERNAL], (int)o->peakTotal[EMU_HEAP_SPIRAM],
+                 (int)o->leaked[EMU_HEAP_INTERNAL], (int)o->leaked[EMU_HEAP_SPIRAM],
+                 o->numAllocs, o->numFailed);
+    }
+}
+
+//==============================================================================
+// Static functions
+//==============================================================================
+
+/**
+ * @brief Wait for other threads to finish with the allocation table
+ */
+static void allocLock(void)
+{
+    while(__atomic_test_and_set(&allocLocked, __ATOMIC_ACQUIRE))
+    {
+        ;
+    }
+}
+
+/**
+ * @brief Let other threads use the allocation table
+ */
+static void allocUnlock(void)
+{
+    __atomic_clear(&allocLocked, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Find the table slot an allocation is in, or the slot it would go in.
+ * Must be called while locked
+ *
+ * @param ptr The allocation to find
+ * @return The slot the allocation is in, or an empty slot or tombstone if it
+ *         isn't in the table
+ */
+static emuAlloc_t* findAlloc(const void* ptr)
+{
+    size_t mask = allocTableSize - 1;
+    size_t idx = (size_t)((((uint64_t)(uintptr_t)ptr >> 3) * 0x9E3779B97F4A7C15ull) >> 32) & mask;
+    emuAlloc_t* tombstone = NULL;
+
+    while(true)
+    {
+        emuAlloc_t* slot = &allocTable[idx];
+        if(slot->ptr == ptr)
+        {
+            return slot;
+        }
+        else if(NULL == slot->ptr)
+        {
+            return (NULL != tombstone) ? tombstone : slot;
+        }
+        else if((TOMBSTONE == slot->ptr) && (NULL == tombstone))
+        {
+            tombstone = slot;
+        }
+        idx = (idx + 1) & mask;
+    }
+}
+
+/**
+ * @brief Make room in the table for more allocations by growing it or
+ * clearing out tombstones. Must be called while locked
+ *
+ * @return true if there is room, false if memory couldn't be allocated
+ */
+static bool growTable(void)
+{
+    size_t numLive = 0;
+    for(size_t i = 0; i < allocTableSize; i++)
+    {
+        if((NULL != allocTable[i].ptr) && (TOMBSTONE != allocTable[i].ptr))
+        {
+            numLive++;
+        }
+    }
+
+    // If the table is mostly tombstones, rehashing at the same size is enough
+    size_t newSize = allocTableSize;
+    if(0 == newSize)
+    {
+        newSize = INITIAL_TABLE_SIZE;
+    }
+    else if(numLive * 4 >= allocTableSize)
+    {
+        newSize *= 2;
+    }
+    emuAlloc_t* newTable = __real_calloc(newSize, sizeof(emuAlloc_t));
+    if(NULL == newTable)
+    {
+        return false;
+    }
+
+    emuAlloc_t* oldTable = allocTable;
+    size_t oldSize = allocTableSize;
+    allocTable = newTable;
+    allocTableSize = newSize;
+    allocTableUsed = 0;
+
+    // Tombstones are dropped while rehashing
+    for(size_t i = 0; i < oldSize; i++)
+    {
+        if((NULL != oldTable[i].ptr) && (TOMBSTONE != oldTable[i].ptr))
+        {
+            *findAlloc(oldTable[i].ptr) = oldTable[i];
+            allocTableUsed++;
+        }
+    }
+
+    __real_free(oldTable);
+    return true;
+}
+
+/**
+ * @brief Start counting an allocation
+ *
+ * @param ptr The allocation
+ * @param size The number of bytes requested
+ * @param heap The heap to count it against
+ * @param owner The owner to count it against
+ * @param caller The address the allocation was made from
+ */
+static void trackAlloc(void* ptr, size_t size, emuHeap_t heap, uint8_t owner, void* caller)
+{
+    allocLock();
+
+    // Keep the table at most half full, counting tombstones
+    if(((allocTableUsed + 1) * 2 > allocTableSize) && !growTable())
+    {
+        allocUnlock();
+        return;
+    }
+
+    emuAlloc_t* slot = findAlloc(ptr);
+    if(NULL == slot->ptr)
+    {
+        allocTableUsed++;
+    }
+    else if(slot->ptr == ptr)
+    {
+        // A stale record for this address, e.g. freed without going through
+        // freeTracked(). Stop counting it before it's replaced
+        owners[slot->owner].live[slot->heap] -= slot->size;
+        liveBytes[slot->heap] -= slot->size;
+    }
+    slot->ptr = ptr;
+    slot->size = size;
+    slot->caller = caller;
+    slot->heap = heap;
+    slot->owner = owner;
+
+    emuAllocOwner_t* o = &owners[owner];
+    o->live[heap] += size;
+    o->numAllocs++;
+    if(o->live[heap] > o->peak[heap])
+    {
+        o->peak[heap] = o->live[heap];
+    }
+
+    liveBytes[heap] += size;
+    if(liveBytes[heap] > peakBytes[heap])
+    {
+        peakBytes[heap] = liveBytes[heap];
+    }
+    if(liveBytes[heap] > owners[currentOwner].peakTotal[heap])
+    {
+        owners[currentOwner].peakTotal[heap] = liveBytes[heap];
+    }
+
+    allocUnlock();
+}
+
+/**
+ * @brief Stop counting an allocation
+ *
+ * @param ptr The allocation
+ * @param[out] removed If not NULL, the allocation's record is written here
+ * @return true if the allocation was counted, false if it wasn't
+ */
+static bool untrackAlloc(void* ptr, emuAlloc_t* removed)
+{
+    bool found = false;
+    allocLock();
+
+    if(0 != allocTableSize)
+    {
+        emuAlloc_t* slot = findAlloc(ptr);
+        if(slot->ptr == ptr)
+        {
+            owners[slot->owner].live[slot->heap] -= slot->size;
+            liveBytes[slot->heap] -= slot->size;
+            if(NULL != removed)
+            {
+                *removed = *slot;
+            }
+            slot->ptr = TOMBSTONE;
+            found = true;
+        }
+    }
+
+    allocUnlock();
+    return found;
+}
+
+/**
+ * @brief Check if memory may be allocated without going over the heap's limit
+ *
+ * @param heap The heap to allocate from
+ * @param size The number of bytes to allocate
+ * @return true if the memory may be allocated, false if not
+ */
+static bool reserve(emuHeap_t heap, size_t size)
+{
+    allocLock();
+    bool ok = (0 == limitBytes[heap]) || (liveBytes[heap] + size <= limitBytes[heap]);
+    if(!ok)
+    {
+        owners[currentOwner].numFailed++;
+    }
+    const emuAllocOwner_t* owner = &owners[currentOwner];
+    size_t live = liveBytes[heap];
+    allocUnlock();
+
+    if(!ok)
+    {
+        ESP_LOGE("MEM", "%s: %d byte %s allocation refused, %d of %d bytes in use",
+                 ownerName(owner), (int)size, heapNames[heap], (int)live, (int)limitBytes[heap]);
+    }
+    return ok;
+}
+
+/**
+ * @brief Allocate memory and count it against the current mode
+ *
+ * @param size The number of bytes to allocate
+ * @param zero true to zero the memory
+ * @param heap The heap to count it against
+ * @param caller The address the allocation was made from
+ * @return A pointer to the memory, or NULL if it couldn't be allocated
+ */
+static void* allocTracked(size_t size, bool zero, emuHeap_t heap, void* caller)
+{
+    if(!reserve(heap, size))
+    {
+        return NULL;
+    }
+
+    void* ptr = zero ? __real_calloc(1, size) : __real_malloc(size);
+    if(NULL != ptr)
+    {
+        trackAlloc(ptr, size, heap, currentOwner, caller);
+    }
+    return ptr;
+}
+
+/**
+ * @brief Resize memory. It stays counted against whoever allocated it
+ *
+ * @param ptr The memory to resize, may be NULL
+ * @param size The new size, 0 to free the memory
+ * @param heap The heap to count the memory against, or -1 to keep the heap
+ *             it was allocated from
+ * @param caller The address the allocation was made from
+ * @return A pointer to the memory, or NULL if it couldn't be allocated
+ */
+static void* reallocTracked(void* ptr, size_t size, int heap, void* caller)
+{
+    if(NULL == ptr)
+    {
+        return allocTracked(size, false, (heap < 0) ? EMU_HEAP_INTERNAL : (emuHeap_t)heap, caller);
+    }
+    else if(0 == size)
+    {
+        freeTracked(ptr);
+        return NULL;
+    }
+
+    emuAlloc_t old;
+    if(!untrackAlloc(ptr, &old))
+    {
+        // Not allocated by anything here, so don't count it
+        return __real_realloc(ptr, size);
+    }
+
+    emuHeap_t newHeap = (heap < 0) ? (emuHeap_t)old.heap : (emuHeap_t)heap;
+    void* newPtr = NULL;
+    if(reserve(newHeap, size))
+    {
+        newPtr = __real_realloc(ptr, size);
+    }
+
+    if(NULL == newPtr)
+    {
+        // The old memory is still allocated
+        trackAlloc(ptr, old.size, old.heap, old.owner, old.caller);
+    }
+    else
+    {
+        trackAlloc(newPtr, size, newHeap, old.owner, caller);
+    }
+    return newPtr;
+}
+
+/**
+ * @brief Free memory and stop counting it
+ *
+ * @param ptr The memory to free, may be NULL
+ */
+static void freeTracked(void* ptr)
+{
+    if(NULL != ptr)
+    {
+        untrackAlloc(ptr, NULL);
+        __real_free(ptr);
+    }
+}
+
+/**
+ * @brief Get which heap memory with the given capabilities would come from
+ *
+ * @param caps Bitwise OR of MALLOC_CAP_* flags
+ * @return The heap the memory is counted against
+ */
+static emuHeap_t capsToHeap(uint32_t caps)
+{
+    return (caps & MALLOC_CAP_SPIRAM) ? EMU_HEAP_SPIRAM : EMU_HEAP_INTERNAL;
+}
+
+/**
+ * @brief Get the name to print for an owner
+ *
+ * @param owner The owner
+ * @return The owner's mode name, or "System"
+ */
+static const char* ownerName(const emuAllocOwner_t* owner)
+{
+    return (NULL == owner->mode) ? "System" : owner->mode->modeName;
+}
+
+/**
+ * @brief Print where an allocation was made from, followed by a newline
+ *
+ * @param caller The address the allocation was made from
+ */
+static void printCaller(void* caller)
+{
+#ifdef __linux__
+    // Symbols look like "swadge_emulator(func+0x1a)", for addr2line
+    char** symbols = backtrace_symbols(&caller, 1);
+    if(NULL != symbols)
+    {
+        fprintf(stderr, "%s\n", symbols[0]);
+        free(symbols);
+        return;
+    }
+#endif
+    fprintf(stderr, "%p\n", caller);
+}
@@ -0,0 +1,23 @@
+#ifndef _EMU_ALLOC_H_
+#define _EMU_ALLOC_H_
+
+#include <stddef.h>
+
+#include "swadgeMode.h"
+
+/**
+ * The heaps allocations are counted against, as they would be on hardware
+ */
+typedef enum
+{
+    EMU_HEAP_INTERNAL, ///< Internal RAM. malloc() always allocates from here
+    EMU_HEAP_SPIRAM,   ///< SPI RAM, only from heap_caps_*() with MALLOC_CAP_SPIRAM
+    NUM_EMU_HEAPS
+} emuHeap_t;
+
+void emuAllocSetLimit(emuHeap_t heap, size_t bytes);
+void emuAllocModeEnter(const swadgeMode* mode);
+void emuAllocModeExit(void);
+void emuAllocPrintSummary(void);
+
+#endif
@@ -249,6 +249,10 @@ uint32_t paletteColorsEmu[216] =
 // Display memory
 paletteColor_t * frameBuffer = NULL;
 uint32_t * scaledBitmapDisplay = NULL; //0xRRGGBBAA
+// A copy of the framebuffer as of the last draw, to find rows which changed
+paletteColor_t * prevFrameBuffer = NULL;
+// Set when every row must be converted, i.e. the scaled bitmap was reallocated
+bool redrawAllRows = true;
 int bitmapWidth = 0;
 int bitmapHeight = 0;
 int displayMult = 1;
@@ -267,6 +271,7 @@ void emuSetPxTft(int16_t x, int16_t y, paletteColor_t px);
 paletteColor_t emuGetPxTft(int16_t x, int16_t y);
 void emuClearPxTft(void);
 void emuDrawDisplayTft(display_t *,bool,fnBackgroundDrawCallback_t);
+static void emuConvertRowTft(int16_t y);
 
 void emuSetPxOled(int16_t x, int16_t y, paletteColor_t px);
 paletteColor_t emuGetPxOled(int16_t x, int16_t y);
@@ -290,6 +295,7 @@ void setDisplayBitmapMultiplier(uint8_t multiplier)
     free(scaledBitmapDisplay);
     scaledBitmapDisplay = calloc((multiplier * TFT_WIDTH) * (multiplier * TFT_HEIGHT),
         sizeof(uint32_t));
+    redrawAllRows = true;
 }
 
 /**
@@ -333,6 +339,11 @@ void deinitDisplayMemory(void)
         free(scaledBitmapDisplay);
         scaledBitmapDisplay = NULL;
     }
+    if(NULL != prevFrameBuffer)
+    {
+        free(prevFrameBuffer);
+        prevFrameBuffer = NULL;
+    }
     if(NULL != rdLeds)
     {
         free(rdLeds);
@@ -373,6 +384,10 @@ void initTFT(display_t * disp, spi_host_device_t spiHost UNUSED,
     {
         frameBuffer = calloc(TFT_WIDTH * TFT_HEIGHT, sizeof(paletteColor_t));
     }
+    if(NULL == prevFrameBuffer)
+    {
+        prevFrameBuffer = calloc(TFT_WIDTH * TFT_HEIGHT, sizeof(paletteColor_t));
+    }
 
     // This may be setup by the emulator already
     if(NULL == scaledBitmapDisplay)
@@ -380,6 +395,7 @@ void initTFT(display_t * disp, spi_host_device_t spiHost UNUSED,
         scaledBitmapDisplay = calloc(TFT_WIDTH * TFT_HEIGHT, sizeof(uint32_t));
         displayMult = 1;        
     }
+    redrawAllRows = true;
 
     // Rawdraw initialized in main
 
@@ -474,10 +490,49 @@ void emuClearPxTft(void)
 	memset(frameBuffer, c000, sizeof(paletteColor_t) * TFT_HEIGHT * TFT_WIDTH);
 }
 
+/**
+ * @brief Convert one framebuffer row to the scaled bitmap. The row is converted
+ * through the palette and scaled horizontally once, then copied to the rest of
+ * the scaled rows
+ *
+ * @param y The framebuffer row to convert
+ */
+static void emuConvertRowTft(int16_t y)
+{
+    const paletteColor_t * src = &frameBuffer[y * TFT_WIDTH];
+    int scaledWidth = TFT_WIDTH * displayMult;
+    uint32_t * dstRow = &scaledBitmapDisplay[(y * displayMult) * scaledWidth];
+
+    if(1 == displayMult)
+    {
+        for(int16_t x = 0; x < TFT_WIDTH; x++)
+        {
+            dstRow[x] = paletteColorsEmu[src[x]];
+        }
+        return;
+    }
+
+    uint32_t * dst = dstRow;
+    for(int16_t x = 0; x < TFT_WIDTH; x++)
+    {
+        uint32_t color = paletteColorsEmu[src[x]];
+        for(int mX = 0; mX < displayMult; mX++)
+        {
+            *(dst++) = color;
+        }
+    }
+
+    for(int mY = 1; mY < displayMult; mY++)
+    {
+        memcpy(&dstRow[mY * scaledWidth], dstRow, scaledWidth * sizeof(uint32_t));
+    }
+}
+
 /**
  * @brief Called when the Swadge wants to draw a new display.
  *
- * @param drawDiff unused, the whole display is always drawn
+ * @param drawDiff unused, only rows which changed since the last draw are
+ *                 converted, but the whole display is always drawn
  */
 void emuDrawDisplayTft(display_t * disp, bool drawDiff UNUSED, fnBackgroundDrawCallback_t fnBackgroundDrawCallback )
 {
@@ -493,18 +548,14 @@ void emuDrawDisplayTft(display_t * disp, bool drawDiff UNUSED, fnBackgroundDrawC
     int16_t y;
     for(y = 0; y < TFT_HEIGHT; y++)
     {
-        for(int16_t x = 0; x < TFT_WIDTH; x++)
+        // Only convert rows which changed since the last draw
+        paletteColor_t * fbRow = &frameBuffer[y * TFT_WIDTH];
+        paletteColor_t * prevRow = &prevFrameBuffer[y * TFT_WIDTH];
+        if(redrawAllRows || (0 != memcmp(fbRow, prevRow, TFT_WIDTH * sizeof(paletteColor_t))))
         {
-            for(uint16_t mY = 0; mY < displayMult; mY++)
-            {
-                for(uint16_t mX = 0; mX < displayMult; mX++)
-                {
-                    int dstX = ((x * displayMult) + mX);
-                    int dstY = ((y * displayMult) + mY);
-                    scaledBitmapDisplay[(dstY * (TFT_WIDTH * displayMult)) + dstX] = paletteColorsEmu[frameBuffer[(y * TFT_WIDTH) + x]];
-                }
-            }
-        }        
+            emuConvertRowTft(y);
+            memcpy(prevRow, fbRow, TFT_WIDTH * sizeof(paletteColor_t));
+        }
 
 		if( ( y & 0xf ) == 0 && fnBackgroundDrawCallback && y > 0 )
 		{
@@ -516,6 +567,8 @@ void emuDrawDisplayTft(display_t * disp, bool drawDiff UNUSED, fnBackgroundDrawC
 	{
 		fnBackgroundDrawCallback( disp, 0, y-16, TFT_WIDTH, 16, (y-16)/16, TFT_HEIGHT/16 );
 	}
+
+    redrawAllRows = false;
 }
 
 //==============================================================================
@@ -646,3 +699,11 @@ void setLeds(led_t* leds, uint8_t numLeds)
         rdLeds[i].b = leds[i].b >> ledBrightness;
     }
 }
+
+/**
+ * @brief Do nothing, emulated LEDs are drawn from setLeds() directly
+ */
+void flushLeds(void)
+{
+    ;
+}
@@ -28,7 +28,6 @@
 #include "rmt_reg.h"
 #include "tinyusb.h"
 #include "tusb_hid_gamepad.h"
-#include "esp_heap_caps.h"
 
 //==============================================================================
 // Functions
@@ -61,20 +60,24 @@ esp_err_t tinyusb_driver_install(const tinyusb_config_t *config UNUSED)
  * @brief Send a USB HID gamepad report to the USB host
  *
  * @param report The report to send to the host
+ * @return true if the report was queued, false if it was not
  */
-void tud_gamepad_report(hid_gamepad_report_t * report UNUSED)
+bool tud_gamepad_report(hid_gamepad_report_t * report UNUSED)
 {
     WARN_UNIMPLEMENTED();
+    return true;
 }
 
 /**
  * @brief Send a USB HID gamepad report to the USB host
  *
  * @param report The report to send to the host
+ * @return true if the report was queued, false if it was not
  */
-void tud_gamepad_ns_report(hid_gamepad_ns_report_t * report UNUSED)
+bool tud_gamepad_ns_report(hid_gamepad_ns_report_t * report UNUSED)
 {
     WARN_UNIMPLEMENTED();
+    return true;
 }
 
 /**
@@ -97,40 +100,3 @@ void taskYIELD(void)
 	// Sleep for one ms
 	usleep(1000);
 }
-
-/**
- * @brief Allocate a chunk of memory which has the given capabilities
- *
- * Equivalent semantics to libc malloc(), for capability-aware memory.
- *
- * In IDF, ``malloc(p)`` is equivalent to ``heap_caps_malloc(p, MALLOC_CAP_8BIT)``.
- *
- * @param size Size, in bytes, of the amount of memory to allocate
- * @param caps        Bitwise OR of MALLOC_CAP_* flags indicating the type
- *                    of memory to be returned
- *
- * @return A pointer to the memory allocated on success, NULL on failure
- */
-void *heap_caps_malloc(size_t size, uint32_t caps __attribute__((unused)))
-{
-    return malloc(size);
-}
-
-/**
- * @brief Allocate a chunk of memory which has the given capabilities. The initialized value in the memory is set to zero.
- *
- * Equivalent semantics to libc calloc(), for capability-aware memory.
- *
- * In IDF, ``calloc(p)`` is equivalent to ``heap_caps_calloc(p, MALLOC_CAP_8BIT)``.
- *
- * @param n    Number of continuing chunks of memory to allocate
- * @param size Size, in bytes, of a chunk of memory to allocate
- * @param caps        Bitwise OR of MALLOC_CAP_* flags indicating the type
- *                    of memory to be returned
- *
- * @return A pointer to the memory allocated on success, NULL on failure
- */
-void *heap_caps_calloc(size_t n, size_t size, uint32_t caps)
-{
-    return calloc(n, size);
-}
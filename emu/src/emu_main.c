@@ -8,6 +8,7 @@
 #include <stdlib.h>
 #include <getopt.h>
 #include <ctype.h>
+#include <inttypes.h>
 
 #ifdef __linux__
 #include <execinfo.h>
@@ -28,6 +29,9 @@
 #include "emu_sound.h"
 #include "emu_sensors.h"
 #include "emu_main.h"
+#include "emu_alloc.h"
+#include "emu_wifi.h"
+#include "spiffs_song.h"
 
 #include "fighter_menu.h"
 #include "jumper_menu.h"
@@ -108,11 +112,13 @@ bool handleFuzzButtons(const char* buttons);
 bool parseKeyConfig(const char* config, char* outKeys, char* outTouch);
 void printModeList(FILE* stream);
 void handleArgs(int argc, char** argv);
+int renderSongs(const char* bgmName, const char* sfxName, uint32_t maxMs, const char* wavName);
 
 
 #ifdef __linux__
 void init_crashSignals(void);
 void signalHandler_crash(int signum, siginfo_t* si, void* vcontext);
+void signalHandler_memReport(int signum);
 #endif
 
 //==============================================================================
@@ -121,6 +127,11 @@ void signalHandler_crash(int signum, siginfo_t* si, void* vcontext);
 
 static bool isRunning = true;
 
+#ifdef __linux__
+/// Set by SIGUSR1 to print a memory summary from the main loop
+static volatile sig_atomic_t memReportRequested = false;
+#endif
+
 //==============================================================================
 // Functions
 //==============================================================================
@@ -475,6 +486,45 @@ void printModeList(FILE* stream)
     }
 }
 
+/**
+ * @brief Load songs and render them to a WAV file
+ *
+ * @param bgmName The SNG to render as background music, may be NULL
+ * @param sfxName The SNG to render as a sound effect, may be NULL
+ * @param maxMs The number of milliseconds to render, or 0 to render until done
+ * @param wavName The WAV file to write
+ * @return 0 if the WAV was written, 1 if there was an error
+ */
+int renderSongs(const char* bgmName, const char* sfxName, uint32_t maxMs, const char* wavName)
+{
+    song_t* bgm = NULL;
+    song_t* sfx = NULL;
+    int result = 1;
+
+    if ((bgmName && NULL == (bgm = loadSong(bgmName))) || (sfxName && NULL == (sfx = loadSong(sfxName))))
+    {
+        fprintf(stderr, "ERROR: Couldn't load songs to render\n");
+    }
+    else
+    {
+        int64_t samples = emuSoundRenderWav(bgm, sfx, maxMs, wavName);
+        if (samples >= 0)
+        {
+            printf("Rendered %" PRId64 " samples to %s\n", samples, wavName);
+            result = 0;
+        }
+    }
+
+    if (bgm)
+    {
+        freeSong(bgm);
+    }
+    if (sfx)
+    {
+        freeSong(sfx);
+    }
+    return result;
+}
 
 static const struct option opts[] = {
     {"start-mode", required_argument, NULL, 'm'},
@@ -493,6 +543,19 @@ static const struct option opts[] = {
     {"help", no_argument, NULL, 'h'},
     {"fullscreen", no_argument, &fullscreen, true},
     {"hide-leds", no_argument, &hideLeds, true},
+    {"mem-limit-internal", required_argument, NULL, 0},
+    {"mem-limit-spiram", required_argument, NULL, 0},
+    {"render-song", required_argument, NULL, 0},
+    {"render-sfx", required_argument, NULL, 0},
+    {"render-wav", required_argument, NULL, 0},
+    {"render-ms", required_argument, NULL, 0},
+    {"net-loss", required_argument, NULL, 0},
+    {"net-dup", required_argument, NULL, 0},
+    {"net-reorder", required_argument, NULL, 0},
+    {"net-latency", required_argument, NULL, 0},
+    {"net-jitter", required_argument, NULL, 0},
+    {"net-bandwidth", required_argument, NULL, 0},
+    {"net-seed", required_argument, NULL, 0},
 
     {NULL, 0, NULL, 0},
 };
@@ -506,6 +569,11 @@ void handleArgs(int argc, char** argv)
     bool fuzzP2 = true;
     char* p1Keys = NULL;
     char* p2Keys = NULL;
+    char* renderBgm = NULL;
+    char* renderSfx = NULL;
+    char* renderWav = "song.wav";
+    int renderMs = 0;
+    emuWifiImpairment_t netImpairment = {0};
 
     int optVal, optIndex;
 
@@ -574,6 +642,98 @@ void handleArgs(int argc, char** argv)
                             return;
                         }
                     break;
+
+                    // Memory limits
+                    case 16:
+                    case 17:
+                    {
+                        int limitKb = atoi(optarg);
+                        if (limitKb <= 0)
+                        {
+                            fprintf(stderr, "ERROR: Invalid numeric argument for option %s: '%s'\n", argv[optind - 2], optarg);
+                            exit(1);
+                            return;
+                        }
+                        emuAllocSetLimit((16 == optIndex) ? EMU_HEAP_INTERNAL : EMU_HEAP_SPIRAM, (size_t)limitKb * 1024);
+                    }
+                    break;
+
+                    // Render Song
+                    case 18:
+                        renderBgm = optarg;
+                    break;
+
+                    // Render SFX
+                    case 19:
+                        renderSfx = optarg;
+                    break;
+
+                    // Render WAV
+                    case 20:
+                        renderWav = optarg;
+                    break;
+
+                    // Render Length
+                    case 21:
+                        renderMs = atoi(optarg);
+                        if (renderMs <= 0)
+                        {
+                            fprintf(stderr, "ERROR: Invalid numeric argument for option %s: '%s'\n", argv[optind - 2], optarg);
+                            exit(1);
+                            return;
+                        }
+                    break;
+
+                    // Network loss, duplication, and reordering percentages
+                    case 22:
+                    case 23:
+                    case 24:
+                    {
+                        int pct = atoi(optarg);
+                        if (pct < 0 || pct > 100)
+                        {
+                            fprintf(stderr, "ERROR: Invalid numeric argument for option %s: '%s'\n", argv[optind - 2], optarg);
+                            exit(1);
+                            return;
+                        }
+                        uint8_t* pcts[] = {&netImpairment.lossPct, &netImpairment.dupPct, &netImpairment.reorderPct};
+                        *pcts[optIndex - 22] = pct;
+                    }
+                    break;
+
+                    // Network latency and jitter
+                    case 25:
+                    case 26:
+                    {
+                        int ms = atoi(optarg);
+                        if (ms < 0)
+                        {
+                            fprintf(stderr, "ERROR: Invalid numeric argument for option %s: '%s'\n", argv[optind - 2], optarg);
+                            exit(1);
+                            return;
+                        }
+                        *((25 == optIndex) ? &netImpairment.latencyUs : &netImpairment.jitterUs) = ms * 1000;
+                    }
+                    break;
+
+                    // Network bandwidth
+                    case 27:
+                    {
+                        int bps = atoi(optarg);
+                        if (bps <= 0)
+                        {
+                            fprintf(stderr, "ERROR: Invalid numeric argument for option %s: '%s'\n", argv[optind - 2], optarg);
+                            exit(1);
+                            return;
+                        }
+                        netImpairment.bandwidthBps = bps;
+                    }
+                    break;
+
+                    // Network seed
+                    case 28:
+                        netImpairment.seed = strtoul(optarg, NULL, 0);
+                    break;
                 }
                 break;
             }
@@ -639,6 +799,25 @@ void handleArgs(int argc, char** argv)
                 printf("\t--dvorak\t\tSets keybindings for the Dvorak layout which are equivalent to the default QWERTY keybinings.\n");
                 printf("\t--fullscreen\tStarts the window in fullscreen mode.\n");
                 printf("\t--hide-leds\tHides the emulated LED display\n");
+                printf("\t--mem-limit-internal KB\tMakes internal RAM allocations fail past KB kilobytes, like they would on hardware. Defaults to no limit.\n");
+                printf("\t--mem-limit-spiram KB\tMakes SPI RAM allocations fail past KB kilobytes. Defaults to no limit.\n");
+                printf("\t--render-song SONG\tRenders the SNG file named SONG from spiffs_image to a WAV file and exits, without opening a window or audio device.\n");
+                printf("\t--render-sfx SFX\tAlso renders the SNG file named SFX, which plays over the song from the start like a sound effect would.\n");
+                printf("\t--render-wav FILE\tSets the name of the rendered WAV file. Defaults to 'song.wav'.\n");
+                printf("\t--render-ms MILLIS\tSets how many milliseconds to render. Defaults to until each song ends or loops once.\n");
+                printf("\t--net-loss PERCENT\tDrops received ESP-NOW packets this percent of the time. Defaults to 0.\n");
+                printf("\t--net-dup PERCENT\tDelivers received ESP-NOW packets twice this percent of the time. Defaults to 0.\n");
+                printf("\t--net-reorder PERCENT\tHolds back received ESP-NOW packets this percent of the time, so later packets pass them. Defaults to 0.\n");
+                printf("\t--net-latency MILLIS\tDelays received ESP-NOW packets by MILLIS milliseconds. Defaults to 0.\n");
+                printf("\t--net-jitter MILLIS\tAdds up to MILLIS random milliseconds to each packet's latency. Defaults to 0.\n");
+                printf("\t--net-bandwidth BYTES\tLimits received ESP-NOW packets to BYTES bytes per second. Defaults to no limit.\n");
+                printf("\t--net-seed SEED\tSeeds the random network impairments, so a run can be repeated. Defaults to 1.\n");
+                printf("\n");
+                printf("Memory use for each mode is printed on exit");
+#ifdef __linux__
+                printf(", or when the emulator receives SIGUSR1");
+#endif
+                printf(". Leaks are printed when a mode exits.\n");
                 printf("\n");
                 exit(0);
                 return;
@@ -654,6 +833,16 @@ void handleArgs(int argc, char** argv)
         }
     }
 
+    // Impair received ESP-NOW packets, if asked to
+    emuWifiSetImpairment(&netImpairment);
+
+    // Render songs instead of running the emulator
+    if (renderBgm || renderSfx)
+    {
+        exit(renderSongs(renderBgm, renderSfx, renderMs, renderWav));
+        return;
+    }
+
     // Handle keybindings
     // P1
     if (p1Keys != NULL)
@@ -742,10 +931,14 @@ int main(int argc, char** argv)
 {
 #ifdef __linux__
     init_crashSignals();
+    signal(SIGUSR1, signalHandler_memReport);
 #endif
 
     handleArgs(argc, argv);
 
+    // Print memory use however the emulator exits
+    atexit(emuAllocPrintSummary);
+
     // First initialize rawdraw
     // Screen-specific configurations
     // Save window dimensions from the last loop
@@ -832,6 +1025,14 @@ void emu_loop(void)
         tLastCall = tNow;
     }
 
+#ifdef __linux__
+    if (memReportRequested)
+    {
+        memReportRequested = false;
+        emuAllocPrintSummary();
+    }
+#endif
+
     // Always handle inputs
     if (!CNFGHandleInput())
     {
@@ -1015,4 +1216,14 @@ void signalHandler_crash(int signum, siginfo_t* si, void* vcontext)
 	// Exit
 	_exit(1);
 }
+
+/**
+ * @brief Request a memory summary, which is printed from the main loop
+ *
+ * @param signum unused
+ */
+void signalHandler_memReport(int signum UNUSED)
+{
+    memReportRequested = true;
+}
 #endif
@@ -10,6 +10,7 @@
 
 #include "esp_log.h"
 #include "esp_err.h"
+#include "esp_timer.h"
 
 #include "swadge_esp32.h"
 #include "emu_esp.h"
@@ -178,6 +179,7 @@ void emuSensorHandleKey( int keycode, int bDown )
 			evt->button = (1 << idx);
 			evt->down = bDown;
 			evt->state = buttonState;
+			evt->time = esp_timer_get_time();
 
 			// Add the event to the list
 			push(buttonQueue, evt);
@@ -230,6 +232,7 @@ void emuSensorHandleKey( int keycode, int bDown )
 			evt->state = touchState;
 			evt->pad = idx;
 			evt->down = bDown;
+			evt->time = esp_timer_get_time();
 
 			/* LUT the location */
 			const uint8_t touchLoc[] =
@@ -327,6 +330,18 @@ bool checkTouchSensor(touch_event_t * evt UNUSED)
 	}
 }
 
+/**
+ * @brief Discard all queued touch events
+ */
+void drainTouchSensor(void)
+{
+	touch_event_t evt;
+	while(checkTouchSensor(&evt))
+	{
+		;
+	}
+}
+
 int getTouchRawValues( uint32_t * rawvalues, int maxPads )
 {
 	for(int i = 0; i < maxPads; i++)
@@ -417,3 +432,15 @@ esp_err_t qma7981_get_acce_int(int16_t *x, int16_t *y, int16_t *z)
 	*z = 4095 / 3;
 	return ESP_OK;	
 }
+
+esp_err_t qma7981_set_fifo(bool enable UNUSED)
+{
+	// There is no FIFO to turn on, so the accelerometer is polled instead
+	return ESP_ERR_NOT_SUPPORTED;
+}
+
+esp_err_t qma7981_get_acce_fifo(int16_t *xyz UNUSED, uint8_t maxSamples UNUSED, uint8_t *numSamples)
+{
+	*numSamples = 0;
+	return ESP_ERR_NOT_SUPPORTED;
+}
@@ -3,6 +3,7 @@
 //==============================================================================
 
 #include <stdint.h>
+#include <stdio.h>
 #include <math.h>
 #include <string.h>
 
@@ -14,6 +15,7 @@
 #include "emu_esp.h"
 #include "sound.h"
 #include "musical_buzzer.h"
+#include "song_cursor.h"
 #include "emu_sound.h"
 #include "hdw-mic.h"
 
@@ -24,17 +26,31 @@
 #define SAMPLING_RATE 8000
 #define SSBUF 8192
 
+// The wavetable is indexed by the top WAVE_BITS of the oscillator's phase
+#define WAVE_BITS 8
+#define WAVE_LEN (1 << WAVE_BITS)
+#define WAVE_AMPLITUDE 1024
+
+// The number of samples rendered at a time when writing a WAV
+#define RENDER_CHUNK 256
+
 //==============================================================================
 // Structs
 //==============================================================================
 
 typedef struct
 {
-	const song_t *song;
-	uint32_t note_index;
+	songCursor_t cursor;
 	int64_t start_time;
 } emu_buzzer_t;
 
+typedef struct
+{
+	songCursor_t cursor;
+	uint32_t samplesLeft; // Samples left in the current note
+	uint32_t passes;      // The number of times the song looped
+} emu_render_track_t;
+
 //==============================================================================
 // Variables
 //==============================================================================
@@ -57,12 +73,22 @@ emu_buzzer_t emuBzrSfx = {0};
 bool emuBgmMuted;
 bool emuSfxMuted;
 
+// One cycle of the buzzer's square wave, and the oscillator reading it
+int16_t squareWave[WAVE_LEN] = {0};
+uint32_t buzzerPhase = 0;
+
 //==============================================================================
 // Function Prototypes
 //==============================================================================
 
 void EmuSoundCb(struct SoundDriver *sd, short *in, short *out, int samplesr, int samplesp);
 bool buzzer_track_check_next_note(emu_buzzer_t * track, bool isActive);
+void initWavetable(void);
+void synthFill(uint32_t * phase, uint16_t freq, short * out, int samples);
+void renderTrackStart(emu_render_track_t * track, const song_t * song);
+void renderTrackAdvance(emu_render_track_t * track);
+void writeLe16(FILE * f, uint16_t val);
+void writeLe32(FILE * f, uint32_t val);
 
 //==============================================================================
 // Functions
@@ -140,33 +166,240 @@ void EmuSoundCb(struct SoundDriver *sd UNUSED, short *in, short *out,
 	// If this is an output callback, and there are samples to write
 	if (samplesp && out)
 	{
-		// Keep track of our place in the wave
-		static float placeInWave = 0;
+		synthFill(&buzzerPhase, buzzernote, out, samplesp);
+	}
+}
 
-		// If there is a note to play
-		if (buzzernote)
+//==============================================================================
+// Synth
+//==============================================================================
+
+/**
+ * @brief Fill the wavetable with one cycle of a square wave. The buzzer is
+ * driven by a square wave, but a perfect one aliases badly at 8kHz, so it is
+ * built from only its first four odd harmonics. The same table is used for
+ * every note, so it isn't band-limited per note: notes above about 570Hz,
+ * where the 7th harmonic passes 4kHz, still alias a little
+ */
+void initWavetable(void)
+{
+	for (int i = 0; i < WAVE_LEN; i++)
+	{
+		double sum = 0;
+		for (int h = 1; h <= 7; h += 2)
 		{
-			// For each sample
-			for (int i = 0; i < samplesp; i++)
+			sum += sin((2 * M_PI * h * i) / WAVE_LEN) / h;
+		}
+		// The harmonic sum of a square wave peaks at about pi/4
+		squareWave[i] = (int16_t)((WAVE_AMPLITUDE * 4 / M_PI) * sum);
+	}
+}
+
+/**
+ * @brief Write samples of a note with a fixed point oscillator. The phase is a
+ * 32 bit fraction of a cycle, so it wraps for free and only its top bits index
+ * the wavetable
+ *
+ * @param phase The oscillator's phase, kept between calls so notes don't click
+ * @param freq The frequency to play, or SILENCE
+ * @param out The buffer to write samples to
+ * @param samples The number of samples to write
+ */
+void synthFill(uint32_t * phase, uint16_t freq, short * out, int samples)
+{
+	if (SILENCE == freq)
+	{
+		// No note to play
+		memset(out, 0, samples * sizeof(short));
+		*phase = 0;
+		return;
+	}
+
+	uint32_t step = (uint32_t)(((uint64_t)freq << 32) / SAMPLING_RATE);
+	for (int i = 0; i < samples; i++)
+	{
+		out[i] = squareWave[*phase >> (32 - WAVE_BITS)];
+		*phase += step;
+	}
+}
+
+/**
+ * @brief Start a track for offline rendering
+ *
+ * @param track The track to start
+ * @param song The song to render, may be NULL for no song
+ */
+void renderTrackStart(emu_render_track_t * track, const song_t * song)
+{
+	memset(track, 0, sizeof(emu_render_track_t));
+	if (NULL != song)
+	{
+		songCursorStart(&track->cursor, song);
+		track->samplesLeft = (track->cursor.note.timeMs * SAMPLING_RATE) / 1000;
+		if (0 == track->samplesLeft)
+		{
+			renderTrackAdvance(track);
+		}
+	}
+}
+
+/**
+ * @brief Advance an offline track by one sample, moving to the next note when
+ * the current one is over
+ *
+ * @param track The track to advance
+ */
+void renderTrackAdvance(emu_render_track_t * track)
+{
+	if (track->samplesLeft)
+	{
+		track->samplesLeft--;
+	}
+
+	// Zero length notes are skipped, like the note check does
+	uint32_t skipped = 0;
+	while (NULL != track->cursor.song && 0 == track->samplesLeft)
+	{
+		if (skipped++ > track->cursor.song->numNotes)
+		{
+			// A looping song with no length would never end
+			songCursorStop(&track->cursor);
+			break;
+		}
+
+		uint32_t lastIdx = track->cursor.noteIdx;
+		if (songCursorNext(&track->cursor))
+		{
+			if (track->cursor.noteIdx <= lastIdx)
 			{
-				// Write the sample
-				out[i] = 1024 * sin(placeInWave);
-				// Advance the place in the wave
-				placeInWave += ((2 * M_PI * buzzernote) / ((float)SAMPLING_RATE));
-				// Keep it bound between 0 and 2*PI
-				if (placeInWave >= (2 * M_PI))
-				{
-					placeInWave -= (2 * M_PI);
-				}
+				track->passes++;
 			}
+			track->samplesLeft = (track->cursor.note.timeMs * SAMPLING_RATE) / 1000;
 		}
-		else
+	}
+}
+
+/**
+ * @brief Write a little endian 16 bit value to a file
+ *
+ * @param f The file to write to
+ * @param val The value to write
+ */
+void writeLe16(FILE * f, uint16_t val)
+{
+	fputc(val & 0xFF, f);
+	fputc((val >> 8) & 0xFF, f);
+}
+
+/**
+ * @brief Write a little endian 32 bit value to a file
+ *
+ * @param f The file to write to
+ * @param val The value to write
+ */
+void writeLe32(FILE * f, uint32_t val)
+{
+	writeLe16(f, val & 0xFFFF);
+	writeLe16(f, (val >> 16) & 0xFFFF);
+}
+
+/**
+ * @brief Render songs to a mono 16 bit WAV file without an audio device.
+ * Notes are timed in samples rather than by the note check timer, and the SFX
+ * takes over the buzzer while it plays, just like on the swadge
+ *
+ * @param bgm The background music to render, may be NULL
+ * @param sfx A sound effect to render from the start, may be NULL
+ * @param maxMs The most milliseconds to render. If 0, rendering stops when each
+ *              song has either ended or looped once
+ * @param fname The WAV file to write
+ * @return The number of samples written, or -1 if the file couldn't be written
+ */
+int64_t emuSoundRenderWav(const song_t * bgm, const song_t * sfx, uint32_t maxMs, const char * fname)
+{
+	FILE * f = fopen(fname, "wb");
+	if (NULL == f)
+	{
+		ESP_LOGE("SND", "Couldn't open %s", fname);
+		return -1;
+	}
+
+	initWavetable();
+
+	emu_render_track_t bgmTrack, sfxTrack;
+	renderTrackStart(&bgmTrack, bgm);
+	renderTrackStart(&sfxTrack, sfx);
+
+	// Write the header now, the sizes are filled in when the length is known
+	uint16_t blockAlign = sizeof(short);
+	fwrite("RIFF", 1, 4, f);
+	writeLe32(f, 0);
+	fwrite("WAVEfmt ", 1, 8, f);
+	writeLe32(f, 16);
+	writeLe16(f, 1); // PCM
+	writeLe16(f, 1); // Mono
+	writeLe32(f, SAMPLING_RATE);
+	writeLe32(f, SAMPLING_RATE * blockAlign);
+	writeLe16(f, blockAlign);
+	writeLe16(f, 16);
+	fwrite("data", 1, 4, f);
+	writeLe32(f, 0);
+
+	uint64_t maxSamples = ((uint64_t)maxMs * SAMPLING_RATE) / 1000;
+	uint32_t phase = 0;
+	int64_t numSamples = 0;
+	short chunk[RENDER_CHUNK];
+	while (true)
+	{
+		bool sfxActive = (NULL != sfxTrack.cursor.song);
+		bool bgmActive = (NULL != bgmTrack.cursor.song);
+		// Looping songs never end, so a song is done once it loops
+		bool sfxDone = !sfxActive || sfxTrack.passes;
+		bool bgmDone = !bgmActive || bgmTrack.passes;
+		if (maxMs ? (numSamples >= maxSamples) : (sfxDone && bgmDone))
+		{
+			break;
+		}
+
+		// Render one sample at a time so notes change on the right sample
+		uint16_t freq = SILENCE;
+		if (sfxActive)
+		{
+			freq = sfxTrack.cursor.note.note;
+		}
+		else if (bgmActive)
+		{
+			freq = bgmTrack.cursor.note.note;
+		}
+		synthFill(&phase, freq, &chunk[numSamples % RENDER_CHUNK], 1);
+		renderTrackAdvance(&sfxTrack);
+		renderTrackAdvance(&bgmTrack);
+		numSamples++;
+
+		if (0 == numSamples % RENDER_CHUNK)
 		{
-			// No note to play
-			memset(out, 0, samplesp * 2);
-			placeInWave = 0;
+			for (int i = 0; i < RENDER_CHUNK; i++)
+			{
+				writeLe16(f, chunk[i]);
+			}
 		}
 	}
+
+	// Write any partial chunk
+	for (int i = 0; i < numSamples % RENDER_CHUNK; i++)
+	{
+		writeLe16(f, chunk[i]);
+	}
+
+	// Fill in the sizes
+	uint32_t dataSize = numSamples * blockAlign;
+	fseek(f, 4, SEEK_SET);
+	writeLe32(f, 36 + dataSize);
+	fseek(f, 40, SEEK_SET);
+	writeLe32(f, dataSize);
+	fclose(f);
+
+	return numSamples;
 }
 
 //==============================================================================
@@ -194,6 +427,7 @@ void buzzer_init(gpio_num_t bzrGpio,
 	buzzer_stop();
 	if (!sounddriver)
 	{
+		initWavetable();
 		sounddriver = InitSound(0, EmuSoundCb, SAMPLING_RATE, 1, 1, 256, 0, 0);
 	}
 	memset(&emuBzrBgm, 0, sizeof(emuBzrBgm));
@@ -232,13 +466,12 @@ void buzzer_play_sfx(const song_t *song)
 		return;
 	}
 
-	// Save the song pointer
-	emuBzrSfx.song = song;
-	emuBzrSfx.note_index = 0;
+	// Start reading the song
+	songCursorStart(&emuBzrSfx.cursor, song);
 	emuBzrSfx.start_time = esp_timer_get_time();
 
 	// Start playing the first note
-	playNote(emuBzrSfx.song->notes[0].note);
+	playNote(emuBzrSfx.cursor.note.note);
 }
 
 /**
@@ -253,15 +486,14 @@ void buzzer_play_bgm(const song_t *song)
 		return;
 	}
 
-	// Save the song pointer
-	emuBzrBgm.song = song;
-	emuBzrBgm.note_index = 0;
+	// Start reading the song
+	songCursorStart(&emuBzrBgm.cursor, song);
 	emuBzrBgm.start_time = esp_timer_get_time();
 
-	if(NULL == emuBzrSfx.song)
+	if(NULL == emuBzrSfx.cursor.song)
 	{
 		// Start playing the first note
-		playNote(emuBzrBgm.song->notes[0].note);
+		playNote(emuBzrBgm.cursor.note.note);
 	}
 }
 
@@ -275,32 +507,23 @@ void buzzer_play_bgm(const song_t *song)
  */
 bool buzzer_track_check_next_note(emu_buzzer_t * track, bool isActive)
 {
-	// Check if there is a song and there are still notes
-	if ((NULL != track->song) && (track->note_index < track->song->numNotes))
+	// Check if there is a song
+	if (NULL != track->cursor.song)
 	{
 		// Get the current time
 		int64_t cTime = esp_timer_get_time();
 
 		// Check if it's time to play the next note
-		if (cTime - track->start_time >= (1000 * track->song->notes[track->note_index].timeMs))
+		if (cTime - track->start_time >= (1000 * track->cursor.note.timeMs))
 		{
-			// Move to the next note
-			track->note_index++;
+			// Move to the next note, looping if requested
 			track->start_time = cTime;
-
-			// Loop if requested
-			if(track->song->shouldLoop && (track->note_index == track->song->numNotes))
-			{
-				track->note_index = 0;
-			}
-
-			// If there is a note
-			if (track->note_index < track->song->numNotes)
+			if (songCursorNext(&track->cursor))
 			{
 				if(isActive)
 				{
 					// Play the note
-					playNote(track->song->notes[track->note_index].note);
+					playNote(track->cursor.note.note);
 				}
 			}
 			else
@@ -312,8 +535,6 @@ bool buzzer_track_check_next_note(emu_buzzer_t * track, bool isActive)
 				}
 
 				track->start_time = 0;
-				track->note_index = 0;
-				track->song = NULL;
 				// Track is inactive
 				return false;
 			}
@@ -340,13 +561,42 @@ void buzzer_check_next_note(void)
 	bool bgmIsActive = buzzer_track_check_next_note(&emuBzrBgm, !sfxIsActive);
 
     // If nothing is playing, but there is BGM (i.e. SFX finished)
-    if((false == sfxIsActive) && (false == bgmIsActive) && (NULL != emuBzrBgm.song))
+    if((false == sfxIsActive) && (false == bgmIsActive) && (NULL != emuBzrBgm.cursor.song))
     {
         // Immediately start playing BGM to get back on track faster
-        playNote(emuBzrBgm.song->notes[emuBzrBgm.note_index].note);
+        playNote(emuBzrBgm.cursor.note.note);
     }
 }
 
+/**
+ * @brief Get when buzzer_check_next_note() next needs to be called
+ *
+ * @return The time in microseconds, comparable to esp_timer_get_time(), when
+ *         the next note starts. INT64_MAX if nothing is playing
+ */
+int64_t emuSoundGetNextNoteTime(void)
+{
+	int64_t nextNoteTime = INT64_MAX;
+	if(emuBgmMuted && emuSfxMuted)
+	{
+		return nextNoteTime;
+	}
+
+	const emu_buzzer_t * tracks[] = {&emuBzrSfx, &emuBzrBgm};
+	for(uint8_t i = 0; i < sizeof(tracks) / sizeof(tracks[0]); i++)
+	{
+		if(NULL != tracks[i]->cursor.song)
+		{
+			int64_t noteEnd = tracks[i]->start_time + (1000 * (int64_t)tracks[i]->cursor.note.timeMs);
+			if(noteEnd < nextNoteTime)
+			{
+				nextNoteTime = noteEnd;
+			}
+		}
+	}
+	return nextNoteTime;
+}
+
 /**
  * @brief Stop playing a song on the emulated buzzer
  */
@@ -357,12 +607,10 @@ void buzzer_stop(void)
 		return;
 	}
 
-	emuBzrBgm.song = NULL;
-	emuBzrBgm.note_index = 0;
+	songCursorStop(&emuBzrBgm.cursor);
 	emuBzrBgm.start_time = 0;
 
-	emuBzrSfx.song = NULL;
-	emuBzrSfx.note_index = 0;
+	songCursorStop(&emuBzrSfx.cursor);
 	emuBzrSfx.start_time = 0;
 
 	buzzernote = SILENCE;
@@ -1,6 +1,12 @@
 #ifndef _EMU_SOUND_H_
 #define _EMU_SOUND_H_
 
+#include <stdint.h>
+
+#include "musical_buzzer.h"
+
 void deinitSound(void);
+int64_t emuSoundGetNextNoteTime(void);
+int64_t emuSoundRenderWav(const song_t * bgm, const song_t * sfx, uint32_t maxMs, const char * fname);
 
-#endif
\ No newline at end of file
+#endif
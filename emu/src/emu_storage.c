@@ -764,6 +764,24 @@ void strToBlob(char * str, void * outBlob, size_t blobLen)
     }
 }
 
+/**
+ * @brief Do nothing, the emulator writes NVS straight to its file
+ *
+ * @return true
+ */
+bool flushNvs(void)
+{
+    return true;
+}
+
+/**
+ * @brief Do nothing, the emulator writes NVS straight to its file
+ */
+void checkNvsWriteBack(void)
+{
+    ;
+}
+
 //==============================================================================
 // SPIFFS
 //==============================================================================
@@ -5,8 +5,6 @@
 #include <stdlib.h>
 #include <time.h>
 
-#include "linked_list.h"
-
 #include "esp_timer.h"
 #include "esp_log.h"
 
@@ -17,13 +15,41 @@
 // Variables
 //==============================================================================
 
-list_t* timerList = NULL;
 static unsigned long boot_time_in_micros = 0;
 
+// Every created timer, so they can be freed on deinit
+static esp_timer_handle_t* allTimers = NULL;
+static int32_t numAllTimers = 0;
+static int32_t allTimersCap = 0;
+
+// Running timers, as a min-heap ordered by alarm
+static esp_timer_handle_t* timerHeap = NULL;
+static int32_t timerHeapLen = 0;
+static int32_t timerHeapCap = 0;
+
+// Timers run on the time passed to check_esp_timer(). Alarms are absolute in
+// this time, and this is the time of the last check
+static uint64_t timerNowUs = 0;
+// The real time of the last check, to convert alarms to real time
+static int64_t lastCheckUs = 0;
+
+// The timer whose callback is running, set to NULL if the callback deletes it
+static esp_timer_handle_t dispatchingTimer = NULL;
+
 //==============================================================================
-// Functions
+// Function Prototypes
 //==============================================================================
 
+static bool growTimerArray(esp_timer_handle_t** arr, int32_t* cap, int32_t len);
+static void timerHeapSwap(int32_t a, int32_t b);
+static void timerHeapUp(int32_t idx);
+static void timerHeapDown(int32_t idx);
+static void timerHeapInsert(esp_timer_handle_t timer, uint64_t alarm);
+static void timerHeapRemove(esp_timer_handle_t timer);
+
+//==============================================================================
+// Functions
+//==============================================================================
 /**
  * @brief Set the time of 'boot'
  *
@@ -40,8 +66,11 @@ esp_err_t esp_timer_init(void)
     }
     boot_time_in_micros = (ts.tv_sec * 1000000) + (ts.tv_nsec / 1000);
 
-    // Create an empty list of timers
-    timerList = calloc(1, sizeof(list_t));
+    // Start with no timers
+    numAllTimers = 0;
+    timerHeapLen = 0;
+    timerNowUs = 0;
+    lastCheckUs = 0;
 
     return ESP_OK;
 }
@@ -57,16 +86,22 @@ esp_err_t esp_timer_init(void)
  */
 esp_err_t esp_timer_deinit(void)
 {
-    if(timerList)
+    if(allTimers)
     {
-        void* val;
-        while (NULL != (val = shift(timerList)))
+        for(int32_t i = 0; i < numAllTimers; i++)
         {
-            free(val);
+            free(allTimers[i]);
         }
 
-        clear(timerList);
-        free(timerList);
+        free(allTimers);
+        allTimers = NULL;
+        numAllTimers = 0;
+        allTimersCap = 0;
+
+        free(timerHeap);
+        timerHeap = NULL;
+        timerHeapLen = 0;
+        timerHeapCap = 0;
         return ESP_OK;
     }
     return ESP_ERR_INVALID_STATE;
@@ -109,8 +144,26 @@ esp_err_t esp_timer_create(const esp_timer_create_args_t* create_args,
 {
     if(NULL == *out_handle)
     {
+        // Make room to track the timer
+        if(!growTimerArray(&allTimers, &allTimersCap, numAllTimers))
+        {
+            return ESP_ERR_NO_MEM;
+        }
+
         // Allocate memory for a timer
-        (*out_handle) = (esp_timer_handle_t)malloc(sizeof(struct esp_timer));
+        (*out_handle) = (esp_timer_handle_t)calloc(1, sizeof(struct esp_timer));
+        if(NULL == *out_handle)
+        {
+            return ESP_ERR_NO_MEM;
+        }
+        (*out_handle)->heap_idx = -1;
+        (*out_handle)->all_idx = numAllTimers;
+        allTimers[numAllTimers++] = *out_handle;
+    }
+    else
+    {
+        // Reusing a timer, so make sure it isn't running
+        timerHeapRemove(*out_handle);
     }
 
     // Initialize the timer
@@ -134,9 +187,6 @@ esp_err_t esp_timer_create(const esp_timer_create_args_t* create_args,
     }
 #endif
 
-    // Link the node
-    push(timerList, *out_handle);
-
     return ESP_OK;
 }
 
@@ -153,16 +203,29 @@ esp_err_t esp_timer_create(const esp_timer_create_args_t* create_args,
  */
 esp_err_t esp_timer_delete(esp_timer_handle_t timer)
 {
-    for (node_t* node = timerList->first; NULL != node; node = node->next)
+    if(NULL == timer)
     {
-        if(node->val == timer)
-        {
-            free(node->val);
-            removeEntry(timerList, node);
-            break;
-        }
+        return ESP_ERR_INVALID_ARG;
     }
 
+    timerHeapRemove(timer);
+
+    // Fill its place in the array of all timers with the last timer
+    int32_t idx = timer->all_idx;
+    if(idx >= 0 && idx < numAllTimers && allTimers[idx] == timer)
+    {
+        numAllTimers--;
+        allTimers[idx] = allTimers[numAllTimers];
+        allTimers[idx]->all_idx = idx;
+    }
+
+    // Don't reschedule it if it's deleted from its own callback
+    if(dispatchingTimer == timer)
+    {
+        dispatchingTimer = NULL;
+    }
+
+    free(timer);
     return ESP_OK;
 }
 
@@ -179,6 +242,12 @@ esp_err_t esp_timer_delete(esp_timer_handle_t timer)
  */
 esp_err_t esp_timer_stop(esp_timer_handle_t timer)
 {
+    if(NULL == timer)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    timerHeapRemove(timer);
     timer->alarm = 0;
     timer->period = 0;
     return ESP_OK;
@@ -198,8 +267,18 @@ esp_err_t esp_timer_stop(esp_timer_handle_t timer)
  */
 esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout_us)
 {
-    timer->alarm = timeout_us;
+    if(NULL == timer)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    timerHeapRemove(timer);
     timer->period = 0;
+    // A zero timeout never expired before, so keep it stopped
+    if(timeout_us)
+    {
+        timerHeapInsert(timer, timerNowUs + timeout_us);
+    }
     return ESP_OK;
 }
 
@@ -218,53 +297,211 @@ esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout_us)
  */
 esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t period)
 {
-    timer->alarm = period;
+    if(NULL == timer)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    timerHeapRemove(timer);
     timer->period = period;
+    if(period)
+    {
+        timerHeapInsert(timer, timerNowUs + period);
+    }
     return ESP_OK;
 }
 
 /**
- * @brief Check running timers and call any that expire
+ * @brief Get the time when the next timer will expire
+ *
+ * @return The time in microseconds, comparable to esp_timer_get_time(), when
+ *         the next running timer expires. INT64_MAX if no timers are running
+ */
+int64_t esp_timer_get_next_alarm(void)
+{
+    if(0 == timerHeapLen)
+    {
+        return INT64_MAX;
+    }
+    return lastCheckUs + (int64_t)(timerHeap[0]->alarm - timerNowUs);
+}
+
+/**
+ * @brief Get the number of timers which were created and not deleted, running
+ * or not
+ *
+ * @return The number of timers
+ */
+int32_t count_esp_timers(void)
+{
+    return numAllTimers;
+}
+
+/**
+ * @brief Call any timers which expire. Only the timers at the front of the
+ * queue are looked at, so this doesn't slow down as more timers are created
  *
  * @param elapsed_us The elapsed time in microseconds since this was last called
  */
 void check_esp_timer(uint64_t elapsed_us)
 {
-    if(0 == timerList->length)
+    timerNowUs += elapsed_us;
+    lastCheckUs = esp_timer_get_time();
+
+    // Timers which expire now are rescheduled in the future, so each fires at
+    // most once per call
+    while((timerHeapLen > 0) && (timerHeap[0]->alarm <= timerNowUs))
     {
-        // Nothing linked, so return
-        return;
+        esp_timer_handle_t tmr = timerHeap[0];
+        uint64_t alarm = tmr->alarm;
+        timerHeapRemove(tmr);
+
+        // Call the callback, which may stop, restart, or delete the timer
+        dispatchingTimer = tmr;
+        tmr->callback(tmr->arg);
+
+        // Reset the timer if it's periodic and the callback didn't change it.
+        // Schedule from when it should have expired so that the period doesn't
+        // drift
+        if((dispatchingTimer == tmr) && (-1 == tmr->heap_idx) && tmr->period)
+        {
+            uint64_t overshoot = timerNowUs - alarm;
+            timerHeapInsert(tmr, (overshoot < tmr->period) ? (alarm + tmr->period) : (timerNowUs + 1));
+        }
+        dispatchingTimer = NULL;
     }
+}
+
+/**
+ * @brief Make sure an array of timers has room for one more
+ *
+ * @param arr The array, which may be reallocated
+ * @param cap The capacity of the array, which may be increased
+ * @param len The number of timers in the array
+ * @return true if there is room, false if memory couldn't be allocated
+ */
+static bool growTimerArray(esp_timer_handle_t** arr, int32_t* cap, int32_t len)
+{
+    if(len < *cap)
+    {
+        return true;
+    }
+
+    int32_t newCap = (0 == *cap) ? 16 : (*cap * 2);
+    esp_timer_handle_t* newArr = realloc(*arr, newCap * sizeof(esp_timer_handle_t));
+    if(NULL == newArr)
+    {
+        return false;
+    }
+    *arr = newArr;
+    *cap = newCap;
+    return true;
+}
+
+/**
+ * @brief Swap two timers in the queue
+ *
+ * @param a The index of one timer
+ * @param b The index of the other timer
+ */
+static void timerHeapSwap(int32_t a, int32_t b)
+{
+    esp_timer_handle_t tmp = timerHeap[a];
+    timerHeap[a] = timerHeap[b];
+    timerHeap[b] = tmp;
+    timerHeap[a]->heap_idx = a;
+    timerHeap[b]->heap_idx = b;
+}
 
-    for (node_t* node = timerList->first; NULL != node; node = node->next)
+/**
+ * @brief Move a timer towards the front of the queue until it's in order
+ *
+ * @param idx The index of the timer
+ */
+static void timerHeapUp(int32_t idx)
+{
+    while(idx > 0)
     {
-        bool timerExpired = false;
-        esp_timer_handle_t tmr = node->val;
-        if(tmr->alarm > elapsed_us)
+        int32_t parent = (idx - 1) / 2;
+        if(timerHeap[parent]->alarm <= timerHeap[idx]->alarm)
         {
-            tmr->alarm -= elapsed_us;
+            break;
+        }
+        timerHeapSwap(parent, idx);
+        idx = parent;
+    }
+}
 
-            if(0 == tmr->alarm)
-            {
-                // If it decrements to 0 exactly, expire
-                timerExpired = true;
-            }
+/**
+ * @brief Move a timer towards the back of the queue until it's in order
+ *
+ * @param idx The index of the timer
+ */
+static void timerHeapDown(int32_t idx)
+{
+    while(true)
+    {
+        int32_t smallest = idx;
+        int32_t left = (2 * idx) + 1;
+        int32_t right = left + 1;
+        if((left < timerHeapLen) && (timerHeap[left]->alarm < timerHeap[smallest]->alarm))
+        {
+            smallest = left;
         }
-        else if(tmr->alarm)
+        if((right < timerHeapLen) && (timerHeap[right]->alarm < timerHeap[smallest]->alarm))
         {
-            // If there's less time on left than elapsed, expire
-            timerExpired = true;
+            smallest = right;
         }
-
-        if(timerExpired)
+        if(smallest == idx)
         {
-            // Call the callback
-            tmr->callback(tmr->arg);
-            // Reset the timer if periodic
-            if(tmr->period)
-            {
-                tmr->alarm = tmr->period;
-            }
+            break;
         }
+        timerHeapSwap(smallest, idx);
+        idx = smallest;
+    }
+}
+
+/**
+ * @brief Add a stopped timer to the queue of running timers
+ *
+ * @param timer The timer to start
+ * @param alarm When the timer expires, in the time passed to check_esp_timer()
+ */
+static void timerHeapInsert(esp_timer_handle_t timer, uint64_t alarm)
+{
+    if(!growTimerArray(&timerHeap, &timerHeapCap, timerHeapLen))
+    {
+        ESP_LOGE("EMU", "No memory to start a timer");
+        return;
     }
-}
\ No newline at end of file
+
+    timer->alarm = alarm;
+    timer->heap_idx = timerHeapLen;
+    timerHeap[timerHeapLen++] = timer;
+    timerHeapUp(timer->heap_idx);
+}
+
+/**
+ * @brief Remove a timer from the queue of running timers, if it's in it
+ *
+ * @param timer The timer to remove
+ */
+static void timerHeapRemove(esp_timer_handle_t timer)
+{
+    int32_t idx = timer->heap_idx;
+    if((idx < 0) || (idx >= timerHeapLen) || (timerHeap[idx] != timer))
+    {
+        return;
+    }
+
+    // Move the last timer into this one's place, then put it in order
+    timerHeapLen--;
+    timer->heap_idx = -1;
+    if(idx != timerHeapLen)
+    {
+        timerHeap[idx] = timerHeap[timerHeapLen];
+        timerHeap[idx]->heap_idx = idx;
+        timerHeapUp(idx);
+        timerHeapDown(timerHeap[idx]->heap_idx);
+    }
+}
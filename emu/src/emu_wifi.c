@@ -20,11 +20,14 @@
 
  #include <unistd.h>
  #include <string.h>
+ #include <stdlib.h>
 
 #include "emu_esp.h"
+#include "emu_wifi.h"
 #include "esp_log.h"
 #include "esp_wifi.h"
 #include "esp_random.h"
+#include "esp_timer.h"
 
 #include "espNowUtils.h"
 #include "p2pConnection.h"
@@ -35,6 +38,38 @@
 
 #define ESP_NOW_PORT 32888
 #define MAXRECVSTRING 1024  // Longest string to receive 
+#define ESP_NOW_HDR_LEN 21  // Length of "ESP_NOW-XXXXXXXXXXXX-"
+#define MAX_DELAYED_PACKETS 256 // Packets held back beyond this are dropped, like a full queue
+#define REORDER_MAX_HOLD_US 100000 // A reordered packet is delivered after the next in-order one, or after this long
+
+//==============================================================================
+// Structs
+//==============================================================================
+
+/**
+ * A received packet which is held back until it's due
+ */
+typedef struct delayedPacket
+{
+    struct delayedPacket* next; ///< The next packet due, NULL if this is the last
+    int64_t deliverUs;          ///< When to deliver the packet
+    bool isReordered;           ///< true if this waits for the next in-order packet
+    uint8_t mac[6];             ///< Who sent the packet
+    uint8_t len;                ///< The length of data
+    char data[];                ///< The packet, without the ESP-NOW header
+} delayedPacket_t;
+
+//==============================================================================
+// Function Prototypes
+//==============================================================================
+
+static uint32_t impairmentRand(void);
+static bool impairmentRoll(uint8_t pct);
+static void impairPacket(const uint8_t* mac, const char* data, uint8_t len);
+static bool delayPacket(const uint8_t* mac, const char* data, uint8_t len, int64_t deliverUs, bool isReordered);
+static void releaseReorderedPackets(int64_t deliverUs);
+static void insertDelayedPacket(delayedPacket_t* packet);
+static void deliverDelayedPackets(void);
 
 //==============================================================================
 // Variables
@@ -45,6 +80,19 @@ hostEspNowSendCb_t hostEspNowSendCb = NULL;
 
 int socketFd;
 
+// How received packets are impaired
+static emuWifiImpairment_t impairment = {0};
+static bool isImpaired = false;
+static uint32_t impairmentRandState = 1;
+
+// Packets which aren't due yet, in the order they're due
+static delayedPacket_t* delayedPackets = NULL;
+static uint32_t numDelayedPackets = 0;
+// When the last in-order packet is due, so jitter doesn't reorder packets
+static int64_t lastInOrderUs = 0;
+// When the bandwidth cap lets the next packet start arriving
+static int64_t linkFreeUs = 0;
+
 //==============================================================================
 // Functions
 //==============================================================================
@@ -150,6 +198,16 @@ void espNowUseSerial(bool crossoverPins)
  */
 void espNowDeinit(void)
 {
+    while(NULL != delayedPackets)
+    {
+        delayedPacket_t* next = delayedPackets->next;
+        free(delayedPackets);
+        delayedPackets = next;
+    }
+    numDelayedPackets = 0;
+    lastInOrderUs = 0;
+    linkFreeUs = 0;
+
     close(socketFd);
 #if defined(USING_WINDOWS)
     WSACleanup();
@@ -206,6 +264,10 @@ void checkEspNowRxQueue(void)
     char recvString[MAXRECVSTRING+1]; // Buffer for received string
     int recvStringLen;                // Length of received string
 
+    // Deliver packets which were held back, once they're due. This is done
+    // before recvfrom(), which waits a little when there's nothing to receive
+    deliverDelayedPackets();
+
     // While we've received a packet
     while ((recvStringLen = recvfrom(socketFd, recvString, MAXRECVSTRING, 0, NULL, 0)) > 0)
     {
@@ -224,10 +286,233 @@ void checkEspNowRxQueue(void)
             esp_wifi_get_mac(WIFI_IF_STA, ourMac);
             if(0 != memcmp(recvMac, ourMac, sizeof(ourMac)))
             {
-                // If it does, send it to the application through the callback
-                hostEspNowRecvCb(recvMac, &recvString[21], recvStringLen - 21, 0x7F);
+                if(isImpaired)
+                {
+                    // Drop, delay, or duplicate it like a radio link would
+                    impairPacket(recvMac, &recvString[ESP_NOW_HDR_LEN], recvStringLen - ESP_NOW_HDR_LEN);
+                    deliverDelayedPackets();
+                }
+                else
+                {
+                    // If it does, send it to the application through the callback
+                    hostEspNowRecvCb(recvMac, &recvString[ESP_NOW_HDR_LEN], recvStringLen - ESP_NOW_HDR_LEN, 0x7F);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Set how received packets are impaired. Packets already held back are
+ * still delivered when they're due
+ *
+ * @param newImpairment The impairment, all zero to deliver every packet immediately
+ */
+void emuWifiSetImpairment(const emuWifiImpairment_t* newImpairment)
+{
+    impairment = *newImpairment;
+    isImpaired = (0 != impairment.lossPct) || (0 != impairment.dupPct) ||
+                 (0 != impairment.reorderPct) || (0 != impairment.latencyUs) ||
+                 (0 != impairment.jitterUs) || (0 != impairment.bandwidthBps);
+
+    // xorshift gets stuck at zero
+    impairmentRandState = (0 != impairment.seed) ? impairment.seed : 1;
+}
+
+/**
+ * @brief Get a random number for impairing packets. This doesn't use
+ * esp_random() so that runs with the same seed roll the same numbers
+ *
+ * @return A random number
+ */
+static uint32_t impairmentRand(void)
+{
+    // xorshift32
+    impairmentRandState ^= impairmentRandState << 13;
+    impairmentRandState ^= impairmentRandState >> 17;
+    impairmentRandState ^= impairmentRandState << 5;
+    return impairmentRandState;
+}
+
+/**
+ * @brief Randomly decide if something happens
+ *
+ * @param pct The chance it happens, 0 to 100
+ * @return true if it happens, false if it doesn't
+ */
+static bool impairmentRoll(uint8_t pct)
+{
+    return (0 != pct) && ((impairmentRand() % 100) < pct);
+}
+
+/**
+ * @brief Drop, delay, or duplicate a received packet according to the
+ * impairment, then hold it back until it's due
+ *
+ * @param mac Who sent the packet
+ * @param data The packet, without the ESP-NOW header
+ * @param len The length of the packet
+ */
+static void impairPacket(const uint8_t* mac, const char* data, uint8_t len)
+{
+    if(impairmentRoll(impairment.lossPct))
+    {
+        return;
+    }
+
+    uint8_t copies = impairmentRoll(impairment.dupPct) ? 2 : 1;
+    for(uint8_t i = 0; i < copies; i++)
+    {
+        int64_t tNowUs = esp_timer_get_time();
+
+        // Packets take turns on the link if bandwidth is capped
+        int64_t arriveUs = tNowUs;
+        if(0 != impairment.bandwidthBps)
+        {
+            if(arriveUs < linkFreeUs)
+            {
+                arriveUs = linkFreeUs;
             }
+            arriveUs += ((int64_t)(len + ESP_NOW_HDR_LEN) * 1000000) / impairment.bandwidthBps;
+        }
+
+        int64_t deliverUs = arriveUs + impairment.latencyUs;
+        if(0 != impairment.jitterUs)
+        {
+            deliverUs += impairmentRand() % (impairment.jitterUs + 1);
         }
+
+        bool isReordered = impairmentRoll(impairment.reorderPct);
+        if(isReordered)
+        {
+            // Hold it back until the next in-order packet passes it, however
+            // far apart packets are. Don't hold it forever if none comes
+            deliverUs += REORDER_MAX_HOLD_US;
+        }
+        else if(deliverUs < lastInOrderUs)
+        {
+            // Otherwise keep it in order with the packets before it
+            deliverUs = lastInOrderUs;
+        }
+
+        // Packets dropped by a full queue don't use the link
+        if(delayPacket(mac, data, len, deliverUs, isReordered))
+        {
+            if(0 != impairment.bandwidthBps)
+            {
+                linkFreeUs = arriveUs;
+            }
+            if(!isReordered)
+            {
+                lastInOrderUs = deliverUs;
+                releaseReorderedPackets(deliverUs);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Hold back a received packet until it's due
+ *
+ * @param mac Who sent the packet
+ * @param data The packet, without the ESP-NOW header
+ * @param len The length of the packet
+ * @param deliverUs When to deliver the packet
+ * @param isReordered true to deliver it after the next in-order packet instead, if that's sooner
+ * @return true if the packet was held back, false if it was dropped
+ */
+static bool delayPacket(const uint8_t* mac, const char* data, uint8_t len, int64_t deliverUs, bool isReordered)
+{
+    if(numDelayedPackets >= MAX_DELAYED_PACKETS)
+    {
+        return false;
+    }
+
+    delayedPacket_t* packet = malloc(sizeof(delayedPacket_t) + len);
+    if(NULL == packet)
+    {
+        return false;
+    }
+    memcpy(packet->mac, mac, sizeof(packet->mac));
+    packet->deliverUs = deliverUs;
+    packet->isReordered = isReordered;
+    packet->len = len;
+    memcpy(packet->data, data, len);
+
+    insertDelayedPacket(packet);
+    numDelayedPackets++;
+    return true;
+}
+
+/**
+ * @brief Deliver reordered packets right after an in-order packet which
+ * arrived after them, if they aren't due before it anyway
+ *
+ * @param deliverUs When the in-order packet is due
+ */
+static void releaseReorderedPackets(int64_t deliverUs)
+{
+    delayedPacket_t* released = NULL;
+
+    // Take out the reordered packets which are due later
+    delayedPacket_t** link = &delayedPackets;
+    while(NULL != *link)
+    {
+        delayedPacket_t* packet = *link;
+        if(packet->isReordered && (packet->deliverUs > deliverUs))
+        {
+            *link = packet->next;
+            packet->next = released;
+            released = packet;
+        }
+        else
+        {
+            link = &packet->next;
+        }
+    }
+
+    // And put them back after the in-order packet. This reverses the order they
+    // were taken out in, which is fine for packets that are out of order anyway
+    while(NULL != released)
+    {
+        delayedPacket_t* packet = released;
+        released = packet->next;
+        packet->deliverUs = deliverUs;
+        packet->isReordered = false;
+        insertDelayedPacket(packet);
+    }
+}
+
+/**
+ * @brief Insert a packet into the list of held back packets, after every packet
+ * due at the same time or earlier
+ *
+ * @param packet The packet to insert
+ */
+static void insertDelayedPacket(delayedPacket_t* packet)
+{
+    delayedPacket_t** link = &delayedPackets;
+    while((NULL != *link) && ((*link)->deliverUs <= packet->deliverUs))
+    {
+        link = &(*link)->next;
+    }
+    packet->next = *link;
+    *link = packet;
+}
+
+/**
+ * @brief Send packets which were held back to the application, once they're due
+ */
+static void deliverDelayedPackets(void)
+{
+    int64_t tNowUs = esp_timer_get_time();
+    while((NULL != delayedPackets) && (delayedPackets->deliverUs <= tNowUs))
+    {
+        delayedPacket_t* packet = delayedPackets;
+        delayedPackets = packet->next;
+        numDelayedPackets--;
+        hostEspNowRecvCb(packet->mac, packet->data, packet->len, 0x7F);
+        free(packet);
     }
 }
 
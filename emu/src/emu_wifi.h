@@ -0,0 +1,23 @@
+#ifndef _EMU_WIFI_H_
+#define _EMU_WIFI_H_
+
+#include <stdint.h>
+
+/**
+ * How received ESP-NOW packets are impaired, to act like a radio link. All
+ * zero delivers every packet immediately
+ */
+typedef struct
+{
+    uint8_t lossPct;       ///< Chance that a packet is dropped, 0 to 100
+    uint8_t dupPct;        ///< Chance that a packet arrives twice, 0 to 100
+    uint8_t reorderPct;    ///< Chance that a packet is held back so later ones pass it, 0 to 100
+    uint32_t latencyUs;    ///< Time each packet takes to arrive
+    uint32_t jitterUs;     ///< Most random time added to each packet's latency
+    uint32_t bandwidthBps; ///< Bytes per second which can arrive, 0 for no limit
+    uint32_t seed;         ///< Seed for the random rolls, so runs can be repeated
+} emuWifiImpairment_t;
+
+void emuWifiSetImpairment(const emuWifiImpairment_t* impairment);
+
+#endif
@@ -0,0 +1,8 @@
+#ifndef _ESP_ATTR_H_
+#define _ESP_ATTR_H_
+
+// The emulator doesn't have separate instruction and data RAM
+#define IRAM_ATTR
+#define DRAM_ATTR
+
+#endif
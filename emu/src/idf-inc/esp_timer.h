@@ -29,6 +29,8 @@ struct esp_timer {
     uint64_t total_callback_run_time;
 #endif // WITH_PROFILING
     // LIST_ENTRY(esp_timer) list_entry;
+    int32_t heap_idx; //!< Where the timer is in the queue of running timers, -1 if stopped
+    int32_t all_idx;  //!< Where the timer is in the array of all timers
 };
 
 typedef struct esp_timer* esp_timer_handle_t;
@@ -65,6 +67,9 @@ esp_err_t esp_timer_stop(esp_timer_handle_t timer);
 esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout_us);
 esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t period);
 
+int64_t esp_timer_get_next_alarm(void);
+
 void check_esp_timer(uint64_t elapsed_us);
+int32_t count_esp_timers(void);
 
 #endif
\ No newline at end of file
@@ -150,8 +150,8 @@ typedef struct TU_ATTR_PACKED
   int8_t  rz;        ///< Delta Rz movement of right analog-joystick
 }hid_gamepad_ns_report_t;
 
-void tud_gamepad_report(hid_gamepad_report_t * report);
-void tud_gamepad_ns_report(hid_gamepad_ns_report_t * report);
+bool tud_gamepad_report(hid_gamepad_report_t * report);
+bool tud_gamepad_ns_report(hid_gamepad_ns_report_t * report);
 bool tud_ready(void);
 
 uint16_t tud_hid_get_report_cb(uint8_t itf, uint8_t report_id,
@@ -0,0 +1,174 @@
+//==============================================================================
+// Includes
+//==============================================================================
+
+#include <stddef.h>
+#include <string.h>
+
+#include "audio_analysis.h"
+
+//==============================================================================
+// Variables
+//==============================================================================
+
+/// The one DFT which is shared by everything that listens to the mic
+static dft32_data aaDft;
+/// The one note finder which is shared by everything that listens to the mic
+static embeddednf_data aaNotes;
+/// The number of samples pushed since the last analysis frame
+static uint32_t aaSamplesInFrame = 0;
+
+/// The current mode's callback, if it has one
+static audioAnalysisCb_t aaModeCb = NULL;
+/// Other callbacks, e.g. background LED effects
+static audioAnalysisCb_t aaSubscribers[MAX_AUDIO_ANALYSIS_SUBSCRIBERS] = {NULL};
+
+//==============================================================================
+// Functions
+//==============================================================================
+
+/**
+ * @brief Initialize the shared DFT and note finder. Subscribers are not cleared
+ */
+void initAudioAnalysis(void)
+{
+    InitColorChord(&aaNotes, &aaDft);
+    aaSamplesInFrame = 0;
+}
+
+/**
+ * @brief Set the current mode's callback. This is called by the system when a
+ * mode starts, modes should use fnAudioAnalysisCallback instead
+ *
+ * @param cb The mode's callback, may be NULL
+ */
+void audioAnalysisSetModeCb(audioAnalysisCb_t cb)
+{
+    aaModeCb = cb;
+}
+
+/**
+ * @brief Subscribe to analysis frames. This is for things which aren't the
+ * current mode. Subscribing doesn't start the mic. Frames are only published
+ * while the current mode has fnAudioCallback or fnAudioAnalysisCallback, which
+ * start it. The emulator always runs the mic
+ *
+ * @param cb The function to call with each analysis frame
+ * @return true if subscribed, false if there are too many subscribers
+ */
+bool audioAnalysisSubscribe(audioAnalysisCb_t cb)
+{
+    for(uint8_t i = 0; i < MAX_AUDIO_ANALYSIS_SUBSCRIBERS; i++)
+    {
+        if(cb == aaSubscribers[i])
+        {
+            return true;
+        }
+    }
+
+    for(uint8_t i = 0; i < MAX_AUDIO_ANALYSIS_SUBSCRIBERS; i++)
+    {
+        if(NULL == aaSubscribers[i])
+        {
+            aaSubscribers[i] = cb;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Stop calling a subscriber with analysis frames
+ *
+ * @param cb The function which was subscribed
+ */
+void audioAnalysisUnsubscribe(audioAnalysisCb_t cb)
+{
+    for(uint8_t i = 0; i < MAX_AUDIO_ANALYSIS_SUBSCRIBERS; i++)
+    {
+        if(cb == aaSubscribers[i])
+        {
+            aaSubscribers[i] = NULL;
+        }
+    }
+}
+
+/**
+ * @brief Check if anything wants analysis frames. If nothing does, samples
+ * don't need to be pushed at all
+ *
+ * @return true if the mode or any subscriber wants analysis frames
+ */
+bool audioAnalysisHasSubscribers(void)
+{
+    if(NULL != aaModeCb)
+    {
+        return true;
+    }
+
+    for(uint8_t i = 0; i < MAX_AUDIO_ANALYSIS_SUBSCRIBERS; i++)
+    {
+        if(NULL != aaSubscribers[i])
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Push filtered mic samples through the shared DFT. Every
+ * AUDIO_ANALYSIS_FRAME_SAMPLES samples, the note finder is run and the result
+ * is published to the mode and all subscribers
+ *
+ * @param samples The filtered samples, as read by the main loop
+ * @param sampleCnt The number of samples
+ */
+void audioAnalysisPushSamples(const uint16_t* samples, uint32_t sampleCnt)
+{
+    // Process samples in blocks which end at analysis frames
+    uint32_t idx = 0;
+    while(idx < sampleCnt)
+    {
+        uint32_t blockLen = AUDIO_ANALYSIS_FRAME_SAMPLES - aaSamplesInFrame;
+        if(blockLen > sampleCnt - idx)
+        {
+            blockLen = sampleCnt - idx;
+        }
+
+        PushSamples32(&aaDft, (const int16_t*)&samples[idx], blockLen);
+        idx += blockLen;
+
+        aaSamplesInFrame += blockLen;
+        if(aaSamplesInFrame >= AUDIO_ANALYSIS_FRAME_SAMPLES)
+        {
+            aaSamplesInFrame = 0;
+
+            // Run the note finder once, no matter how many listeners there are
+            HandleFrameInfo(&aaNotes, &aaDft);
+
+            if(NULL != aaModeCb)
+            {
+                aaModeCb(&aaNotes, &aaDft);
+            }
+
+            for(uint8_t i = 0; i < MAX_AUDIO_ANALYSIS_SUBSCRIBERS; i++)
+            {
+                if(NULL != aaSubscribers[i])
+                {
+                    aaSubscribers[i](&aaNotes, &aaDft);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Get the most recent note finder output, e.g. for drawing
+ *
+ * @return The note finder output
+ */
+const embeddednf_data* getAudioAnalysisNotes(void)
+{
+    return &aaNotes;
+}
@@ -0,0 +1,47 @@
+#ifndef _AUDIO_ANALYSIS_H_
+#define _AUDIO_ANALYSIS_H_
+
+//==============================================================================
+// Includes
+//==============================================================================
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "embeddednf.h"
+
+//==============================================================================
+// Defines
+//==============================================================================
+
+/// The number of samples between each analysis frame
+#define AUDIO_ANALYSIS_FRAME_SAMPLES 128
+
+/// The number of subscribers which may be registered at once, besides the mode
+#define MAX_AUDIO_ANALYSIS_SUBSCRIBERS 4
+
+//==============================================================================
+// Typedefs
+//==============================================================================
+
+/**
+ * A function which is called each time a new analysis frame is ready
+ *
+ * @param end The note finder output, including folded and fuzzed bins and notes
+ * @param dd The DFT state, including the raw embeddedbins32
+ */
+typedef void (*audioAnalysisCb_t)(const embeddednf_data* end, const dft32_data* dd);
+
+//==============================================================================
+// Functions
+//==============================================================================
+
+void initAudioAnalysis(void);
+void audioAnalysisSetModeCb(audioAnalysisCb_t cb);
+bool audioAnalysisSubscribe(audioAnalysisCb_t cb);
+void audioAnalysisUnsubscribe(audioAnalysisCb_t cb);
+bool audioAnalysisHasSubscribers(void);
+void audioAnalysisPushSamples(const uint16_t* samples, uint32_t sampleCnt);
+const embeddednf_data* getAudioAnalysisNotes(void);
+
+#endif
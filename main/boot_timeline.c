@@ -0,0 +1,94 @@
+//==============================================================================
+// Includes
+//==============================================================================
+
+#include <stddef.h>
+
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include "boot_timeline.h"
+
+//==============================================================================
+// Structs
+//==============================================================================
+
+typedef struct
+{
+    const char* name;
+    int64_t startUs;
+    int64_t endUs;
+} bootStep_t;
+
+//==============================================================================
+// Variables
+//==============================================================================
+
+/// Every step recorded since boot, in the order they were started
+static bootStep_t bootSteps[MAX_BOOT_TIMELINE_STEPS];
+/// The number of steps recorded. Steps may be started from multiple tasks
+static uint8_t numBootSteps = 0;
+
+//==============================================================================
+// Functions
+//==============================================================================
+
+/**
+ * @brief Record the start of a boot step. This may be called from any task
+ *
+ * @param name The name of the step, which must be a string literal
+ * @return The step to pass to bootTimelineEnd(), or BOOT_TIMELINE_FULL
+ */
+int8_t bootTimelineStart(const char* name)
+{
+    uint8_t step = __atomic_fetch_add(&numBootSteps, 1, __ATOMIC_RELAXED);
+    if(step >= MAX_BOOT_TIMELINE_STEPS)
+    {
+        return BOOT_TIMELINE_FULL;
+    }
+
+    bootSteps[step].name = name;
+    bootSteps[step].startUs = esp_timer_get_time();
+    bootSteps[step].endUs = 0;
+    return step;
+}
+
+/**
+ * @brief Record the end of a boot step
+ *
+ * @param step The step returned by bootTimelineStart()
+ */
+void bootTimelineEnd(int8_t step)
+{
+    if(BOOT_TIMELINE_FULL != step)
+    {
+        bootSteps[step].endUs = esp_timer_get_time();
+    }
+}
+
+/**
+ * @brief Log all recorded boot steps. Times are from when the chip started
+ */
+void bootTimelinePrint(void)
+{
+    uint8_t numSteps = numBootSteps;
+    if(numSteps > MAX_BOOT_TIMELINE_STEPS)
+    {
+        ESP_LOGW("BOOT", "%d steps not recorded", numSteps - MAX_BOOT_TIMELINE_STEPS);
+        numSteps = MAX_BOOT_TIMELINE_STEPS;
+    }
+
+    for(uint8_t i = 0; i < numSteps; i++)
+    {
+        const bootStep_t* bs = &bootSteps[i];
+        if(0 == bs->endUs)
+        {
+            ESP_LOGI("BOOT", "%-16s %8d us ... unfinished", bs->name, (int)bs->startUs);
+        }
+        else
+        {
+            ESP_LOGI("BOOT", "%-16s %8d us -> %8d us (%d us)", bs->name,
+                     (int)bs->startUs, (int)bs->endUs, (int)(bs->endUs - bs->startUs));
+        }
+    }
+}
@@ -0,0 +1,28 @@
+#ifndef _BOOT_TIMELINE_H_
+#define _BOOT_TIMELINE_H_
+
+//==============================================================================
+// Includes
+//==============================================================================
+
+#include <stdint.h>
+
+//==============================================================================
+// Defines
+//==============================================================================
+
+/// The most boot steps which may be recorded
+#define MAX_BOOT_TIMELINE_STEPS 24
+
+/// Returned by bootTimelineStart() when the timeline is full
+#define BOOT_TIMELINE_FULL -1
+
+//==============================================================================
+// Functions
+//==============================================================================
+
+int8_t bootTimelineStart(const char* name);
+void bootTimelineEnd(int8_t step);
+void bootTimelinePrint(void);
+
+#endif
@@ -256,6 +256,142 @@ static void HandleInt( dft32_data* dd, int16_t sample )
     }
 }
 
+/**
+ * @brief Apply a run of filtered samples to all of one octave's bins. Each bin
+ * is updated in the same order as HandleInt() would, but its state stays in
+ * registers for the whole run instead of being reloaded for every sample
+ *
+ * @param dd The DFT data
+ * @param oct The octave to update
+ * @param filtered The filtered samples for this octave, in order
+ * @param numFiltered The number of filtered samples
+ */
+static void UpdateOctave32( dft32_data* dd, int oct, const int16_t* filtered, int numFiltered )
+{
+    uint16_t* dsA = &dd->Sdatspace32A[oct * FIXBPERO * 2];
+    int32_t* dsB = &dd->Sdatspace32B[oct * FIXBPERO * 2];
+
+    for( int i = 0; i < FIXBPERO; i++ )
+    {
+        uint16_t adv = dsA[0];
+        uint16_t place = dsA[1];
+        int32_t isses = dsB[0];
+        int32_t icses = dsB[1];
+
+        for( int j = 0; j < numFiltered; j++ )
+        {
+            uint8_t localipl = place >> 8;
+            place += adv;
+
+            isses += (Ssinonlytable[localipl] * filtered[j]);
+            //Get the cosine (1/4 wavelength out-of-phase with sin)
+            localipl += 64;
+            icses += (Ssinonlytable[localipl] * filtered[j]);
+        }
+
+        dsA[1] = place;
+        dsB[0] = isses;
+        dsB[1] = icses;
+        dsA += 2;
+        dsB += 2;
+    }
+}
+
+/**
+ * @brief Latch all bins to the output and decay them. This is what HandleInt()
+ * does once every (1<<OCTAVES) times
+ *
+ * @param dd The DFT data
+ */
+static void DecayBins32( dft32_data* dd )
+{
+    int32_t* bins = &dd->Sdatspace32B[0];
+    int32_t* binsOut = &dd->Sdatspace32BOut[0];
+
+    for( int i = 0; i < FIXBINS * 2; i++ )
+    {
+        int32_t val = bins[i];
+        binsOut[i] = val;
+        bins[i] -= val >> DFTIIR;
+    }
+}
+
+/**
+ * @brief Push a block of samples. This has the same results as calling
+ * PushSample32() for each sample, but it is faster.
+ *
+ * Rather than adding every sample to every octave's accumulator, a running
+ * total is kept and each octave takes the difference since it was last
+ * processed. Filtered samples are buffered per octave until the next decay,
+ * which is the only point where octaves interact, then each octave's bins are
+ * updated in one tight loop.
+ *
+ * @param dd The DFT data
+ * @param samples The samples to push, -4095 to +4095
+ * @param numSamples The number of samples to push
+ */
+void PushSamples32( dft32_data* dd, const int16_t* samples, int numSamples )
+{
+    // At most one cycle of filtered samples is buffered, and the top octave
+    // gets the most, every other time
+    int16_t filtered[OCTAVES][BINCYCLE / 2];
+    int numFiltered[OCTAVES] = {0};
+
+    // Convert the accumulators to marks against a running total. Unsigned
+    // math makes wraparound harmless
+    uint32_t total = 0;
+    uint32_t marks[OCTAVES];
+    for( int i = 0; i < OCTAVES; i++ )
+    {
+        marks[i] = -(uint32_t)dd->Saccum_octavebins[i];
+    }
+
+    uint8_t whichoctaveplace = dd->Swhichoctaveplace;
+
+    for( int s = 0; s < numSamples; s++ )
+    {
+        int16_t sample = samples[s];
+
+        // Every sample is handled twice, just like PushSample32()
+        for( int r = 0; r < 2; r++ )
+        {
+            uint8_t oct = dd->Sdo_this_octave[whichoctaveplace];
+            whichoctaveplace = (whichoctaveplace + 1) & (BINCYCLE - 1);
+            total += sample;
+
+            if( oct > 128 )
+            {
+                // Catch up all the octaves before latching and decaying
+                for( int o = 0; o < OCTAVES; o++ )
+                {
+                    UpdateOctave32( dd, o, filtered[o], numFiltered[o] );
+                    numFiltered[o] = 0;
+                }
+                DecayBins32( dd );
+            }
+            else if( oct < OCTAVES )
+            {
+                // Only possible if the schedule wasn't set up
+                if( numFiltered[oct] == BINCYCLE / 2 )
+                {
+                    UpdateOctave32( dd, oct, filtered[oct], numFiltered[oct] );
+                    numFiltered[oct] = 0;
+                }
+                filtered[oct][numFiltered[oct]++] = (int32_t)(total - marks[oct]) >> (OCTAVES - oct);
+                marks[oct] = total;
+            }
+        }
+    }
+
+    // Apply whatever is left over and save the state
+    for( int o = 0; o < OCTAVES; o++ )
+    {
+        UpdateOctave32( dd, o, filtered[o], numFiltered[o] );
+        dd->Saccum_octavebins[o] = (int32_t)(total - marks[o]);
+    }
+    dd->Swhichoctaveplace = whichoctaveplace;
+}
+
 /**
  * @brief TODO
  *
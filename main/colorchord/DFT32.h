@@ -100,6 +100,11 @@ void UpdateBins32(dft32_data* dd, const uint16_t* frequencies );
 //Any more and you will exceed the accumulators and it will cause an overflow.
 void PushSample32(dft32_data* dd, int16_t dat );
 
+//Call this to push a whole block of sound at once, e.g. an ADC buffer.
+//This is faster than calling PushSample32() for each sample, and has the
+//same result.
+void PushSamples32(dft32_data* dd, const int16_t* samples, int numSamples );
+
 #ifndef CCEMBEDDED
     //ColorChord regular uses this to pass in floats.
     void UpdateBinsForDFT32( dft32_data* dd, const float* frequencies );   //Update the frequencies
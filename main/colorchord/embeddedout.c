@@ -17,7 +17,7 @@
  * @param eod
  * @param end
  */
-void UpdateLinearLEDs(embeddedout_data* eod, embeddednf_data* end)
+void UpdateLinearLEDs(embeddedout_data* eod, const embeddednf_data* end)
 {
     //Source material:
     /*
@@ -265,7 +265,7 @@ void UpdateLinearLEDs(embeddedout_data* eod, embeddednf_data* end)
  * @param eod
  * @param end
  */
-void UpdateAllSameLEDs(embeddedout_data* eod, embeddednf_data* end)
+void UpdateAllSameLEDs(embeddedout_data* eod, const embeddednf_data* end)
 {
     int i;
     uint8_t freq = 0;
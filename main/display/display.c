@@ -19,6 +19,10 @@
 
 #define CLAMP(x,l,u) ((x) < l ? l : ((x) > u ? u : (x)))
 
+// Must match spiffs_file_preprocessor's atlas_processor.c
+#define ATLAS_MAGIC   "ATL"
+#define ATLAS_VERSION 1
+
 //==============================================================================
 // Constant data
 //==============================================================================
@@ -155,6 +159,58 @@ void fillDisplayArea(display_t* disp, int16_t x1, int16_t y1, int16_t x2,
     }
 }
 
+/**
+ * @brief Read a heatshrink compressed file, like a WSG, from ROM and decompress
+ * it. The file starts with its four byte decompressed size
+ *
+ * @param name The filename to read
+ * @param decompressedSize Written with the size of the decompressed data
+ * @param spiRam true to decompress to SPI RAM, false to decompress to normal RAM
+ * @return The decompressed data which must be freed, or NULL if the file
+ *         couldn't be read
+ */
+static uint8_t* readCompressedFile(char* name, uint32_t* decompressedSize, bool spiRam)
+{
+    // Read the file
+    uint8_t* buf = NULL;
+    size_t sz;
+    if(!spiffsReadFile(name, &buf, &sz, true))
+    {
+        return NULL;
+    }
+
+    // Pick out the decompresed size and create a space for it
+    if(sz < 4)
+    {
+        free(buf);
+        return NULL;
+    }
+    *decompressedSize = (buf[0] << 24) | (buf[1] << 16) | (buf[2] << 8) | (buf[3]);
+    uint8_t* decompressedBuf;
+    if(spiRam)
+    {
+        decompressedBuf = (uint8_t*)heap_caps_malloc(*decompressedSize, MALLOC_CAP_SPIRAM);
+    }
+    else
+    {
+        decompressedBuf = (uint8_t*)malloc(*decompressedSize);
+    }
+    if(NULL == decompressedBuf)
+    {
+        free(buf);
+        return NULL;
+    }
+
+    // The whole file is in RAM, so decode it in one go
+    size_t outputSize = 0;
+    heatshrink_decode_buffer(&buf[4], sz - 4, decompressedBuf, *decompressedSize, &outputSize, 8, 4);
+    // Free the bytes read from the file
+    free(buf);
+
+    *decompressedSize = outputSize;
+    return decompressedBuf;
+}
+
 /**
  * @brief Load a WSG from ROM to RAM. WSGs placed in the spiffs_image folder
  * before compilation will be automatically flashed to ROM
@@ -181,54 +237,15 @@ bool loadWsg(char* name, wsg_t* wsg)
  */
 bool loadWsgSpiRam(char* name, wsg_t* wsg, bool spiRam)
 {
-    // Read WSG from file
-    uint8_t* buf = NULL;
-    size_t sz;
-    if(!spiffsReadFile(name, &buf, &sz, true))
+    // Read and decompress the WSG
+    uint32_t decompressedSize;
+    uint8_t* decompressedBuf = readCompressedFile(name, &decompressedSize, true);
+    if(NULL == decompressedBuf)
     {
         ESP_LOGE("WSG", "Failed to read %s", name);
         return false;
     }
 
-    // Pick out the decompresed size and create a space for it
-    uint32_t decompressedSize = (buf[0] << 24) | (buf[1] << 16) | (buf[2] << 8) | (buf[3]);
-    uint8_t * decompressedBuf = (uint8_t *)heap_caps_malloc(decompressedSize, MALLOC_CAP_SPIRAM);
-
-    // Create the decoder
-    size_t copied = 0;
-    heatshrink_decoder* hsd = heatshrink_decoder_alloc(256, 8, 4);
-    heatshrink_decoder_reset(hsd);
-
-    // Decode the file in chunks
-    uint32_t inputIdx = 0;
-    uint32_t outputIdx = 0;
-    while(inputIdx < (sz - 4))
-    {
-        // Decode some data
-        copied = 0;
-        heatshrink_decoder_sink(hsd, &buf[4 + inputIdx], sz - 4 - inputIdx, &copied);
-        inputIdx += copied;
-
-        // Save it to the output array
-        copied = 0;
-        heatshrink_decoder_poll(hsd, &decompressedBuf[outputIdx], decompressedSize - outputIdx, &copied);
-        outputIdx += copied;
-    }
-
-    // Note that it's all done
-    heatshrink_decoder_finish(hsd);
-
-    // Flush any final output
-    copied = 0;
-    heatshrink_decoder_poll(hsd, &decompressedBuf[outputIdx], decompressedSize - outputIdx, &copied);
-    outputIdx += copied;
-
-    // All done decoding
-    heatshrink_decoder_finish(hsd);
-    heatshrink_decoder_free(hsd);
-    // Free the bytes read from the file
-    free(buf);
-
     // Save the decompressed info to the wsg. The first four bytes are dimension
     wsg->w = (decompressedBuf[0] << 8) | decompressedBuf[1];
     wsg->h = (decompressedBuf[2] << 8) | decompressedBuf[3];
@@ -244,7 +261,7 @@ bool loadWsgSpiRam(char* name, wsg_t* wsg, bool spiRam)
 
     if(NULL != wsg->px)
     {
-        memcpy(wsg->px, &decompressedBuf[4], outputIdx - 4);
+        memcpy(wsg->px, &decompressedBuf[4], decompressedSize - 4);
         free(decompressedBuf);
         return true;
     }
@@ -264,6 +281,200 @@ void freeWsg(wsg_t* wsg)
     free(wsg->px);
 }
 
+/**
+ * @brief Load an atlas of WSGs from ROM to RAM. A directory of PNGs named
+ * "name.atlas" in the assets folder is packed into "name.atl" before
+ * compilation. The whole atlas is one file read, one decoder and one
+ * allocation for pixels, rather than one of each per WSG
+ *
+ * @param name The filename of the atlas to load
+ * @param atlas A handle to load the atlas to
+ * @param spiRam true to load to SPI RAM, false to load to normal RAM
+ * @return true if the atlas was loaded successfully,
+ *         false if the atlas load failed and should not be used
+ */
+bool loadWsgAtlas(char* name, wsgAtlas_t* atlas, bool spiRam)
+{
+    memset(atlas, 0, sizeof(wsgAtlas_t));
+
+    // Read and decompress the atlas
+    uint32_t size;
+    uint8_t* data = readCompressedFile(name, &size, spiRam);
+    if(NULL == data)
+    {
+        ESP_LOGE("WSG", "Failed to read %s", name);
+        return false;
+    }
+
+    if(size < 6 || 0 != memcmp(data, ATLAS_MAGIC, 3) || ATLAS_VERSION != data[3])
+    {
+        ESP_LOGE("WSG", "%s is not an atlas", name);
+        free(data);
+        return false;
+    }
+
+    uint16_t numRegions = (data[4] << 8) | data[5];
+    wsgAtlasRegion_t* regions = calloc(numRegions, sizeof(wsgAtlasRegion_t));
+    if(NULL == regions)
+    {
+        free(data);
+        return false;
+    }
+
+    // Each region's name and size are in a table, the pixels follow it in the same order
+    uint32_t tIdx = 6;
+    for(uint16_t i = 0; i < numRegions; i++)
+    {
+        regions[i].name = (const char*)&data[tIdx];
+        while(tIdx < size && 0 != data[tIdx])
+        {
+            tIdx++;
+        }
+        tIdx++;
+        if(tIdx + 4 > size)
+        {
+            // Caught by the check below
+            tIdx = size + 1;
+            break;
+        }
+        regions[i].wsg.w = (data[tIdx] << 8) | data[tIdx + 1];
+        regions[i].wsg.h = (data[tIdx + 2] << 8) | data[tIdx + 3];
+        tIdx += 4;
+    }
+
+    uint32_t pIdx = tIdx;
+    for(uint16_t i = 0; i < numRegions; i++)
+    {
+        regions[i].wsg.px = (paletteColor_t*)&data[pIdx];
+        pIdx += regions[i].wsg.w * regions[i].wsg.h;
+    }
+
+    // Make sure nothing points past the end of the atlas
+    if(tIdx > size || pIdx > size)
+    {
+        ESP_LOGE("WSG", "%s is truncated", name);
+        free(regions);
+        free(data);
+        return false;
+    }
+
+    atlas->data = data;
+    atlas->regions = regions;
+    atlas->numRegions = numRegions;
+    return true;
+}
+
+/**
+ * @brief Free the memory for a loaded atlas. Any WSG from the atlas, including
+ * copies of them, must not be used afterwards
+ *
+ * @param atlas The atlas to free memory from
+ */
+void freeWsgAtlas(wsgAtlas_t* atlas)
+{
+    free(atlas->regions);
+    free(atlas->data);
+    memset(atlas, 0, sizeof(wsgAtlas_t));
+}
+
+/**
+ * @brief Find the index of a WSG in an atlas. Looking up indices once is faster
+ * than drawing by name.
+ *
+ * This binary searches with strcmp(), so it relies on spiffs_file_preprocessor
+ * sorting the regions by strcmp() on their names, without ".png". Changing
+ * either side's ordering breaks lookups by name
+ *
+ * @param atlas The atlas to search
+ * @param name The name of the WSG, its PNG's filename without ".png"
+ * @return The index of the WSG, or -1 if it isn't in the atlas
+ */
+int32_t getAtlasIndex(const wsgAtlas_t* atlas, const char* name)
+{
+    // Regions are sorted by strcmp() of their names, see atlas_processor.c
+    int32_t lo = 0;
+    int32_t hi = (int32_t)atlas->numRegions - 1;
+    while(lo <= hi)
+    {
+        int32_t mid = (lo + hi) / 2;
+        int cmp = strcmp(name, atlas->regions[mid].name);
+        if(0 == cmp)
+        {
+            return mid;
+        }
+        else if(cmp < 0)
+        {
+            hi = mid - 1;
+        }
+        else
+        {
+            lo = mid + 1;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Get a WSG from an atlas by name. The WSG may be copied, but its pixels
+ * belong to the atlas
+ *
+ * @param atlas The atlas to search
+ * @param name The name of the WSG, its PNG's filename without ".png"
+ * @return The WSG, or NULL if it isn't in the atlas
+ */
+const wsg_t* getAtlasWsg(const wsgAtlas_t* atlas, const char* name)
+{
+    int32_t idx = getAtlasIndex(atlas, name);
+    if(idx < 0)
+    {
+        return NULL;
+    }
+    return &atlas->regions[idx].wsg;
+}
+
+/**
+ * @brief Draw a WSG from an atlas to the display
+ *
+ * @param disp The display to draw the WSG to
+ * @param atlas The atlas the WSG is in
+ * @param idx The index of the WSG in the atlas, from getAtlasIndex()
+ * @param xOff The x offset to draw the WSG at
+ * @param yOff The y offset to draw the WSG at
+ * @param flipLR true to flip the image across the Y axis
+ * @param flipUD true to flip the image across the X axis
+ * @param rotateDeg The number of degrees to rotate clockwise, must be 0-359
+ */
+void drawAtlasWsg(display_t* disp, const wsgAtlas_t* atlas, uint16_t idx, int16_t xOff, int16_t yOff,
+                  bool flipLR, bool flipUD, int16_t rotateDeg)
+{
+    if(idx < atlas->numRegions)
+    {
+        drawWsg(disp, &atlas->regions[idx].wsg, xOff, yOff, flipLR, flipUD, rotateDeg);
+    }
+}
+
+/**
+ * @brief Draw a WSG from an atlas to the display, looking it up by name
+ *
+ * @param disp The display to draw the WSG to
+ * @param atlas The atlas the WSG is in
+ * @param name The name of the WSG, its PNG's filename without ".png"
+ * @param xOff The x offset to draw the WSG at
+ * @param yOff The y offset to draw the WSG at
+ * @param flipLR true to flip the image across the Y axis
+ * @param flipUD true to flip the image across the X axis
+ * @param rotateDeg The number of degrees to rotate clockwise, must be 0-359
+ */
+void drawAtlasWsgNamed(display_t* disp, const wsgAtlas_t* atlas, const char* name, int16_t xOff, int16_t yOff,
+                       bool flipLR, bool flipUD, int16_t rotateDeg)
+{
+    const wsg_t* wsg = getAtlasWsg(atlas, name);
+    if(NULL != wsg)
+    {
+        drawWsg(disp, wsg, xOff, yOff, flipLR, flipUD, rotateDeg);
+    }
+}
+
 /**
  * Transform a pixel's coordinates by rotation around the sprite's center point,
  * then reflection over Y axis, then reflection over X axis, then translation
@@ -61,6 +61,25 @@ typedef struct
     uint16_t h;
 } wsg_t;
 
+/**
+ * @brief One WSG in an atlas
+ */
+typedef struct
+{
+    const char* name; ///< The filename of the WSG's PNG without ".png"
+    wsg_t wsg;        ///< The WSG, its pixels belong to the atlas
+} wsgAtlasRegion_t;
+
+/**
+ * @brief A group of WSGs which are loaded from one file, see loadWsgAtlas()
+ */
+typedef struct
+{
+    uint8_t* data;              ///< The decompressed atlas, all of the names and pixels
+    wsgAtlasRegion_t* regions;  ///< The WSGs, in alphabetical order of name
+    uint16_t numRegions;        ///< The number of WSGs
+} wsgAtlas_t;
+
 struct display;
 
 typedef void (*fnBackgroundDrawCallback_t)(struct display* disp, int16_t x, int16_t y, int16_t w, int16_t h, int16_t up,
@@ -112,6 +131,15 @@ void drawWsgSimpleFast(display_t* disp, const wsg_t* wsg, int16_t xOff, int16_t
 void drawWsgTile(display_t* disp, const wsg_t* wsg, int32_t xOff, int32_t yOff);
 void freeWsg(wsg_t* wsg);
 
+bool loadWsgAtlas(char* name, wsgAtlas_t* atlas, bool spiRam);
+void freeWsgAtlas(wsgAtlas_t* atlas);
+int32_t getAtlasIndex(const wsgAtlas_t* atlas, const char* name);
+const wsg_t* getAtlasWsg(const wsgAtlas_t* atlas, const char* name);
+void drawAtlasWsg(display_t* disp, const wsgAtlas_t* atlas, uint16_t idx, int16_t xOff, int16_t yOff,
+                  bool flipLR, bool flipUD, int16_t rotateDeg);
+void drawAtlasWsgNamed(display_t* disp, const wsgAtlas_t* atlas, const char* name, int16_t xOff, int16_t yOff,
+                       bool flipLR, bool flipUD, int16_t rotateDeg);
+
 bool loadFont(const char* name, font_t* font);
 void drawChar(display_t* disp, paletteColor_t color, int h, const font_ch_t* ch,
               int16_t xOff, int16_t yOff);
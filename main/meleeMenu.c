@@ -6,6 +6,8 @@
 #include <string.h>
 #include <math.h>
 
+#include "esp_heap_caps.h"
+
 #include "led_util.h"
 #include "swadgeMode.h"
 
@@ -66,6 +68,12 @@ static void drawMeleeMenuText(display_t* d, font_t* font, const char* text,
                               int16_t xPos, int16_t yPos, bool isSelected);
 
 uint8_t maybeGrowRowsArray(meleeMenu_t* menu, size_t originalCount, size_t additionalCount);
+static void drawBackgroundGridRows(display_t* d, int16_t yMin, int16_t yMax);
+static display_t* getMeleeMenuSurface(display_t* d, meleeMenu_t* menu, display_t* surfaceDisp);
+static void drawMeleeMenuFrame(display_t* d, meleeMenu_t* menu, int16_t yMin, int16_t yMax);
+static void fillMeleeMenuBorder(display_t* d, int16_t yMin, int16_t yMax,
+                                int16_t x1, int16_t y1, int16_t x2, int16_t y2, paletteColor_t c);
+static bool meleeMenuLabelChanged(meleeMenu_t* menu, uint16_t slot, const char* label);
 
 //==============================================================================
 // Functions
@@ -119,6 +127,7 @@ void resetMeleeMenu(meleeMenu_t* menu, const char* title, meleeMenuCb cbFunc)
     menu->lastSelectedRow = 0;
     menu->cbFunc = cbFunc;
     memset(menu->rows, 0,  menu->numRowsAllocated * sizeof(const char*));
+    menu->surfaceValid = false;
 }
 
 /**
@@ -128,6 +137,10 @@ void resetMeleeMenu(meleeMenu_t* menu, const char* title, meleeMenuCb cbFunc)
  */
 void deinitMeleeMenu(meleeMenu_t* menu)
 {
+    if(NULL != menu->surface)
+    {
+        heap_caps_free(menu->surface);
+    }
     free(menu->rows);
     free(menu);
 }
@@ -254,18 +267,41 @@ void meleeMenuButton(meleeMenu_t* menu, buttonBit_t btn)
  */
 void drawBackgroundGrid(display_t * d)
 {
-    // Draw a dim blue background with a grey grid
-    for(int16_t y = 0; y < d->h; y++)
+    drawBackgroundGridRows(d, 0, d->h);
+}
+
+/**
+ * @brief Draw a band of rows of the background grid
+ *
+ * @param d The display to draw to
+ * @param yMin The first row to draw
+ * @param yMax The row after the last row to draw
+ */
+static void drawBackgroundGridRows(display_t* d, int16_t yMin, int16_t yMax)
+{
+    if(yMin < 0)
+    {
+        yMin = 0;
+    }
+    if(yMax > d->h)
     {
-        for(int16_t x = 0; x < d->w; x++)
+        yMax = d->h;
+    }
+
+    // Draw a dim blue background with a grey grid, a row at a time
+    for(int16_t y = yMin; y < yMax; y++)
+    {
+        paletteColor_t* row = &d->pxFb[y * d->w];
+        if(0 == (y % 12))
         {
-            if(((x % 12) == 0) || ((y % 12) == 0))
-            {
-                SET_PIXEL(d, x, y, c111); // Grid
-            }
-            else
+            memset(row, c111, d->w * sizeof(paletteColor_t)); // Grid
+        }
+        else
+        {
+            memset(row, c001, d->w * sizeof(paletteColor_t)); // Background
+            for(int16_t x = 0; x < d->w; x += 12)
             {
-                SET_PIXEL(d, x, y, c001); // Background
+                row[x] = c111; // Grid
             }
         }
     }
@@ -274,13 +310,16 @@ void drawBackgroundGrid(display_t * d)
 /**
  * Draw a melee menu to a display. This overwrites the entire framebuffer.
  *
+ * The menu is kept in a retained surface between frames and copied to the
+ * framebuffer each frame. The background, borders, title and arrows are only
+ * drawn again when the selection, title, or rows change, or while the menu is
+ * animating. Otherwise only rows whose labels changed are drawn again.
+ *
  * @param d    The display to draw to
  * @param menu The menu to draw
  */
 void drawMeleeMenu(display_t* d, meleeMenu_t* menu)
 {
-    drawBackgroundGrid(d);
-
     // The width of the border
 #define BORDER_WIDTH 7
     // The gap between display edge and border
@@ -304,43 +343,6 @@ void drawMeleeMenu(display_t* d, meleeMenu_t* menu)
     // The maximum speed at which the menu will animate
 #define ANIM_MAXSPEED 30
 
-    // Draw the title and note where it ends
-    int16_t textEnd = drawText(d, menu->font, c222, menu->title, BORDER_GAP + 1 + TITLE_X_GAP, BORDER_GAP + 1);
-    textEnd += TITLE_X_GAP;
-
-    paletteColor_t borderColor = borderColors[menu->selectedRow % NUM_ROW_COLORS_AND_OFFSETS];
-
-    // Draw a border, on the right
-    fillDisplayArea(d,
-                    BORDER_GAP,                BORDER_GAP + menu->font->h + TEXT_Y_GAP + 1,
-                    BORDER_GAP + BORDER_WIDTH, d->h - BORDER_GAP,
-                    borderColor);
-    // Then the left
-    fillDisplayArea(d,
-                    d->w - BORDER_GAP - BORDER_WIDTH, BORDER_GAP,
-                    d->w - BORDER_GAP,                d->h - BORDER_GAP,
-                    borderColor);
-    // At the bottom
-    fillDisplayArea(d,
-                    BORDER_GAP,        d->h - BORDER_GAP - BORDER_WIDTH,
-                    d->w - BORDER_GAP, d->h - BORDER_GAP,
-                    borderColor);
-    // Right of title
-    fillDisplayArea(d,
-                    textEnd,                BORDER_GAP,
-                    textEnd + BORDER_WIDTH, BORDER_GAP + menu->font->h + TEXT_Y_GAP + 1,
-                    borderColor);
-    // Below title
-    fillDisplayArea(d,
-                    BORDER_GAP,             BORDER_GAP + menu->font->h + TEXT_Y_GAP + 1,
-                    textEnd + BORDER_WIDTH, BORDER_GAP + menu->font->h + TEXT_Y_GAP + 1 + BORDER_WIDTH,
-                    borderColor);
-    // Top right of the title
-    fillDisplayArea(d,
-                    textEnd,           BORDER_GAP,
-                    d->w - BORDER_GAP, BORDER_GAP + BORDER_WIDTH,
-                    borderColor);
-
     uint8_t startRow = menu->firstRowOnScreen;
     uint8_t endRow = menu->firstRowOnScreen + (menu->enableScrolling ? MAX_ROWS_ON_SCROLLABLE_SCREEN : MAX_ROWS_ON_SCREEN);
     int16_t yIdx = FIRST_ITEM_Y;
@@ -404,7 +406,30 @@ void drawMeleeMenu(display_t* d, meleeMenu_t* menu)
             menu->animateSpeed = 0;
             menu->animateOffset = 0;
         }
+    } // if(menu->enableScrolling)
+
+    // Animation moves everything, so it can't be drawn over the last frame
+    bool animatedThisFrame = menu->animating;
+
+    // Draw to the retained surface, or straight to the display if there isn't one
+    display_t surfaceDisp;
+    display_t* sd = getMeleeMenuSurface(d, menu, &surfaceDisp);
+
+    // The border color follows the selection, so a new selection is drawn
+    // from scratch, like new rows, a new title, or a new scroll position
+    bool redrawAll = (sd == d) || !menu->surfaceValid || animatedThisFrame ||
+                     (menu->surfaceTitle != menu->title) ||
+                     (menu->surfaceSelectedRow != menu->selectedRow) ||
+                     (menu->surfaceFirstRow != startRow) ||
+                     (menu->surfaceNumRows != menu->numRows);
+    if(redrawAll)
+    {
+        drawMeleeMenuFrame(sd, menu, 0, sd->h);
+        menu->surfaceLabelsValid = 0;
+    }
 
+    if(menu->enableScrolling && redrawAll)
+    {
         // Draw up arrow
         if(!menu->animating)
         {
@@ -418,12 +443,12 @@ void drawMeleeMenu(display_t* d, meleeMenu_t* menu)
             {
                 int16_t arrowFlatSideY = yIdx - TEXT_Y_GAP - 3;
                 int16_t arrowPointY = arrowFlatSideY - ARROW_HEIGHT + 1; //= round(arrowFlatSideY - (ARROW_WIDTH * sqrt(3.0f)) / 2.0f);
-                plotLine(d, arrowFlatSideX1, arrowFlatSideY, arrowFlatSideX2, arrowFlatSideY, boundaryColor, 0);
-                plotLine(d, arrowFlatSideX1, arrowFlatSideY - 1, arrowPointX, arrowPointY, boundaryColor, 0);
-                plotLine(d, arrowFlatSideX2, arrowFlatSideY - 1, arrowPointX, arrowPointY, boundaryColor, 0);
+                plotLine(sd, arrowFlatSideX1, arrowFlatSideY, arrowFlatSideX2, arrowFlatSideY, boundaryColor, 0);
+                plotLine(sd, arrowFlatSideX1, arrowFlatSideY - 1, arrowPointX, arrowPointY, boundaryColor, 0);
+                plotLine(sd, arrowFlatSideX2, arrowFlatSideY - 1, arrowPointX, arrowPointY, boundaryColor, 0);
 
                 // Fill the arrow shape
-                oddEvenFill(d,
+                oddEvenFill(sd,
                             arrowFlatSideX1, arrowPointY,
                             arrowFlatSideX2 + 1, arrowFlatSideY,
                             boundaryColor, unselectedFillColor);
@@ -436,13 +461,13 @@ void drawMeleeMenu(display_t* d, meleeMenu_t* menu)
                     if(menu->numRows > MAX_ROWS_ON_SCROLLABLE_SCREEN)
 #endif
                     {
-                        plotLine(d, arrowBarX1, arrowPointY + ARROW_BAR_INSET - 1, arrowBarX2, arrowPointY + ARROW_BAR_INSET - 1, boundaryColor, 0);
-                        plotLine(d, arrowBarX1, arrowPointY + ARROW_BAR_INSET - 2, arrowBarX2, arrowPointY + ARROW_BAR_INSET - 2, boundaryColor, 0);
-                        plotLine(d, arrowBarX1, arrowPointY + ARROW_BAR_INSET - 3, arrowBarX2, arrowPointY + ARROW_BAR_INSET - 3, boundaryColor, 0);
+                        plotLine(sd, arrowBarX1, arrowPointY + ARROW_BAR_INSET - 1, arrowBarX2, arrowPointY + ARROW_BAR_INSET - 1, boundaryColor, 0);
+                        plotLine(sd, arrowBarX1, arrowPointY + ARROW_BAR_INSET - 2, arrowBarX2, arrowPointY + ARROW_BAR_INSET - 2, boundaryColor, 0);
+                        plotLine(sd, arrowBarX1, arrowPointY + ARROW_BAR_INSET - 3, arrowBarX2, arrowPointY + ARROW_BAR_INSET - 3, boundaryColor, 0);
 
-                        plotLine(d, arrowBarX1 + 1, arrowPointY + ARROW_BAR_INSET - 2, arrowBarX2 - 1, arrowPointY + ARROW_BAR_INSET - 2, unselectedFillColor, 0);
+                        plotLine(sd, arrowBarX1 + 1, arrowPointY + ARROW_BAR_INSET - 2, arrowBarX2 - 1, arrowPointY + ARROW_BAR_INSET - 2, unselectedFillColor, 0);
 #if ARROW_BAR_INSET >= 2
-                        plotLine(d, arrowPointX - ARROW_BAR_INSET + 2, arrowPointY + ARROW_BAR_INSET - 1, arrowPointX + ARROW_BAR_INSET - 2, arrowPointY + ARROW_BAR_INSET - 1, unselectedFillColor, 0);
+                        plotLine(sd, arrowPointX - ARROW_BAR_INSET + 2, arrowPointY + ARROW_BAR_INSET - 1, arrowPointX + ARROW_BAR_INSET - 2, arrowPointY + ARROW_BAR_INSET - 1, unselectedFillColor, 0);
 #endif
                     } // if(menu->numRows > MAX_ROWS_ON_SCROLLABLE_SCREEN)
                 } // if(menu->firstRowOnScreen == 0)
@@ -519,7 +544,7 @@ void drawMeleeMenu(display_t* d, meleeMenu_t* menu)
                 if (endRow < menu->numRows)
                 {
                     // draw an extra menu item at the bottom of the screen (at endRow)
-                    drawMeleeMenuText(d, menu->font, menu->rows[endRow],
+                    drawMeleeMenuText(sd, menu->font, menu->rows[endRow],
                                     menu->usePerRowXOffsets ? rowOffsets[(endRow) % NUM_ROW_COLORS_AND_OFFSETS] : MIN_ROW_OFFSET,
                                     bottomOffset + rowGap + menu->animateOffset * 2,
                                     //yIdx + (rowGap) * (endRow - startRow),// + (rowGap + menu->animateOffset) * 2,
@@ -529,7 +554,7 @@ void drawMeleeMenu(display_t* d, meleeMenu_t* menu)
                 if (startRow > 0)
                 {
                     // draw an extra menu item at the top of the screen (before startRow)
-                    drawMeleeMenuText(d, menu->font, menu->rows[startRow - 1],
+                    drawMeleeMenuText(sd, menu->font, menu->rows[startRow - 1],
                                     menu->usePerRowXOffsets ? rowOffsets[(startRow - 1) % NUM_ROW_COLORS_AND_OFFSETS] : MIN_ROW_OFFSET,
                                     topOffset + 3 * (menu->animateOffset - rowGap),
                                     (startRow - 1 == menu->selectedRow));
@@ -541,15 +566,26 @@ void drawMeleeMenu(display_t* d, meleeMenu_t* menu)
     // Draw the entries
     for(uint16_t row = startRow; row < menu->numRows && row < endRow; row++)
     {
-        drawMeleeMenuText(d, menu->font, menu->rows[row],
-                          menu->usePerRowXOffsets ? rowOffsets[row % NUM_ROW_COLORS_AND_OFFSETS] : MIN_ROW_OFFSET,
-                          yIdx + menu->animateOffset,
-                          (row == menu->selectedRow));
+        // Labels are remembered by their position on screen
+        bool labelChanged = meleeMenuLabelChanged(menu, row - startRow, menu->rows[row]);
+        if(redrawAll || labelChanged)
+        {
+            if(!redrawAll)
+            {
+                // Put back what was under the old label
+                drawMeleeMenuFrame(sd, menu, yIdx - TEXT_Y_GAP - 1, yIdx - TEXT_Y_GAP - 1 + rowGap);
+            }
+
+            drawMeleeMenuText(sd, menu->font, menu->rows[row],
+                              menu->usePerRowXOffsets ? rowOffsets[row % NUM_ROW_COLORS_AND_OFFSETS] : MIN_ROW_OFFSET,
+                              yIdx + menu->animateOffset,
+                              (row == menu->selectedRow));
+        }
 
         yIdx += rowGap;
     }
 
-    if(menu->enableScrolling)
+    if(menu->enableScrolling && redrawAll)
     {
         // Draw down arrow
         if(!menu->animating)
@@ -564,12 +600,12 @@ void drawMeleeMenu(display_t* d, meleeMenu_t* menu)
             {
                 int16_t arrowFlatSideY = yIdx - TEXT_Y_GAP - 1 + bottomArrowBump;
                 int16_t arrowPointY = arrowFlatSideY + ARROW_HEIGHT - 1; //round(arrowFlatSideY + (ARROW_WIDTH * sqrt(3.0f)) / 2.0f);
-                plotLine(d, arrowFlatSideX1, arrowFlatSideY, arrowFlatSideX2, arrowFlatSideY, boundaryColor, 0);
-                plotLine(d, arrowFlatSideX1, arrowFlatSideY + 1, arrowPointX, arrowPointY, boundaryColor, 0);
-                plotLine(d, arrowFlatSideX2, arrowFlatSideY + 1, arrowPointX, arrowPointY, boundaryColor, 0);
+                plotLine(sd, arrowFlatSideX1, arrowFlatSideY, arrowFlatSideX2, arrowFlatSideY, boundaryColor, 0);
+                plotLine(sd, arrowFlatSideX1, arrowFlatSideY + 1, arrowPointX, arrowPointY, boundaryColor, 0);
+                plotLine(sd, arrowFlatSideX2, arrowFlatSideY + 1, arrowPointX, arrowPointY, boundaryColor, 0);
 
                 // Fill the arrow shape
-                oddEvenFill(d,
+                oddEvenFill(sd,
                             arrowFlatSideX1, arrowFlatSideY + 1,
                             arrowFlatSideX2 + 1, arrowPointY,
                             boundaryColor, unselectedFillColor);
@@ -582,13 +618,13 @@ void drawMeleeMenu(display_t* d, meleeMenu_t* menu)
                     if(menu->numRows > MAX_ROWS_ON_SCROLLABLE_SCREEN)
 #endif
                     {
-                        plotLine(d, arrowBarX1, arrowPointY - ARROW_BAR_INSET + 1, arrowBarX2, arrowPointY - ARROW_BAR_INSET + 1, boundaryColor, 0);
-                        plotLine(d, arrowBarX1, arrowPointY - ARROW_BAR_INSET + 2, arrowBarX2, arrowPointY - ARROW_BAR_INSET + 2, boundaryColor, 0);
-                        plotLine(d, arrowBarX1, arrowPointY - ARROW_BAR_INSET + 3, arrowBarX2, arrowPointY - ARROW_BAR_INSET + 3, boundaryColor, 0);
+                        plotLine(sd, arrowBarX1, arrowPointY - ARROW_BAR_INSET + 1, arrowBarX2, arrowPointY - ARROW_BAR_INSET + 1, boundaryColor, 0);
+                        plotLine(sd, arrowBarX1, arrowPointY - ARROW_BAR_INSET + 2, arrowBarX2, arrowPointY - ARROW_BAR_INSET + 2, boundaryColor, 0);
+                        plotLine(sd, arrowBarX1, arrowPointY - ARROW_BAR_INSET + 3, arrowBarX2, arrowPointY - ARROW_BAR_INSET + 3, boundaryColor, 0);
 
-                        plotLine(d, arrowBarX1 + 1, arrowPointY - ARROW_BAR_INSET + 2, arrowBarX2 - 1, arrowPointY - ARROW_BAR_INSET + 2, unselectedFillColor, 0);
+                        plotLine(sd, arrowBarX1 + 1, arrowPointY - ARROW_BAR_INSET + 2, arrowBarX2 - 1, arrowPointY - ARROW_BAR_INSET + 2, unselectedFillColor, 0);
 #if ARROW_BAR_INSET >= 2
-                        plotLine(d, arrowPointX - ARROW_BAR_INSET + 2, arrowPointY - ARROW_BAR_INSET + 1, arrowPointX + ARROW_BAR_INSET - 2, arrowPointY - ARROW_BAR_INSET + 1, unselectedFillColor, 0);
+                        plotLine(sd, arrowPointX - ARROW_BAR_INSET + 2, arrowPointY - ARROW_BAR_INSET + 1, arrowPointX + ARROW_BAR_INSET - 2, arrowPointY - ARROW_BAR_INSET + 1, unselectedFillColor, 0);
 #endif
                     } // if(menu->numRows > MAX_ROWS_ON_SCROLLABLE_SCREEN)
                 } // if(menu->numRows <= menu->firstRowOnScreen + MAX_ROWS_ON_SCROLLABLE_SCREEN)
@@ -597,6 +633,17 @@ void drawMeleeMenu(display_t* d, meleeMenu_t* menu)
         } // if(!menu->animating)
     } // if(menu->enableScrolling)
 
+    if(sd != d)
+    {
+        // Remember what the surface holds, then show it
+        menu->surfaceValid = !animatedThisFrame;
+        menu->surfaceTitle = menu->title;
+        menu->surfaceSelectedRow = menu->selectedRow;
+        menu->surfaceFirstRow = startRow;
+        menu->surfaceNumRows = menu->numRows;
+        memcpy(d->pxFb, menu->surface, d->w * d->h * sizeof(paletteColor_t));
+    }
+
     if( menu->allowLEDControl )
     {
         led_t leds[NUM_LEDS] = {0};
@@ -608,6 +655,146 @@ void drawMeleeMenu(display_t* d, meleeMenu_t* menu)
     }
 }
 
+/**
+ * @brief Get a display which draws to the menu's retained surface. The surface
+ * is allocated on the first draw, when the display's size is known
+ *
+ * @param d The display the menu is shown on
+ * @param menu The menu
+ * @param surfaceDisp A display to point at the surface
+ * @return surfaceDisp, or d if the surface couldn't be allocated
+ */
+static display_t* getMeleeMenuSurface(display_t* d, meleeMenu_t* menu, display_t* surfaceDisp)
+{
+    if(NULL == d->pxFb)
+    {
+        return d;
+    }
+
+    if((NULL != menu->surface) && ((menu->surfaceW != d->w) || (menu->surfaceH != d->h)))
+    {
+        heap_caps_free(menu->surface);
+        menu->surface = NULL;
+    }
+
+    if(NULL == menu->surface)
+    {
+        menu->surface = heap_caps_malloc(d->w * d->h * sizeof(paletteColor_t), MALLOC_CAP_SPIRAM);
+        if(NULL == menu->surface)
+        {
+            return d;
+        }
+        menu->surfaceW = d->w;
+        menu->surfaceH = d->h;
+        menu->surfaceValid = false;
+    }
+
+    *surfaceDisp = *d;
+    surfaceDisp->pxFb = menu->surface;
+    return surfaceDisp;
+}
+
+/**
+ * @brief Draw a menu's background grid, title and borders in a band of rows.
+ * This draws the whole frame, or puts back what was under a label before it's
+ * drawn again. The title is only drawn if the band reaches it
+ *
+ * @param d The display to draw to
+ * @param menu The menu to draw
+ * @param yMin The first row to draw
+ * @param yMax The row after the last row to draw
+ */
+static void drawMeleeMenuFrame(display_t* d, meleeMenu_t* menu, int16_t yMin, int16_t yMax)
+{
+    drawBackgroundGridRows(d, yMin, yMax);
+
+    if(yMin < BORDER_GAP + 1 + menu->font->h)
+    {
+        // Draw the title and note where it ends
+        int16_t titleEnd = drawText(d, menu->font, c222, menu->title, BORDER_GAP + 1 + TITLE_X_GAP, BORDER_GAP + 1);
+        menu->surfaceTitleEnd = titleEnd + TITLE_X_GAP;
+    }
+    int16_t textEnd = menu->surfaceTitleEnd;
+
+    paletteColor_t borderColor = borderColors[menu->selectedRow % NUM_ROW_COLORS_AND_OFFSETS];
+
+    // Draw a border, on the right
+    fillMeleeMenuBorder(d, yMin, yMax,
+                        BORDER_GAP,                BORDER_GAP + menu->font->h + TEXT_Y_GAP + 1,
+                        BORDER_GAP + BORDER_WIDTH, d->h - BORDER_GAP,
+                        borderColor);
+    // Then the left
+    fillMeleeMenuBorder(d, yMin, yMax,
+                        d->w - BORDER_GAP - BORDER_WIDTH, BORDER_GAP,
+                        d->w - BORDER_GAP,                d->h - BORDER_GAP,
+                        borderColor);
+    // At the bottom
+    fillMeleeMenuBorder(d, yMin, yMax,
+                        BORDER_GAP,        d->h - BORDER_GAP - BORDER_WIDTH,
+                        d->w - BORDER_GAP, d->h - BORDER_GAP,
+                        borderColor);
+    // Right of title
+    fillMeleeMenuBorder(d, yMin, yMax,
+                        textEnd,                BORDER_GAP,
+                        textEnd + BORDER_WIDTH, BORDER_GAP + menu->font->h + TEXT_Y_GAP + 1,
+                        borderColor);
+    // Below title
+    fillMeleeMenuBorder(d, yMin, yMax,
+                        BORDER_GAP,             BORDER_GAP + menu->font->h + TEXT_Y_GAP + 1,
+                        textEnd + BORDER_WIDTH, BORDER_GAP + menu->font->h + TEXT_Y_GAP + 1 + BORDER_WIDTH,
+                        borderColor);
+    // Top right of the title
+    fillMeleeMenuBorder(d, yMin, yMax,
+                        textEnd,           BORDER_GAP,
+                        d->w - BORDER_GAP, BORDER_GAP + BORDER_WIDTH,
+                        borderColor);
+}
+
+/**
+ * @brief Fill the part of a menu border which is in a band of rows
+ *
+ * @param d The display to draw to
+ * @param yMin The first row to draw
+ * @param yMax The row after the last row to draw
+ * @param x1 The left side of the border
+ * @param y1 The top of the border
+ * @param x2 The right side of the border
+ * @param y2 The bottom of the border
+ * @param c The color of the border
+ */
+static void fillMeleeMenuBorder(display_t* d, int16_t yMin, int16_t yMax,
+                                int16_t x1, int16_t y1, int16_t x2, int16_t y2, paletteColor_t c)
+{
+    fillDisplayArea(d, x1, (y1 > yMin) ? y1 : yMin, x2, (y2 < yMax) ? y2 : yMax, c);
+}
+
+/**
+ * @brief Check if a row's label changed since it was last drawn in this
+ * position on screen, and remember the new label
+ *
+ * @param menu The menu
+ * @param slot The position of the row on screen
+ * @param label The row's label
+ * @return true if the label must be drawn again, false if it's already drawn
+ */
+static bool meleeMenuLabelChanged(meleeMenu_t* menu, uint16_t slot, const char* label)
+{
+    uint8_t bit = (1 << slot);
+    bool changed = !(menu->surfaceLabelsValid & bit) || (0 != strcmp(menu->surfaceLabels[slot], label));
+
+    // Labels which don't fit are drawn every frame
+    size_t len = strlen(label);
+    if(len < MELEE_LABEL_CACHE_LEN)
+    {
+        memcpy(menu->surfaceLabels[slot], label, len + 1);
+        menu->surfaceLabelsValid |= bit;
+    }
+    else
+    {
+        menu->surfaceLabelsValid &= ~bit;
+    }
+    return changed;
+}
 /**
  * Draw text with a boundary and filled background to a Melee style menu
  *
@@ -16,6 +16,8 @@
 #define MAX_ROWS_ON_SCREEN 6
 #define MAX_ROWS_ON_SCROLLABLE_SCREEN 5
 #define NUM_ROW_COLORS_AND_OFFSETS 6
+// Labels longer than this are drawn every frame rather than compared
+#define MELEE_LABEL_CACHE_LEN 32
 
 //==============================================================================
 // Typedefs
@@ -45,6 +47,22 @@ typedef struct
     // these are dumb and should not exist please put them out of all our misery
     uint16_t lastFirstRow;
     uint16_t lastSelectedRow;
+
+    // The menu as last drawn, kept between frames so the background, borders,
+    // title and arrows are only drawn when the selection or rows change, and
+    // rows are only drawn when their labels change
+    paletteColor_t* surface;
+    bool surfaceValid;
+    uint16_t surfaceW;
+    uint16_t surfaceH;
+    int16_t surfaceTitleEnd;
+    const char* surfaceTitle;
+    uint16_t surfaceSelectedRow;
+    uint16_t surfaceFirstRow;
+    uint16_t surfaceNumRows;
+    // The labels drawn on the surface, and a bit for each one which is valid
+    char surfaceLabels[MAX_ROWS_ON_SCREEN][MELEE_LABEL_CACHE_LEN];
+    uint8_t surfaceLabelsValid;
 } meleeMenu_t;
 
 //==============================================================================
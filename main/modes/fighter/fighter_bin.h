@@ -0,0 +1,123 @@
+#ifndef _FIGHTER_BIN_H_
+#define _FIGHTER_BIN_H_
+
+//==============================================================================
+// Includes
+//==============================================================================
+
+#include <stdint.h>
+
+/*
+ * Fighter definitions are compiled from JSON into a binary .ftr file by
+ * spiffs_file_preprocessor, which includes this header too, so the firmware and
+ * the compiler always agree on the layout.
+ *
+ * All fields are 32 bits wide so the structs have no padding and can be read
+ * in place. Values are already converted to the units used at runtime, and all
+ * references are byte offsets from the start of the file.
+ */
+
+//==============================================================================
+// Defines
+//==============================================================================
+
+#define FTR_BIN_MAGIC         "FTRB"
+#define FTR_BIN_VERSION       1
+#define FTR_BIN_SPR_NAME_LEN  32
+#define FTR_BIN_NO_SPRITE     -1
+#define FTR_BIN_NUM_ATTACKS   10
+
+// The firmware checks these against FRAME_TIME_MS and SF in mode_fighter.h
+#define FTR_BIN_FRAME_TIME_MS 33
+#define FTR_BIN_SF            8
+
+//==============================================================================
+// Structs
+//==============================================================================
+
+typedef struct
+{
+    int32_t spriteIdx; // Index into the file's sprite name table
+    int32_t offsetX;
+    int32_t offsetY;
+} ftrBinSprite_t;
+
+typedef struct
+{
+    int32_t posX;
+    int32_t posY;
+    int32_t sizeX;
+    int32_t sizeY;
+    int32_t knockbackX;
+    int32_t knockbackY;
+    int32_t damage;
+    int32_t hitstun;
+    ftrBinSprite_t projSprite;
+    int32_t projVeloX;
+    int32_t projVeloY;
+    int32_t projAccelX;
+    int32_t projAccelY;
+    int32_t projDuration;
+    int32_t isProjectile;
+    int32_t projPassThru;
+} ftrBinHitbox_t;
+
+typedef struct
+{
+    ftrBinSprite_t sprite;
+    int32_t hurtboxOffsetX;
+    int32_t hurtboxOffsetY;
+    int32_t hurtboxSizeX;
+    int32_t hurtboxSizeY;
+    int32_t veloX;
+    int32_t veloY;
+    int32_t duration;
+    int32_t iFrames;
+    uint32_t numHitboxes;
+    uint32_t hitboxesOffset;
+} ftrBinAttackFrame_t;
+
+typedef struct
+{
+    ftrBinSprite_t startupLagSprite;
+    ftrBinSprite_t endLagSprite;
+    int32_t startupLag;
+    int32_t endLag;
+    int32_t landingLag;
+    int32_t iFrames;
+    int32_t onlyFirstHit;
+    uint32_t numAttackFrames;
+    uint32_t attackFramesOffset;
+} ftrBinAttack_t;
+
+typedef struct
+{
+    char magic[4];
+    uint32_t version;
+    uint32_t frameTimeMs;
+    uint32_t numSprites;
+    uint32_t spriteNamesOffset;
+    int32_t gravity;
+    int32_t weight;
+    int32_t jumpVelo;
+    int32_t runAccel;
+    int32_t runDecel;
+    int32_t runMaxVelo;
+    int32_t sizeX;
+    int32_t sizeY;
+    int32_t numJumps;
+    int32_t landingLag;
+    int32_t stockIconIdx;
+    ftrBinSprite_t idleSprite0;
+    ftrBinSprite_t idleSprite1;
+    ftrBinSprite_t runSprite0;
+    ftrBinSprite_t runSprite1;
+    ftrBinSprite_t jumpSprite;
+    ftrBinSprite_t duckSprite;
+    ftrBinSprite_t landingLagSprite;
+    ftrBinSprite_t hitstunGroundSprite;
+    ftrBinSprite_t hitstunAirSprite;
+    ftrBinAttack_t attacks[FTR_BIN_NUM_ATTACKS];
+} ftrBinFighter_t;
+
+#endif
@@ -11,923 +11,246 @@
 #include "freertos/task.h"
 
 #include "esp_log.h"
-#include "jsmn.h"
+#include "spiffs_manager.h"
 
-#include "spiffs_json.h"
 #include "fighter_json.h"
 
+//==============================================================================
+// Defines
+//==============================================================================
+
+// The compiled layout must match the fighter it is loaded into
+_Static_assert(FTR_BIN_NUM_ATTACKS == NUM_ATTACKS, "fighter_bin.h is out of sync with attackOrder_t");
+_Static_assert(FTR_BIN_FRAME_TIME_MS == FRAME_TIME_MS, "fighter_bin.h is out of sync with FRAME_TIME_MS");
+_Static_assert(FTR_BIN_SF == SF, "fighter_bin.h is out of sync with SF");
+
 //==============================================================================
 // Prototypes
 //==============================================================================
 
-int32_t parseJsonFighter(          char* jsonStr, jsmntok_t* toks, int32_t tokIdx, namedSprite_t* loadedSprites,
-                                   fighter_t* ftr);
-int32_t parseJsonAttack(           char* jsonStr, jsmntok_t* toks, int32_t tokIdx, namedSprite_t* loadedSprites,
-                                   attack_t* atk);
-int32_t parseJsonAttackFrame(      char* jsonStr, jsmntok_t* toks, int32_t tokIdx, namedSprite_t* loadedSprites,
-                                   attackFrame_t* frm);
-int32_t parseJsonAttackFrameHitbox(char* jsonStr, jsmntok_t* toks, int32_t tokIdx, namedSprite_t* loadedSprites,
-                                   attackHitbox_t* hbx);
-int32_t parseJsonOffsetSprite(     char* jsonStr, jsmntok_t* toks, int32_t tokIdx, namedSprite_t* loadedSprites,
-                                   offsetSprite_t* os);
+static bool ftrBinInBounds(uint32_t offset, uint32_t count, size_t elemSize, size_t sz);
+static bool loadSpriteIdx(int32_t binIdx, const uint8_t* spriteMap, uint32_t numSprites, uint8_t* spriteIdx);
+static bool loadOffsetSprite(const ftrBinSprite_t* bin, const uint8_t* spriteMap, uint32_t numSprites,
+                             offsetSprite_t* os);
 
 //==============================================================================
-// JSON Utility Functions
+// Loading Functions
 //==============================================================================
 
 /**
- * @brief Compare a JSMN String to a given string value
+ * @brief Check if an array in a compiled fighter is within the file and word
+ * aligned, so it can be read in place. The count is divided rather than
+ * multiplied so a huge count can't overflow
  *
- * @param jsonStr The full JSON string
- * @param tok The token for the string to compare
- * @param s The string to compare to
- * @return 0 if the strings match, non-zero value if they do not (see strcmp())
+ * @param offset The offset of the array
+ * @param count The number of elements in the array
+ * @param elemSize The size of each element
+ * @param sz The size of the file
+ * @return true if the array is within the file, false if it is not
  */
-static int32_t jsoneq(const char* jsonStr, jsmntok_t* tok, const char* s)
+static bool ftrBinInBounds(uint32_t offset, uint32_t count, size_t elemSize, size_t sz)
 {
-    if (tok->type == JSMN_STRING && (int32_t)strlen(s) == tok->end - tok->start)
-    {
-        return strncmp(jsonStr + tok->start, s, tok->end - tok->start);
-    }
-    return -1;
+    return (0 == (offset % sizeof(uint32_t))) && (offset <= sz) && (count <= ((sz - offset) / elemSize));
 }
 
 /**
- * @brief Extract an integer value from a JSMN primitive
+ * @brief Map a sprite index from a compiled fighter to a loaded sprite index
  *
- * @param jsonStr The full JSON string
- * @param tok The token for the integer to extract
- * @return An integer value
+ * @param binIdx The index into the file's sprite name table
+ * @param spriteMap A map from the file's sprite indices to loaded sprite indices
+ * @param numSprites The number of sprites in the file's sprite name table
+ * @param spriteIdx The loaded sprite index is written here. Sprites which
+ *                  weren't set, or are out of range, use the first loaded sprite
+ * @return true if the index was valid, false if it was out of range
  */
-static int32_t jsonInteger(const char* jsonStr, jsmntok_t tok)
+static bool loadSpriteIdx(int32_t binIdx, const uint8_t* spriteMap, uint32_t numSprites, uint8_t* spriteIdx)
 {
-    if(JSMN_PRIMITIVE == tok.type)
+    if(FTR_BIN_NO_SPRITE == binIdx)
     {
-        char jsonVal[(tok.end - tok.start) + 1];
-        memcpy(jsonVal, &(jsonStr[tok.start]), (tok.end - tok.start));
-        jsonVal[(tok.end - tok.start)] = 0;
-        return atoi(jsonVal);
+        *spriteIdx = 0;
+        return true;
     }
-    else
+    else if((binIdx < 0) || ((uint32_t)binIdx >= numSprites))
     {
-        return 0;
+        *spriteIdx = 0;
+        return false;
     }
+    *spriteIdx = spriteMap[binIdx];
+    return true;
 }
 
 /**
- * @brief Extract a string value from a JSMN string. This allocates memory which
- * must be free()'d later
+ * @brief Load an offset sprite from a compiled fighter
  *
- * @param jsonStr The full JSON string
- * @param tok The token for the string to extract
- * @return A pointer to a freshly allocated string
+ * @param bin The compiled offset sprite
+ * @param spriteMap A map from the file's sprite indices to loaded sprite indices
+ * @param numSprites The number of sprites in the file's sprite name table
+ * @param os The offset sprite to load data into
+ * @return true if the sprite index was valid, false if it was out of range
  */
-static char* jsonString(const char* jsonStr, jsmntok_t tok)
+static bool loadOffsetSprite(const ftrBinSprite_t* bin, const uint8_t* spriteMap, uint32_t numSprites,
+                             offsetSprite_t* os)
 {
-    char* copiedStr = calloc((tok.end - tok.start + 1), sizeof(char));
-    memcpy(copiedStr, &(jsonStr[tok.start]), (tok.end - tok.start));
-    copiedStr[tok.end - tok.start] = 0;
-    return copiedStr;
+    os->offset.x = bin->offsetX;
+    os->offset.y = bin->offsetY;
+    return loadSpriteIdx(bin->spriteIdx, spriteMap, numSprites, &os->spriteIdx);
 }
 
 /**
- * @brief Extract a boolean value from a JSMN primitive
- *
- * @param jsonStr The full JSON string
- * @param tok The token for the boolean to extract
- * @return true or false
- */
-static bool jsonBoolean(const char* jsonStr, jsmntok_t tok)
-{
-    return (0 == memcmp("true", &(jsonStr[tok.start]), (tok.end - tok.start))) ? true : false;
-}
-
-//==============================================================================
-// Parsing Functions
-//==============================================================================
-
-/**
- * @brief Parse fighter attributes from a JSON file into the given pointer
+ * @brief Load fighter attributes from a compiled fighter file into the given pointer.
+ * The file is built from JSON by spiffs_file_preprocessor, so there is no parsing here
  *
  * @param fighter The fighter_t struct to load a fighter into
- * @param jsonFile The JSON file to load data from
+ * @param ftrFile The compiled fighter file to load data from
  * @param loadedSprites A list of loaded sprites. Will be filled with sprites
+ * @return true if the fighter was loaded, false if there was an error
  */
-void loadJsonFighterData(fighter_t* fighter, const char* jsonFile, namedSprite_t* loadedSprites)
-{
-    // Load the json string
-    char* jsonStr = loadJson(jsonFile);
-
-    // Allocate a bunch of tokens
-    jsmn_parser p;
-    jsmntok_t* toks = calloc(1024, sizeof(jsmntok_t));
-    int32_t tokIdx = 0;
-
-    // Parse the JSON into tokens
-    jsmn_init(&p);
-    int32_t numToks = jsmn_parse(&p, jsonStr, strlen(jsonStr), toks, 1024);
-    if (numToks < 0)
-    {
-        ESP_LOGE("FTR", "Failed to parse JSON: %d\n", numToks);
-    }
-    else
-    {
-        ESP_LOGI("FTR", "numToks = %d", numToks);
-    }
-
-    // Load the fighter
-    parseJsonFighter(jsonStr, toks, tokIdx, loadedSprites, fighter);
-
-    free(toks);
-    free(jsonStr);
-}
-
-/**
- * @brief Parse a fighter object from a JSON string
- *
- * @param jsonStr The whole JSON string
- * @param toks An array of JSON tokens
- * @param tokIdx The index of the current JSON token
- * @param loadedSprites A list of sprites, used for loading
- * @param ftr The fighter to parse data into
- * @return int32_t The index of the JSON token after parsing
- */
-int32_t parseJsonFighter(char* jsonStr, jsmntok_t* toks, int32_t tokIdx, namedSprite_t* loadedSprites, fighter_t* ftr)
-{
-    // Each fighter is an object
-    if(JSMN_OBJECT != toks[tokIdx].type)
-    {
-        ESP_LOGE("JSON", "Non-object!!");
-    }
-
-    uint8_t numFieldsParsed = 0;
-    uint8_t numFieldsToParse = toks[tokIdx].size;
-
-    // Move to the first field
-    tokIdx++;
-
-    // Parse the tokens
-    while(true)
-    {
-        if(JSMN_STRING == toks[tokIdx].type)
-        {
-            if (0 == jsoneq(jsonStr, &toks[tokIdx], "name"))
-            {
-                tokIdx++;
-                char* name = jsonString(jsonStr, toks[tokIdx]);
-                ESP_LOGD("FTR", "Fighter name is %s", name);
-                free(name);
-                tokIdx++;
-                numFieldsParsed++;
-            }
-            else if (0 == jsoneq(jsonStr, &toks[tokIdx], "idle_spr_0"))
-            {
-                tokIdx++;
-                char* name = jsonString(jsonStr, toks[tokIdx]);
-                tokIdx = parseJsonOffsetSprite(jsonStr, toks, tokIdx, loadedSprites, &ftr->idleSprite0);
-                free(name);
-                numFieldsParsed++;
-            }
-            else if (0 == jsoneq(jsonStr, &toks[tokIdx], "idle_spr_1"))
-            {
-                tokIdx++;
-                char* name = jsonString(jsonStr, toks[tokIdx]);
-                tokIdx = parseJsonOffsetSprite(jsonStr, toks, tokIdx, loadedSprites, &ftr->idleSprite1);
-                free(name);
-                numFieldsParsed++;
-            }
-            else if (0 == jsoneq(jsonStr, &toks[tokIdx], "run_spr_0"))
-            {
-                tokIdx++;
-                char* name = jsonString(jsonStr, toks[tokIdx]);
-                tokIdx = parseJsonOffsetSprite(jsonStr, toks, tokIdx, loadedSprites, &ftr->runSprite0);
-                free(name);
-                numFieldsParsed++;
-            }
-            else if (0 == jsoneq(jsonStr, &toks[tokIdx], "run_spr_1"))
-            {
-                tokIdx++;
-                char* name = jsonString(jsonStr, toks[tokIdx]);
-                tokIdx = parseJsonOffsetSprite(jsonStr, toks, tokIdx, loadedSprites, &ftr->runSprite1);
-                free(name);
-                numFieldsParsed++;
-            }
-            else if (0 == jsoneq(jsonStr, &toks[tokIdx], "jump_spr"))
-            {
-                tokIdx++;
-                char* name = jsonString(jsonStr, toks[tokIdx]);
-                tokIdx = parseJsonOffsetSprite(jsonStr, toks, tokIdx, loadedSprites, &ftr->jumpSprite);
-                free(name);
-                numFieldsParsed++;
-            }
-            else if (0 == jsoneq(jsonStr, &toks[tokIdx], "duck_spr"))
-            {
-                tokIdx++;
-                char* name = jsonString(jsonStr, toks[tokIdx]);
-                tokIdx = parseJsonOffsetSprite(jsonStr, toks, tokIdx, loadedSprites, &ftr->duckSprite);
-                free(name);
-                numFieldsParsed++;
-            }
-            else if (0 == jsoneq(jsonStr, &toks[tokIdx], "land_lag_spr"))
-            {
-                tokIdx++;
-                char* name = jsonString(jsonStr, toks[tokIdx]);
-                tokIdx = parseJsonOffsetSprite(jsonStr, toks, tokIdx, loadedSprites, &ftr->landingLagSprite);
-                free(name);
-                numFieldsParsed++;
-            }
-            else if (0 == jsoneq(jsonStr, &toks[tokIdx], "hitstun_ground_sprite"))
-            {
-                tokIdx++;
-                char* name = jsonString(jsonStr, toks[tokIdx]);
-                tokIdx = parseJsonOffsetSprite(jsonStr, toks, tokIdx, loadedSprites, &ftr->hitstunGroundSprite);
-                free(name);
-                numFieldsParsed++;
-            }
-            else if (0 == jsoneq(jsonStr, &toks[tokIdx], "hitstun_air_sprite"))
-            {
-                tokIdx++;
-                char* name = jsonString(jsonStr, toks[tokIdx]);
-                tokIdx = parseJsonOffsetSprite(jsonStr, toks, tokIdx, loadedSprites, &ftr->hitstunAirSprite);
-                free(name);
-                numFieldsParsed++;
-            }
-            else if(0 == jsoneq(jsonStr, &toks[tokIdx], "gravity"))
-            {
-                tokIdx++;
-                ftr->gravity = jsonInteger(jsonStr, toks[tokIdx]);
-                tokIdx++;
-                numFieldsParsed++;
-            }
-            else if(0 == jsoneq(jsonStr, &toks[tokIdx], "weight"))
-            {
-                tokIdx++;
-                ftr->weight = jsonInteger(jsonStr, toks[tokIdx]);
-                if(0 < ftr->weight && ftr->weight < 2048)
-                {
-                    ftr->weight = 2048 - ftr->weight;
-                }
-                else
-                {
-                    ftr->weight = 1024;
-                }
-                tokIdx++;
-                numFieldsParsed++;
-            }
-            else if(0 == jsoneq(jsonStr, &toks[tokIdx], "jump_velo"))
-            {
-                tokIdx++;
-                ftr->jump_velo = jsonInteger(jsonStr, toks[tokIdx]);
-                tokIdx++;
-                numFieldsParsed++;
-            }
-            else if(0 == jsoneq(jsonStr, &toks[tokIdx], "run_accel"))
-            {
-                tokIdx++;
-                ftr->run_accel = jsonInteger(jsonStr, toks[tokIdx]);
-                tokIdx++;
-                numFieldsParsed++;
-            }
-            else if(0 == jsoneq(jsonStr, &toks[tokIdx], "run_decel"))
-            {
-                tokIdx++;
-                ftr->run_decel = jsonInteger(jsonStr, toks[tokIdx]);
-                tokIdx++;
-                numFieldsParsed++;
-            }
-            else if(0 == jsoneq(jsonStr, &toks[tokIdx], "run_max_velo"))
-            {
-                tokIdx++;
-                ftr->run_max_velo = jsonInteger(jsonStr, toks[tokIdx]);
-                tokIdx++;
-                numFieldsParsed++;
-            }
-            else if(0 == jsoneq(jsonStr, &toks[tokIdx], "size_x"))
-            {
-                tokIdx++;
-                ftr->size.x = jsonInteger(jsonStr, toks[tokIdx]) << SF;
-                ftr->originalSize.x = jsonInteger(jsonStr, toks[tokIdx]) << SF;
-                tokIdx++;
-                numFieldsParsed++;
-            }
-            else if(0 == jsoneq(jsonStr, &toks[tokIdx], "size_y"))
-            {
-                tokIdx++;
-                ftr->size.y = jsonInteger(jsonStr, toks[tokIdx]) << SF;
-                ftr->originalSize.y = jsonInteger(jsonStr, toks[tokIdx]) << SF;
-                tokIdx++;
-                numFieldsParsed++;
-            }
-            else if(0 == jsoneq(jsonStr, &toks[tokIdx], "nJumps"))
-            {
-                tokIdx++;
-                ftr->numJumps = jsonInteger(jsonStr, toks[tokIdx]);
-                tokIdx++;
-                numFieldsParsed++;
-            }
-            else if(0 == jsoneq(jsonStr, &toks[tokIdx], "landing_lag"))
-            {
-                tokIdx++;
-                // Convert ms to frames
-                ftr->landingLag = jsonInteger(jsonStr, toks[tokIdx]) / FRAME_TIME_MS;
-                if(0 == ftr->landingLag)
-                {
-                    ftr->landingLag = 1;
-                }
-                tokIdx++;
-                numFieldsParsed++;
-            }
-            else if(0 == jsoneq(jsonStr, &toks[tokIdx], "stock_icn"))
-            {
-                tokIdx++;
-                char* name = jsonString(jsonStr, toks[tokIdx]);
-                ftr->stockIconIdx = loadFighterSprite(name, loadedSprites);
-                free(name);
-                tokIdx++;
-                numFieldsParsed++;
-            }
-            else if(0 == jsoneq(jsonStr, &toks[tokIdx], "attacks"))
-            {
-                // Move to the array, get the size
-                tokIdx++;
-                uint8_t numAttacks = toks[tokIdx].size;
-
-                // Check length
-                if(numAttacks != NUM_ATTACKS)
-                {
-                    ESP_LOGE("JSON", "Incorrect number of attacks");
-                }
-
-                tokIdx++;
-                for(uint8_t atkIdx = 0; atkIdx < numAttacks; atkIdx++)
-                {
-                    tokIdx = parseJsonAttack(jsonStr, toks, tokIdx, loadedSprites, ftr->attacks);
-                }
-                numFieldsParsed++;
-            }
-        }
-        else
-        {
-            ESP_LOGE("JSON", "Non-string key!!");
-        }
-
-        // Check to return
-        if(numFieldsParsed == numFieldsToParse)
-        {
-            return tokIdx;
-        }
-    }
-    return tokIdx;
-}
-
-/**
- * @brief Parse an attack object from a JSON string
- *
- * @param jsonStr The whole JSON string
- * @param toks An array of JSON tokens
- * @param tokIdx The index of the current JSON token
- * @param loadedSprites A list of sprites, used for loading
- * @param atks A pointer to all the attacks
- * @return int32_t The index of the JSON token after parsing
- */
-int32_t parseJsonAttack(char* jsonStr, jsmntok_t* toks, int32_t tokIdx, namedSprite_t* loadedSprites, attack_t* atks)
+bool loadFighterData(fighter_t* fighter, const char* ftrFile, namedSprite_t* loadedSprites)
 {
-    // Each attack is an object
-    if(JSMN_OBJECT != toks[tokIdx].type)
+    // Read the whole file at once
+    uint8_t* buf = NULL;
+    size_t sz;
+    if(!spiffsReadFile(ftrFile, &buf, &sz, false))
     {
-        ESP_LOGE("JSON", "Non-object!!");
+        ESP_LOGE("FTR", "Failed to read %s", ftrFile);
+        return false;
     }
 
-    // Keep track of fields so we know when we're done
-    uint8_t numFieldsParsed = 0;
-    uint8_t numFieldsToParse = toks[tokIdx].size;
-
-    // Move to the first field
-    tokIdx++;
-
-    // The attack to parse into
-    attack_t* atk = NULL;
-
-    // Parse the tokens
-    while(true)
+    // Validate the header
+    const ftrBinFighter_t* bin = (const ftrBinFighter_t*)buf;
+    if((sz < sizeof(ftrBinFighter_t)) ||
+            (0 != memcmp(bin->magic, FTR_BIN_MAGIC, sizeof(bin->magic))) ||
+            (FTR_BIN_VERSION != bin->version) ||
+            (FRAME_TIME_MS != bin->frameTimeMs) ||
+            !ftrBinInBounds(bin->spriteNamesOffset, bin->numSprites, FTR_BIN_SPR_NAME_LEN, sz))
     {
-        if(JSMN_STRING == toks[tokIdx].type)
-        {
-            if (0 == jsoneq(jsonStr, &toks[tokIdx], "type"))
-            {
-                tokIdx++;
-                char* type = jsonString(jsonStr, toks[tokIdx]);
-
-                // Pick the attack slot based on type
-                if(0 == strcmp(type, "up_gnd"))
-                {
-                    atk = &atks[UP_GROUND];
-                }
-                else if(0 == strcmp(type, "down_gnd"))
-                {
-                    atk = &atks[DOWN_GROUND];
-                }
-                else if(0 == strcmp(type, "dash_gnd"))
-                {
-                    atk = &atks[DASH_GROUND];
-                }
-                else if(0 == strcmp(type, "front_gnd"))
-                {
-                    atk = &atks[FRONT_GROUND];
-                }
-                else if(0 == strcmp(type, "neutral_gnd"))
-                {
-                    atk = &atks[NEUTRAL_GROUND];
-                }
-                else if(0 == strcmp(type, "neutral_air"))
-                {
-                    atk = &atks[NEUTRAL_AIR];
-                }
-                else if(0 == strcmp(type, "front_air"))
-                {
-                    atk = &atks[FRONT_AIR];
-                }
-                else if(0 == strcmp(type, "back_air"))
-                {
-                    atk = &atks[BACK_AIR];
-                }
-                else if(0 == strcmp(type, "up_air"))
-                {
-                    atk = &atks[UP_AIR];
-                }
-                else if(0 == strcmp(type, "down_air"))
-                {
-                    atk = &atks[DOWN_AIR];
-                }
-
-                free(type);
-                tokIdx++;
-                numFieldsParsed++;
-            }
-            else if (0 == jsoneq(jsonStr, &toks[tokIdx], "startupLag"))
-            {
-                tokIdx++;
-                // Convert ms to frames
-                atk->startupLag = jsonInteger(jsonStr, toks[tokIdx]) / FRAME_TIME_MS;
-                if(0 == atk->startupLag)
-                {
-                    atk->startupLag = 1;
-                }
-                tokIdx++;
-                numFieldsParsed++;
-            }
-            else if (0 == jsoneq(jsonStr, &toks[tokIdx], "endLag"))
-            {
-                tokIdx++;
-                // Convert ms to frames
-                atk->endLag = jsonInteger(jsonStr, toks[tokIdx]) / FRAME_TIME_MS;
-                if(0 == atk->endLag)
-                {
-                    atk->endLag = 1;
-                }
-                tokIdx++;
-                numFieldsParsed++;
-            }
-            else if(0 == jsoneq(jsonStr, &toks[tokIdx], "landing_lag"))
-            {
-                tokIdx++;
-                // Convert ms to frames
-                atk->landingLag = jsonInteger(jsonStr, toks[tokIdx]) / FRAME_TIME_MS;
-                if(0 == atk->landingLag)
-                {
-                    atk->landingLag = 1;
-                }
-                tokIdx++;
-                numFieldsParsed++;
-            }
-            else if (0 == jsoneq(jsonStr, &toks[tokIdx], "startupLagSpr"))
-            {
-                tokIdx++;
-                char* name = jsonString(jsonStr, toks[tokIdx]);
-                tokIdx = parseJsonOffsetSprite(jsonStr, toks, tokIdx, loadedSprites, &atk->startupLagSprite);
-                free(name);
-                numFieldsParsed++;
-            }
-            else if (0 == jsoneq(jsonStr, &toks[tokIdx], "endLagSpr"))
-            {
-                tokIdx++;
-                char* name = jsonString(jsonStr, toks[tokIdx]);
-                tokIdx = parseJsonOffsetSprite(jsonStr, toks, tokIdx, loadedSprites, &atk->endLagSprite);
-                free(name);
-                numFieldsParsed++;
-            }
-            else if(0 == jsoneq(jsonStr, &toks[tokIdx], "onlyFirstHit"))
-            {
-                tokIdx++;
-                atk->onlyFirstHit = jsonBoolean(jsonStr, toks[tokIdx]);
-                tokIdx++;
-                numFieldsParsed++;
-            }
-            else if(0 == jsoneq(jsonStr, &toks[tokIdx], "iframe_timer"))
-            {
-                tokIdx++;
-                // Convert ms to frames
-                atk->iFrames = jsonInteger(jsonStr, toks[tokIdx]) / FRAME_TIME_MS;
-                tokIdx++;
-                numFieldsParsed++;
-            }
-            else if (0 == jsoneq(jsonStr, &toks[tokIdx], "attack_frames"))
-            {
-                // Move to the array, get the size
-                tokIdx++;
-                atk->numAttackFrames = toks[tokIdx].size;
-
-                // Allocate memory
-                atk->attackFrames = calloc(atk->numAttackFrames, sizeof(attackFrame_t));
-
-                tokIdx++;
-                for(uint8_t frmIdx = 0; frmIdx < atk->numAttackFrames; frmIdx++)
-                {
-                    tokIdx = parseJsonAttackFrame(jsonStr, toks, tokIdx, loadedSprites, &atk->attackFrames[frmIdx]);
-                }
-                numFieldsParsed++;
-            }
-        }
-        else
-        {
-            ESP_LOGE("JSON", "Non-string key!!");
-        }
-
-        // Check to return
-        if(numFieldsParsed == numFieldsToParse)
-        {
-            return tokIdx;
-        }
+        ESP_LOGE("FTR", "%s is not a valid fighter", ftrFile);
+        free(buf);
+        return false;
     }
-    return tokIdx;
-}
 
-/**
- * @brief Parse an attack frame object from a JSON string
- *
- * @param jsonStr The whole JSON string
- * @param toks An array of JSON tokens
- * @param tokIdx The index of the current JSON token
- * @param loadedSprites A list of sprites, used for loading
- * @param ftr The attack frame to parse data into
- * @return int32_t The index of the JSON token after parsing
- */
-int32_t parseJsonAttackFrame(char* jsonStr, jsmntok_t* toks, int32_t tokIdx, namedSprite_t* loadedSprites,
-                             attackFrame_t* frm)
-{
-    // Each attack is an object
-    if(JSMN_OBJECT != toks[tokIdx].type)
+    // Load all the sprites this fighter uses
+    uint8_t* spriteMap = calloc(bin->numSprites + 1, sizeof(uint8_t));
+    for(uint32_t sprIdx = 0; sprIdx < bin->numSprites; sprIdx++)
     {
-        ESP_LOGE("JSON", "Non-object!!");
+        char* name = (char*)&buf[bin->spriteNamesOffset + (sprIdx * FTR_BIN_SPR_NAME_LEN)];
+        name[FTR_BIN_SPR_NAME_LEN - 1] = 0;
+        spriteMap[sprIdx] = loadFighterSprite(name, loadedSprites);
     }
 
-    // Keep track of fields so we know when we're done
-    uint8_t numFieldsParsed = 0;
-    uint8_t numFieldsToParse = toks[tokIdx].size;
-
-    // Move to the first field
-    tokIdx++;
-
-    // Parse the tokens
-    while(true)
+    // Load the fighter attributes, already in runtime units. Sprite indices
+    // and attack data are checked against the file, and ok is cleared if any
+    // of them are out of bounds
+    bool ok = true;
+    fighter->gravity      = bin->gravity;
+    fighter->weight       = bin->weight;
+    fighter->jump_velo    = bin->jumpVelo;
+    fighter->run_accel    = bin->runAccel;
+    fighter->run_decel    = bin->runDecel;
+    fighter->run_max_velo = bin->runMaxVelo;
+    fighter->size.x       = bin->sizeX;
+    fighter->size.y       = bin->sizeY;
+    fighter->originalSize = fighter->size;
+    fighter->numJumps     = bin->numJumps;
+    fighter->landingLag   = bin->landingLag;
+    ok &= loadSpriteIdx(bin->stockIconIdx, spriteMap, bin->numSprites, &fighter->stockIconIdx);
+
+    ok &= loadOffsetSprite(&bin->idleSprite0,         spriteMap, bin->numSprites, &fighter->idleSprite0);
+    ok &= loadOffsetSprite(&bin->idleSprite1,         spriteMap, bin->numSprites, &fighter->idleSprite1);
+    ok &= loadOffsetSprite(&bin->runSprite0,          spriteMap, bin->numSprites, &fighter->runSprite0);
+    ok &= loadOffsetSprite(&bin->runSprite1,          spriteMap, bin->numSprites, &fighter->runSprite1);
+    ok &= loadOffsetSprite(&bin->jumpSprite,          spriteMap, bin->numSprites, &fighter->jumpSprite);
+    ok &= loadOffsetSprite(&bin->duckSprite,          spriteMap, bin->numSprites, &fighter->duckSprite);
+    ok &= loadOffsetSprite(&bin->landingLagSprite,    spriteMap, bin->numSprites, &fighter->landingLagSprite);
+    ok &= loadOffsetSprite(&bin->hitstunGroundSprite, spriteMap, bin->numSprites, &fighter->hitstunGroundSprite);
+    ok &= loadOffsetSprite(&bin->hitstunAirSprite,    spriteMap, bin->numSprites, &fighter->hitstunAirSprite);
+
+    // Load the attacks
+    for(uint8_t atkIdx = 0; atkIdx < NUM_ATTACKS; atkIdx++)
     {
-        if(JSMN_STRING == toks[tokIdx].type)
-        {
-            if (0 == jsoneq(jsonStr, &toks[tokIdx], "duration"))
-            {
-                tokIdx++;
-                // Convert ms to frames
-                frm->duration = jsonInteger(jsonStr, toks[tokIdx]) / FRAME_TIME_MS;
-                if(0 == frm->duration)
-                {
-                    frm->duration = 1;
-                }
-                tokIdx++;
-                numFieldsParsed++;
-            }
-            else if (0 == jsoneq(jsonStr, &toks[tokIdx], "atkSpr"))
-            {
-                tokIdx++;
-                char* name = jsonString(jsonStr, toks[tokIdx]);
-                tokIdx = parseJsonOffsetSprite(jsonStr, toks, tokIdx, loadedSprites, &frm->sprite);
-                free(name);
-                numFieldsParsed++;
-            }
-            else if (0 == jsoneq(jsonStr, &toks[tokIdx], "hurtbox_offset_x"))
-            {
-                tokIdx++;
-                frm->hurtbox_offset.x = jsonInteger(jsonStr, toks[tokIdx]);
-                tokIdx++;
-                numFieldsParsed++;
-            }
-            else if (0 == jsoneq(jsonStr, &toks[tokIdx], "hurtbox_offset_y"))
-            {
-                tokIdx++;
-                frm->hurtbox_offset.y = jsonInteger(jsonStr, toks[tokIdx]);
-                tokIdx++;
-                numFieldsParsed++;
-            }
-            else if (0 == jsoneq(jsonStr, &toks[tokIdx], "hurtbox_size_x"))
-            {
-                tokIdx++;
-                frm->hurtbox_size.x = jsonInteger(jsonStr, toks[tokIdx]);
-                tokIdx++;
-                numFieldsParsed++;
-            }
-            else if (0 == jsoneq(jsonStr, &toks[tokIdx], "hurtbox_size_y"))
-            {
-                tokIdx++;
-                frm->hurtbox_size.y = jsonInteger(jsonStr, toks[tokIdx]);
-                tokIdx++;
-                numFieldsParsed++;
-            }
-            else if (0 == jsoneq(jsonStr, &toks[tokIdx], "iframe_timer"))
-            {
-                tokIdx++;
-                // Convert ms to frames
-                frm->iFrames = jsonInteger(jsonStr, toks[tokIdx]) / FRAME_TIME_MS;
-                tokIdx++;
-                numFieldsParsed++;
-            }
-            else if (0 == jsoneq(jsonStr, &toks[tokIdx], "velo_x"))
-            {
-                tokIdx++;
-                frm->velocity.x = jsonInteger(jsonStr, toks[tokIdx]);
-                tokIdx++;
-                numFieldsParsed++;
-            }
-            else if (0 == jsoneq(jsonStr, &toks[tokIdx], "velo_y"))
-            {
-                tokIdx++;
-                frm->velocity.y = jsonInteger(jsonStr, toks[tokIdx]);
-                tokIdx++;
-                numFieldsParsed++;
-            }
-            else if (0 == jsoneq(jsonStr, &toks[tokIdx], "hitboxes"))
-            {
-                // Move to the array, get the size
-                tokIdx++;
-                frm->numHitboxes = toks[tokIdx].size;
-
-                // Allocate memory
-                frm->hitboxes = calloc(frm->numHitboxes, sizeof(attackHitbox_t));
-
-                // Move to the first object and start parsing
-                tokIdx++;
-                for(uint8_t hbxIdx = 0; hbxIdx < frm->numHitboxes; hbxIdx++)
-                {
-                    tokIdx = parseJsonAttackFrameHitbox(jsonStr, toks, tokIdx, loadedSprites, &frm->hitboxes[hbxIdx]);
-                }
-                numFieldsParsed++;
-            }
-        }
-        else
+        const ftrBinAttack_t* binAtk = &bin->attacks[atkIdx];
+        attack_t* atk = &fighter->attacks[atkIdx];
+
+        ok &= loadOffsetSprite(&binAtk->startupLagSprite, spriteMap, bin->numSprites, &atk->startupLagSprite);
+        ok &= loadOffsetSprite(&binAtk->endLagSprite,     spriteMap, bin->numSprites, &atk->endLagSprite);
+        atk->startupLag   = binAtk->startupLag;
+        atk->endLag       = binAtk->endLag;
+        atk->landingLag   = binAtk->landingLag;
+        atk->iFrames      = binAtk->iFrames;
+        atk->onlyFirstHit = binAtk->onlyFirstHit;
+
+        // The count must also fit in attack_t
+        if((binAtk->numAttackFrames > UINT8_MAX) ||
+                !ftrBinInBounds(binAtk->attackFramesOffset, binAtk->numAttackFrames, sizeof(ftrBinAttackFrame_t), sz))
         {
-            ESP_LOGE("JSON", "Non-string key!!");
+            ok = false;
+            continue;
         }
 
-        // Check to return
-        if(numFieldsParsed == numFieldsToParse)
-        {
-            return tokIdx;
-        }
-    }
-    return tokIdx;
-}
-
-/**
- * @brief Parse an attack hitbox object from a JSON string
- *
- * @param jsonStr The whole JSON string
- * @param toks An array of JSON tokens
- * @param tokIdx The index of the current JSON token
- * @param loadedSprites A list of sprites, used for loading
- * @param ftr The attack hitbox to parse data into
- * @return int32_t The index of the JSON token after parsing
- */
-int32_t parseJsonAttackFrameHitbox(char* jsonStr, jsmntok_t* toks, int32_t tokIdx, namedSprite_t* loadedSprites,
-                                   attackHitbox_t* hbx)
-{
-    // Each attack is an object
-    if(JSMN_OBJECT != toks[tokIdx].type)
-    {
-        ESP_LOGE("JSON", "Non-object!!");
-    }
-
-    // Keep track of fields so we know when we're done
-    uint8_t numFieldsParsed = 0;
-    uint8_t numFieldsToParse = toks[tokIdx].size;
+        // Allocate attack frames individually so freeFighterData() can free them
+        atk->numAttackFrames = binAtk->numAttackFrames;
+        atk->attackFrames = calloc(atk->numAttackFrames, sizeof(attackFrame_t));
 
-    // Move to the first field
-    tokIdx++;
-
-    // Parse the tokens
-    while(true)
-    {
-        if(JSMN_STRING == toks[tokIdx].type)
+        const ftrBinAttackFrame_t* binFrms = (const ftrBinAttackFrame_t*)&buf[binAtk->attackFramesOffset];
+        for(uint8_t frmIdx = 0; frmIdx < atk->numAttackFrames; frmIdx++)
         {
-            if(0 == jsoneq(jsonStr, &toks[tokIdx], "relativePos_x"))
-            {
-                tokIdx++;
-                hbx->hitboxPos.x = jsonInteger(jsonStr, toks[tokIdx]) << SF;
-                tokIdx++;
-                numFieldsParsed++;
+            const ftrBinAttackFrame_t* binFrm = &binFrms[frmIdx];
+            attackFrame_t* frm = &atk->attackFrames[frmIdx];
+
+            ok &= loadOffsetSprite(&binFrm->sprite, spriteMap, bin->numSprites, &frm->sprite);
+            frm->hurtbox_offset.x = binFrm->hurtboxOffsetX;
+            frm->hurtbox_offset.y = binFrm->hurtboxOffsetY;
+            frm->hurtbox_size.x   = binFrm->hurtboxSizeX;
+            frm->hurtbox_size.y   = binFrm->hurtboxSizeY;
+            frm->velocity.x       = binFrm->veloX;
+            frm->velocity.y       = binFrm->veloY;
+            frm->duration         = binFrm->duration;
+            frm->iFrames          = binFrm->iFrames;
+
+            if((binFrm->numHitboxes > UINT8_MAX) ||
+                    !ftrBinInBounds(binFrm->hitboxesOffset, binFrm->numHitboxes, sizeof(ftrBinHitbox_t), sz))
+            {
+                ok = false;
+                continue;
+            }
+
+            frm->numHitboxes = binFrm->numHitboxes;
+            frm->hitboxes = calloc(frm->numHitboxes, sizeof(attackHitbox_t));
+
+            const ftrBinHitbox_t* binHbxs = (const ftrBinHitbox_t*)&buf[binFrm->hitboxesOffset];
+            for(uint8_t hbxIdx = 0; hbxIdx < frm->numHitboxes; hbxIdx++)
+            {
+                const ftrBinHitbox_t* binHbx = &binHbxs[hbxIdx];
+                attackHitbox_t* hbx = &frm->hitboxes[hbxIdx];
+
+                hbx->hitboxPos.x  = binHbx->posX;
+                hbx->hitboxPos.y  = binHbx->posY;
+                hbx->hitboxSize.x = binHbx->sizeX;
+                hbx->hitboxSize.y = binHbx->sizeY;
+                hbx->knockback.x  = binHbx->knockbackX;
+                hbx->knockback.y  = binHbx->knockbackY;
+                hbx->damage       = binHbx->damage;
+                hbx->hitstun      = binHbx->hitstun;
+                ok &= loadOffsetSprite(&binHbx->projSprite, spriteMap, bin->numSprites, &hbx->projSprite);
+                hbx->projVelo.x   = binHbx->projVeloX;
+                hbx->projVelo.y   = binHbx->projVeloY;
+                hbx->projAccel.x  = binHbx->projAccelX;
+                hbx->projAccel.y  = binHbx->projAccelY;
+                hbx->projDuration = binHbx->projDuration;
+                hbx->isProjectile = binHbx->isProjectile;
+                hbx->projPassThru = binHbx->projPassThru;
             }
-            else if(0 == jsoneq(jsonStr, &toks[tokIdx], "relativePos_y"))
-            {
-                tokIdx++;
-                hbx->hitboxPos.y = jsonInteger(jsonStr, toks[tokIdx]) << SF;
-                tokIdx++;
-                numFieldsParsed++;
-            }
-            else if(0 == jsoneq(jsonStr, &toks[tokIdx], "size_x"))
-            {
-                tokIdx++;
-                hbx->hitboxSize.x = jsonInteger(jsonStr, toks[tokIdx]) << SF;
-                tokIdx++;
-                numFieldsParsed++;
-            }
-            else if(0 == jsoneq(jsonStr, &toks[tokIdx], "size_y"))
-            {
-                tokIdx++;
-                hbx->hitboxSize.y = jsonInteger(jsonStr, toks[tokIdx]) << SF;
-                tokIdx++;
-                numFieldsParsed++;
-            }
-            else if(0 == jsoneq(jsonStr, &toks[tokIdx], "damage"))
-            {
-                tokIdx++;
-                hbx->damage = jsonInteger(jsonStr, toks[tokIdx]);
-                tokIdx++;
-                numFieldsParsed++;
-            }
-            else if(0 == jsoneq(jsonStr, &toks[tokIdx], "knockback_x"))
-            {
-                tokIdx++;
-                hbx->knockback.x = jsonInteger(jsonStr, toks[tokIdx]);
-                tokIdx++;
-                numFieldsParsed++;
-            }
-            else if(0 == jsoneq(jsonStr, &toks[tokIdx], "knockback_y"))
-            {
-                tokIdx++;
-                hbx->knockback.y = jsonInteger(jsonStr, toks[tokIdx]);
-                tokIdx++;
-                numFieldsParsed++;
-            }
-            else if(0 == jsoneq(jsonStr, &toks[tokIdx], "hitstun"))
-            {
-                tokIdx++;
-                // Convert ms to frames
-                hbx->hitstun = jsonInteger(jsonStr, toks[tokIdx]) / FRAME_TIME_MS;
-                // Allow 0 frames hitstun
-                tokIdx++;
-                numFieldsParsed++;
-            }
-            else if(0 == jsoneq(jsonStr, &toks[tokIdx], "isProjectile"))
-            {
-                tokIdx++;
-                hbx->isProjectile = jsonBoolean(jsonStr, toks[tokIdx]);
-                tokIdx++;
-                numFieldsParsed++;
-            }
-            else if(0 == jsoneq(jsonStr, &toks[tokIdx], "projectileSprite"))
-            {
-                tokIdx++;
-                char* name = jsonString(jsonStr, toks[tokIdx]);
-                tokIdx = parseJsonOffsetSprite(jsonStr, toks, tokIdx, loadedSprites, &hbx->projSprite);
-                free(name);
-                numFieldsParsed++;
-            }
-            else if(0 == jsoneq(jsonStr, &toks[tokIdx], "projectileDuration"))
-            {
-                tokIdx++;
-                // Convert ms to frames
-                hbx->projDuration = jsonInteger(jsonStr, toks[tokIdx]) / FRAME_TIME_MS;
-                if(0 == hbx->projDuration)
-                {
-                    hbx->projDuration = 1;
-                }
-                tokIdx++;
-                numFieldsParsed++;
-            }
-            else if(0 == jsoneq(jsonStr, &toks[tokIdx], "projectileVelo_x"))
-            {
-                tokIdx++;
-                hbx->projVelo.x = jsonInteger(jsonStr, toks[tokIdx]);
-                tokIdx++;
-                numFieldsParsed++;
-            }
-            else if(0 == jsoneq(jsonStr, &toks[tokIdx], "projectileVelo_y"))
-            {
-                tokIdx++;
-                hbx->projVelo.y = jsonInteger(jsonStr, toks[tokIdx]);
-                tokIdx++;
-                numFieldsParsed++;
-            }
-            else if(0 == jsoneq(jsonStr, &toks[tokIdx], "projectileAccel_x"))
-            {
-                tokIdx++;
-                hbx->projAccel.x = jsonInteger(jsonStr, toks[tokIdx]);
-                tokIdx++;
-                numFieldsParsed++;
-            }
-            else if(0 == jsoneq(jsonStr, &toks[tokIdx], "projectileAccel_y"))
-            {
-                tokIdx++;
-                hbx->projAccel.y = jsonInteger(jsonStr, toks[tokIdx]);
-                tokIdx++;
-                numFieldsParsed++;
-            }
-            else if(0 == jsoneq(jsonStr, &toks[tokIdx], "projectilePassThru"))
-            {
-                tokIdx++;
-                hbx->projPassThru = jsonBoolean(jsonStr, toks[tokIdx]);
-                tokIdx++;
-                numFieldsParsed++;
-            }
-        }
-        else
-        {
-            ESP_LOGE("JSON", "Non-string key!!");
-        }
-
-        // Check to return
-        if(numFieldsParsed == numFieldsToParse)
-        {
-            return tokIdx;
         }
     }
-    return tokIdx;
-}
 
-/**
- * @brief Parse an offset sprite JSON object
- *
- * @param jsonStr The whole JSON string
- * @param toks An array of JSON tokens
- * @param tokIdx The index of the current JSON token
- * @param loadedSprites A list of sprites, used for loading
- * @param os The offset sprite to load data into
- * @return The index of the JSON token after parsing
- */
-int32_t parseJsonOffsetSprite(char* jsonStr, jsmntok_t* toks, int32_t tokIdx,
-                              namedSprite_t* loadedSprites, offsetSprite_t* os)
-{
-    // Each attack is an object
-    if(JSMN_OBJECT != toks[tokIdx].type)
+    if(!ok)
     {
-        ESP_LOGE("JSON", "Non-object!!");
+        ESP_LOGE("FTR", "%s has sprites or attack data out of bounds", ftrFile);
     }
 
-    // Keep track of fields so we know when we're done
-    uint8_t numFieldsParsed = 0;
-    uint8_t numFieldsToParse = toks[tokIdx].size;
-
-    // Move to the first field
-    tokIdx++;
-
-    // Parse the tokens
-    while(true)
-    {
-        if(JSMN_STRING == toks[tokIdx].type)
-        {
-            if (0 == jsoneq(jsonStr, &toks[tokIdx], "sprite"))
-            {
-                tokIdx++;
-                char* name = jsonString(jsonStr, toks[tokIdx]);
-                os->spriteIdx = loadFighterSprite(name, loadedSprites);
-                free(name);
-                tokIdx++;
-                numFieldsParsed++;
-            }
-            else if (0 == jsoneq(jsonStr, &toks[tokIdx], "off_x"))
-            {
-                tokIdx++;
-                os->offset.x = jsonInteger(jsonStr, toks[tokIdx]);
-                tokIdx++;
-                numFieldsParsed++;
-            }
-            else if (0 == jsoneq(jsonStr, &toks[tokIdx], "off_y"))
-            {
-                tokIdx++;
-                os->offset.y = jsonInteger(jsonStr, toks[tokIdx]);
-                tokIdx++;
-                numFieldsParsed++;
-            }
-        }
-        else
-        {
-            ESP_LOGE("JSON", "Non-string key!!");
-        }
-
-        // Check to return
-        if(numFieldsParsed == numFieldsToParse)
-        {
-            return tokIdx;
-        }
-    }
-    return tokIdx;
+    free(spriteMap);
+    free(buf);
+    return ok;
 }
 
 /**
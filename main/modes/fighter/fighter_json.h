@@ -6,6 +6,7 @@
 //==============================================================================
 
 #include "mode_fighter.h"
+#include "fighter_bin.h"
 
 //==============================================================================
 // Defines
@@ -28,7 +29,7 @@ typedef struct
 // Function declarations
 //==============================================================================
 
-void loadJsonFighterData(fighter_t* fighter, const char* jsonFile, namedSprite_t* loadedSprites);
+bool loadFighterData(fighter_t* fighter, const char* ftrFile, namedSprite_t* loadedSprites);
 void freeFighterData(fighter_t* fighter, uint8_t numFighters);
 
 void freeFighterSprites(namedSprite_t* loadedSprites);
@@ -25,7 +25,7 @@
 //==============================================================================
 
 #define VER_LEN 7
-#define FTR_VERSION "221112a" // must be seven chars! yymmddl
+#define FTR_VERSION "261018a" // must be seven chars! yymmddl
 
 #define FIGHTER_MENU_IDLE_US (1000000 * 15)
 
@@ -50,7 +50,6 @@ typedef enum
     CHAR_SEL_MSG,
     STAGE_SEL_MSG,
     BUTTON_INPUT_MSG,
-    MP_COMPOSED_SCENE_MSG,
     MP_GAME_OVER_MSG
 } fighterMessageType_t;
 
@@ -314,8 +313,10 @@ void fighterMainLoop(int64_t elapsedUs)
                 fm->characters[1] = esp_random() % SANDBAG;
                 fm->stage = esp_random() % HR_STADIUM;
                 // CPU Battle!
-                fighterStartGame(fm->disp, &fm->mmFont, CPU_ONLY, fm->characters, fm->stage, true);
-                fm->screen = FIGHTER_GAME;
+                if(fighterStartGame(fm->disp, &fm->mmFont, CPU_ONLY, fm->characters, fm->stage, true))
+                {
+                    fm->screen = FIGHTER_GAME;
+                }
             }
             else
             {
@@ -793,8 +794,10 @@ void fighterHrMenuCb(const char* opt)
     }
 
     // No return, start the game
-    fighterStartGame(fm->disp, &fm->mmFont, HR_CONTEST, fm->characters, fm->stage, true);
-    fm->screen = FIGHTER_GAME;
+    if(fighterStartGame(fm->disp, &fm->mmFont, HR_CONTEST, fm->characters, fm->stage, true))
+    {
+        fm->screen = FIGHTER_GAME;
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -977,8 +980,10 @@ void fighterVsCpuStageMenuCb(const char* opt)
         return;
     }
 
-    fighterStartGame(fm->disp, &fm->mmFont, VS_CPU, fm->characters, fm->stage, true);
-    fm->screen = FIGHTER_GAME;
+    if(fighterStartGame(fm->disp, &fm->mmFont, VS_CPU, fm->characters, fm->stage, true))
+    {
+        fm->screen = FIGHTER_GAME;
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1303,8 +1308,10 @@ void fighterLocalVsStageMenuCb(const char* opt)
     }
 
     // No return, start the game
-    fighterStartGame(fm->disp, &fm->mmFont, LOCAL_VS, fm->characters, fm->stage, true);
-    fm->screen = FIGHTER_GAME;
+    if(fighterStartGame(fm->disp, &fm->mmFont, LOCAL_VS, fm->characters, fm->stage, true))
+    {
+        fm->screen = FIGHTER_GAME;
+    }
 }
 
 #endif // defined(EMU)
@@ -1427,10 +1434,10 @@ void fighterP2pMsgRxCbFn(p2pInfo* p2p, const uint8_t* payload, uint8_t len)
         }
         case FIGHTER_GAME:
         {
-            if(BUTTON_INPUT_MSG == payload[0])
+            if((BUTTON_INPUT_MSG == payload[0]) && (len >= sizeof(fighterInputMsg_t)))
             {
                 // Receive button inputs, so save them
-                fighterRxButtonInput(payload[1]);
+                fighterRxButtonInput((const fighterInputMsg_t*)payload);
             }
             break;
         }
@@ -1470,13 +1477,13 @@ void fighterP2pMsgTxCbFn(p2pInfo* p2p, messageStatus_t status, const uint8_t* da
                 // If there is any data
                 if(dataLen > 0)
                 {
-                    // If this is a scene
-                    if(MP_COMPOSED_SCENE_MSG == data[0])
+                    // If these are the other swadge's button inputs
+                    if((BUTTON_INPUT_MSG == data[0]) && (dataLen >= sizeof(fighterInputMsg_t)))
                     {
-                        // Pull composed scene out of the ack, setup for render
-                        fighterRxScene((const fighterScene_t*) data, dataLen);
+                        // Pull inputs out of the ack
+                        fighterRxButtonInput((const fighterInputMsg_t*)data);
                         // Then send buttons again
-                        fighterSendButtonsToOther(fighterGetButtonState());
+                        fighterSendButtonsToOther();
                     }
                     // Or if this is a game over
                     else if(MP_GAME_OVER_MSG == data[0])
@@ -1496,13 +1503,24 @@ void fighterP2pMsgTxCbFn(p2pInfo* p2p, messageStatus_t status, const uint8_t* da
                 {
                     // There was no data in the ACK, but keep the loop
                     // alive by sending button state again
-                    fighterSendButtonsToOther(fighterGetButtonState());
+                    fighterSendButtonsToOther();
                 }
             }
             break;
         }
         case MSG_FAILED:
         {
+            // After the game, the other swadge may have already left
+            if(FIGHTER_MP_RESULT == fm->screen)
+            {
+                break;
+            }
+            // If player 1 lost the result from player 0, but knows the game
+            // is over, show its own result instead of leaving
+            else if((FIGHTER_GAME == fm->screen) && fighterEndMpGameIfOver())
+            {
+                break;
+            }
             setFighterMainMenu(false);
             break;
         }
@@ -1522,9 +1540,11 @@ void fighterCheckGameBegin(void)
             fm->stage != NO_STAGE)
     {
         // Characters and stage set, start the game!
-        fighterStartGame(fm->disp, &fm->mmFont, MULTIPLAYER, fm->characters,
-                         fm->stage, GOING_FIRST == fm->p2p.cnc.playOrder);
-        fm->screen = FIGHTER_GAME;
+        if(fighterStartGame(fm->disp, &fm->mmFont, MULTIPLAYER, fm->characters,
+                            fm->stage, GOING_FIRST == fm->p2p.cnc.playOrder))
+        {
+            fm->screen = FIGHTER_GAME;
+        }
     }
 }
 
@@ -1541,35 +1561,30 @@ void fighterSendVersionToOther(void)
 }
 
 /**
- * @brief Send a packet to the other swadge with this's player's button input
- *
- * @param btnState This swadge's current button state
+ * @brief Send a packet to the other swadge with this player's most recent
+ * button inputs. This is used by player 1
  */
-void fighterSendButtonsToOther(int32_t btnState)
+void fighterSendButtonsToOther(void)
 {
-    const uint8_t payload[] =
-    {
-        BUTTON_INPUT_MSG,
-        btnState // This clips 32 bits to 8 bits, but there are 8 buttons anyway
-    };
+    fighterInputMsg_t msg;
+    fighterGetInputMsg(&msg);
+    msg.msgType = BUTTON_INPUT_MSG;
     // Send button state to the other swawdge
-    p2pSendMsg(&fm->p2p, payload, sizeof(payload), fighterP2pMsgTxCbFn);
+    p2pSendMsg(&fm->p2p, (const uint8_t*)&msg, sizeof(msg), fighterP2pMsgTxCbFn);
     fm->lastSentMsg = BUTTON_INPUT_MSG;
 }
 
 /**
- * Set up a scene to be sent to the other Swadge in an ACK for a button input
- * message
- *
- * @param scene The scene to be sent in the ACK
- * @param len The length of the scene to be sent
+ * Set up this player's most recent button inputs to be sent to the other
+ * Swadge in an ACK for a button input message. This is used by player 0
  */
-void fighterSendSceneToOther(fighterScene_t* scene, uint8_t len)
+void fighterSetButtonsInAck(void)
 {
-    // Fill in the type byte
-    scene->msgType = MP_COMPOSED_SCENE_MSG;
-    // Embed the composed scene in the p2p ack
-    p2pSetDataInAck(&(fm->p2p), (const uint8_t*)scene, len);
+    fighterInputMsg_t msg;
+    fighterGetInputMsg(&msg);
+    msg.msgType = BUTTON_INPUT_MSG;
+    // Embed the inputs in the p2p ack
+    p2pSetDataInAck(&(fm->p2p), (const uint8_t*)&msg, sizeof(msg));
 }
 
 /**
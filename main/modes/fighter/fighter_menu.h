@@ -10,8 +10,8 @@ extern const char* const charNamesShort[3];
 extern const char str_multiplayer[];
 extern const char str_hrContest[];
 
-void fighterSendButtonsToOther(int32_t btnState);
-void fighterSendSceneToOther(fighterScene_t* scene, uint8_t len);
+void fighterSendButtonsToOther(void);
+void fighterSetButtonsInAck(void);
 void fighterShowHrResult(fightingCharacter_t character, vector_t position,
                          vector_t velocity, int32_t gravity, int32_t platformStartX, int32_t platformEndX);
 void fighterShowMpResult(uint32_t roundTimeMs,
@@ -1,1526 +0,0 @@
-#include "fighter_music.h"
-
-const song_t battlefield_music =
-{
-    .notes =
-    {
-        {.note = D_2, .timeMs = 172},
-        {.note = SILENCE, .timeMs = 172},
-        {.note = D_3, .timeMs = 43},
-        {.note = F_3, .timeMs = 43},
-        {.note = A_3, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = SILENCE, .timeMs = 344},
-        {.note = D_2, .timeMs = 86},
-        {.note = SILENCE, .timeMs = 86},
-        {.note = D_3, .timeMs = 43},
-        {.note = F_3, .timeMs = 43},
-        {.note = A_3, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = SILENCE, .timeMs = 172},
-        {.note = D_2, .timeMs = 172},
-        {.note = SILENCE, .timeMs = 172},
-        {.note = D_3, .timeMs = 43},
-        {.note = G_3, .timeMs = 43},
-        {.note = B_3, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = SILENCE, .timeMs = 344},
-        {.note = D_2, .timeMs = 86},
-        {.note = SILENCE, .timeMs = 86},
-        {.note = D_3, .timeMs = 43},
-        {.note = G_3, .timeMs = 43},
-        {.note = B_3, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = SILENCE, .timeMs = 172},
-        {.note = D_2, .timeMs = 172},
-        {.note = SILENCE, .timeMs = 172},
-        {.note = D_3, .timeMs = 43},
-        {.note = A_3, .timeMs = 43},
-        {.note = C_4, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = SILENCE, .timeMs = 344},
-        {.note = D_2, .timeMs = 86},
-        {.note = SILENCE, .timeMs = 86},
-        {.note = D_3, .timeMs = 43},
-        {.note = A_3, .timeMs = 43},
-        {.note = C_4, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = SILENCE, .timeMs = 172},
-        {.note = D_2, .timeMs = 172},
-        {.note = SILENCE, .timeMs = 172},
-        {.note = D_3, .timeMs = 43},
-        {.note = G_3, .timeMs = 43},
-        {.note = B_3, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = SILENCE, .timeMs = 344},
-        {.note = D_2, .timeMs = 86},
-        {.note = SILENCE, .timeMs = 86},
-        {.note = D_3, .timeMs = 43},
-        {.note = G_3, .timeMs = 43},
-        {.note = B_3, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = SILENCE, .timeMs = 172},
-        {.note = D_2, .timeMs = 172},
-        {.note = SILENCE, .timeMs = 172},
-        {.note = D_3, .timeMs = 43},
-        {.note = F_3, .timeMs = 43},
-        {.note = A_3, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = SILENCE, .timeMs = 344},
-        {.note = D_2, .timeMs = 86},
-        {.note = SILENCE, .timeMs = 86},
-        {.note = D_3, .timeMs = 43},
-        {.note = F_3, .timeMs = 43},
-        {.note = A_3, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = SILENCE, .timeMs = 172},
-        {.note = C_2, .timeMs = 172},
-        {.note = SILENCE, .timeMs = 172},
-        {.note = E_3, .timeMs = 43},
-        {.note = G_3, .timeMs = 43},
-        {.note = C_4, .timeMs = 43},
-        {.note = E_4, .timeMs = 43},
-        {.note = SILENCE, .timeMs = 344},
-        {.note = C_2, .timeMs = 86},
-        {.note = SILENCE, .timeMs = 86},
-        {.note = E_3, .timeMs = 43},
-        {.note = G_3, .timeMs = 43},
-        {.note = C_4, .timeMs = 43},
-        {.note = E_4, .timeMs = 43},
-        {.note = SILENCE, .timeMs = 172},
-        {.note = A_SHARP_1, .timeMs = 172},
-        {.note = SILENCE, .timeMs = 172},
-        {.note = F_3, .timeMs = 43},
-        {.note = A_SHARP_3, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = F_4, .timeMs = 43},
-        {.note = SILENCE, .timeMs = 344},
-        {.note = A_SHARP_1, .timeMs = 86},
-        {.note = SILENCE, .timeMs = 86},
-        {.note = F_3, .timeMs = 43},
-        {.note = A_SHARP_3, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = F_4, .timeMs = 43},
-        {.note = SILENCE, .timeMs = 172},
-        {.note = E_2, .timeMs = 172},
-        {.note = G_3, .timeMs = 43},
-        {.note = A_SHARP_3, .timeMs = 43},
-        {.note = E_4, .timeMs = 43},
-        {.note = G_4, .timeMs = 43},
-        {.note = A_1, .timeMs = 86},
-        {.note = SILENCE, .timeMs = 86},
-        {.note = C_SHARP_3, .timeMs = 43},
-        {.note = E_3, .timeMs = 43},
-        {.note = A_3, .timeMs = 43},
-        {.note = C_SHARP_4, .timeMs = 43},
-        {.note = E_4, .timeMs = 344},
-        {.note = SILENCE, .timeMs = 344},
-        {.note = D_2, .timeMs = 172},
-        {.note = A_5, .timeMs = 172},
-        {.note = D_3, .timeMs = 43},
-        {.note = F_3, .timeMs = 43},
-        {.note = A_3, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = G_5, .timeMs = 172},
-        {.note = F_5, .timeMs = 172},
-        {.note = D_2, .timeMs = 86},
-        {.note = SILENCE, .timeMs = 86},
-        {.note = D_5, .timeMs = 43},
-        {.note = F_3, .timeMs = 43},
-        {.note = F_5, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = C_6, .timeMs = 172},
-        {.note = D_2, .timeMs = 172},
-        {.note = B_5, .timeMs = 172},
-        {.note = D_3, .timeMs = 43},
-        {.note = G_3, .timeMs = 43},
-        {.note = B_3, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = A_5, .timeMs = 172},
-        {.note = G_5, .timeMs = 172},
-        {.note = D_2, .timeMs = 86},
-        {.note = G_5, .timeMs = 86},
-        {.note = D_3, .timeMs = 43},
-        {.note = G_3, .timeMs = 43},
-        {.note = B_3, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = A_5, .timeMs = 172},
-        {.note = D_2, .timeMs = 172},
-        {.note = A_5, .timeMs = 172},
-        {.note = D_3, .timeMs = 43},
-        {.note = A_3, .timeMs = 43},
-        {.note = C_4, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = G_5, .timeMs = 172},
-        {.note = F_5, .timeMs = 172},
-        {.note = D_2, .timeMs = 86},
-        {.note = D_5, .timeMs = 86},
-        {.note = D_3, .timeMs = 43},
-        {.note = A_3, .timeMs = 43},
-        {.note = C_4, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = E_5, .timeMs = 172},
-        {.note = D_2, .timeMs = 172},
-        {.note = E_5, .timeMs = 172},
-        {.note = D_3, .timeMs = 43},
-        {.note = G_3, .timeMs = 43},
-        {.note = B_3, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = E_5, .timeMs = 344},
-        {.note = D_2, .timeMs = 86},
-        {.note = SILENCE, .timeMs = 86},
-        {.note = D_3, .timeMs = 43},
-        {.note = G_3, .timeMs = 43},
-        {.note = B_3, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = F_5, .timeMs = 43},
-        {.note = E_5, .timeMs = 43},
-        {.note = C_5, .timeMs = 43},
-        {.note = A_4, .timeMs = 43},
-        {.note = D_2, .timeMs = 172},
-        {.note = A_5, .timeMs = 172},
-        {.note = D_3, .timeMs = 43},
-        {.note = F_3, .timeMs = 43},
-        {.note = A_3, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = G_5, .timeMs = 172},
-        {.note = F_5, .timeMs = 172},
-        {.note = D_2, .timeMs = 86},
-        {.note = SILENCE, .timeMs = 86},
-        {.note = D_5, .timeMs = 43},
-        {.note = F_3, .timeMs = 43},
-        {.note = F_5, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = C_6, .timeMs = 172},
-        {.note = C_2, .timeMs = 172},
-        {.note = G_5, .timeMs = 172},
-        {.note = E_3, .timeMs = 43},
-        {.note = G_3, .timeMs = 43},
-        {.note = C_4, .timeMs = 43},
-        {.note = E_4, .timeMs = 43},
-        {.note = A_SHARP_5, .timeMs = 172},
-        {.note = A_5, .timeMs = 172},
-        {.note = C_2, .timeMs = 86},
-        {.note = G_5, .timeMs = 86},
-        {.note = E_3, .timeMs = 43},
-        {.note = G_3, .timeMs = 43},
-        {.note = C_4, .timeMs = 43},
-        {.note = E_4, .timeMs = 43},
-        {.note = A_5, .timeMs = 172},
-        {.note = A_SHARP_1, .timeMs = 172},
-        {.note = A_SHARP_5, .timeMs = 172},
-        {.note = F_3, .timeMs = 43},
-        {.note = A_SHARP_3, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = F_4, .timeMs = 43},
-        {.note = A_5, .timeMs = 172},
-        {.note = G_5, .timeMs = 172},
-        {.note = A_SHARP_1, .timeMs = 86},
-        {.note = F_5, .timeMs = 86},
-        {.note = F_3, .timeMs = 43},
-        {.note = A_SHARP_3, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = F_4, .timeMs = 43},
-        {.note = E_5, .timeMs = 172},
-        {.note = E_2, .timeMs = 172},
-        {.note = G_5, .timeMs = 86},
-        {.note = A_SHARP_3, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = A_1, .timeMs = 86},
-        {.note = E_5, .timeMs = 86},
-        {.note = E_3, .timeMs = 43},
-        {.note = G_3, .timeMs = 43},
-        {.note = A_3, .timeMs = 43},
-        {.note = C_SHARP_4, .timeMs = 43},
-        {.note = A_5, .timeMs = 344},
-        {.note = C_SHARP_6, .timeMs = 86},
-        {.note = A_SHARP_5, .timeMs = 86},
-        {.note = A_5, .timeMs = 86},
-        {.note = G_SHARP_5, .timeMs = 86},
-        {.note = D_2, .timeMs = 172},
-        {.note = A_5, .timeMs = 172},
-        {.note = D_3, .timeMs = 43},
-        {.note = F_3, .timeMs = 43},
-        {.note = A_3, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = G_5, .timeMs = 172},
-        {.note = F_5, .timeMs = 172},
-        {.note = D_2, .timeMs = 86},
-        {.note = SILENCE, .timeMs = 86},
-        {.note = D_5, .timeMs = 43},
-        {.note = F_3, .timeMs = 43},
-        {.note = F_5, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = C_6, .timeMs = 172},
-        {.note = D_2, .timeMs = 172},
-        {.note = B_5, .timeMs = 172},
-        {.note = D_3, .timeMs = 43},
-        {.note = G_3, .timeMs = 43},
-        {.note = B_3, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = A_5, .timeMs = 172},
-        {.note = G_5, .timeMs = 172},
-        {.note = D_2, .timeMs = 86},
-        {.note = G_5, .timeMs = 86},
-        {.note = D_3, .timeMs = 43},
-        {.note = G_3, .timeMs = 43},
-        {.note = B_3, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = A_5, .timeMs = 172},
-        {.note = D_2, .timeMs = 172},
-        {.note = A_5, .timeMs = 172},
-        {.note = D_3, .timeMs = 43},
-        {.note = A_3, .timeMs = 43},
-        {.note = C_4, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = G_5, .timeMs = 172},
-        {.note = F_5, .timeMs = 172},
-        {.note = D_2, .timeMs = 86},
-        {.note = D_5, .timeMs = 86},
-        {.note = D_3, .timeMs = 43},
-        {.note = A_3, .timeMs = 43},
-        {.note = C_4, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = E_5, .timeMs = 172},
-        {.note = D_2, .timeMs = 172},
-        {.note = E_5, .timeMs = 172},
-        {.note = D_3, .timeMs = 43},
-        {.note = G_3, .timeMs = 43},
-        {.note = B_3, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = E_5, .timeMs = 344},
-        {.note = D_2, .timeMs = 86},
-        {.note = SILENCE, .timeMs = 86},
-        {.note = D_3, .timeMs = 43},
-        {.note = G_3, .timeMs = 43},
-        {.note = B_3, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = F_5, .timeMs = 43},
-        {.note = E_5, .timeMs = 43},
-        {.note = C_5, .timeMs = 43},
-        {.note = A_4, .timeMs = 43},
-        {.note = D_2, .timeMs = 172},
-        {.note = A_5, .timeMs = 172},
-        {.note = D_3, .timeMs = 43},
-        {.note = F_3, .timeMs = 43},
-        {.note = A_3, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = G_5, .timeMs = 172},
-        {.note = F_5, .timeMs = 172},
-        {.note = D_2, .timeMs = 86},
-        {.note = SILENCE, .timeMs = 86},
-        {.note = D_5, .timeMs = 43},
-        {.note = F_3, .timeMs = 43},
-        {.note = F_5, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = C_6, .timeMs = 172},
-        {.note = A_SHARP_1, .timeMs = 172},
-        {.note = D_6, .timeMs = 172},
-        {.note = D_3, .timeMs = 43},
-        {.note = F_3, .timeMs = 43},
-        {.note = A_SHARP_3, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = A_SHARP_5, .timeMs = 172},
-        {.note = D_5, .timeMs = 172},
-        {.note = A_SHARP_1, .timeMs = 86},
-        {.note = E_5, .timeMs = 86},
-        {.note = D_3, .timeMs = 43},
-        {.note = F_3, .timeMs = 43},
-        {.note = A_SHARP_3, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = F_5, .timeMs = 172},
-        {.note = G_1, .timeMs = 172},
-        {.note = G_5, .timeMs = 172},
-        {.note = F_3, .timeMs = 43},
-        {.note = A_SHARP_3, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = F_4, .timeMs = 43},
-        {.note = A_5, .timeMs = 172},
-        {.note = D_5, .timeMs = 172},
-        {.note = G_1, .timeMs = 86},
-        {.note = E_5, .timeMs = 86},
-        {.note = F_3, .timeMs = 43},
-        {.note = A_SHARP_3, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = F_4, .timeMs = 43},
-        {.note = F_5, .timeMs = 172},
-        {.note = E_2, .timeMs = 172},
-        {.note = G_5, .timeMs = 86},
-        {.note = A_SHARP_3, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = A_1, .timeMs = 86},
-        {.note = E_5, .timeMs = 86},
-        {.note = E_3, .timeMs = 43},
-        {.note = G_3, .timeMs = 43},
-        {.note = A_3, .timeMs = 43},
-        {.note = C_SHARP_4, .timeMs = 43},
-        {.note = A_5, .timeMs = 689},
-        {.note = A_SHARP_1, .timeMs = 172},
-        {.note = SILENCE, .timeMs = 172},
-        {.note = D_3, .timeMs = 43},
-        {.note = F_3, .timeMs = 43},
-        {.note = A_3, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = SILENCE, .timeMs = 172},
-        {.note = A_5, .timeMs = 172},
-        {.note = A_SHARP_1, .timeMs = 86},
-        {.note = SILENCE, .timeMs = 86},
-        {.note = D_3, .timeMs = 43},
-        {.note = F_3, .timeMs = 43},
-        {.note = A_3, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = D_5, .timeMs = 172},
-        {.note = A_SHARP_1, .timeMs = 172},
-        {.note = SILENCE, .timeMs = 172},
-        {.note = E_3, .timeMs = 43},
-        {.note = G_3, .timeMs = 43},
-        {.note = C_4, .timeMs = 43},
-        {.note = E_4, .timeMs = 43},
-        {.note = G_5, .timeMs = 172},
-        {.note = SILENCE, .timeMs = 172},
-        {.note = A_SHARP_1, .timeMs = 86},
-        {.note = SILENCE, .timeMs = 86},
-        {.note = E_3, .timeMs = 43},
-        {.note = G_3, .timeMs = 43},
-        {.note = C_4, .timeMs = 43},
-        {.note = E_4, .timeMs = 43},
-        {.note = C_5, .timeMs = 172},
-        {.note = A_SHARP_1, .timeMs = 172},
-        {.note = SILENCE, .timeMs = 172},
-        {.note = F_3, .timeMs = 43},
-        {.note = A_SHARP_3, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = F_4, .timeMs = 43},
-        {.note = F_5, .timeMs = 172},
-        {.note = A_5, .timeMs = 172},
-        {.note = A_SHARP_1, .timeMs = 86},
-        {.note = SILENCE, .timeMs = 86},
-        {.note = F_3, .timeMs = 43},
-        {.note = A_SHARP_3, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = F_4, .timeMs = 43},
-        {.note = D_5, .timeMs = 172},
-        {.note = A_SHARP_1, .timeMs = 172},
-        {.note = E_5, .timeMs = 172},
-        {.note = G_3, .timeMs = 43},
-        {.note = C_4, .timeMs = 43},
-        {.note = E_4, .timeMs = 43},
-        {.note = G_4, .timeMs = 43},
-        {.note = G_5, .timeMs = 172},
-        {.note = C_6, .timeMs = 172},
-        {.note = A_SHARP_1, .timeMs = 86},
-        {.note = C_6, .timeMs = 86},
-        {.note = G_3, .timeMs = 43},
-        {.note = C_4, .timeMs = 43},
-        {.note = E_4, .timeMs = 43},
-        {.note = G_4, .timeMs = 43},
-        {.note = C_6, .timeMs = 86},
-        {.note = C_5, .timeMs = 86},
-        {.note = G_SHARP_2, .timeMs = 172},
-        {.note = SILENCE, .timeMs = 172},
-        {.note = F_3, .timeMs = 43},
-        {.note = G_SHARP_3, .timeMs = 43},
-        {.note = C_4, .timeMs = 43},
-        {.note = F_4, .timeMs = 43},
-        {.note = SILENCE, .timeMs = 172},
-        {.note = C_6, .timeMs = 172},
-        {.note = G_SHARP_2, .timeMs = 86},
-        {.note = SILENCE, .timeMs = 86},
-        {.note = F_3, .timeMs = 43},
-        {.note = G_SHARP_3, .timeMs = 43},
-        {.note = C_4, .timeMs = 43},
-        {.note = F_4, .timeMs = 43},
-        {.note = F_5, .timeMs = 172},
-        {.note = G_SHARP_2, .timeMs = 172},
-        {.note = SILENCE, .timeMs = 172},
-        {.note = G_3, .timeMs = 43},
-        {.note = A_SHARP_3, .timeMs = 43},
-        {.note = D_SHARP_4, .timeMs = 43},
-        {.note = G_4, .timeMs = 43},
-        {.note = A_SHARP_5, .timeMs = 172},
-        {.note = SILENCE, .timeMs = 172},
-        {.note = G_SHARP_2, .timeMs = 86},
-        {.note = SILENCE, .timeMs = 86},
-        {.note = G_3, .timeMs = 43},
-        {.note = A_SHARP_3, .timeMs = 43},
-        {.note = D_SHARP_4, .timeMs = 43},
-        {.note = G_4, .timeMs = 43},
-        {.note = D_SHARP_5, .timeMs = 172},
-        {.note = G_SHARP_2, .timeMs = 172},
-        {.note = F_5, .timeMs = 172},
-        {.note = G_SHARP_3, .timeMs = 43},
-        {.note = C_4, .timeMs = 43},
-        {.note = F_4, .timeMs = 43},
-        {.note = G_SHARP_4, .timeMs = 43},
-        {.note = C_6, .timeMs = 172},
-        {.note = A_SHARP_5, .timeMs = 172},
-        {.note = G_SHARP_2, .timeMs = 86},
-        {.note = G_SHARP_5, .timeMs = 86},
-        {.note = G_SHARP_3, .timeMs = 43},
-        {.note = C_4, .timeMs = 43},
-        {.note = F_4, .timeMs = 43},
-        {.note = G_SHARP_4, .timeMs = 43},
-        {.note = G_5, .timeMs = 172},
-        {.note = G_SHARP_2, .timeMs = 172},
-        {.note = A_SHARP_5, .timeMs = 172},
-        {.note = A_SHARP_3, .timeMs = 43},
-        {.note = D_SHARP_4, .timeMs = 43},
-        {.note = G_4, .timeMs = 43},
-        {.note = A_SHARP_4, .timeMs = 43},
-        {.note = G_5, .timeMs = 172},
-        {.note = D_SHARP_6, .timeMs = 172},
-        {.note = G_SHARP_2, .timeMs = 86},
-        {.note = D_SHARP_6, .timeMs = 86},
-        {.note = A_SHARP_3, .timeMs = 43},
-        {.note = D_SHARP_4, .timeMs = 43},
-        {.note = G_4, .timeMs = 43},
-        {.note = A_SHARP_4, .timeMs = 43},
-        {.note = D_SHARP_6, .timeMs = 172},
-        {.note = F_SHARP_2, .timeMs = 172},
-        {.note = D_SHARP_6, .timeMs = 172},
-        {.note = A_SHARP_3, .timeMs = 43},
-        {.note = C_SHARP_4, .timeMs = 43},
-        {.note = F_SHARP_4, .timeMs = 43},
-        {.note = A_SHARP_4, .timeMs = 43},
-        {.note = C_SHARP_6, .timeMs = 258},
-        {.note = E_2, .timeMs = 172},
-        {.note = C_SHARP_6, .timeMs = 86},
-        {.note = G_SHARP_3, .timeMs = 43},
-        {.note = B_3, .timeMs = 43},
-        {.note = E_4, .timeMs = 43},
-        {.note = G_SHARP_4, .timeMs = 43},
-        {.note = B_5, .timeMs = 258},
-        {.note = D_2, .timeMs = 172},
-        {.note = B_5, .timeMs = 86},
-        {.note = F_SHARP_3, .timeMs = 43},
-        {.note = A_3, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = F_SHARP_4, .timeMs = 43},
-        {.note = A_5, .timeMs = 258},
-        {.note = C_2, .timeMs = 172},
-        {.note = A_5, .timeMs = 86},
-        {.note = E_3, .timeMs = 43},
-        {.note = G_3, .timeMs = 43},
-        {.note = C_4, .timeMs = 43},
-        {.note = E_4, .timeMs = 43},
-        {.note = B_5, .timeMs = 172},
-        {.note = G_SHARP_5, .timeMs = 172},
-        {.note = C_SHARP_2, .timeMs = 86},
-        {.note = G_SHARP_5, .timeMs = 86},
-        {.note = F_3, .timeMs = 43},
-        {.note = G_SHARP_3, .timeMs = 43},
-        {.note = C_SHARP_4, .timeMs = 43},
-        {.note = F_4, .timeMs = 43},
-        {.note = G_SHARP_5, .timeMs = 172},
-        {.note = C_SHARP_2, .timeMs = 172},
-        {.note = SILENCE, .timeMs = 86},
-        {.note = G_SHARP_5, .timeMs = 86},
-        {.note = F_3, .timeMs = 43},
-        {.note = G_SHARP_3, .timeMs = 43},
-        {.note = C_SHARP_4, .timeMs = 43},
-        {.note = F_4, .timeMs = 43},
-        {.note = G_SHARP_5, .timeMs = 172},
-        {.note = SILENCE, .timeMs = 86},
-        {.note = G_SHARP_5, .timeMs = 86},
-        {.note = C_SHARP_2, .timeMs = 86},
-        {.note = G_SHARP_5, .timeMs = 86},
-        {.note = F_3, .timeMs = 43},
-        {.note = G_SHARP_3, .timeMs = 43},
-        {.note = C_SHARP_4, .timeMs = 43},
-        {.note = F_4, .timeMs = 43},
-        {.note = G_SHARP_5, .timeMs = 172},
-        {.note = D_SHARP_2, .timeMs = 172},
-        {.note = A_SHARP_5, .timeMs = 86},
-        {.note = SILENCE, .timeMs = 86},
-        {.note = G_3, .timeMs = 43},
-        {.note = A_SHARP_3, .timeMs = 43},
-        {.note = D_SHARP_4, .timeMs = 43},
-        {.note = G_4, .timeMs = 43},
-        {.note = G_5, .timeMs = 172},
-        {.note = D_2, .timeMs = 172},
-        {.note = A_5, .timeMs = 172},
-        {.note = D_3, .timeMs = 43},
-        {.note = F_3, .timeMs = 43},
-        {.note = A_3, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = A_5, .timeMs = 150},
-        {.note = SILENCE, .timeMs = 21},
-        {.note = A_5, .timeMs = 172},
-        {.note = D_2, .timeMs = 86},
-        {.note = SILENCE, .timeMs = 86},
-        {.note = D_3, .timeMs = 43},
-        {.note = F_3, .timeMs = 43},
-        {.note = A_3, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = A_5, .timeMs = 172},
-        {.note = D_2, .timeMs = 172},
-        {.note = G_5, .timeMs = 172},
-        {.note = D_3, .timeMs = 43},
-        {.note = G_3, .timeMs = 43},
-        {.note = B_3, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = G_5, .timeMs = 150},
-        {.note = SILENCE, .timeMs = 21},
-        {.note = G_5, .timeMs = 172},
-        {.note = D_2, .timeMs = 86},
-        {.note = SILENCE, .timeMs = 86},
-        {.note = D_3, .timeMs = 43},
-        {.note = G_3, .timeMs = 43},
-        {.note = B_3, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = G_5, .timeMs = 172},
-        {.note = D_2, .timeMs = 172},
-        {.note = F_5, .timeMs = 172},
-        {.note = D_3, .timeMs = 43},
-        {.note = A_3, .timeMs = 43},
-        {.note = C_4, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = F_5, .timeMs = 150},
-        {.note = SILENCE, .timeMs = 21},
-        {.note = F_5, .timeMs = 172},
-        {.note = D_2, .timeMs = 86},
-        {.note = SILENCE, .timeMs = 86},
-        {.note = D_3, .timeMs = 43},
-        {.note = A_3, .timeMs = 43},
-        {.note = C_4, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = F_5, .timeMs = 172},
-        {.note = D_2, .timeMs = 172},
-        {.note = E_5, .timeMs = 172},
-        {.note = D_3, .timeMs = 43},
-        {.note = G_3, .timeMs = 43},
-        {.note = B_3, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = E_5, .timeMs = 150},
-        {.note = SILENCE, .timeMs = 21},
-        {.note = E_5, .timeMs = 172},
-        {.note = D_2, .timeMs = 86},
-        {.note = SILENCE, .timeMs = 86},
-        {.note = D_3, .timeMs = 43},
-        {.note = G_3, .timeMs = 43},
-        {.note = B_3, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = E_5, .timeMs = 172},
-        {.note = D_2, .timeMs = 172},
-        {.note = A_5, .timeMs = 172},
-        {.note = D_3, .timeMs = 43},
-        {.note = F_3, .timeMs = 43},
-        {.note = A_3, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = A_5, .timeMs = 150},
-        {.note = SILENCE, .timeMs = 21},
-        {.note = A_5, .timeMs = 172},
-        {.note = D_2, .timeMs = 86},
-        {.note = SILENCE, .timeMs = 86},
-        {.note = D_3, .timeMs = 43},
-        {.note = F_3, .timeMs = 43},
-        {.note = A_3, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = A_5, .timeMs = 172},
-        {.note = C_2, .timeMs = 172},
-        {.note = G_5, .timeMs = 172},
-        {.note = E_3, .timeMs = 43},
-        {.note = G_3, .timeMs = 43},
-        {.note = C_4, .timeMs = 43},
-        {.note = E_4, .timeMs = 43},
-        {.note = G_5, .timeMs = 150},
-        {.note = SILENCE, .timeMs = 21},
-        {.note = G_5, .timeMs = 172},
-        {.note = C_2, .timeMs = 86},
-        {.note = SILENCE, .timeMs = 86},
-        {.note = E_3, .timeMs = 43},
-        {.note = G_3, .timeMs = 43},
-        {.note = C_4, .timeMs = 43},
-        {.note = E_4, .timeMs = 43},
-        {.note = G_5, .timeMs = 172},
-        {.note = A_SHARP_1, .timeMs = 172},
-        {.note = F_5, .timeMs = 172},
-        {.note = F_3, .timeMs = 43},
-        {.note = A_SHARP_3, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = F_4, .timeMs = 43},
-        {.note = F_5, .timeMs = 150},
-        {.note = SILENCE, .timeMs = 21},
-        {.note = F_5, .timeMs = 172},
-        {.note = A_SHARP_1, .timeMs = 86},
-        {.note = SILENCE, .timeMs = 86},
-        {.note = F_3, .timeMs = 43},
-        {.note = A_SHARP_3, .timeMs = 43},
-        {.note = D_4, .timeMs = 43},
-        {.note = F_4, .timeMs = 43},
-        {.note = F_5, .timeMs = 172},
-        {.note = E_2, .timeMs = 172},
-        {.note = G_5, .timeMs = 172},
-        {.note = A_1, .timeMs = 86},
-        {.note = SILENCE, .timeMs = 86},
-        {.note = C_SHARP_3, .timeMs = 43},
-        {.note = E_3, .timeMs = 43},
-        {.note = A_3, .timeMs = 43},
-        {.note = C_SHARP_4, .timeMs = 43},
-        {.note = E_5, .timeMs = 682},
-
-    },
-    .numNotes = 654,
-    .shouldLoop = true
-};
-
-const song_t final_dest_music =
-{
-    .notes =
-    {
-        {.note = A_4, .timeMs = 70},
-        {.note = SILENCE, .timeMs = 136},
-        {.note = A_4, .timeMs = 74},
-        {.note = SILENCE, .timeMs = 132},
-        {.note = D_3, .timeMs = 57},
-        {.note = SILENCE, .timeMs = 45},
-        {.note = F_4, .timeMs = 65},
-        {.note = SILENCE, .timeMs = 37},
-        {.note = A_4, .timeMs = 68},
-        {.note = SILENCE, .timeMs = 137},
-        {.note = A_4, .timeMs = 69},
-        {.note = SILENCE, .timeMs = 137},
-        {.note = D_3, .timeMs = 67},
-        {.note = SILENCE, .timeMs = 36},
-        {.note = F_4, .timeMs = 87},
-        {.note = SILENCE, .timeMs = 16},
-        {.note = A_4, .timeMs = 74},
-        {.note = SILENCE, .timeMs = 132},
-        {.note = A_4, .timeMs = 60},
-        {.note = SILENCE, .timeMs = 146},
-        {.note = D_3, .timeMs = 77},
-        {.note = SILENCE, .timeMs = 25},
-        {.note = F_4, .timeMs = 84},
-        {.note = SILENCE, .timeMs = 18},
-        {.note = B_4, .timeMs = 306},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_3, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = F_3, .timeMs = 68},
-        {.note = SILENCE, .timeMs = 34},
-        {.note = A_3, .timeMs = 68},
-        {.note = SILENCE, .timeMs = 34},
-        {.note = G_3, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_SHARP_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = E_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_2, .timeMs = 65},
-        {.note = SILENCE, .timeMs = 37},
-        {.note = C_SHARP_3, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 4},
-        {.note = A_4, .timeMs = 103},
-        {.note = SILENCE, .timeMs = 103},
-        {.note = A_4, .timeMs = 73},
-        {.note = SILENCE, .timeMs = 133},
-        {.note = D_3, .timeMs = 62},
-        {.note = SILENCE, .timeMs = 40},
-        {.note = F_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_4, .timeMs = 69},
-        {.note = SILENCE, .timeMs = 137},
-        {.note = A_4, .timeMs = 69},
-        {.note = SILENCE, .timeMs = 137},
-        {.note = D_3, .timeMs = 69},
-        {.note = SILENCE, .timeMs = 33},
-        {.note = F_4, .timeMs = 86},
-        {.note = SILENCE, .timeMs = 17},
-        {.note = A_4, .timeMs = 65},
-        {.note = SILENCE, .timeMs = 141},
-        {.note = A_4, .timeMs = 71},
-        {.note = SILENCE, .timeMs = 135},
-        {.note = D_3, .timeMs = 74},
-        {.note = SILENCE, .timeMs = 28},
-        {.note = F_4, .timeMs = 89},
-        {.note = SILENCE, .timeMs = 13},
-        {.note = G_4, .timeMs = 51},
-        {.note = SILENCE, .timeMs = 4},
-        {.note = D_SHARP_4, .timeMs = 43},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_4, .timeMs = 48},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_SHARP_4, .timeMs = 48},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_4, .timeMs = 48},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_SHARP_4, .timeMs = 48},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_4, .timeMs = 45},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_SHARP_4, .timeMs = 50},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_4, .timeMs = 43},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_2, .timeMs = 52},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_SHARP_2, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_2, .timeMs = 310},
-        {.note = SILENCE, .timeMs = 103},
-        {.note = C_SHARP_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = E_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_4, .timeMs = 82},
-        {.note = SILENCE, .timeMs = 124},
-        {.note = A_4, .timeMs = 69},
-        {.note = SILENCE, .timeMs = 137},
-        {.note = D_2, .timeMs = 74},
-        {.note = SILENCE, .timeMs = 28},
-        {.note = F_4, .timeMs = 74},
-        {.note = SILENCE, .timeMs = 28},
-        {.note = A_4, .timeMs = 68},
-        {.note = SILENCE, .timeMs = 137},
-        {.note = A_4, .timeMs = 72},
-        {.note = SILENCE, .timeMs = 134},
-        {.note = D_2, .timeMs = 69},
-        {.note = SILENCE, .timeMs = 33},
-        {.note = F_4, .timeMs = 75},
-        {.note = SILENCE, .timeMs = 27},
-        {.note = A_4, .timeMs = 68},
-        {.note = SILENCE, .timeMs = 138},
-        {.note = A_4, .timeMs = 62},
-        {.note = SILENCE, .timeMs = 144},
-        {.note = D_2, .timeMs = 74},
-        {.note = SILENCE, .timeMs = 28},
-        {.note = F_4, .timeMs = 93},
-        {.note = SILENCE, .timeMs = 9},
-        {.note = C_5, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = F_2, .timeMs = 103},
-        {.note = SILENCE, .timeMs = 103},
-        {.note = D_5, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = C_5, .timeMs = 43},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_5, .timeMs = 43},
-        {.note = SILENCE, .timeMs = 12},
-        {.note = C_5, .timeMs = 43},
-        {.note = SILENCE, .timeMs = 7},
-        {.note = B_4, .timeMs = 258},
-        {.note = SILENCE, .timeMs = 103},
-        {.note = G_2, .timeMs = 120},
-        {.note = SILENCE, .timeMs = 86},
-        {.note = A_4, .timeMs = 112},
-        {.note = SILENCE, .timeMs = 94},
-        {.note = A_SHARP_4, .timeMs = 410},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_SHARP_2, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = F_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_SHARP_2, .timeMs = 103},
-        {.note = SILENCE, .timeMs = 103},
-        {.note = G_4, .timeMs = 103},
-        {.note = SILENCE, .timeMs = 103},
-        {.note = A_4, .timeMs = 124},
-        {.note = SILENCE, .timeMs = 81},
-        {.note = G_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = E_2, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = E_2, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_SHARP_2, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = C_SHARP_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_2, .timeMs = 206},
-        {.note = D_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_2, .timeMs = 79},
-        {.note = SILENCE, .timeMs = 24},
-        {.note = E_4, .timeMs = 93},
-        {.note = SILENCE, .timeMs = 10},
-        {.note = F_4, .timeMs = 87},
-        {.note = SILENCE, .timeMs = 118},
-        {.note = A_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_2, .timeMs = 103},
-        {.note = SILENCE, .timeMs = 103},
-        {.note = D_2, .timeMs = 103},
-        {.note = SILENCE, .timeMs = 103},
-        {.note = D_4, .timeMs = 85},
-        {.note = SILENCE, .timeMs = 18},
-        {.note = F_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = C_5, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = B_4, .timeMs = 48},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_4, .timeMs = 48},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = B_4, .timeMs = 48},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_4, .timeMs = 48},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = B_4, .timeMs = 47},
-        {.note = SILENCE, .timeMs = 4},
-        {.note = G_4, .timeMs = 48},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = B_4, .timeMs = 48},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_4, .timeMs = 48},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = F_2, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_2, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_2, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = C_3, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = B_2, .timeMs = 410},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_2, .timeMs = 103},
-        {.note = SILENCE, .timeMs = 103},
-        {.note = G_4, .timeMs = 93},
-        {.note = SILENCE, .timeMs = 10},
-        {.note = A_4, .timeMs = 88},
-        {.note = SILENCE, .timeMs = 14},
-        {.note = A_SHARP_4, .timeMs = 410},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_SHARP_2, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_4, .timeMs = 88},
-        {.note = SILENCE, .timeMs = 14},
-        {.note = G_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = F_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_SHARP_2, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_SHARP_2, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = E_2, .timeMs = 103},
-        {.note = E_2, .timeMs = 103},
-        {.note = D_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_SHARP_2, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_SHARP_2, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = F_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_SHARP_2, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_SHARP_2, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = E_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_2, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_2, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_2, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = E_4, .timeMs = 94},
-        {.note = SILENCE, .timeMs = 8},
-        {.note = F_4, .timeMs = 103},
-        {.note = SILENCE, .timeMs = 103},
-        {.note = A_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_2, .timeMs = 120},
-        {.note = SILENCE, .timeMs = 86},
-        {.note = D_2, .timeMs = 120},
-        {.note = SILENCE, .timeMs = 86},
-        {.note = D_4, .timeMs = 85},
-        {.note = SILENCE, .timeMs = 18},
-        {.note = F_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = C_5, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = B_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_2, .timeMs = 103},
-        {.note = SILENCE, .timeMs = 103},
-        {.note = D_6, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = E_6, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = F_6, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_6, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_6, .timeMs = 48},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = E_6, .timeMs = 48},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_6, .timeMs = 48},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = E_6, .timeMs = 48},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_6, .timeMs = 48},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = E_6, .timeMs = 48},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_6, .timeMs = 48},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = E_6, .timeMs = 48},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_2, .timeMs = 111},
-        {.note = SILENCE, .timeMs = 95},
-        {.note = G_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_SHARP_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_SHARP_2, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_4, .timeMs = 272},
-        {.note = SILENCE, .timeMs = 37},
-        {.note = G_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = F_4, .timeMs = 93},
-        {.note = SILENCE, .timeMs = 10},
-        {.note = D_SHARP_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = E_2, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = C_SHARP_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_2, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_4, .timeMs = 410},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_2, .timeMs = 103},
-        {.note = SILENCE, .timeMs = 103},
-        {.note = D_2, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_2, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_2, .timeMs = 410},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_3, .timeMs = 111},
-        {.note = SILENCE, .timeMs = 95},
-        {.note = C_SHARP_4, .timeMs = 111},
-        {.note = SILENCE, .timeMs = 95},
-        {.note = D_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_2, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = E_4, .timeMs = 96},
-        {.note = SILENCE, .timeMs = 6},
-        {.note = F_4, .timeMs = 84},
-        {.note = SILENCE, .timeMs = 122},
-        {.note = A_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_2, .timeMs = 93},
-        {.note = SILENCE, .timeMs = 113},
-        {.note = D_2, .timeMs = 93},
-        {.note = SILENCE, .timeMs = 113},
-        {.note = D_4, .timeMs = 78},
-        {.note = SILENCE, .timeMs = 24},
-        {.note = F_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_4, .timeMs = 83},
-        {.note = SILENCE, .timeMs = 19},
-        {.note = C_5, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = B_4, .timeMs = 410},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_2, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = F_2, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_2, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = C_3, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = B_2, .timeMs = 410},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_2, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_4, .timeMs = 93},
-        {.note = SILENCE, .timeMs = 10},
-        {.note = A_SHARP_4, .timeMs = 410},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_SHARP_2, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_4, .timeMs = 81},
-        {.note = SILENCE, .timeMs = 22},
-        {.note = G_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = F_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_SHARP_2, .timeMs = 74},
-        {.note = SILENCE, .timeMs = 29},
-        {.note = G_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_SHARP_2, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = E_2, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_SHARP_2, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = F_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_SHARP_2, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = E_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_2, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_2, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = E_4, .timeMs = 95},
-        {.note = SILENCE, .timeMs = 7},
-        {.note = F_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 106},
-        {.note = A_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_2, .timeMs = 103},
-        {.note = SILENCE, .timeMs = 103},
-        {.note = D_2, .timeMs = 103},
-        {.note = SILENCE, .timeMs = 103},
-        {.note = D_4, .timeMs = 87},
-        {.note = SILENCE, .timeMs = 16},
-        {.note = F_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = C_5, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = B_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_2, .timeMs = 103},
-        {.note = SILENCE, .timeMs = 103},
-        {.note = F_6, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_6, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_6, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = C_7, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = B_6, .timeMs = 48},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_6, .timeMs = 48},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = B_6, .timeMs = 48},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_6, .timeMs = 48},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = B_6, .timeMs = 48},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_6, .timeMs = 48},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = B_6, .timeMs = 48},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_6, .timeMs = 48},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_2, .timeMs = 103},
-        {.note = SILENCE, .timeMs = 103},
-        {.note = G_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_SHARP_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = E_2, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_4, .timeMs = 306},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_4, .timeMs = 86},
-        {.note = SILENCE, .timeMs = 17},
-        {.note = F_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_SHARP_4, .timeMs = 189},
-        {.note = SILENCE, .timeMs = 17},
-        {.note = A_SHARP_2, .timeMs = 189},
-        {.note = SILENCE, .timeMs = 17},
-        {.note = C_SHARP_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_2, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_4, .timeMs = 310},
-        {.note = SILENCE, .timeMs = 103},
-        {.note = D_2, .timeMs = 103},
-        {.note = SILENCE, .timeMs = 103},
-        {.note = D_2, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_2, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_2, .timeMs = 206},
-        {.note = SILENCE, .timeMs = 206},
-        {.note = D_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = E_4, .timeMs = 97},
-        {.note = SILENCE, .timeMs = 6},
-        {.note = F_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_4, .timeMs = 96},
-        {.note = SILENCE, .timeMs = 6},
-        {.note = A_4, .timeMs = 413},
-        {.note = F_SHARP_2, .timeMs = 103},
-        {.note = SILENCE, .timeMs = 103},
-        {.note = F_SHARP_2, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = F_SHARP_2, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = F_SHARP_2, .timeMs = 310},
-        {.note = SILENCE, .timeMs = 103},
-        {.note = D_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = E_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = F_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_4, .timeMs = 97},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_4, .timeMs = 184},
-        {.note = SILENCE, .timeMs = 24},
-        {.note = F_SHARP_2, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_4, .timeMs = 120},
-        {.note = SILENCE, .timeMs = 86},
-        {.note = F_SHARP_2, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = F_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = E_4, .timeMs = 85},
-        {.note = SILENCE, .timeMs = 18},
-        {.note = D_4, .timeMs = 103},
-        {.note = SILENCE, .timeMs = 103},
-        {.note = E_4, .timeMs = 84},
-        {.note = SILENCE, .timeMs = 18},
-        {.note = F_SHARP_2, .timeMs = 103},
-        {.note = F_4, .timeMs = 94},
-        {.note = SILENCE, .timeMs = 112},
-        {.note = G_4, .timeMs = 95},
-        {.note = SILENCE, .timeMs = 110},
-        {.note = A_4, .timeMs = 307},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_2, .timeMs = 103},
-        {.note = SILENCE, .timeMs = 206},
-        {.note = G_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_2, .timeMs = 95},
-        {.note = SILENCE, .timeMs = 111},
-        {.note = G_2, .timeMs = 103},
-        {.note = SILENCE, .timeMs = 103},
-        {.note = A_SHARP_5, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_6, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_6, .timeMs = 293},
-        {.note = SILENCE, .timeMs = 17},
-        {.note = G_2, .timeMs = 103},
-        {.note = SILENCE, .timeMs = 206},
-        {.note = G_6, .timeMs = 74},
-        {.note = SILENCE, .timeMs = 29},
-        {.note = A_6, .timeMs = 68},
-        {.note = SILENCE, .timeMs = 34},
-        {.note = D_6, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_2, .timeMs = 103},
-        {.note = SILENCE, .timeMs = 103},
-        {.note = G_2, .timeMs = 93},
-        {.note = SILENCE, .timeMs = 9},
-        {.note = E_4, .timeMs = 84},
-        {.note = SILENCE, .timeMs = 18},
-        {.note = F_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_4, .timeMs = 206},
-        {.note = SILENCE, .timeMs = 103},
-        {.note = B_2, .timeMs = 103},
-        {.note = SILENCE, .timeMs = 206},
-        {.note = D_4, .timeMs = 155},
-        {.note = SILENCE, .timeMs = 51},
-        {.note = A_4, .timeMs = 155},
-        {.note = SILENCE, .timeMs = 51},
-        {.note = F_SHARP_2, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = C_SHARP_3, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = B_2, .timeMs = 155},
-        {.note = SILENCE, .timeMs = 51},
-        {.note = D_4, .timeMs = 103},
-        {.note = SILENCE, .timeMs = 103},
-        {.note = A_4, .timeMs = 310},
-        {.note = G_4, .timeMs = 103},
-        {.note = B_2, .timeMs = 103},
-        {.note = SILENCE, .timeMs = 103},
-        {.note = F_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = E_4, .timeMs = 98},
-        {.note = SILENCE, .timeMs = 5},
-        {.note = D_4, .timeMs = 98},
-        {.note = SILENCE, .timeMs = 108},
-        {.note = E_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = B_2, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = F_4, .timeMs = 93},
-        {.note = SILENCE, .timeMs = 113},
-        {.note = G_4, .timeMs = 105},
-        {.note = SILENCE, .timeMs = 101},
-        {.note = G_4, .timeMs = 410},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = C_3, .timeMs = 137},
-        {.note = SILENCE, .timeMs = 68},
-        {.note = F_4, .timeMs = 102},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = E_4, .timeMs = 97},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_2, .timeMs = 204},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = F_4, .timeMs = 202},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_SHARP_2, .timeMs = 208},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = F_4, .timeMs = 405},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_SHARP_2, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = F_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = E_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_2, .timeMs = 206},
-        {.note = SILENCE, .timeMs = 4},
-        {.note = A_3, .timeMs = 199},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = C_SHARP_2, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_2, .timeMs = 79},
-        {.note = SILENCE, .timeMs = 24},
-        {.note = E_4, .timeMs = 93},
-        {.note = SILENCE, .timeMs = 10},
-        {.note = F_4, .timeMs = 87},
-        {.note = SILENCE, .timeMs = 118},
-        {.note = A_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_2, .timeMs = 103},
-        {.note = SILENCE, .timeMs = 103},
-        {.note = D_2, .timeMs = 103},
-        {.note = SILENCE, .timeMs = 103},
-        {.note = D_4, .timeMs = 85},
-        {.note = SILENCE, .timeMs = 18},
-        {.note = F_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = C_5, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = B_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_2, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = F_5, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_5, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_5, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = C_6, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = B_5, .timeMs = 48},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_5, .timeMs = 48},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = B_5, .timeMs = 48},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_5, .timeMs = 48},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = B_5, .timeMs = 47},
-        {.note = SILENCE, .timeMs = 4},
-        {.note = G_5, .timeMs = 48},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = B_5, .timeMs = 48},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_5, .timeMs = 48},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_2, .timeMs = 103},
-        {.note = SILENCE, .timeMs = 103},
-        {.note = G_4, .timeMs = 93},
-        {.note = SILENCE, .timeMs = 10},
-        {.note = A_4, .timeMs = 88},
-        {.note = SILENCE, .timeMs = 14},
-        {.note = A_SHARP_4, .timeMs = 410},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_SHARP_2, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_4, .timeMs = 88},
-        {.note = SILENCE, .timeMs = 14},
-        {.note = G_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = F_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_SHARP_2, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_SHARP_2, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = E_2, .timeMs = 103},
-        {.note = E_2, .timeMs = 103},
-        {.note = D_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_SHARP_2, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_SHARP_2, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = F_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_SHARP_2, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_SHARP_2, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = E_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = C_SHARP_2, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = C_SHARP_2, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_2, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = E_4, .timeMs = 94},
-        {.note = SILENCE, .timeMs = 8},
-        {.note = F_4, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 66},
-        {.note = A_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_2, .timeMs = 120},
-        {.note = SILENCE, .timeMs = 86},
-        {.note = D_2, .timeMs = 120},
-        {.note = SILENCE, .timeMs = 86},
-        {.note = D_4, .timeMs = 85},
-        {.note = SILENCE, .timeMs = 18},
-        {.note = F_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = C_5, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = B_4, .timeMs = 206},
-        {.note = G_2, .timeMs = 103},
-        {.note = SILENCE, .timeMs = 103},
-        {.note = D_6, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = E_6, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = F_6, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_6, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_6, .timeMs = 48},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = E_6, .timeMs = 48},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_6, .timeMs = 48},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = E_6, .timeMs = 48},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_6, .timeMs = 48},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = E_6, .timeMs = 48},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_6, .timeMs = 48},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = E_6, .timeMs = 48},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_2, .timeMs = 103},
-        {.note = SILENCE, .timeMs = 103},
-        {.note = G_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_SHARP_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_SHARP_2, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_4, .timeMs = 272},
-        {.note = SILENCE, .timeMs = 37},
-        {.note = G_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = F_4, .timeMs = 93},
-        {.note = SILENCE, .timeMs = 10},
-        {.note = D_SHARP_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = E_2, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = C_SHARP_4, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = A_2, .timeMs = 203},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_4, .timeMs = 410},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_2, .timeMs = 103},
-        {.note = SILENCE, .timeMs = 103},
-        {.note = D_2, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_2, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_2, .timeMs = 410},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = D_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = E_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = F_4, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 3},
-        {.note = G_4, .timeMs = 137},
-
-    },
-    .numNotes = 851,
-    .shouldLoop = true
-};
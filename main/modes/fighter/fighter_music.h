@@ -1,9 +0,0 @@
-#ifndef _FIGHTER_MUSIC_H_
-#define _FIGHTER_MUSIC_H_
-
-#include "musical_buzzer.h"
-
-extern const song_t battlefield_music;
-extern const song_t final_dest_music;
-
-#endif
\ No newline at end of file
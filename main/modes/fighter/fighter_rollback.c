@@ -0,0 +1,217 @@
+//==============================================================================
+// Includes
+//==============================================================================
+
+#include <string.h>
+
+#include "fighter_rollback.h"
+
+//==============================================================================
+// Defines
+//==============================================================================
+
+#define RB_IDX(frame) ((frame) & (ROLLBACK_BUF_LEN - 1))
+
+#define MIN(X, Y) (((X) < (Y)) ? (X) : (Y))
+
+//==============================================================================
+// Functions
+//==============================================================================
+
+/**
+ * @brief Initialize rollback state at the start of a match
+ *
+ * @param rb The rollback state to initialize
+ * @param localIdx The index of the local player, 0 or 1
+ */
+void rollbackInit(fighterRollback_t* rb, uint8_t localIdx)
+{
+    memset(rb, 0, sizeof(fighterRollback_t));
+    rb->localIdx = localIdx;
+    rb->mispredictedFrame = ROLLBACK_NO_FRAME;
+}
+
+/**
+ * @brief Queue a local button event. Events are assigned to frames in order,
+ * one per frame, so quick taps aren't lost between frames
+ *
+ * @param rb The rollback state
+ * @param btnState The local button state
+ */
+void rollbackQueueLocalInput(fighterRollback_t* rb, uint8_t btnState)
+{
+    rb->localQueue[rb->lqTail] = btnState;
+    rb->lqTail = (rb->lqTail + 1) % ROLLBACK_LOCAL_QUEUE_LEN;
+}
+
+/**
+ * @brief Check if another frame may be simulated. This is false when the local
+ * simulation is too far ahead of the remote swadge's confirmed input
+ *
+ * @param rb The rollback state
+ * @return true if another frame may be simulated, false to wait
+ */
+bool rollbackCanAdvance(const fighterRollback_t* rb)
+{
+    // The remote swadge may be ahead, which is fine
+    uint32_t remoteConfirmed = rb->numConfirmed[1 - rb->localIdx];
+    return (remoteConfirmed >= rb->numSimulated) ||
+           ((rb->numSimulated - remoteConfirmed) < ROLLBACK_MAX_FRAMES);
+}
+
+/**
+ * @brief Assign the next local input to a new frame and mark that frame as
+ * simulated. The caller must simulate the returned frame.
+ *
+ * @param rb The rollback state
+ * @return The index of the frame to simulate
+ */
+uint32_t rollbackAdvance(fighterRollback_t* rb)
+{
+    // Dequeue a button event, or repeat the last state if nothing changed
+    if(rb->lqHead != rb->lqTail)
+    {
+        rb->lastLocalInput = rb->localQueue[rb->lqHead];
+        rb->lqHead = (rb->lqHead + 1) % ROLLBACK_LOCAL_QUEUE_LEN;
+    }
+
+    // Local input is always confirmed
+    uint32_t frame = rb->numSimulated;
+    rb->inputs[rb->localIdx][RB_IDX(frame)] = rb->lastLocalInput;
+    rb->numConfirmed[rb->localIdx] = frame + 1;
+
+    rb->numSimulated++;
+    return frame;
+}
+
+/**
+ * @brief Get the inputs for both players for a given frame. If the remote
+ * player's input hasn't been received yet, it is predicted to be the same as
+ * the last received input, and the prediction is remembered so it can be
+ * checked later
+ *
+ * @param rb The rollback state
+ * @param frame The frame to get inputs for
+ * @param inputs Two button states are written here, one per player
+ */
+void rollbackGetInputs(fighterRollback_t* rb, uint32_t frame, uint8_t* inputs)
+{
+    uint8_t remoteIdx = 1 - rb->localIdx;
+    uint32_t remoteConfirmed = rb->numConfirmed[remoteIdx];
+
+    if(frame >= remoteConfirmed)
+    {
+        // Predict that the remote player is still holding the same buttons
+        uint8_t prediction = 0;
+        if(remoteConfirmed > 0)
+        {
+            prediction = rb->inputs[remoteIdx][RB_IDX(remoteConfirmed - 1)];
+        }
+        rb->inputs[remoteIdx][RB_IDX(frame)] = prediction;
+    }
+
+    inputs[0] = rb->inputs[0][RB_IDX(frame)];
+    inputs[1] = rb->inputs[1][RB_IDX(frame)];
+}
+
+/**
+ * @brief Receive inputs from the remote swadge. Inputs for frames which were
+ * already simulated are checked against the prediction, and if any differ, the
+ * earliest such frame is noted for resimulation
+ *
+ * @param rb The rollback state
+ * @param msg The received inputs
+ */
+void rollbackRxInputs(fighterRollback_t* rb, const fighterInputMsg_t* msg)
+{
+    uint8_t remoteIdx = 1 - rb->localIdx;
+    uint8_t numInputs = MIN(msg->numInputs, ROLLBACK_INPUTS_PER_MSG);
+
+    // Messages may arrive out of order, so only move the acknowledgement forward
+    if((msg->numAcked > rb->numRemoteAcked) && (msg->numAcked <= rb->numConfirmed[rb->localIdx]))
+    {
+        rb->numRemoteAcked = msg->numAcked;
+    }
+
+    for(uint8_t i = 0; i < numInputs; i++)
+    {
+        uint32_t frame = msg->firstFrame + i;
+
+        // Inputs are sent redundantly, so skip ones already received
+        if(frame < rb->numConfirmed[remoteIdx])
+        {
+            continue;
+        }
+        // Inputs must be confirmed in order
+        else if(frame > rb->numConfirmed[remoteIdx])
+        {
+            break;
+        }
+
+        uint8_t* slot = &rb->inputs[remoteIdx][RB_IDX(frame)];
+        // If this frame was already simulated with a wrong prediction
+        if((frame < rb->numSimulated) && (*slot != msg->inputs[i]))
+        {
+            rb->mispredictedFrame = MIN(rb->mispredictedFrame, frame);
+        }
+        *slot = msg->inputs[i];
+        rb->numConfirmed[remoteIdx] = frame + 1;
+    }
+}
+
+/**
+ * @brief Fill a message with the local inputs the remote swadge hasn't
+ * acknowledged yet, oldest first, so that it can always confirm the next frame
+ * no matter how many messages were lost
+ *
+ * @param rb The rollback state
+ * @param msg The message to fill. msgType is not written
+ */
+void rollbackFillInputMsg(const fighterRollback_t* rb, fighterInputMsg_t* msg)
+{
+    uint32_t localConfirmed = rb->numConfirmed[rb->localIdx];
+    msg->numAcked = rb->numConfirmed[1 - rb->localIdx];
+    msg->firstFrame = rb->numRemoteAcked;
+    msg->numInputs = MIN(localConfirmed - rb->numRemoteAcked, ROLLBACK_INPUTS_PER_MSG);
+    for(uint8_t i = 0; i < msg->numInputs; i++)
+    {
+        msg->inputs[i] = rb->inputs[rb->localIdx][RB_IDX(msg->firstFrame + i)];
+    }
+}
+
+/**
+ * @brief Get the earliest frame which was simulated with a mispredicted input
+ *
+ * @param rb The rollback state
+ * @return The frame to roll back to, or ROLLBACK_NO_FRAME if none
+ */
+uint32_t rollbackGetMispredictedFrame(const fighterRollback_t* rb)
+{
+    return rb->mispredictedFrame;
+}
+
+/**
+ * @brief Clear the mispredicted frame after resimulating
+ *
+ * @param rb The rollback state
+ */
+void rollbackClearMispredictedFrame(fighterRollback_t* rb)
+{
+    rb->mispredictedFrame = ROLLBACK_NO_FRAME;
+}
+
+/**
+ * @brief Check if a frame was simulated with confirmed inputs from both
+ * players and will never be rolled back
+ *
+ * @param rb The rollback state
+ * @param frame The frame to check
+ * @return true if the frame is final, false if it may still change
+ */
+bool rollbackIsConfirmed(const fighterRollback_t* rb, uint32_t frame)
+{
+    return (ROLLBACK_NO_FRAME == rb->mispredictedFrame) &&
+           (frame < rb->numConfirmed[0]) &&
+           (frame < rb->numConfirmed[1]) &&
+           (frame < rb->numSimulated);
+}
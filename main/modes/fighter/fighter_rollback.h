@@ -0,0 +1,88 @@
+#ifndef _FIGHTER_ROLLBACK_H_
+#define _FIGHTER_ROLLBACK_H_
+
+//==============================================================================
+// Includes
+//==============================================================================
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//==============================================================================
+// Defines
+//==============================================================================
+
+// The number of frames which may be simulated with predicted input before
+// waiting for the other swadge to catch up
+#define ROLLBACK_MAX_FRAMES 8
+
+// The number of game state snapshots to keep, one for each frame which may be rolled back to
+#define ROLLBACK_NUM_SNAPSHOTS (ROLLBACK_MAX_FRAMES + 1)
+
+// Length of the input history ring buffers. Must be a power of two and
+// comfortably larger than twice ROLLBACK_MAX_FRAMES
+#define ROLLBACK_BUF_LEN 32
+
+// Length of the queue for local button events which haven't been assigned to a frame yet
+#define ROLLBACK_LOCAL_QUEUE_LEN 10
+
+// Every input message redundantly carries the inputs the other swadge hasn't
+// acknowledged yet, up to this many. Each swadge may be up to
+// ROLLBACK_MAX_FRAMES ahead of the other's confirmed input, so the other swadge
+// may be missing up to twice that many
+#define ROLLBACK_INPUTS_PER_MSG (2 * ROLLBACK_MAX_FRAMES)
+
+// Returned when no frame needs to be resimulated
+#define ROLLBACK_NO_FRAME UINT32_MAX
+
+//==============================================================================
+// Structs
+//==============================================================================
+
+typedef struct
+{
+    uint8_t msgType;
+    uint8_t numInputs;
+    uint8_t inputs[ROLLBACK_INPUTS_PER_MSG];
+    uint32_t firstFrame;
+    /* The number of the receiver's inputs the sender has confirmed */
+    uint32_t numAcked;
+} fighterInputMsg_t;
+
+typedef struct
+{
+    /* Per-player ring buffers of button state, indexed by frame */
+    uint8_t inputs[2][ROLLBACK_BUF_LEN];
+    /* Frames [0, numConfirmed) have real inputs for each player */
+    uint32_t numConfirmed[2];
+    /* The number of local inputs the remote swadge has confirmed */
+    uint32_t numRemoteAcked;
+    /* Frames [0, numSimulated) have been simulated */
+    uint32_t numSimulated;
+    /* The earliest simulated frame which used a mispredicted input */
+    uint32_t mispredictedFrame;
+    /* Which player is local, 0 or 1 */
+    uint8_t localIdx;
+    /* Local button events waiting to be assigned to a frame */
+    uint8_t localQueue[ROLLBACK_LOCAL_QUEUE_LEN];
+    uint8_t lqHead;
+    uint8_t lqTail;
+    uint8_t lastLocalInput;
+} fighterRollback_t;
+
+//==============================================================================
+// Functions
+//==============================================================================
+
+void rollbackInit(fighterRollback_t* rb, uint8_t localIdx);
+void rollbackQueueLocalInput(fighterRollback_t* rb, uint8_t btnState);
+bool rollbackCanAdvance(const fighterRollback_t* rb);
+uint32_t rollbackAdvance(fighterRollback_t* rb);
+void rollbackGetInputs(fighterRollback_t* rb, uint32_t frame, uint8_t* inputs);
+void rollbackRxInputs(fighterRollback_t* rb, const fighterInputMsg_t* msg);
+void rollbackFillInputMsg(const fighterRollback_t* rb, fighterInputMsg_t* msg);
+uint32_t rollbackGetMispredictedFrame(const fighterRollback_t* rb);
+void rollbackClearMispredictedFrame(fighterRollback_t* rb);
+bool rollbackIsConfirmed(const fighterRollback_t* rb, uint32_t frame);
+
+#endif
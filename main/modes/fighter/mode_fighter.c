@@ -22,13 +22,14 @@
 
 #include "bresenham.h"
 #include "linked_list.h"
+#include "mode_arena.h"
 #include "led_util.h"
 #include "musical_buzzer.h"
 
 #include "mode_fighter.h"
 #include "fighter_json.h"
 #include "fighter_menu.h"
-#include "fighter_music.h"
+#include "spiffs_song.h"
 
 //==============================================================================
 // Constants
@@ -56,6 +57,9 @@ typedef enum
 
 #define FPS_MEASUREMENT_SEC 3
 
+// More projectiles than this won't survive a rollback
+#define MAX_SNAPSHOT_PROJECTILES 16
+
 #define BARRIER_COLOR         c435
 #define BOTTOM_PLATFORM_COLOR c111
 #define TOP_PLATFORM_COLOR    c232
@@ -82,6 +86,21 @@ typedef struct
     bool cpuBpressed;
 } cpuState_t;
 
+// Everything which changes during a simulated frame, for rollback
+typedef struct
+{
+    fighter_t fighters[NUM_FIGHTERS];
+    // Bit n is the attackConnected flag for attack frame n, which lives outside fighter_t
+    uint32_t frameConnected[NUM_FIGHTERS][NUM_ATTACKS];
+    projectile_t projectiles[MAX_SNAPSHOT_PROJECTILES];
+    uint8_t numProjectiles;
+    fighterGamePhase_t gamePhase;
+    int32_t gameTimerUs;
+    int32_t printGoTimerUs;
+    uint32_t gameOverFrame;
+    uint32_t gameOverTimeMs;
+} fighterSnapshot_t;
+
 typedef struct
 {
     int64_t frameElapsed;
@@ -113,6 +132,12 @@ typedef struct
     int32_t ledTimerUs;
     cpuState_t cpu0;
     cpuState_t cpu1;
+    fighterRollback_t rollback;
+    fighterSnapshot_t* snapshots;
+    uint32_t simFrame;
+    uint32_t gameOverFrame;
+    uint32_t gameOverTimeMs;
+    song_t* bgm;
 } fightingGame_t;
 
 //==============================================================================
@@ -157,6 +182,14 @@ uint8_t cpuButtonAction(cpuState_t* cs, fighter_t* human, fighter_t* cpu, list_t
 void fighterEnqueueButtonInput(fighter_t* ftr, uint32_t btn);
 bool fighterDequeueButtonInput(fighter_t* ftr, uint32_t* btn);
 
+bool fighterUpdateGamePhase(int64_t elapsedUs);
+bool fighterSimulateFrame(void);
+bool fighterRollbackLoop(int64_t elapsedUs);
+void fighterSimulateRollbackFrame(uint32_t frame, bool isResim);
+void fighterSaveSnapshot(fighterSnapshot_t* snap);
+void fighterLoadSnapshot(const fighterSnapshot_t* snap);
+void fighterEndMpGame(uint32_t roundTimeMs);
+
 // void fighterAccelerometerCb(accel_t* accel);
 // void fighterAudioCb(uint16_t * samples, uint32_t sampleCnt);
 // void fighterTemperatureCb(float tmp_c);
@@ -174,6 +207,9 @@ bool fighterDequeueButtonInput(fighter_t* ftr, uint32_t* btn);
 
 static fightingGame_t* f = NULL;
 
+// Projectiles are allocated from this, and freed when the mode exits
+static modePool_t projectilePool = {0};
+
 // I don't like redefining this, but const data...
 #define SCREEN_W    280
 
@@ -353,14 +389,23 @@ const song_t f2hit =
  * @param fightingCharacter Two characters to load
  * @param stage The stage to fight on
  * @param isPlayerOne true if this is player one, false if player two
+ * @return true if the game started, false if a fighter couldn't be loaded and
+ *         the main menu was shown instead
  */
-void fighterStartGame(display_t* disp, font_t* mmFont, fightingGameType_t type,
+bool fighterStartGame(display_t* disp, font_t* mmFont, fightingGameType_t type,
                       fightingCharacter_t* fightingCharacter, fightingStage_t stage,
                       bool isPlayerOne)
 {
     // Allocate base memory for the mode
     f = calloc(1, sizeof(fightingGame_t));
 
+    // Projectiles come and go constantly, so reuse them from a pool. The pool
+    // lives as long as the mode, not the game, so only set it up once
+    if(0 == projectilePool.objSize)
+    {
+        modePoolInit(&projectilePool, ARENA_INTERNAL, sizeof(projectile_t), 8);
+    }
+
     // Save the display
     f->d = disp;
 
@@ -390,32 +435,41 @@ void fighterStartGame(display_t* disp, font_t* mmFont, fightingGameType_t type,
     f->loadedSprites = calloc(MAX_LOADED_SPRITES, sizeof(namedSprite_t));
     for(int i = 0; i < NUM_FIGHTERS; i++)
     {
+        bool loaded = false;
         f->fighters[i].character = fightingCharacter[i];
         switch (f->fighters[i].character)
         {
             case KING_DONUT:
             {
-                loadJsonFighterData(&f->fighters[i], "kd.json", f->loadedSprites);
+                loaded = loadFighterData(&f->fighters[i], "kd.ftr", f->loadedSprites);
                 break;
             }
             case SUNNY:
             {
-                loadJsonFighterData(&f->fighters[i], "sn.json", f->loadedSprites);
+                loaded = loadFighterData(&f->fighters[i], "sn.ftr", f->loadedSprites);
                 break;
             }
             case BIGG_FUNKUS:
             {
-                loadJsonFighterData(&f->fighters[i], "bf.json", f->loadedSprites);
+                loaded = loadFighterData(&f->fighters[i], "bf.ftr", f->loadedSprites);
                 break;
             }
             case SANDBAG:
             case NO_CHARACTER:
             {
-                loadJsonFighterData(&f->fighters[i], "sb.json", f->loadedSprites);
+                loaded = loadFighterData(&f->fighters[i], "sb.ftr", f->loadedSprites);
                 break;
             }
         }
 
+        // Don't play with a half loaded fighter
+        if(!loaded)
+        {
+            fighterExitGame();
+            fighterReturnToMainMenu();
+            return false;
+        }
+
         setFighterRelPos(&(f->fighters[i]), NOT_TOUCHING_PLATFORM, NULL, NULL, true);
         f->fighters[i].cAttack = NO_ATTACK;
 
@@ -465,21 +519,35 @@ void fighterStartGame(display_t* disp, font_t* mmFont, fightingGameType_t type,
         f->printGoTimerUs = -1;
     }
 
-    // Player 1 starts by sending buttons to player 0
-    // After this, buttons will be sent after buttons are ACKed
-    if((type == MULTIPLAYER) && (1 == f->playerIdx))
+    if(MULTIPLAYER == type)
     {
-        fighterSendButtonsToOther(fighterGetButtonState());
+        // Both swadges simulate the match and exchange only inputs
+        rollbackInit(&f->rollback, f->playerIdx);
+        f->snapshots = calloc(ROLLBACK_NUM_SNAPSHOTS, sizeof(fighterSnapshot_t));
+        f->gameOverFrame = ROLLBACK_NO_FRAME;
+
+        // Player 1 starts by sending buttons to player 0
+        // After this, buttons will be sent after buttons are ACKed
+        if(1 == f->playerIdx)
+        {
+            fighterSendButtonsToOther();
+        }
     }
 
     if(&finalDest == stages[f->stageIdx])
     {
-        buzzer_play_bgm(&final_dest_music);
+        f->bgm = loadSong("final_dest_music.sng");
     }
     else
     {
-        buzzer_play_bgm(&battlefield_music);
+        f->bgm = loadSong("battlefield_music.sng");
     }
+
+    if(NULL != f->bgm)
+    {
+        buzzer_play_bgm(f->bgm);
+    }
+    return true;
 }
 
 /**
@@ -487,8 +555,17 @@ void fighterStartGame(display_t* disp, font_t* mmFont, fightingGameType_t type,
  */
 void fighterExitGame(void)
 {
+    // Stop the music before it's freed
+    buzzer_stop();
+
     if(NULL != f)
     {
+        // Free the music
+        if(NULL != f->bgm)
+        {
+            freeSong(f->bgm);
+        }
+
         // Free the indicator
         freeWsg(&f->p1indicH);
         freeWsg(&f->p1indicV);
@@ -499,7 +576,7 @@ void fighterExitGame(void)
         projectile_t* toFree;
         while (NULL != (toFree = pop(&f->projectiles)))
         {
-            free(toFree);
+            modePoolFree(&projectilePool, toFree);
         }
 
         // Free fighter data
@@ -517,12 +594,17 @@ void fighterExitGame(void)
             f->composedSceneLen = 0;
         }
 
+        // Free rollback snapshots if they exist
+        if(NULL != f->snapshots)
+        {
+            free(f->snapshots);
+            f->snapshots = NULL;
+        }
+
         // Free game data
         free(f);
         f = NULL;
     }
-
-    buzzer_stop();
 }
 
 /**
@@ -755,76 +837,21 @@ void fighterGameLoop(int64_t elapsedUs)
         setLeds(f->leds, NUM_LEDS);
     }
 
-    // Only process the loop as single player, or as the server in multi
-    bool runProcLoop =
-        (f->type == HR_CONTEST) ||
-        (f->type == LOCAL_VS) ||
-        (f->type == VS_CPU) ||
-        (f->type == CPU_ONLY) ||
-        ((f->type == MULTIPLAYER) && (0 == f->playerIdx));
-
-    if(runProcLoop)
+    if(MULTIPLAYER == f->type)
     {
-        switch(f->gamePhase)
+        // Both swadges run the simulation, rolling back when inputs arrive late
+        if(fighterRollbackLoop(elapsedUs))
         {
-            case COUNTING_IN:
-            {
-                f->gameTimerUs -= elapsedUs;
-                if(f->gameTimerUs <= 0)
-                {
-                    // After count-in, transition to the appropriate state
-                    if((MULTIPLAYER == f->type) || (LOCAL_VS == f->type) || (VS_CPU == f->type) || (CPU_ONLY == f->type))
-                    {
-                        f->gameTimerUs = 0; // Count up after this
-                        f->gamePhase = MP_GAME;
-                    }
-                    else if (HR_CONTEST == f->type)
-                    {
-                        f->gameTimerUs = 15000000; // 15s total
-                        f->gamePhase = HR_BARRIER_UP;
-                    }
-                    // Print GO!!! for 1.5s after COUNTING_IN elapses
-                    f->printGoTimerUs = 1500000;
-                }
-                break;
-            }
-            case HR_BARRIER_UP:
-            {
-                f->gameTimerUs -= elapsedUs;
-                if(f->gameTimerUs <= 5000000) // last 5s
-                {
-                    f->gamePhase = HR_BARRIER_DOWN;
-                }
-                break;
-            }
-            case HR_BARRIER_DOWN:
-            {
-                f->gameTimerUs -= elapsedUs;
-                if(f->gameTimerUs <= 0)
-                {
-                    f->gameTimerUs = 0;
-                    // Initialize the result
-                    fighterShowHrResult(f->fighters[0].character, f->fighters[1].pos, f->fighters[1].velocity, f->fighters[1].gravity,
-                                        hrStadium.platforms[0].area.x0, hrStadium.platforms[0].area.x1);
-                    // Deinit the game
-                    fighterExitGame();
-                    // Return after deinit
-                    return;
-                }
-                break;
-            }
-            case MP_GAME:
-            {
-                // Timer counts up in this state
-                f->gameTimerUs += elapsedUs;
-                break;
-            }
+            // Return after deinit
+            return;
         }
-
-        // Don't print GO!!! forever
-        if(f->printGoTimerUs >= 0)
+    }
+    else
+    {
+        // Advance the count-in and timers, return if the game ended
+        if(fighterUpdateGamePhase(elapsedUs))
         {
-            f->printGoTimerUs -= elapsedUs;
+            return;
         }
 
         // Keep track of time and only calculate frames every FRAME_TIME_MS
@@ -837,18 +864,7 @@ void fighterGameLoop(int64_t elapsedUs)
             {
                 case MULTIPLAYER:
                 {
-                    // If it's time to calculate a frame, but button inputs haven't been received
-                    if(false == f->buttonInputReceived)
-                    {
-                        // Reset the frameElapsed timer for next loop
-                        f->frameElapsed += (FRAME_TIME_MS * 1000);
-
-                        // Draw the scene as-is to avoid flicker
-                        drawFighterScene(f->d, (const fighterScene_t*)f->composedScene);
-
-                        // Don't run game logic
-                        return;
-                    }
+                    // Handled by fighterRollbackLoop()
                     break;
                 }
                 case HR_CONTEST:
@@ -876,86 +892,410 @@ void fighterGameLoop(int64_t elapsedUs)
             }
         }
 
-        bool hitstopActive = (f->fighters[0].hitstopTimer || f->fighters[1].hitstopTimer);
-
         if(f->buttonInputReceived)
         {
             f->buttonInputReceived = false;
 
-            if(!hitstopActive)
+            // Run one frame of the game, return if the game ended
+            if(fighterSimulateFrame())
             {
-                // When counting in, ignore button inputs
-                if(COUNTING_IN == f->gamePhase)
-                {
-                    f->fighters[0].bsBufHead = 0;
-                    f->fighters[0].bsBufTail = 0;
-                    f->fighters[1].bsBufHead = 0;
-                    f->fighters[1].bsBufTail = 0;
-                }
-                // Check fighter button inputs
-                checkFighterButtonInput(&f->fighters[0]);
-                checkFighterButtonInput(&f->fighters[1]);
+                return;
+            }
+
+            // Free scene before composing another
+            if(NULL != f->composedScene)
+            {
+                free(f->composedScene);
+            }
+            f->composedScene = composeFighterScene(f->stageIdx, &f->fighters[0], &f->fighters[1],
+                                                   &f->projectiles, &(f->composedSceneLen));
+        }
+
+        // Frame drawn!
+        f->fpsFrameCount++;
+    }
+
+    // Draw the scene
+    drawFighterScene(f->d, (const fighterScene_t*)f->composedScene);
+}
 
-                // Move fighters, and if one KO'd and the round ended, return
-                if(updateFighterPosition(&f->fighters[0], stages[f->stageIdx]->platforms, stages[f->stageIdx]->numPlatforms))
+/**
+ * Advance the count-in and game timers, and manage transitions between game
+ * phases
+ *
+ * @param elapsedUs The time to advance the timers by
+ * @return true if the game ended and was deinitialized, false otherwise
+ */
+bool fighterUpdateGamePhase(int64_t elapsedUs)
+{
+    switch(f->gamePhase)
+    {
+        case COUNTING_IN:
+        {
+            f->gameTimerUs -= elapsedUs;
+            if(f->gameTimerUs <= 0)
+            {
+                // After count-in, transition to the appropriate state
+                if((MULTIPLAYER == f->type) || (LOCAL_VS == f->type) || (VS_CPU == f->type) || (CPU_ONLY == f->type))
                 {
-                    return;
+                    f->gameTimerUs = 0; // Count up after this
+                    f->gamePhase = MP_GAME;
                 }
-                if(updateFighterPosition(&f->fighters[1], stages[f->stageIdx]->platforms, stages[f->stageIdx]->numPlatforms))
+                else if (HR_CONTEST == f->type)
                 {
-                    return;
+                    f->gameTimerUs = 15000000; // 15s total
+                    f->gamePhase = HR_BARRIER_UP;
                 }
+                // Print GO!!! for 1.5s after COUNTING_IN elapses
+                f->printGoTimerUs = 1500000;
             }
-
-            // If the home run contest ended early, this will be NULL
-            if(NULL == f)
+            break;
+        }
+        case HR_BARRIER_UP:
+        {
+            f->gameTimerUs -= elapsedUs;
+            if(f->gameTimerUs <= 5000000) // last 5s
             {
-                return;
+                f->gamePhase = HR_BARRIER_DOWN;
+            }
+            break;
+        }
+        case HR_BARRIER_DOWN:
+        {
+            f->gameTimerUs -= elapsedUs;
+            if(f->gameTimerUs <= 0)
+            {
+                f->gameTimerUs = 0;
+                // Initialize the result
+                fighterShowHrResult(f->fighters[0].character, f->fighters[1].pos, f->fighters[1].velocity, f->fighters[1].gravity,
+                                    hrStadium.platforms[0].area.x0, hrStadium.platforms[0].area.x1);
+                // Deinit the game
+                fighterExitGame();
+                // Return after deinit
+                return true;
             }
+            break;
+        }
+        case MP_GAME:
+        {
+            // Timer counts up in this state
+            f->gameTimerUs += elapsedUs;
+            break;
+        }
+    }
 
-            // Update timers. This transitions between states and spawns projectiles
-            checkFighterTimer(&f->fighters[0], hitstopActive);
-            checkFighterTimer(&f->fighters[1], hitstopActive);
+    // Don't print GO!!! forever
+    if(f->printGoTimerUs >= 0)
+    {
+        f->printGoTimerUs -= elapsedUs;
+    }
+    return false;
+}
 
-            if(!hitstopActive)
-            {
-                // Update projectile timers. This moves projectiles and despawns if necessary
-                checkProjectileTimer(&f->projectiles, stages[f->stageIdx]->platforms, stages[f->stageIdx]->numPlatforms);
+/**
+ * Simulate a single frame of the game using the inputs already queued for each
+ * fighter. This moves fighters, checks collisions, and manages projectiles.
+ * Given the same starting state and inputs, this always produces the same
+ * result, which rollback depends on.
+ *
+ * @return true if the game ended and was deinitialized, false otherwise
+ */
+bool fighterSimulateFrame(void)
+{
+    bool hitstopActive = (f->fighters[0].hitstopTimer || f->fighters[1].hitstopTimer);
+
+    if(!hitstopActive)
+    {
+        // When counting in, ignore button inputs
+        if(COUNTING_IN == f->gamePhase)
+        {
+            f->fighters[0].bsBufHead = 0;
+            f->fighters[0].bsBufTail = 0;
+            f->fighters[1].bsBufHead = 0;
+            f->fighters[1].bsBufTail = 0;
+        }
+        // Check fighter button inputs
+        checkFighterButtonInput(&f->fighters[0]);
+        checkFighterButtonInput(&f->fighters[1]);
+
+        // Move fighters, and if one KO'd and the round ended, return
+        if(updateFighterPosition(&f->fighters[0], stages[f->stageIdx]->platforms, stages[f->stageIdx]->numPlatforms))
+        {
+            return true;
+        }
+        if(updateFighterPosition(&f->fighters[1], stages[f->stageIdx]->platforms, stages[f->stageIdx]->numPlatforms))
+        {
+            return true;
+        }
+    }
+
+    // If the home run contest ended early, this will be NULL
+    if(NULL == f)
+    {
+        return true;
+    }
+
+    // Update timers. This transitions between states and spawns projectiles
+    checkFighterTimer(&f->fighters[0], hitstopActive);
+    checkFighterTimer(&f->fighters[1], hitstopActive);
+
+    if(!hitstopActive)
+    {
+        // Update projectile timers. This moves projectiles and despawns if necessary
+        checkProjectileTimer(&f->projectiles, stages[f->stageIdx]->platforms, stages[f->stageIdx]->numPlatforms);
+
+        // Check for collisions between hitboxes and hurtboxes
+        checkFighterHitboxCollisions(&f->fighters[0], &f->fighters[1]);
+        checkFighterHitboxCollisions(&f->fighters[1], &f->fighters[0]);
 
-                // Check for collisions between hitboxes and hurtboxes
-                checkFighterHitboxCollisions(&f->fighters[0], &f->fighters[1]);
-                checkFighterHitboxCollisions(&f->fighters[1], &f->fighters[0]);
+        // After hitboxes are checked, enter hitstun states
+        checkFigherDeferredHitstun(&f->fighters[0]);
+        checkFigherDeferredHitstun(&f->fighters[1]);
+
+        // Check for collisions between projectiles and hurtboxes
+        checkFighterProjectileCollisions(&f->projectiles);
+    }
+    return false;
+}
 
-                // After hitboxes are checked, enter hitstun states
-                checkFigherDeferredHitstun(&f->fighters[0]);
-                checkFigherDeferredHitstun(&f->fighters[1]);
+/**
+ * Run the multiplayer game with rollback. Frames are simulated immediately
+ * with local input and a prediction of the remote input. When the remote
+ * input arrives and differs from the prediction, the game state is restored
+ * from a snapshot and the frames are simulated again.
+ *
+ * @param elapsedUs The time elapsed since the last time this was called
+ * @return true if the game ended and was deinitialized, false otherwise
+ */
+bool fighterRollbackLoop(int64_t elapsedUs)
+{
+    bool frameSimulated = false;
 
-                // Check for collisions between projectiles and hurtboxes
-                checkFighterProjectileCollisions(&f->projectiles);
+    // If a late input didn't match the prediction, roll back and resimulate
+    uint32_t rbFrame = rollbackGetMispredictedFrame(&f->rollback);
+    if(ROLLBACK_NO_FRAME != rbFrame)
+    {
+        rollbackClearMispredictedFrame(&f->rollback);
+        fighterLoadSnapshot(&f->snapshots[rbFrame % ROLLBACK_NUM_SNAPSHOTS]);
+        for(uint32_t frame = rbFrame; frame < f->rollback.numSimulated; frame++)
+        {
+            fighterSimulateRollbackFrame(frame, true);
+        }
+        frameSimulated = true;
+    }
+
+    // Keep track of time and only calculate frames every FRAME_TIME_MS
+    f->frameElapsed += elapsedUs;
+    if (f->frameElapsed > (FRAME_TIME_MS * 1000))
+    {
+        if(rollbackCanAdvance(&f->rollback))
+        {
+            f->frameElapsed -= (FRAME_TIME_MS * 1000);
+
+            // Commit local input to a new frame and share it
+            uint32_t frame = rollbackAdvance(&f->rollback);
+            if(0 == f->playerIdx)
+            {
+                // Player 0 sends buttons to player 1 in ACKs
+                fighterSetButtonsInAck();
             }
 
-            // Free scene before composing another
-            if(NULL != f->composedScene)
+            fighterSimulateRollbackFrame(frame, false);
+            frameSimulated = true;
+
+            // Frame drawn!
+            f->fpsFrameCount++;
+        }
+        else
+        {
+            // Too far ahead of the other swadge, wait for its inputs
+            f->frameElapsed = (FRAME_TIME_MS * 1000);
+        }
+    }
+
+    // Player 0 ends the game once the final frame can't be rolled back, and
+    // sends the result to player 1 in an ACK. Player 1 keeps sending inputs
+    // until then, so that player 0 can confirm the final frame
+    if((0 == f->playerIdx) && fighterEndMpGameIfOver())
+    {
+        return true;
+    }
+
+    if(frameSimulated)
+    {
+        // Free scene before composing another
+        if(NULL != f->composedScene)
+        {
+            free(f->composedScene);
+        }
+        f->composedScene = composeFighterScene(f->stageIdx, &f->fighters[0], &f->fighters[1],
+                                               &f->projectiles, &(f->composedSceneLen));
+    }
+    return false;
+}
+
+/**
+ * Snapshot the game state, then simulate one frame of a multiplayer game with
+ * inputs from the rollback history
+ *
+ * @param frame The frame to simulate
+ * @param isResim true if this frame was simulated before and its sounds and
+ *                LEDs were already played, false if it is a new frame
+ */
+void fighterSimulateRollbackFrame(uint32_t frame, bool isResim)
+{
+    // Save the state before this frame in case it needs to be rolled back
+    fighterSaveSnapshot(&f->snapshots[frame % ROLLBACK_NUM_SNAPSHOTS]);
+
+    // Feed exactly one input per fighter for this frame
+    uint8_t inputs[NUM_FIGHTERS];
+    rollbackGetInputs(&f->rollback, frame, inputs);
+    for(int i = 0; i < NUM_FIGHTERS; i++)
+    {
+        f->fighters[i].bsBufHead = 0;
+        f->fighters[i].bsBufTail = 0;
+        fighterEnqueueButtonInput(&f->fighters[i], inputs[i]);
+    }
+
+    // Timers advance by exactly one frame, not wall-clock time
+    f->simFrame = frame;
+    fighterUpdateGamePhase(FRAME_TIME_MS * 1000);
+    fighterSimulateFrame();
+
+    // Hits in frames which were already shown don't play again
+    if(isResim)
+    {
+        f->fighters[0].damagedThisFrame = false;
+        f->fighters[1].damagedThisFrame = false;
+    }
+}
+
+/**
+ * Save everything which may change during a simulated frame
+ *
+ * @param snap The snapshot to save to
+ */
+void fighterSaveSnapshot(fighterSnapshot_t* snap)
+{
+    memcpy(snap->fighters, f->fighters, sizeof(snap->fighters));
+
+    // Attack frame data lives outside fighter_t, so save its mutable flags
+    for(int i = 0; i < NUM_FIGHTERS; i++)
+    {
+        for(int aIdx = 0; aIdx < NUM_ATTACKS; aIdx++)
+        {
+            const attack_t* atk = &f->fighters[i].attacks[aIdx];
+            uint32_t connected = 0;
+            for(uint8_t frIdx = 0; frIdx < MIN(atk->numAttackFrames, 32); frIdx++)
             {
-                free(f->composedScene);
+                if(atk->attackFrames[frIdx].attackConnected)
+                {
+                    connected |= (1 << frIdx);
+                }
             }
-            f->composedScene = composeFighterScene(f->stageIdx, &f->fighters[0], &f->fighters[1],
-                                                   &f->projectiles, &(f->composedSceneLen));
+            snap->frameConnected[i][aIdx] = connected;
+        }
+    }
+
+    // Copy projectiles out of the list
+    snap->numProjectiles = 0;
+    node_t* currentNode = f->projectiles.first;
+    while((NULL != currentNode) && (snap->numProjectiles < MAX_SNAPSHOT_PROJECTILES))
+    {
+        snap->projectiles[snap->numProjectiles++] = *((projectile_t*)currentNode->val);
+        currentNode = currentNode->next;
+    }
+    if(NULL != currentNode)
+    {
+        ESP_LOGW("FTR", "Too many projectiles to snapshot");
+    }
+
+    snap->gamePhase = f->gamePhase;
+    snap->gameTimerUs = f->gameTimerUs;
+    snap->printGoTimerUs = f->printGoTimerUs;
+    snap->gameOverFrame = f->gameOverFrame;
+    snap->gameOverTimeMs = f->gameOverTimeMs;
+}
+
+/**
+ * Restore the game state from a snapshot. Fighters are restored in place, so
+ * pointers into fighter_t and to the fighters themselves remain valid
+ *
+ * @param snap The snapshot to restore from
+ */
+void fighterLoadSnapshot(const fighterSnapshot_t* snap)
+{
+    memcpy(f->fighters, snap->fighters, sizeof(f->fighters));
 
-            // Player 0 sends the scene to player 1 in an ACK
-            if((MULTIPLAYER == f->type) && (0 == f->playerIdx))
+    for(int i = 0; i < NUM_FIGHTERS; i++)
+    {
+        for(int aIdx = 0; aIdx < NUM_ATTACKS; aIdx++)
+        {
+            attack_t* atk = &f->fighters[i].attacks[aIdx];
+            for(uint8_t frIdx = 0; frIdx < MIN(atk->numAttackFrames, 32); frIdx++)
             {
-                // Set the scene in the ack
-                fighterSendSceneToOther(f->composedScene, f->composedSceneLen);
+                atk->attackFrames[frIdx].attackConnected = (snap->frameConnected[i][aIdx] >> frIdx) & 0x01;
             }
         }
+    }
 
-        // Frame drawn!
-        f->fpsFrameCount++;
+    // Replace the current projectiles with the saved ones
+    projectile_t* toFree;
+    while (NULL != (toFree = pop(&f->projectiles)))
+    {
+        modePoolFree(&projectilePool, toFree);
+    }
+    for(uint8_t pIdx = 0; pIdx < snap->numProjectiles; pIdx++)
+    {
+        projectile_t* proj = modePoolAlloc(&projectilePool);
+        *proj = snap->projectiles[pIdx];
+        push(&f->projectiles, proj);
     }
 
-    // Draw the scene
-    drawFighterScene(f->d, (const fighterScene_t*)f->composedScene);
+    f->gamePhase = snap->gamePhase;
+    f->gameTimerUs = snap->gameTimerUs;
+    f->printGoTimerUs = snap->printGoTimerUs;
+    f->gameOverFrame = snap->gameOverFrame;
+    f->gameOverTimeMs = snap->gameOverTimeMs;
+
+    // Hits before the snapshot were already shown
+    f->fighters[0].damagedThisFrame = false;
+    f->fighters[1].damagedThisFrame = false;
+}
+
+/**
+ * End a multiplayer game if a fighter was KO'd in a frame which can't be
+ * rolled back anymore
+ *
+ * @return true if the game ended and was deinitialized, false otherwise
+ */
+bool fighterEndMpGameIfOver(void)
+{
+    if((ROLLBACK_NO_FRAME != f->gameOverFrame) && rollbackIsConfirmed(&f->rollback, f->gameOverFrame))
+    {
+        fighterEndMpGame(f->gameOverTimeMs);
+        return true;
+    }
+    return false;
+}
+
+/**
+ * End a multiplayer game and show the result from this swadge's perspective
+ *
+ * @param roundTimeMs The time the round took, in milliseconds
+ */
+void fighterEndMpGame(uint32_t roundTimeMs)
+{
+    fighter_t* self  = &f->fighters[f->playerIdx];
+    fighter_t* other = &f->fighters[1 - f->playerIdx];
+
+    // End game and show result
+    fighterShowMpResult(roundTimeMs,
+                        self->character, NUM_STOCKS - other->stocks, self->damageGiven,
+                        other->character, NUM_STOCKS - self->stocks, other->damageGiven,
+                        f->type);
+    // Deinit the game
+    fighterExitGame();
 }
 
 /**
@@ -1187,7 +1527,7 @@ void checkFighterTimer(fighter_t* ftr, bool hitstopActive)
                 if(hbx->isProjectile)
                 {
                     // Allocate the projectile
-                    projectile_t* proj = malloc(sizeof(projectile_t));
+                    projectile_t* proj = modePoolAlloc(&projectilePool);
 
                     // Copy data from the attack frame to the projectile
                     proj->sprite   = hbx->projSprite;
@@ -2148,6 +2488,19 @@ bool updateFighterPosition(fighter_t* ftr, const platform_t* platforms,
             // Return after deinit
             return true;
         }
+        else if(MULTIPLAYER == f->type)
+        {
+            ftr->stocks = 0;
+            // This frame may still be rolled back, so note when the game
+            // ended and let fighterRollbackLoop() end it once confirmed
+            if(ROLLBACK_NO_FRAME == f->gameOverFrame)
+            {
+                f->gameOverFrame = f->simFrame;
+                f->gameOverTimeMs = f->gameTimerUs / 1000;
+            }
+            // Don't respawn
+            return false;
+        }
         else
         {
             ftr->stocks = 0;
@@ -2466,7 +2819,7 @@ void checkProjectileTimer(list_t* projectiles, const platform_t* platforms,
         if((0 == proj->duration) || (true == proj->removeNextFrame))
         {
             // Free and remove the projectile, and iterate
-            free(proj);
+            modePoolFree(&projectilePool, proj);
             node_t* toRemove = currentNode;
             currentNode = currentNode->next;
             removeEntry(projectiles, toRemove);
@@ -2574,8 +2927,6 @@ fighterScene_t* composeFighterScene(uint8_t stageIdx, fighter_t* f1, fighter_t*
     (*outLen) = (sizeof(fighterScene_t)) + (numProj * sizeof(fighterSceneProjectile_t));
     fighterScene_t* scene = calloc(1, (*outLen));
 
-    // message type is filled in later
-
     // If "Go!!!" should be printed
     scene->drawGo = (f->printGoTimerUs >= 0);
 
@@ -3264,6 +3615,13 @@ void fighterGameButtonCb(buttonEvt_t* evt)
         return;
     }
 
+    // Multiplayer input is assigned to frames for rollback
+    if(MULTIPLAYER == f->type)
+    {
+        rollbackQueueLocalInput(&f->rollback, evt->state);
+        return;
+    }
+
 #if defined(EMU)
     if(LOCAL_VS == f->type)
     {
@@ -3321,55 +3679,24 @@ bool fighterDequeueButtonInput(fighter_t* ftr, uint32_t* btn)
 }
 
 /**
- * @brief Get the button state to send to another swadge
- * This will dequeue a button state if it exists, or return the last state
+ * @brief Get the most recent local inputs to send to another swadge
  *
- * @return This fighter's current button state
+ * @param msg The message to fill with inputs. msgType is not written
  */
-int32_t fighterGetButtonState(void)
+void fighterGetInputMsg(fighterInputMsg_t* msg)
 {
-    uint32_t btn;
-    if(fighterDequeueButtonInput(&f->fighters[f->playerIdx], &btn))
-    {
-        f->fighters[f->playerIdx].prevBtnState = btn;
-        return btn;
-    }
-    return f->fighters[f->playerIdx].prevBtnState;
+    rollbackFillInputMsg(&f->rollback, msg);
 }
 
 /**
- * @brief Receive button input from another swadge
+ * @brief Receive button inputs from another swadge
  *
- * @param btnState The button state from the other swadge
+ * @param msg The inputs from the other swadge
  */
-void fighterRxButtonInput(int32_t btnState)
+void fighterRxButtonInput(const fighterInputMsg_t* msg)
 {
-    fighterEnqueueButtonInput(&f->fighters[1], btnState);
-    // Set to true to run main loop with input
-    f->buttonInputReceived = true;
-}
-
-/**
- * @brief Receive a scene to render from another swadge
- *
- * @param scene The scene to render
- */
-void fighterRxScene(const fighterScene_t* scene, uint8_t len)
-{
-    // Save scene to be drawn in fighterGameLoop()
-    if(len > 0)
-    {
-        // Free any prior scenes if it exists
-        if(NULL != f->composedScene)
-        {
-            free(f->composedScene);
-        }
-        // Allocate and copy the new scene
-        f->composedScene = malloc(len);
-        memcpy(f->composedScene, scene, len);
-        // Save the new length
-        f->composedSceneLen = len;
-    }
+    // Inputs for frames which were already predicted may trigger a rollback
+    rollbackRxInputs(&f->rollback, msg);
 }
 
 /**
@@ -8,6 +8,7 @@
 #include "aabb_utils.h"
 #include "musical_buzzer.h"
 #include "swadgeMode.h"
+#include "fighter_rollback.h"
 
 //==============================================================================
 // Defines
@@ -302,7 +303,6 @@ typedef struct
 
 typedef struct
 {
-    uint8_t msgType;
     uint8_t stageIdx;
     uint8_t numProjectiles;
     uint8_t sfx;
@@ -327,16 +327,15 @@ extern const song_t f2hit;
 // Functions
 //==============================================================================
 
-void fighterStartGame(display_t* disp, font_t* mmFont, fightingGameType_t type,
+bool fighterStartGame(display_t* disp, font_t* mmFont, fightingGameType_t type,
                       fightingCharacter_t* fightingCharacter, fightingStage_t stage,
                       bool isPlayerOne);
 void fighterExitGame(void);
 void fighterGameLoop(int64_t elapsedUs);
 void fighterGameButtonCb(buttonEvt_t* evt);
-int32_t fighterGetButtonState(void);
-
-void fighterRxButtonInput(int32_t btnState);
-void fighterRxScene(const fighterScene_t* scene, uint8_t len);
+void fighterGetInputMsg(fighterInputMsg_t* msg);
+void fighterRxButtonInput(const fighterInputMsg_t* msg);
+bool fighterEndMpGameIfOver(void);
 
 void drawFighterScene(display_t* d, const fighterScene_t* sceneData);
 
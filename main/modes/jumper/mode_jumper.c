@@ -54,6 +54,7 @@ void jumperClearBlock(uint8_t blockIndex);
 void jumperDrawScene(display_t* d);
 void jumperDrawEffects(display_t* d);
 void jumperDrawHud(display_t* d, font_t* prompt, font_t* font, font_t* outline, font_t* smaller_prompt);
+void jumperAtlasWsg(const char* name, wsg_t* wsg);
 
 //==============================================================================
 // Variables
@@ -434,64 +435,67 @@ void jumperStartGame(display_t* disp, font_t* mmFont, bool ledEnabled)
     j->scene->smallerScoreFont = false;
     j->scene->lives = 3;
     j->scene->currentPowerup = calloc(1, sizeof(jumperPowerup_t));
-    loadWsg("livesdonut.wsg", &j->livesIcon);
-    loadWsg("target.wsg", &j->target);
-    loadWsg("djpu1.wsg", &j->powerup[0]);
-    loadWsg("djpu2.wsg", &j->powerup[1]);
-    loadWsg("djpu3.wsg", &j->powerup[2]);
-    loadWsg("djpu4.wsg", &j->powerup[3]);
-
-
-    loadWsg("block_0a.wsg", &j->block[0]);
-    loadWsg("block_0b.wsg", &j->block[1]);
-    loadWsg("block_0c.wsg", &j->block[2]);
-    loadWsg("block_0d.wsg", &j->block[3]);
-    loadWsg("block_0e.wsg", &j->block[4]);
-    loadWsg("block_1a.wsg", &j->block[5]);
-    loadWsg("block_1b.wsg", &j->block[6]);
-    loadWsg("block_2.wsg", &j->block[7]);
-    loadWsg("block_2b.wsg", &j->block[8]);
-    loadWsg("block_2c.wsg", &j->block[9]);
-
-    loadWsg("multiplier0.wsg", &j->digit[0]);
-    loadWsg("multiplier1.wsg", &j->digit[1]);
-    loadWsg("multiplier2.wsg", &j->digit[2]);
-    loadWsg("multiplier3.wsg", &j->digit[3]);
-    loadWsg("multiplier4.wsg", &j->digit[4]);
-    loadWsg("multiplier5.wsg", &j->digit[5]);
-    loadWsg("multiplier6.wsg", &j->digit[6]);
-    loadWsg("multiplier7.wsg", &j->digit[7]);
-    loadWsg("multiplier8.wsg", &j->digit[8]);
-    loadWsg("multiplier9.wsg", &j->digit[9]);
-    loadWsg("multiplierx.wsg", &j->digit[10]);
-    loadWsg("perfect.wsg", &j->digit[11]);
+
+    // All of the sprites are in one atlas, made from assets/jumper.atlas/
+    loadWsgAtlas("jumper.atl", &j->atlas, false);
+    jumperAtlasWsg("livesdonut", &j->livesIcon);
+    jumperAtlasWsg("target", &j->target);
+    jumperAtlasWsg("djpu1", &j->powerup[0]);
+    jumperAtlasWsg("djpu2", &j->powerup[1]);
+    jumperAtlasWsg("djpu3", &j->powerup[2]);
+    jumperAtlasWsg("djpu4", &j->powerup[3]);
+
+
+    jumperAtlasWsg("block_0a", &j->block[0]);
+    jumperAtlasWsg("block_0b", &j->block[1]);
+    jumperAtlasWsg("block_0c", &j->block[2]);
+    jumperAtlasWsg("block_0d", &j->block[3]);
+    jumperAtlasWsg("block_0e", &j->block[4]);
+    jumperAtlasWsg("block_1a", &j->block[5]);
+    jumperAtlasWsg("block_1b", &j->block[6]);
+    jumperAtlasWsg("block_2", &j->block[7]);
+    jumperAtlasWsg("block_2b", &j->block[8]);
+    jumperAtlasWsg("block_2c", &j->block[9]);
+
+    jumperAtlasWsg("multiplier0", &j->digit[0]);
+    jumperAtlasWsg("multiplier1", &j->digit[1]);
+    jumperAtlasWsg("multiplier2", &j->digit[2]);
+    jumperAtlasWsg("multiplier3", &j->digit[3]);
+    jumperAtlasWsg("multiplier4", &j->digit[4]);
+    jumperAtlasWsg("multiplier5", &j->digit[5]);
+    jumperAtlasWsg("multiplier6", &j->digit[6]);
+    jumperAtlasWsg("multiplier7", &j->digit[7]);
+    jumperAtlasWsg("multiplier8", &j->digit[8]);
+    jumperAtlasWsg("multiplier9", &j->digit[9]);
+    jumperAtlasWsg("multiplierx", &j->digit[10]);
+    jumperAtlasWsg("perfect", &j->digit[11]);
 
     j->player = calloc(1, sizeof(jumperCharacter_t));
 
-    loadWsg("pdi0.wsg", &j->player->frames[0]);
-    loadWsg("pdi1.wsg", &j->player->frames[1]);
-    loadWsg("pdd0.wsg", &j->player->frames[2]);
-    loadWsg("pdj0.wsg", &j->player->frames[3]);
-    loadWsg("pdk0.wsg", &j->player->frames[4]);
-    loadWsg("pdk1.wsg", &j->player->frames[5]);
-    loadWsg("kk2.wsg", &j->player->frames[6]);
-    loadWsg("kk3.wsg", &j->player->frames[7]);
+    jumperAtlasWsg("pdi0", &j->player->frames[0]);
+    jumperAtlasWsg("pdi1", &j->player->frames[1]);
+    jumperAtlasWsg("pdd0", &j->player->frames[2]);
+    jumperAtlasWsg("pdj0", &j->player->frames[3]);
+    jumperAtlasWsg("pdk0", &j->player->frames[4]);
+    jumperAtlasWsg("pdk1", &j->player->frames[5]);
+    jumperAtlasWsg("kk2", &j->player->frames[6]);
+    jumperAtlasWsg("kk3", &j->player->frames[7]);
 
     j->evilDonut = calloc(1, sizeof(jumperCharacter_t));
-    loadWsg("edi0.wsg", &j->evilDonut->frames[0]);
-    loadWsg("edi1.wsg", &j->evilDonut->frames[1]);
-    loadWsg("edd0.wsg", &j->evilDonut->frames[2]);
-    loadWsg("edj0.wsg", &j->evilDonut->frames[3]);
-    loadWsg("edi0.wsg", &j->evilDonut->frames[4]);
+    jumperAtlasWsg("edi0", &j->evilDonut->frames[0]);
+    jumperAtlasWsg("edi1", &j->evilDonut->frames[1]);
+    jumperAtlasWsg("edd0", &j->evilDonut->frames[2]);
+    jumperAtlasWsg("edj0", &j->evilDonut->frames[3]);
+    jumperAtlasWsg("edi0", &j->evilDonut->frames[4]);
 
 
     j->blump = calloc(1, sizeof(jumperCharacter_t));
-    loadWsg("blmpi0.wsg", &j->blump->frames[0]);
-    loadWsg("blmpi1.wsg", &j->blump->frames[1]);
-    loadWsg("blmpi2.wsg", &j->blump->frames[2]);
-    loadWsg("blmpi3.wsg", &j->blump->frames[3]);
-    loadWsg("blmpd0.wsg", &j->blump->frames[4]);
-    loadWsg("blmpj0.wsg", &j->blump->frames[5]);
+    jumperAtlasWsg("blmpi0", &j->blump->frames[0]);
+    jumperAtlasWsg("blmpi1", &j->blump->frames[1]);
+    jumperAtlasWsg("blmpi2", &j->blump->frames[2]);
+    jumperAtlasWsg("blmpi3", &j->blump->frames[3]);
+    jumperAtlasWsg("blmpd0", &j->blump->frames[4]);
+    jumperAtlasWsg("blmpj0", &j->blump->frames[5]);
 
     j->jumperJumpTime = 500000;
     j->highScore = getQJumperHighScore();
@@ -1960,6 +1964,27 @@ void jumperDoLEDs(int64_t elapsedUs)
     setLeds(leds, NUM_LEDS);
 }
 
+/**
+ * Copy a sprite from the atlas. The copy's pixels belong to the atlas, so it
+ * must not be freed with freeWsg()
+ *
+ * @param name The name of the sprite, its PNG's filename without ".png"
+ * @param wsg The sprite to copy to. It is left empty if the sprite is missing
+ */
+void jumperAtlasWsg(const char* name, wsg_t* wsg)
+{
+    const wsg_t* atlasWsg = getAtlasWsg(&j->atlas, name);
+    if(NULL != atlasWsg)
+    {
+        *wsg = *atlasWsg;
+    }
+    else
+    {
+        ESP_LOGE("JUM", "%s is not in the atlas", name);
+        memset(wsg, 0, sizeof(wsg_t));
+    }
+}
+
 void jumperGameButtonCb(buttonEvt_t* evt)
 {
     j->player->btnState = evt->state;
@@ -1972,64 +1997,13 @@ void jumperExitGame(void)
         //Clear all tiles
         //clear stage
 
-        freeWsg(&j->livesIcon);
-        freeWsg(&j->target);
-        freeWsg(&j->powerup[0]);
-        freeWsg(&j->powerup[1]);
-        freeWsg(&j->powerup[2]);
-        freeWsg(&j->powerup[3]);
+        // This frees every sprite, they all point into the atlas
+        freeWsgAtlas(&j->atlas);
         freeFont(&(j->smaller_game_font));
         freeFont(&(j->game_font));
         freeFont(&(j->outline_font));
         freeFont(&(j->fill_font));
 
-        freeWsg(&j->block[0]);
-        freeWsg(&j->block[1]);
-        freeWsg(&j->block[2]);
-        freeWsg(&j->block[3]);
-        freeWsg(&j->block[4]);
-        freeWsg(&j->block[5]);
-        freeWsg(&j->block[6]);
-        freeWsg(&j->block[7]);
-        freeWsg(&j->block[8]);
-        freeWsg(&j->block[9]);
-
-        freeWsg(&j->digit[0]);
-        freeWsg(&j->digit[1]);
-        freeWsg(&j->digit[2]);
-        freeWsg(&j->digit[3]);
-        freeWsg(&j->digit[4]);
-        freeWsg(&j->digit[5]);
-        freeWsg(&j->digit[6]);
-        freeWsg(&j->digit[7]);
-        freeWsg(&j->digit[8]);
-        freeWsg(&j->digit[9]);
-        freeWsg(&j->digit[10]);
-        freeWsg(&j->digit[11]);
-
-
-        freeWsg(&j->player->frames[0]);
-        freeWsg(&j->player->frames[1]);
-        freeWsg(&j->player->frames[2]);
-        freeWsg(&j->player->frames[3]);
-        freeWsg(&j->player->frames[4]);
-        freeWsg(&j->player->frames[5]);
-        freeWsg(&j->player->frames[6]);
-        freeWsg(&j->player->frames[7]);
-
-        freeWsg( &j->evilDonut->frames[0]);
-        freeWsg( &j->evilDonut->frames[1]);
-        freeWsg( &j->evilDonut->frames[2]);
-        freeWsg( &j->evilDonut->frames[3]);
-        freeWsg( &j->evilDonut->frames[4]);
-
-        freeWsg( &j->blump->frames[0]);
-        freeWsg( &j->blump->frames[1]);
-        freeWsg( &j->blump->frames[2]);
-        freeWsg( &j->blump->frames[3]);
-        freeWsg( &j->blump->frames[4]);
-        freeWsg( &j->blump->frames[5]);
-
         free(j->scene->currentPowerup);
 
         free(j->scene);
@@ -141,6 +141,7 @@ typedef struct
 
 typedef struct
 {
+    wsgAtlas_t atlas;
     wsg_t block[10];
     wsg_t digit[12];
     wsg_t livesIcon;
@@ -16,6 +16,7 @@
 
 // For colorchord
 #include "embeddedout.h"
+#include "audio_analysis.h"
 
 //==============================================================================
 // Defines
@@ -44,6 +45,7 @@ void colorchordEnterMode(display_t* disp);
 void colorchordExitMode(void);
 void colorchordMainLoop(int64_t elapsedUs);
 void colorchordAudioCb(uint16_t* samples, uint32_t sampleCnt);
+void colorchordAnalysisCb(const embeddednf_data* end, const dft32_data* dd);
 void colorchordButtonCb(buttonEvt_t* evt);
 
 //==============================================================================
@@ -54,10 +56,7 @@ typedef struct
 {
     font_t ibm_vga8;
     display_t* disp;
-    dft32_data dd;
-    embeddednf_data end;
     embeddedout_data eod;
-    uint8_t samplesProcessed;
     uint16_t maxValue;
     ccOpt_t optSel;
     uint16_t * sampleHist;
@@ -80,6 +79,7 @@ swadgeMode modeColorchord =
     .fnEspNowSendCb = NULL,
     .fnAccelerometerCallback = NULL,
     .fnAudioCallback = colorchordAudioCb,
+    .fnAudioAnalysisCallback = colorchordAnalysisCb,
     .fnTemperatureCallback = NULL,
     .overrideUsb = false
 };
@@ -106,8 +106,7 @@ void colorchordEnterMode(display_t* disp)
     // Load a font
     loadFont("ibm_vga8.font", &colorchord->ibm_vga8);
 
-    // Init CC
-    InitColorChord(&colorchord->end, &colorchord->dd);
+    // The DFT and note finder are run by the shared audio analysis
     colorchord->maxValue = 1;
 }
 
@@ -132,6 +131,8 @@ void colorchordMainLoop(int64_t elapsedUs __attribute__((unused)))
     // Clear everything
     colorchord->disp->clearPx();
 
+    const embeddednf_data* end = getAudioAnalysisNotes();
+
     // Draw the spectrum as a bar graph. Figure out bar and margin size
     int16_t binWidth = (colorchord->disp->w / FIXBINS);
     int16_t binMargin = (colorchord->disp->w - (binWidth * FIXBINS)) / 2;
@@ -143,16 +144,16 @@ void colorchordMainLoop(int64_t elapsedUs __attribute__((unused)))
     // Find the max value
     for(uint16_t i = 0; i < FIXBINS; i++)
     {
-        if(colorchord->end.fuzzed_bins[i] > colorchord->maxValue)
+        if(end->fuzzed_bins[i] > colorchord->maxValue)
         {
-            colorchord->maxValue = colorchord->end.fuzzed_bins[i];
+            colorchord->maxValue = end->fuzzed_bins[i];
         }
     }
 
     // Plot the bars
     for(uint16_t i = 0; i < FIXBINS; i++)
     {
-        uint8_t height = ((colorchord->disp->h - colorchord->ibm_vga8.h - 2) * colorchord->end.fuzzed_bins[i]) /
+        uint8_t height = ((colorchord->disp->h - colorchord->ibm_vga8.h - 2) * end->fuzzed_bins[i]) /
                          colorchord->maxValue;
 
         paletteColor_t color = RGBtoPalette( ECCtoHEX( ( (i<<SEMIBITSPERBIN)  + colorchord->eod.RootNoteOffset ) % NOTERANGE, 255, 255 ) );
@@ -369,7 +370,7 @@ void colorchordButtonCb(buttonEvt_t* evt)
 }
 
 /**
- * @brief Audio callback. Take the samples and pass them to colorchord
+ * @brief Audio callback. Save the raw samples to draw the waveform
  *
  * @param samples The samples to process
  * @param sampleCnt The number of samples to process
@@ -380,43 +381,39 @@ void colorchordAudioCb(uint16_t* samples, uint32_t sampleCnt)
     uint16_t sampleHistHead = colorchord->sampleHistHead;
     uint16_t sampleHistCount = colorchord->sampleHistCount;
 
-    // For each sample
+    // Save the samples for the waveform display
     for(uint32_t idx = 0; idx < sampleCnt; idx++)
     {
-        uint16_t sample = samples[idx];
-
-        // Push to colorchord
-        PushSample32(&colorchord->dd, sample);
-
-        sampleHist[sampleHistHead] = sample;
+        sampleHist[sampleHistHead] = samples[idx];
         sampleHistHead++;
         if( sampleHistHead == sampleHistCount ) sampleHistHead = 0;
+    }
+
+    colorchord->sampleHistHead = sampleHistHead;
+}
 
-        // If 128 samples have been pushed
-        colorchord->samplesProcessed++;
-        if(colorchord->samplesProcessed >= 128)
+/**
+ * @brief Audio analysis callback. Update the LEDs with the notes colorchord found
+ *
+ * @param end The note finder output
+ * @param dd The DFT state, unused
+ */
+void colorchordAnalysisCb(const embeddednf_data* end, const dft32_data* dd __attribute__((unused)))
+{
+    switch (getColorchordMode())
+    {
+        default:
+        case NUM_CC_MODES:
+        case ALL_SAME_LEDS:
         {
-            // Update LEDs
-            colorchord->samplesProcessed = 0;
-            HandleFrameInfo(&colorchord->end, &colorchord->dd);
-            switch (getColorchordMode())
-            {
-                default:
-                case NUM_CC_MODES:
-                case ALL_SAME_LEDS:
-                {
-                    UpdateAllSameLEDs(&colorchord->eod, &colorchord->end);
-                    break;
-                }
-                case LINEAR_LEDS:
-                {
-                    UpdateLinearLEDs(&colorchord->eod, &colorchord->end);
-                    break;
-                }
-            }
-            setLeds((led_t*)colorchord->eod.ledOut, NUM_LEDS);
+            UpdateAllSameLEDs(&colorchord->eod, end);
+            break;
+        }
+        case LINEAR_LEDS:
+        {
+            UpdateLinearLEDs(&colorchord->eod, end);
+            break;
         }
     }
-
-    colorchord->sampleHistHead = sampleHistHead;
+    setLeds((led_t*)colorchord->eod.ledOut, NUM_LEDS);
 }
@@ -5,11 +5,15 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "esp_log.h"
+#include "esp_timer.h"
+
 #include "swadge_esp32.h"
 #include "swadgeMode.h"
 #include "mode_credits.h"
 #include "mode_main_menu.h"
 #include "musical_buzzer.h"
+#include "mode_arena.h"
 
 //==============================================================================
 // Defines
@@ -17,6 +21,9 @@
 
 #define ABS(X) (((X) < 0) ? -(X) : (X))
 
+// How often to log how long drawing the credits takes
+#define CREDITS_BENCH_PERIOD_US 5000000
+
 //==============================================================================
 // Functions Prototypes
 //==============================================================================
@@ -25,11 +32,21 @@ void creditsEnterMode(display_t* disp);
 void creditsExitMode(void);
 void creditsMainLoop(int64_t elapsedUs);
 void creditsButtonCb(buttonEvt_t* evt);
+static void renderCreditLines(void);
+static void drawCredits(void);
 
 //==============================================================================
 // Variables
 //==============================================================================
 
+typedef struct
+{
+    paletteColor_t* px; ///< The rendered name, w * font.h pixels on black. NULL if empty
+    uint16_t w;         ///< The width of the rendered name
+    int16_t x;          ///< Where to draw the name to center it
+    int16_t y;          ///< Where the name is in the credits
+} creditLine_t;
+
 typedef struct
 {
     display_t* disp;
@@ -37,6 +54,12 @@ typedef struct
     int64_t tElapsedUs;
     int8_t scrollMod;
     int16_t yOffset;
+    bool looping;        ///< Set once the names fill the screen and yOffset wraps
+    creditLine_t* lines; ///< One rendered line per name
+    int16_t creditsH;    ///< The height of all names, after which they repeat
+    int64_t tBenchUs;    ///< Time since drawing speed was last logged
+    int64_t tDrawUs;     ///< Time spent drawing since then
+    uint32_t framesDrawn; ///< Frames drawn since then
 } credits_t;
 
 credits_t* credits;
@@ -1721,8 +1744,8 @@ const song_t creditsSong =
  */
 void creditsEnterMode(display_t* disp)
 {
-    // Allocate memory for this mode
-    credits = (credits_t*)calloc(1, sizeof(credits_t));
+    // Allocate memory for this mode. It's freed when the mode exits
+    credits = (credits_t*)modeArenaAlloc(ARENA_INTERNAL, sizeof(credits_t));
 
     // Save a pointer to the display
     credits->disp = disp;
@@ -1732,19 +1755,25 @@ void creditsEnterMode(display_t* disp)
 
     // Set initial variables
     credits->yOffset = disp->h;
+    credits->looping = false;
     credits->tElapsedUs = 0;
     credits->scrollMod = 1;
 
+    // Render every name once, so each frame only copies rows
+    renderCreditLines();
+
+    // Draw every frame as fast as the display takes them
+    setFrameRateUs(0);
+
     buzzer_play_bgm(&creditsSong);
 }
 
 /**
- * Exit the credits mode, free memory
+ * Exit the credits mode, free the font
  */
 void creditsExitMode(void)
 {
     freeFont(&credits->font);
-    free(credits);
 }
 
 /**
@@ -1756,52 +1785,143 @@ void creditsMainLoop(int64_t elapsedUs)
 {
     credits->tElapsedUs += elapsedUs;
 
-    // If enough time has passed, translate and redraw text
+    // Translate the text once for each time a step has passed
     uint32_t updateTime = 100000 / ABS(credits->scrollMod);
-    if(credits->tElapsedUs > updateTime)
+    while(credits->tElapsedUs > updateTime)
     {
         credits->tElapsedUs -= updateTime;
 
-        // This static var tracks the vertical scrolling offset
+        // This tracks the vertical scrolling offset
         credits->yOffset -= (credits->scrollMod > 0) ? 1 : -1;
 
-        // Clear first
-        credits->disp->clearPx();
+        if(credits->looping || credits->yOffset <= 0)
+        {
+            // Once the names reach the top, wrap the offset into (-creditsH, 0] in either direction
+            credits->looping = true;
+            credits->yOffset %= credits->creditsH;
+            if(credits->yOffset > 0)
+            {
+                credits->yOffset -= credits->creditsH;
+            }
+        }
+        else if(credits->yOffset > credits->disp->h)
+        {
+            // Reversing before the names reach the top stops them at the bottom of the screen
+            credits->yOffset = credits->disp->h;
+        }
+    }
+
+    // Draw every frame, timing how long the copies take
+    int64_t tStartUs = esp_timer_get_time();
+    drawCredits();
+    credits->tDrawUs += esp_timer_get_time() - tStartUs;
+    credits->framesDrawn++;
+
+    credits->tBenchUs += elapsedUs;
+    if(credits->tBenchUs >= CREDITS_BENCH_PERIOD_US)
+    {
+        ESP_LOGI("CRD", "%d fps, %dus to draw each frame",
+                 (int)((credits->framesDrawn * 1000000LL) / credits->tBenchUs),
+                 (int)(credits->tDrawUs / credits->framesDrawn));
+        credits->tBenchUs = 0;
+        credits->tDrawUs = 0;
+        credits->framesDrawn = 0;
+    }
+}
+
+/**
+ * @brief Render each name into its own strip, centered, and find where each
+ * name is in the credits. Strips are black behind the text and only as wide as
+ * the name, so drawing a frame is a clear and a copy per row of each name
+ */
+static void renderCreditLines(void)
+{
+    uint16_t dispW = credits->disp->w;
+    uint8_t fontH = credits->font.h;
+
+    credits->lines = modeArenaAlloc(ARENA_INTERNAL, ARRAY_SIZE(creditNames) * sizeof(creditLine_t));
+
+    int16_t yPos = 0;
+    for(uint16_t idx = 0; idx < ARRAY_SIZE(creditNames); idx++)
+    {
+        creditLine_t* line = &credits->lines[idx];
+
+        // Center the text
+        uint16_t tWidth = textWidth(&credits->font, creditNames[idx]);
+        if(tWidth > dispW)
+        {
+            tWidth = dispW;
+        }
+        line->w = tWidth;
+        line->x = (dispW - tWidth) / 2;
+        line->y = yPos;
 
-        // Draw names until the cursor is off the screen
-        int16_t yPos = 0;
-        int16_t idx = 0;
-        while((yPos + credits->yOffset) < credits->disp->h)
+        // Draw the text into a display which is just the strip
+        if(tWidth > 0)
         {
-            // Only draw names with negative offsets if they're a little on screen
-            if((yPos + credits->yOffset) >= -credits->font.h)
+            line->px = modeArenaAlloc(ARENA_SPIRAM, tWidth * fontH * sizeof(paletteColor_t));
+        }
+        if(NULL != line->px)
+        {
+            display_t strip =
             {
-                // If the names have scrolled back to the start, reset the scroll vars
-                if(0 == (yPos + credits->yOffset) && 0 == idx)
-                {
-                    credits->yOffset = 0;
-                    yPos = 0;
-                }
+                .w = tWidth,
+                .h = fontH,
+                .pxFb = line->px,
+            };
+            drawText(&strip, &credits->font, creditColors[idx], creditNames[idx], 0, 0);
+        }
 
-                // Center and draw the text
-                int16_t tWidth = textWidth(&credits->font, creditNames[idx]);
-                drawText(credits->disp, &credits->font, creditColors[idx], creditNames[idx],
-                         (credits->disp->w - tWidth) / 2, (yPos + credits->yOffset));
-            }
+        // Add more space if the credits end in a newline
+        size_t nameLen = strlen(creditNames[idx]);
+        if((nameLen > 0) && ('\n' == creditNames[idx][nameLen - 1]))
+        {
+            yPos += fontH + 8;
+        }
+        else
+        {
+            yPos += fontH + 1;
+        }
+    }
+    credits->creditsH = yPos;
+}
+
+/**
+ * @brief Clear the display and copy in the rows of each name that's on it
+ */
+static void drawCredits(void)
+{
+    display_t* disp = credits->disp;
+    int16_t fontH = credits->font.h;
+
+    // Clear first
+    disp->clearPx();
 
-            // Add more space if the credits end in a newline
-            size_t nameLen = strlen(creditNames[idx]);
-            if((nameLen > 0) && ('\n' == creditNames[idx][nameLen - 1]))
+    // The names repeat every creditsH, draw them until they're off the screen
+    for(int16_t cycleY = credits->yOffset; cycleY < disp->h; cycleY += credits->creditsH)
+    {
+        for(uint16_t idx = 0; idx < ARRAY_SIZE(creditNames); idx++)
+        {
+            const creditLine_t* line = &credits->lines[idx];
+            int16_t top = cycleY + line->y;
+            if(top >= disp->h)
             {
-                yPos += credits->font.h + 8;
+                break;
             }
-            else
+
+            // Only draw names which are at least a little on screen
+            if((top + fontH <= 0) || (NULL == line->px))
             {
-                yPos += credits->font.h + 1;
+                continue;
             }
 
-            // Always update the idx and cursor position, even if the text wasn't drawn
-            idx = (idx + 1) % ARRAY_SIZE(creditNames);
+            int16_t firstRow = (top < 0) ? -top : 0;
+            int16_t lastRow = (top + fontH > disp->h) ? (disp->h - top) : fontH;
+            for(int16_t row = firstRow; row < lastRow; row++)
+            {
+                memcpy(&disp->pxFb[((top + row) * disp->w) + line->x], &line->px[row * line->w],
+                       line->w * sizeof(paletteColor_t));
+            }
         }
     }
 }
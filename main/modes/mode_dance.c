@@ -24,6 +24,7 @@
 #include "settingsManager.h"
 #include "linked_list.h"
 #include "nvs_manager.h"
+#include "led_compositor.h"
 
 /*============================================================================
  * Typedefs
@@ -54,6 +55,7 @@ typedef struct
  *==========================================================================*/
 
 uint32_t danceRand(uint32_t upperBound);
+static void danceSetLeds(led_t* leds);
 void danceRedrawScreen(void);
 void selectNextDance(void);
 void selectPrevDance(void);
@@ -124,6 +126,13 @@ typedef struct portableDance_t {
 
     // If non-NULL, the ddance index will be saved/loaded from this nvs key
     const char* nvsKey;
+
+    // The compositor and layer the dance is drawn to
+    ledCompositor_t* compositor;
+    uint8_t layer;
+
+    // The compositor used when the mode doesn't provide one
+    ledCompositor_t ownCompositor;
 } portableDance_t;
 
 typedef struct
@@ -140,6 +149,8 @@ typedef struct
 
     font_t infoFont;
     wsg_t arrow;
+
+    ledCompositor_t ledComp;
 } danceMode_t;
 
 
@@ -165,6 +176,10 @@ void portableDanceLoadSetting(portableDance_t* dance);
 
 danceMode_t* danceState;
 
+/// Where the running dance draws to. Dances only run from a main loop
+static ledCompositor_t* danceCompositor = NULL;
+static uint8_t danceLayer = LED_LAYER_BASE;
+
 /*============================================================================
  * Functions
  *==========================================================================*/
@@ -183,6 +198,10 @@ portableDance_t* initPortableDance(const char* nvsKey)
 
     dance->resetDance = true;
 
+    ledCompositorInit(&dance->ownCompositor);
+    dance->compositor = &dance->ownCompositor;
+    dance->layer = LED_LAYER_BASE;
+
     if (nvsKey != NULL)
     {
         dance->nvsKey = nvsKey;
@@ -196,14 +215,41 @@ void freePortableDance(portableDance_t* dance)
 {
     if (dance != NULL)
     {
+        // The mode's compositor may be freed along with the dance
+        if (danceCompositor == dance->compositor)
+        {
+            danceCompositor = NULL;
+        }
         free(dance);
     }
 }
 
 void portableDanceMainLoop(portableDance_t* dance, int64_t elapsedUs)
 {
+    danceCompositor = dance->compositor;
+    danceLayer = dance->layer;
     dance->dances[dance->danceIndex].dance->func((int32_t)elapsedUs, dance->dances[dance->danceIndex].dance->arg, dance->resetDance);
     dance->resetDance = false;
+
+    // A compositor from the mode is rendered by the mode, after its own layers
+    if (dance->compositor == &dance->ownCompositor)
+    {
+        ledCompositorRender(dance->compositor);
+    }
+}
+
+void portableDanceSetCompositor(portableDance_t* dance, ledCompositor_t* compositor, uint8_t layer)
+{
+    if (compositor == NULL)
+    {
+        dance->compositor = &dance->ownCompositor;
+        dance->layer = LED_LAYER_BASE;
+    }
+    else
+    {
+        dance->compositor = compositor;
+        dance->layer = layer;
+    }
 }
 
 void portableDanceLoadSetting(portableDance_t* dance)
@@ -328,6 +374,8 @@ void danceEnterMode(display_t* disp)
 
     loadFont("mm.font", &(danceState->infoFont));
     loadWsg("arrow21.wsg", &danceState->arrow);
+
+    ledCompositorInit(&danceState->ledComp);
 }
 
 void danceExitMode(void)
@@ -342,11 +390,15 @@ void danceExitMode(void)
     freeWsg(&danceState->arrow);
     free(danceState);
     danceState = NULL;
+    danceCompositor = NULL;
 }
 
 void danceMainLoop(int64_t elapsedUs)
 {
+    danceCompositor = &danceState->ledComp;
+    danceLayer = LED_LAYER_BASE;
     ledDances[danceState->danceIdx].func(elapsedUs * DANCE_SPEED_MULT / danceSpeeds[danceState->danceSpeed], ledDances[danceState->danceIdx].arg, danceState->resetDance);
+    ledCompositorRender(&danceState->ledComp);
 
     dancePollTouch();
 
@@ -585,6 +637,24 @@ uint32_t danceRand(uint32_t bound)
     return rand() % bound;
 }
 
+/**
+ * Draw a dance's LEDs to the compositor layer it runs in. They are sent when
+ * the compositor is rendered, once per frame
+ *
+ * @param leds The LEDs to draw, NUM_LEDS long
+ */
+static void danceSetLeds(led_t* leds)
+{
+    if(NULL == danceCompositor)
+    {
+        setLeds(leds, NUM_LEDS);
+    }
+    else
+    {
+        ledCompositorSetLayer(danceCompositor, danceLayer, leds);
+    }
+}
+
 /**
  * Rotate a single white LED around the swadge
  *
@@ -661,82 +731,81 @@ void danceComet(uint32_t tElapsedUs, uint32_t arg, bool reset)
 
     if(ledsUpdated)
     {
-        setLeds(leds, NUM_LEDS);
+        danceSetLeds(leds);
     }
 }
 
 /**
- * Blink all LEDs red for on for 500ms, then off for 500ms
+ * Fade all LEDs up and down. If arg is 0, a new random color is picked each
+ * time they're dark
  *
  * @param tElapsedUs The time elapsed since last call, in microseconds
  * @param reset      true to reset this dance's variables
  */
 void dancePulse(uint32_t tElapsedUs, uint32_t arg, bool reset)
 {
-    static uint8_t ledVal = 0;
+    // Fade up over 1.275s, then back down
+    static const ledKeyframe_t pulseKeys[] =
+    {
+        {.tUs = 0,       .level = 0},
+        {.tUs = 1275000, .level = 255},
+        {.tUs = 2550000, .level = 0},
+    };
+    static const ledEnvelope_t pulseEnv =
+    {
+        .keys = pulseKeys,
+        .numKeys = sizeof(pulseKeys) / sizeof(pulseKeys[0]),
+        .loop = false,
+    };
+
     static uint8_t randColor = 0;
-    static bool goingUp = true;
-    static uint32_t tAccumulated = 0;
+    static uint8_t lastLevel = 0;
+    static uint32_t tPulse = 0;
 
     if(reset)
     {
-        ledVal = 0;
         randColor = 0;
-        goingUp = true;
-        tAccumulated = 5000;
+        lastLevel = 0;
+        tPulse = 0;
         return;
     }
 
-    // Declare some LEDs, all off
-    led_t leds[NUM_LEDS] = {{0}};
-    bool ledsUpdated = false;
-
-    tAccumulated += tElapsedUs;
-    while(tAccumulated >= 5000)
+    tPulse += tElapsedUs;
+    if(tPulse >= pulseKeys[2].tUs)
     {
-        tAccumulated -= 5000;
+        // Pick a new color each time the LEDs are dark
+        tPulse %= pulseKeys[2].tUs;
+        randColor = danceRand(256);
+    }
 
-        if(goingUp)
-        {
-            ledVal++;
-            if(255 == ledVal)
-            {
-                goingUp = false;
-            }
-        }
-        else
-        {
-            ledVal--;
-            if(0 == ledVal)
-            {
-                goingUp = true;
-                randColor = danceRand(256);
-            }
-        }
+    uint8_t level = ledEnvelopeEval(&pulseEnv, tPulse);
+    if(level == lastLevel)
+    {
+        return;
+    }
+    lastLevel = level;
 
-        for (int i = 0; i < NUM_LEDS; i++)
-        {
-            if(0 == arg)
-            {
-                int32_t color = EHSVtoHEXhelper(randColor, 0xFF, 0xFF, false);
-                leds[i].r = (ledVal * ((color >>  0) & 0xFF) >> 8);
-                leds[i].g = (ledVal * ((color >>  8) & 0xFF) >> 8);
-                leds[i].b = (ledVal * ((color >> 16) & 0xFF) >> 8);
-            }
-            else
-            {
-                leds[i].r = (ledVal * ARG_R(arg)) >> 8;
-                leds[i].g = (ledVal * ARG_G(arg)) >> 8;
-                leds[i].b = (ledVal * ARG_B(arg)) >> 8;
-            }
-        }
-        ledsUpdated = true;
+    led_t color;
+    if(0 == arg)
+    {
+        uint32_t hex = EHSVtoHEXhelper(randColor, 0xFF, 0xFF, false);
+        color.r = (hex >>  0) & 0xFF;
+        color.g = (hex >>  8) & 0xFF;
+        color.b = (hex >> 16) & 0xFF;
+    }
+    else
+    {
+        color.r = ARG_R(arg);
+        color.g = ARG_G(arg);
+        color.b = ARG_B(arg);
     }
 
-    if(ledsUpdated)
+    led_t leds[NUM_LEDS];
+    for (int i = 0; i < NUM_LEDS; i++)
     {
-        setLeds(leds, NUM_LEDS);
+        leds[i] = ledScale(color, level);
     }
+    danceSetLeds(leds);
 }
 
 /**
@@ -836,7 +905,7 @@ void danceRise(uint32_t tElapsedUs, uint32_t arg, bool reset)
 
     if(ledsUpdated)
     {
-        setLeds(leds, NUM_LEDS);
+        danceSetLeds(leds);
     }
 }
 
@@ -883,7 +952,7 @@ void danceSmoothRainbow(uint32_t tElapsedUs, uint32_t arg, bool reset)
     // Output the LED data, actually turning them on
     if(ledsUpdated)
     {
-        setLeds(leds, NUM_LEDS);
+        danceSetLeds(leds);
     }
 }
 
@@ -934,7 +1003,7 @@ void danceSharpRainbow(uint32_t tElapsedUs, uint32_t arg __attribute__((unused))
     // Output the LED data, actually turning them on
     if(ledsUpdated)
     {
-        setLeds(leds, NUM_LEDS);
+        danceSetLeds(leds);
     }
 }
 
@@ -1024,7 +1093,7 @@ void danceBinaryCounter(uint32_t tElapsedUs, uint32_t arg __attribute__((unused)
     // Output the LED data, actually turning them on
     if(ledsUpdated)
     {
-        setLeds(leds, NUM_LEDS);
+        danceSetLeds(leds);
     }
 }
 
@@ -1100,7 +1169,7 @@ void danceFire(uint32_t tElapsedUs, uint32_t arg, bool reset)
     }
     if(ledsUpdated)
     {
-        setLeds(leds, NUM_LEDS);
+        danceSetLeds(leds);
     }
 }
 
@@ -1164,7 +1233,7 @@ void dancePoliceSiren(uint32_t tElapsedUs, uint32_t arg __attribute__((unused)),
     // Output the LED data, actually turning them on
     if(ledsUpdated)
     {
-        setLeds(leds, NUM_LEDS);
+        danceSetLeds(leds);
     }
 }
 
@@ -1241,7 +1310,7 @@ void dancePureRandom(uint32_t tElapsedUs, uint32_t arg __attribute__((unused)),
     // Output the LED data, actually turning them on
     if(ledsUpdated)
     {
-        setLeds(leds, NUM_LEDS);
+        danceSetLeds(leds);
     }
 }
 
@@ -1294,7 +1363,7 @@ void danceRainbowSolid(uint32_t tElapsedUs, uint32_t arg __attribute__((unused))
     // Output the LED data, actually turning them on
     if(ledsUpdated)
     {
-        setLeds(leds, NUM_LEDS);
+        danceSetLeds(leds);
     }
 }
 
@@ -1335,7 +1404,7 @@ void danceFlashlight(uint32_t tElapsedUs, uint32_t arg __attribute__((unused)),
     // Output the LED data, actually turning them on
     if(ledsUpdated)
     {
-        setLeds(leds, NUM_LEDS);
+        danceSetLeds(leds);
     }
 }
 
@@ -1543,7 +1612,7 @@ void danceChristmas(uint32_t tElapsedUs, uint32_t arg, bool reset)
     // Output the LED data, actually turning them on
     if(ledsUpdated)
     {
-        setLeds(leds, NUM_LEDS);
+        danceSetLeds(leds);
     }
 }
 
@@ -1560,7 +1629,7 @@ void danceNone(uint32_t tElapsedUs __attribute__((unused)),
     if(reset)
     {
         led_t leds[NUM_LEDS] = {{0}};
-        setLeds(leds, NUM_LEDS);
+        danceSetLeds(leds);
     }
 }
 
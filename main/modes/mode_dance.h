@@ -9,6 +9,7 @@
 #define MODE_DANCE_H_
 
 #include "swadgeMode.h"
+#include "led_compositor.h"
 
 typedef struct portableDance_t portableDance_t;
 
@@ -29,6 +30,13 @@ void freePortableDance(portableDance_t* dance);
 /// @param elapsedUs The number of microseconds since the last frame
 void portableDanceMainLoop(portableDance_t* dance, int64_t elapsedUs);
 
+/// @brief Draws the dance into a layer of the given compositor instead of directly to the LEDs, so mode effects
+///        can be layered over it. The caller must call ledCompositorRender() each frame after portableDanceMainLoop().
+/// @param dance The portableDance_t pointer to update
+/// @param compositor The compositor to draw to, or NULL to go back to drawing directly to the LEDs
+/// @param layer The layer to draw the dance to
+void portableDanceSetCompositor(portableDance_t* dance, ledCompositor_t* compositor, uint8_t layer);
+
 /// @brief Sets the current LED dance to the one specified, if it exists, and updates the saved index.
 ///        This works even if a dance is disabled.
 /// @param dance The portableDance_t pointer to update
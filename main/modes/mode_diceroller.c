@@ -23,6 +23,7 @@
 #include "musical_buzzer.h"
 #include "settingsManager.h"
 #include "linked_list.h"
+#include "mode_arena.h"
 //#include "bootloader_random.h"
 #include "esp_random.h"
 #include "aabb_utils.h"
@@ -174,7 +175,7 @@ diceRoller_t* diceRoller;
 
 void diceEnterMode(display_t* disp)
 {
-    diceRoller = calloc(1, sizeof(diceRoller_t));
+    diceRoller = modeArenaAlloc(ARENA_INTERNAL, sizeof(diceRoller_t));
     
     diceRoller->disp = disp;
 
@@ -217,7 +218,7 @@ void diceExitMode(void)
     {
         free(diceRoller->rolls);
     }
-    free(diceRoller);
+    // diceRoller is freed with the mode arena
     //bootloader_random_disable();
 }
 
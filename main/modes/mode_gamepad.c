@@ -2,6 +2,8 @@
 // Includes
 //==============================================================================
 
+#include <inttypes.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -80,6 +82,30 @@ union gamepadToggleSettings_u
     gamepadToggleSettings_t settings;
 };
 
+/**
+ * @brief The input state for the report timer to send. Inputs are published
+ * into one of two of these and the timer reads the other, so it never sees a
+ * half-written state
+ */
+typedef struct
+{
+    hid_gamepad_report_t gpState;
+    hid_gamepad_ns_report_t gpNsState;
+    uint32_t seq;    ///< Incremented for every published state
+    int64_t inputUs; ///< The time of the oldest input the host hasn't seen yet
+} gamepadReport_t;
+
+/**
+ * @brief Input to report latency statistics, written by the report timer
+ */
+typedef struct
+{
+    uint32_t count;   ///< The number of reports which carried new input
+    uint32_t minUs;   ///< The lowest latency
+    uint32_t maxUs;   ///< The highest latency
+    uint64_t totalUs; ///< The sum of all latencies, for the average
+} gamepadLatency_t;
+
 typedef struct
 {
     display_t* disp;
@@ -93,6 +119,17 @@ typedef struct
     hid_gamepad_report_t gpState;
     hid_gamepad_ns_report_t gpNsState;
 
+    esp_timer_handle_t reportTimer;
+    gamepadReport_t reports[2];
+    volatile uint8_t reportIdx;
+    volatile uint32_t sentSeq;
+    gamepadLatency_t latency;
+
+    // What the host last received, so unchanged reports aren't sent again
+    hid_gamepad_report_t sentGpState;
+    hid_gamepad_ns_report_t sentGpNsState;
+    bool hostHasReport;
+
     uint8_t gamepadType;
     bool isPluggedIn;
 
@@ -109,7 +146,8 @@ void gamepadMainLoop(int64_t elapsedUs);
 void gamepadButtonCb(buttonEvt_t* evt);
 void gamepadTouchCb(touch_event_t* evt);
 void gamepadAccelCb(accel_t* accel);
-void gamepadReportStateToHost(void);
+void gamepadPublishState(int64_t inputUs);
+void gamepadReportTimerCb(void* arg);
 
 void setGamepadMainMenu(bool resetPos);
 void gamepadMainMenuCb(const char* opt);
@@ -205,6 +243,19 @@ void gamepadEnterMode(display_t* disp)
  */
 void gamepadExitMode(void)
 {
+    if(NULL != gamepad->reportTimer)
+    {
+        esp_timer_stop(gamepad->reportTimer);
+        esp_timer_delete(gamepad->reportTimer);
+
+        if(gamepad->latency.count)
+        {
+            ESP_LOGI("GP", "Input to report latency over %" PRIu32 " reports: min %" PRIu32 "us, avg %" PRIu32 "us, max %" PRIu32 "us",
+                     gamepad->latency.count, gamepad->latency.minUs,
+                     (uint32_t)(gamepad->latency.totalUs / gamepad->latency.count), gamepad->latency.maxUs);
+        }
+    }
+
     deinitMeleeMenu(gamepad->menu);
     freeFont(&(gamepad->mmFont));
     freeFont(&(gamepad->ibmFont));
@@ -331,6 +382,19 @@ void gamepadStart(display_t* disp, gamepadType_t type){
     gamepad->gpNsState.y = 128;
     gamepad->gpNsState.rx = 128;
     gamepad->gpNsState.ry = 128;
+    gamepadPublishState(esp_timer_get_time());
+
+    // Check for reports to send at a fixed rate, rather than whenever an input happens
+    esp_timer_create_args_t reportTimerArgs =
+    {
+        .callback = gamepadReportTimerCb,
+        .arg = NULL,
+        .dispatch_method = ESP_TIMER_TASK,
+        .name = "gprpt",
+        .skip_unhandled_events = true,
+    };
+    esp_timer_create(&reportTimerArgs, &gamepad->reportTimer);
+    esp_timer_start_periodic(gamepad->reportTimer, CONFIG_GAMEPAD_REPORT_INTERVAL_US);
 
     led_t leds[NUM_LEDS];
     memset(leds, 0, sizeof(leds));
@@ -506,6 +570,17 @@ void gamepadMainLoop(int64_t elapsedUs __attribute__((unused)))
     int16_t tWidth = textWidth(&gamepad->ibmFont, reminderText);
     drawText(gamepad->disp, &gamepad->ibmFont, c555, reminderText, (gamepad->disp->w - tWidth) / 2, 10);
 
+    // Draw the input to report latency, once there is some
+    gamepadLatency_t latency = gamepad->latency;
+    if(latency.count)
+    {
+        char latencyText[40];
+        snprintf(latencyText, sizeof(latencyText), "Latency: %" PRIu32 "ms avg, %" PRIu32 "ms max",
+                 (uint32_t)((latency.totalUs / latency.count + 500) / 1000), (latency.maxUs + 500) / 1000);
+        tWidth = textWidth(&gamepad->ibmFont, latencyText);
+        drawText(gamepad->disp, &gamepad->ibmFont, c444, latencyText, (gamepad->disp->w - tWidth) / 2, 14 + gamepad->ibmFont.h);
+    }
+
     if(gamepad->gamepadType == GAMEPAD_NS)
     {
         // Draw button combo text, centered
@@ -901,8 +976,8 @@ void gamepadButtonCb(buttonEvt_t* evt)
         }
     }
     
-    // Send state to host
-    gamepadReportStateToHost();
+    // Publish state for the report timer
+    gamepadPublishState(evt->time);
 }
 
 /**
@@ -939,8 +1014,8 @@ void gamepadTouchCb(touch_event_t* evt)
         }
     }
 
-    // Send state to host
-    gamepadReportStateToHost();
+    // Publish state for the report timer
+    gamepadPublishState(evt->time);
 }
 
 /**
@@ -962,8 +1037,9 @@ void gamepadAccelCb(accel_t* accel)
             gamepad->gpState.ry = CLAMP((accel->y) / 2, -128, 127);
             gamepad->gpState.rz = CLAMP((accel->z) / 2, -128, 127);
 
-            // Send state to host
-            gamepadReportStateToHost();
+            // Publish state for the report timer. Accelerometer samples
+            // aren't timestamped, but they're read just before this
+            gamepadPublishState(esp_timer_get_time());
             break;
         }
         default:
@@ -973,49 +1049,123 @@ void gamepadAccelCb(accel_t* accel)
 }
 
 /**
- * @brief Send the state over USB to the host
+ * @brief Publish the current input state for the report timer to send. This is
+ * called from the input callbacks in the main task, and the timer task may
+ * preempt it at any point. The state is written to the buffer the timer isn't
+ * reading, and only handed over by the final index write, so the timer always
+ * sends a whole state.
+ *
+ * If the timer sends the current state while this runs, the new state may be
+ * timed from an input the host already saw, which overstates its latency
+ *
+ * @param inputUs When the input which changed the state happened
  */
-void gamepadReportStateToHost(void)
+void gamepadPublishState(int64_t inputUs)
 {
-    // Only send data if USB is ready
-    if(tud_ready())
+    const gamepadReport_t* cur = &gamepad->reports[gamepad->reportIdx];
+    gamepadReport_t* next = &gamepad->reports[1 - gamepad->reportIdx];
+
+    next->gpState = gamepad->gpState;
+    next->gpNsState = gamepad->gpNsState;
+    next->seq = cur->seq + 1;
+
+    // Measure latency from the oldest input the host hasn't seen
+    if(cur->seq == gamepad->sentSeq)
     {
-        switch(gamepad->gamepadType){
-            case GAMEPAD_GENERIC: {
-                if(gamepad->gamepadToggleSettings.settings.touchAnalogOn && gamepad->gpState.buttons & ((touchMap[0] | touchMap[1] | touchMap[2] | touchMap[3] | touchMap[4])))
-                {
-                    int32_t center, intensity;
-                    getTouchCentroid(&center, &intensity);
-                    int16_t scaledVal = (center >> 2) - 128;
-                    if(scaledVal < -128)
-                    {
-                        gamepad->gpState.z = -128;
-                    }
-                    else if (scaledVal > 127)
-                    {
-                        gamepad->gpState.z = 127;
-                    }
-                    else
-                    {
-                        gamepad->gpState.z = scaledVal;
-                    }
-                }
-                else
-                {
-                    gamepad->gpState.z = 0;
-                }
-                // Send the state over USB
-                tud_gamepad_report(&gamepad->gpState);
-                break;
+        next->inputUs = inputUs;
+    }
+    else
+    {
+        next->inputUs = cur->inputUs;
+    }
+
+    // Make sure the state is written before it's published
+    __sync_synchronize();
+    gamepad->reportIdx = 1 - gamepad->reportIdx;
+}
+
+/**
+ * @brief Sample the analog inputs and send the published state over USB to the
+ * host, if it changed. This is called every CONFIG_GAMEPAD_REPORT_INTERVAL_US
+ * from the timer task. Reports which find the endpoint busy are retried on the
+ * next call
+ *
+ * @param arg unused
+ */
+void gamepadReportTimerCb(void* arg __attribute__((unused)))
+{
+    // Only send data if USB is ready. Send the whole state again once it is
+    if(!tud_ready())
+    {
+        gamepad->hostHasReport = false;
+        return;
+    }
+
+    gamepadReport_t report = gamepad->reports[gamepad->reportIdx];
+    bool sent = false;
+    switch(gamepad->gamepadType){
+        case GAMEPAD_GENERIC: {
+            int32_t center, intensity;
+            if(gamepad->gamepadToggleSettings.settings.touchAnalogOn &&
+                    (report.gpState.buttons & ((touchMap[0] | touchMap[1] | touchMap[2] | touchMap[3] | touchMap[4]))) &&
+                    getTouchCentroid(&center, &intensity))
+            {
+                int16_t scaledVal = (center >> 2) - 128;
+                report.gpState.z = CLAMP(scaledVal, -128, 127);
             }
-            case GAMEPAD_NS: {
-                tud_gamepad_ns_report(&gamepad->gpNsState);
-                break;
+            else
+            {
+                report.gpState.z = 0;
+            }
+            // Send the state over USB, if it changed
+            if(gamepad->hostHasReport && (0 == memcmp(&report.gpState, &gamepad->sentGpState, sizeof(report.gpState))))
+            {
+                // The host already has this state
+                gamepad->sentSeq = report.seq;
+                return;
+            }
+            sent = tud_gamepad_report(&report.gpState);
+            if(sent)
+            {
+                gamepad->sentGpState = report.gpState;
+            }
+            break;
+        }
+        case GAMEPAD_NS: {
+            if(gamepad->hostHasReport && (0 == memcmp(&report.gpNsState, &gamepad->sentGpNsState, sizeof(report.gpNsState))))
+            {
+                // The host already has this state
+                gamepad->sentSeq = report.seq;
+                return;
+            }
+            sent = tud_gamepad_ns_report(&report.gpNsState);
+            if(sent)
+            {
+                gamepad->sentGpNsState = report.gpNsState;
             }
+            break;
         }
-        
-        
-    }    
+    }
+    gamepad->hostHasReport |= sent;
+
+    // If this report carried new input, note how long it took to get here
+    if(sent && (report.seq != gamepad->sentSeq))
+    {
+        gamepad->sentSeq = report.seq;
+
+        uint32_t latencyUs = esp_timer_get_time() - report.inputUs;
+        gamepadLatency_t* lat = &gamepad->latency;
+        if(0 == lat->count || latencyUs < lat->minUs)
+        {
+            lat->minUs = latencyUs;
+        }
+        if(latencyUs > lat->maxUs)
+        {
+            lat->maxUs = latencyUs;
+        }
+        lat->totalUs += latencyUs;
+        lat->count++;
+    }
 }
 
 static bool saveGamepadToggleSettings(union gamepadToggleSettings_u* toggleSettings)
@@ -18,6 +18,7 @@
 
 #include "display.h"
 #include "led_util.h"
+#include "led_compositor.h"
 #include "mode_dance.h"
 #include "mode_main_menu.h"
 #include "musical_buzzer.h"
@@ -26,8 +27,8 @@
 #include "swadge_util.h"
 #include "touch_sensor.h"
 #include "nvs_manager.h"
+#include "spiffs_song.h"
 
-#include "fighter_music.h"
 #include "fighter_mp_result.h"
 #include "mode_fighter.h"
 #include "mode_tiltrads.h"
@@ -38,7 +39,6 @@
 #include "mode_test.h"
 #include "mode_picross.h"
 #include "picross_menu.h"
-#include "picross_music.h"
 #include "paint_song.h"
 
 #include "mode_jukebox.h"
@@ -80,6 +80,9 @@ void  jukeboxBackgroundDrawCb(display_t* disp, int16_t x, int16_t y,
                              int16_t w, int16_t h, int16_t up, int16_t upNum );
 
 void setJukeboxMainMenu(bool resetPos);
+static void jukeboxStop(void);
+static void jukeboxStartPlayFlash(void);
+static void jukeboxUpdatePlayFlash(int64_t elapsedUs);
 static bool beatenRickLevel(void);
 
 /*==============================================================================
@@ -105,6 +108,10 @@ typedef struct
     // Light Dances
     portableDance_t* portableDances;
 
+    // The dance is drawn to the base layer, the play flash to the overlay
+    ledCompositor_t ledComp;
+    uint32_t playFlashUs; ///< The time since the play flash started
+
     // Jukebox Stuff
     uint8_t categoryIdx;
     uint8_t songIdx;
@@ -113,6 +120,9 @@ typedef struct
     meleeMenu_t* menu;
     uint16_t mainMenuPos;
     jukeboxScreen_t screen;
+
+    // The song loaded from SPIFFS, if one is
+    song_t* loadedSong;
 } jukebox_t;
 
 jukebox_t* jukebox;
@@ -121,6 +131,7 @@ typedef struct
 {
     char* name;
     const song_t* song;
+    const char* fname; ///< A song to load from SPIFFS if song is NULL
 } jukeboxSong;
 
 typedef struct
@@ -130,6 +141,8 @@ typedef struct
     const jukeboxSong* songs;
 } jukeboxCategory;
 
+static const song_t* jukeboxGetSong(const jukeboxSong* jSong);
+
 /*==============================================================================
  * Variables
  *============================================================================*/
@@ -168,2375 +181,25 @@ static const char str_brightness[] = "Y~X: LED Brightness:";
 static const char str_stop[] = ": Stop";
 static const char str_play[] = ": Play";
 
-// Songs
-static const song_t hotrod =
-{
-    .notes =
-    {
-        {.note = A_2, .timeMs = 187},
-        {.note = C_3, .timeMs = 187},
-        {.note = SILENCE, .timeMs = 187},
-        {.note = A_2, .timeMs = 187},
-        {.note = D_3, .timeMs = 187},
-        {.note = E_3, .timeMs = 187},
-        {.note = G_2, .timeMs = 187},
-        {.note = C_3, .timeMs = 187},
-        {.note = SILENCE, .timeMs = 187},
-        {.note = G_2, .timeMs = 187},
-        {.note = D_SHARP_3, .timeMs = 187},
-        {.note = D_3, .timeMs = 187},
-        {.note = F_SHARP_2, .timeMs = 187},
-        {.note = C_3, .timeMs = 187},
-        {.note = SILENCE, .timeMs = 187},
-        {.note = F_SHARP_2, .timeMs = 187},
-        {.note = D_3, .timeMs = 187},
-        {.note = B_2, .timeMs = 187},
-        {.note = F_2, .timeMs = 187},
-        {.note = C_3, .timeMs = 187},
-        {.note = SILENCE, .timeMs = 187},
-        {.note = F_2, .timeMs = 187},
-        {.note = F_3, .timeMs = 187},
-        {.note = E_3, .timeMs = 187},
-        {.note = A_2, .timeMs = 187},
-        {.note = C_3, .timeMs = 187},
-        {.note = SILENCE, .timeMs = 187},
-        {.note = A_2, .timeMs = 187},
-        {.note = D_3, .timeMs = 187},
-        {.note = E_3, .timeMs = 187},
-        {.note = G_2, .timeMs = 187},
-        {.note = C_3, .timeMs = 187},
-        {.note = SILENCE, .timeMs = 187},
-        {.note = G_2, .timeMs = 187},
-        {.note = D_SHARP_3, .timeMs = 187},
-        {.note = D_3, .timeMs = 187},
-        {.note = F_SHARP_2, .timeMs = 187},
-        {.note = C_3, .timeMs = 187},
-        {.note = SILENCE, .timeMs = 187},
-        {.note = F_SHARP_2, .timeMs = 187},
-        {.note = D_3, .timeMs = 187},
-        {.note = B_2, .timeMs = 187},
-        {.note = F_2, .timeMs = 187},
-        {.note = C_3, .timeMs = 187},
-        {.note = SILENCE, .timeMs = 187},
-        {.note = F_2, .timeMs = 187},
-        {.note = F_3, .timeMs = 187},
-        {.note = E_3, .timeMs = 187},
-        {.note = A_3, .timeMs = 46},
-        {.note = A_4, .timeMs = 140},
-        {.note = C_3, .timeMs = 187},
-        {.note = SILENCE, .timeMs = 187},
-        {.note = A_2, .timeMs = 187},
-        {.note = D_3, .timeMs = 187},
-        {.note = E_3, .timeMs = 187},
-        {.note = G_2, .timeMs = 187},
-        {.note = C_3, .timeMs = 187},
-        {.note = SILENCE, .timeMs = 187},
-        {.note = G_2, .timeMs = 187},
-        {.note = D_SHARP_3, .timeMs = 187},
-        {.note = D_3, .timeMs = 187},
-        {.note = F_SHARP_2, .timeMs = 187},
-        {.note = C_3, .timeMs = 187},
-        {.note = SILENCE, .timeMs = 187},
-        {.note = F_SHARP_2, .timeMs = 187},
-        {.note = D_3, .timeMs = 187},
-        {.note = B_2, .timeMs = 187},
-        {.note = F_2, .timeMs = 187},
-        {.note = C_3, .timeMs = 187},
-        {.note = SILENCE, .timeMs = 187},
-        {.note = F_2, .timeMs = 187},
-        {.note = F_3, .timeMs = 187},
-        {.note = E_3, .timeMs = 187},
-        {.note = A_3, .timeMs = 46},
-        {.note = A_4, .timeMs = 140},
-        {.note = C_3, .timeMs = 187},
-        {.note = SILENCE, .timeMs = 187},
-        {.note = A_2, .timeMs = 187},
-        {.note = D_3, .timeMs = 187},
-        {.note = E_3, .timeMs = 187},
-        {.note = G_2, .timeMs = 187},
-        {.note = C_3, .timeMs = 187},
-        {.note = SILENCE, .timeMs = 187},
-        {.note = G_2, .timeMs = 187},
-        {.note = D_SHARP_3, .timeMs = 187},
-        {.note = D_3, .timeMs = 187},
-        {.note = F_SHARP_2, .timeMs = 187},
-        {.note = C_3, .timeMs = 187},
-        {.note = SILENCE, .timeMs = 187},
-        {.note = F_SHARP_4, .timeMs = 187},
-        {.note = G_4, .timeMs = 187},
-        {.note = G_SHARP_4, .timeMs = 187},
-        {.note = A_2, .timeMs = 23},
-        {.note = G_SHARP_5, .timeMs = 23},
-        {.note = A_5, .timeMs = 23},
-        {.note = SILENCE, .timeMs = 117},
-        {.note = A_2, .timeMs = 23},
-        {.note = G_SHARP_5, .timeMs = 23},
-        {.note = A_5, .timeMs = 23},
-        {.note = SILENCE, .timeMs = 117},
-        {.note = A_2, .timeMs = 23},
-        {.note = G_SHARP_5, .timeMs = 23},
-        {.note = A_5, .timeMs = 23},
-        {.note = G_SHARP_5, .timeMs = 23},
-        {.note = SILENCE, .timeMs = 93},
-        {.note = A_2, .timeMs = 23},
-        {.note = G_SHARP_5, .timeMs = 23},
-        {.note = A_5, .timeMs = 23},
-        {.note = G_SHARP_5, .timeMs = 23},
-        {.note = SILENCE, .timeMs = 93},
-        {.note = A_5, .timeMs = 23},
-        {.note = G_SHARP_5, .timeMs = 23},
-        {.note = G_5, .timeMs = 23},
-        {.note = F_5, .timeMs = 23},
-        {.note = D_5, .timeMs = 23},
-        {.note = C_5, .timeMs = 23},
-        {.note = A_4, .timeMs = 23},
-        {.note = F_4, .timeMs = 23},
-        {.note = D_4, .timeMs = 23},
-        {.note = C_4, .timeMs = 23},
-        {.note = A_3, .timeMs = 23},
-        {.note = F_3, .timeMs = 23},
-        {.note = C_SHARP_3, .timeMs = 23},
-        {.note = B_2, .timeMs = 23},
-        {.note = A_2, .timeMs = 46},
-        {.note = A_2, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 46},
-        {.note = A_3, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 234},
-        {.note = A_3, .timeMs = 187},
-        {.note = G_SHARP_3, .timeMs = 187},
-        {.note = G_3, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 46},
-        {.note = G_2, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 46},
-        {.note = G_3, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 234},
-        {.note = G_3, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 46},
-        {.note = G_3, .timeMs = 187},
-        {.note = D_SHARP_3, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 46},
-        {.note = F_SHARP_2, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 46},
-        {.note = F_SHARP_3, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 234},
-        {.note = F_SHARP_3, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 46},
-        {.note = F_SHARP_3, .timeMs = 187},
-        {.note = D_3, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 46},
-        {.note = F_2, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 46},
-        {.note = F_3, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 234},
-        {.note = F_3, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 46},
-        {.note = F_3, .timeMs = 187},
-        {.note = E_3, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 46},
-        {.note = A_2, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 46},
-        {.note = A_3, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 234},
-        {.note = A_3, .timeMs = 187},
-        {.note = G_SHARP_3, .timeMs = 187},
-        {.note = G_3, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 46},
-        {.note = G_2, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 46},
-        {.note = G_3, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 234},
-        {.note = G_3, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 46},
-        {.note = G_3, .timeMs = 187},
-        {.note = D_SHARP_3, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 46},
-        {.note = F_SHARP_2, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 46},
-        {.note = F_SHARP_3, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 234},
-        {.note = F_SHARP_3, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 46},
-        {.note = F_SHARP_3, .timeMs = 187},
-        {.note = D_3, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 46},
-        {.note = F_2, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 46},
-        {.note = F_3, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 234},
-        {.note = F_3, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 46},
-        {.note = F_3, .timeMs = 187},
-        {.note = E_3, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 46},
-        {.note = A_3, .timeMs = 187},
-        {.note = C_4, .timeMs = 187},
-        {.note = SILENCE, .timeMs = 187},
-        {.note = A_3, .timeMs = 187},
-        {.note = D_4, .timeMs = 187},
-        {.note = E_4, .timeMs = 187},
-        {.note = G_3, .timeMs = 187},
-        {.note = C_4, .timeMs = 187},
-        {.note = SILENCE, .timeMs = 187},
-        {.note = G_3, .timeMs = 187},
-        {.note = D_SHARP_4, .timeMs = 187},
-        {.note = D_4, .timeMs = 187},
-        {.note = F_SHARP_3, .timeMs = 187},
-        {.note = C_4, .timeMs = 187},
-        {.note = SILENCE, .timeMs = 187},
-        {.note = F_SHARP_3, .timeMs = 187},
-        {.note = D_4, .timeMs = 187},
-        {.note = B_3, .timeMs = 187},
-        {.note = F_3, .timeMs = 187},
-        {.note = C_4, .timeMs = 187},
-        {.note = SILENCE, .timeMs = 187},
-        {.note = F_3, .timeMs = 187},
-        {.note = F_4, .timeMs = 187},
-        {.note = E_4, .timeMs = 187},
-        {.note = A_3, .timeMs = 187},
-        {.note = C_4, .timeMs = 187},
-        {.note = SILENCE, .timeMs = 187},
-        {.note = A_3, .timeMs = 187},
-        {.note = D_4, .timeMs = 187},
-        {.note = E_4, .timeMs = 187},
-        {.note = G_3, .timeMs = 187},
-        {.note = C_4, .timeMs = 187},
-        {.note = SILENCE, .timeMs = 187},
-        {.note = G_3, .timeMs = 187},
-        {.note = D_SHARP_4, .timeMs = 187},
-        {.note = D_4, .timeMs = 187},
-        {.note = F_SHARP_3, .timeMs = 187},
-        {.note = C_4, .timeMs = 187},
-        {.note = SILENCE, .timeMs = 187},
-        {.note = F_SHARP_3, .timeMs = 187},
-        {.note = D_4, .timeMs = 187},
-        {.note = B_3, .timeMs = 187},
-        {.note = F_3, .timeMs = 187},
-        {.note = C_4, .timeMs = 187},
-        {.note = SILENCE, .timeMs = 187},
-        {.note = F_3, .timeMs = 187},
-        {.note = F_4, .timeMs = 187},
-        {.note = E_4, .timeMs = 187},
-        {.note = A_4, .timeMs = 187},
-        {.note = A_3, .timeMs = 187},
-        {.note = SILENCE, .timeMs = 187},
-        {.note = A_2, .timeMs = 187},
-        {.note = SILENCE, .timeMs = 187},
-        {.note = A_2, .timeMs = 187},
-        {.note = G_4, .timeMs = 187},
-        {.note = G_3, .timeMs = 187},
-        {.note = SILENCE, .timeMs = 187},
-        {.note = G_2, .timeMs = 187},
-        {.note = SILENCE, .timeMs = 187},
-        {.note = G_2, .timeMs = 187},
-        {.note = F_SHARP_4, .timeMs = 187},
-        {.note = F_SHARP_3, .timeMs = 187},
-        {.note = SILENCE, .timeMs = 187},
-        {.note = F_SHARP_2, .timeMs = 187},
-        {.note = SILENCE, .timeMs = 187},
-        {.note = F_SHARP_2, .timeMs = 187},
-        {.note = F_4, .timeMs = 187},
-        {.note = F_3, .timeMs = 187},
-        {.note = SILENCE, .timeMs = 187},
-        {.note = F_2, .timeMs = 187},
-        {.note = F_3, .timeMs = 187},
-        {.note = E_3, .timeMs = 187},
-        {.note = A_4, .timeMs = 187},
-        {.note = A_3, .timeMs = 187},
-        {.note = SILENCE, .timeMs = 187},
-        {.note = A_2, .timeMs = 187},
-        {.note = SILENCE, .timeMs = 187},
-        {.note = A_2, .timeMs = 187},
-        {.note = G_4, .timeMs = 187},
-        {.note = G_3, .timeMs = 187},
-        {.note = SILENCE, .timeMs = 187},
-        {.note = G_2, .timeMs = 187},
-        {.note = SILENCE, .timeMs = 187},
-        {.note = G_2, .timeMs = 187},
-        {.note = F_SHARP_4, .timeMs = 187},
-        {.note = F_SHARP_3, .timeMs = 187},
-        {.note = SILENCE, .timeMs = 187},
-        {.note = F_SHARP_2, .timeMs = 187},
-        {.note = SILENCE, .timeMs = 187},
-        {.note = F_SHARP_2, .timeMs = 187},
-        {.note = F_4, .timeMs = 187},
-        {.note = F_3, .timeMs = 187},
-        {.note = SILENCE, .timeMs = 187},
-        {.note = F_2, .timeMs = 187},
-        {.note = F_3, .timeMs = 187},
-        {.note = E_3, .timeMs = 187},
-        {.note = A_2, .timeMs = 187},
-        {.note = A_3, .timeMs = 187},
-        {.note = SILENCE, .timeMs = 187},
-        {.note = A_2, .timeMs = 218},
-        {.note = SILENCE, .timeMs = 156},
-        {.note = A_2, .timeMs = 187},
-        {.note = B_2, .timeMs = 187},
-        {.note = B_3, .timeMs = 187},
-        {.note = SILENCE, .timeMs = 187},
-        {.note = B_2, .timeMs = 218},
-        {.note = SILENCE, .timeMs = 156},
-        {.note = B_2, .timeMs = 187},
-        {.note = G_2, .timeMs = 187},
-        {.note = G_3, .timeMs = 187},
-        {.note = SILENCE, .timeMs = 187},
-        {.note = G_2, .timeMs = 218},
-        {.note = SILENCE, .timeMs = 156},
-        {.note = G_2, .timeMs = 187},
-        {.note = F_2, .timeMs = 187},
-        {.note = F_3, .timeMs = 187},
-        {.note = SILENCE, .timeMs = 187},
-        {.note = F_2, .timeMs = 187},
-        {.note = F_3, .timeMs = 187},
-        {.note = E_3, .timeMs = 187},
-        {.note = A_2, .timeMs = 187},
-        {.note = A_3, .timeMs = 187},
-        {.note = SILENCE, .timeMs = 187},
-        {.note = A_2, .timeMs = 218},
-        {.note = SILENCE, .timeMs = 156},
-        {.note = A_2, .timeMs = 187},
-        {.note = B_2, .timeMs = 187},
-        {.note = B_3, .timeMs = 187},
-        {.note = SILENCE, .timeMs = 187},
-        {.note = B_2, .timeMs = 218},
-        {.note = SILENCE, .timeMs = 156},
-        {.note = B_2, .timeMs = 187},
-        {.note = G_2, .timeMs = 187},
-        {.note = G_3, .timeMs = 187},
-        {.note = SILENCE, .timeMs = 187},
-        {.note = G_2, .timeMs = 218},
-        {.note = SILENCE, .timeMs = 156},
-        {.note = G_2, .timeMs = 187},
-        {.note = F_2, .timeMs = 187},
-        {.note = F_3, .timeMs = 187},
-        {.note = SILENCE, .timeMs = 187},
-        {.note = F_2, .timeMs = 187},
-        {.note = F_3, .timeMs = 187},
-        {.note = E_3, .timeMs = 187},
-        {.note = A_3, .timeMs = 187},
-        {.note = SILENCE, .timeMs = 187},
-        {.note = D_SHARP_4, .timeMs = 187},
-        {.note = D_4, .timeMs = 187},
-        {.note = SILENCE, .timeMs = 187},
-        {.note = C_4, .timeMs = 187},
-        {.note = SILENCE, .timeMs = 187},
-        {.note = A_3, .timeMs = 281},
-        {.note = SILENCE, .timeMs = 93},
-        {.note = E_3, .timeMs = 187},
-        {.note = G_3, .timeMs = 187},
-        {.note = A_3, .timeMs = 281},
-        {.note = SILENCE, .timeMs = 93},
-        {.note = A_3, .timeMs = 187},
-        {.note = B_3, .timeMs = 187},
-        {.note = C_4, .timeMs = 187},
-        {.note = D_4, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 46},
-        {.note = D_4, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 46},
-        {.note = D_4, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 46},
-        {.note = D_4, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 46},
-        {.note = D_4, .timeMs = 187},
-        {.note = C_4, .timeMs = 187},
-        {.note = A_3, .timeMs = 187},
-        {.note = B_3, .timeMs = 890},
-        {.note = SILENCE, .timeMs = 234},
-        {.note = B_3, .timeMs = 187},
-        {.note = C_4, .timeMs = 187},
-        {.note = D_4, .timeMs = 187},
-        {.note = E_4, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 46},
-        {.note = E_4, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 46},
-        {.note = E_4, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 46},
-        {.note = E_4, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 46},
-        {.note = D_SHARP_4, .timeMs = 187},
-        {.note = D_4, .timeMs = 187},
-        {.note = C_4, .timeMs = 187},
-        {.note = D_4, .timeMs = 187},
-        {.note = SILENCE, .timeMs = 187},
-        {.note = C_4, .timeMs = 234},
-        {.note = SILENCE, .timeMs = 140},
-        {.note = A_3, .timeMs = 234},
-        {.note = SILENCE, .timeMs = 140},
-        {.note = E_3, .timeMs = 187},
-        {.note = G_3, .timeMs = 187},
-        {.note = A_3, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 46},
-        {.note = C_4, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 46},
-        {.note = C_4, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 46},
-        {.note = C_4, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 46},
-        {.note = C_4, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 46},
-        {.note = B_3, .timeMs = 187},
-        {.note = A_3, .timeMs = 187},
-        {.note = G_3, .timeMs = 187},
-        {.note = A_3, .timeMs = 890},
-        {.note = SILENCE, .timeMs = 234},
-        {.note = A_3, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 46},
-        {.note = C_4, .timeMs = 187},
-        {.note = D_4, .timeMs = 187},
-        {.note = D_SHARP_4, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 46},
-        {.note = D_SHARP_4, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 46},
-        {.note = D_SHARP_4, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 46},
-        {.note = D_SHARP_4, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 46},
-        {.note = D_4, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 46},
-        {.note = C_4, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 46},
-        {.note = D_4, .timeMs = 140},
-        {.note = SILENCE, .timeMs = 46},
-        {.note = D_SHARP_4, .timeMs = 187},
-        {.note = A_2, .timeMs = 187},
-        {.note = D_4, .timeMs = 23},
-        {.note = D_SHARP_4, .timeMs = 164},
-        {.note = D_4, .timeMs = 23},
-        {.note = D_SHARP_4, .timeMs = 164},
-        {.note = A_2, .timeMs = 187},
-        {.note = D_3, .timeMs = 187},
-        {.note = E_3, .timeMs = 187},
-        {.note = G_2, .timeMs = 187},
-        {.note = F_SHARP_3, .timeMs = 23},
-        {.note = G_3, .timeMs = 164},
-        {.note = F_SHARP_3, .timeMs = 23},
-        {.note = G_3, .timeMs = 164},
-        {.note = G_2, .timeMs = 187},
-        {.note = D_SHARP_3, .timeMs = 187},
-        {.note = D_3, .timeMs = 187},
-        {.note = F_SHARP_2, .timeMs = 187},
-        {.note = F_3, .timeMs = 23},
-        {.note = F_SHARP_3, .timeMs = 164},
-        {.note = F_3, .timeMs = 23},
-        {.note = F_SHARP_3, .timeMs = 164},
-        {.note = F_SHARP_2, .timeMs = 187},
-        {.note = D_3, .timeMs = 187},
-        {.note = B_2, .timeMs = 187},
-        {.note = F_2, .timeMs = 187},
-        {.note = E_3, .timeMs = 23},
-        {.note = F_3, .timeMs = 164},
-        {.note = E_3, .timeMs = 23},
-        {.note = F_3, .timeMs = 164},
-        {.note = F_2, .timeMs = 187},
-        {.note = F_3, .timeMs = 187},
-        {.note = E_3, .timeMs = 187},
-        {.note = A_2, .timeMs = 187},
-        {.note = D_4, .timeMs = 23},
-        {.note = D_SHARP_4, .timeMs = 164},
-        {.note = D_4, .timeMs = 23},
-        {.note = D_SHARP_4, .timeMs = 164},
-        {.note = A_2, .timeMs = 187},
-        {.note = D_3, .timeMs = 187},
-        {.note = E_3, .timeMs = 187},
-        {.note = G_2, .timeMs = 187},
-        {.note = F_SHARP_3, .timeMs = 23},
-        {.note = G_3, .timeMs = 164},
-        {.note = F_SHARP_3, .timeMs = 23},
-        {.note = G_3, .timeMs = 164},
-        {.note = G_2, .timeMs = 187},
-        {.note = D_SHARP_3, .timeMs = 187},
-        {.note = D_3, .timeMs = 187},
-        {.note = F_SHARP_2, .timeMs = 187},
-        {.note = F_3, .timeMs = 23},
-        {.note = F_SHARP_3, .timeMs = 164},
-        {.note = F_3, .timeMs = 23},
-        {.note = F_SHARP_3, .timeMs = 164},
-        {.note = F_SHARP_2, .timeMs = 187},
-        {.note = D_3, .timeMs = 187},
-        {.note = B_2, .timeMs = 187},
-        {.note = F_2, .timeMs = 187},
-        {.note = E_3, .timeMs = 23},
-        {.note = F_3, .timeMs = 164},
-        {.note = E_3, .timeMs = 23},
-        {.note = F_3, .timeMs = 164},
-        {.note = F_2, .timeMs = 187},
-        {.note = F_3, .timeMs = 187},
-        {.note = E_3, .timeMs = 183},
-        {.note = SILENCE, .timeMs = 187},
-
-    },
-    .numNotes = 489,
-    .shouldLoop = true
-};
-
-static const song_t fauxrio_kart =
-{
-    .notes =
-    {
-        {.note = F_4, .timeMs = 111},
-        {.note = SILENCE, .timeMs = 111},
-        {.note = C_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 167},
-        {.note = E_4, .timeMs = 111},
-        {.note = SILENCE, .timeMs = 111},
-        {.note = C_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 167},
-        {.note = A_SHARP_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 167},
-        {.note = C_4, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = G_3, .timeMs = 111},
-        {.note = A_SHARP_2, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = C_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = F_4, .timeMs = 223},
-        {.note = C_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 167},
-        {.note = E_4, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = C_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = A_SHARP_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 167},
-        {.note = C_4, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = G_3, .timeMs = 223},
-        {.note = G_2, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = F_2, .timeMs = 111},
-        {.note = SILENCE, .timeMs = 111},
-        {.note = G_2, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 167},
-        {.note = A_SHARP_2, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 167},
-        {.note = F_4, .timeMs = 111},
-        {.note = SILENCE, .timeMs = 111},
-        {.note = D_SHARP_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 167},
-        {.note = D_SHARP_4, .timeMs = 111},
-        {.note = SILENCE, .timeMs = 111},
-        {.note = D_SHARP_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 167},
-        {.note = A_SHARP_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 167},
-        {.note = C_4, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = G_3, .timeMs = 111},
-        {.note = C_SHARP_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = D_SHARP_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = F_4, .timeMs = 223},
-        {.note = D_SHARP_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 167},
-        {.note = C_4, .timeMs = 111},
-        {.note = D_SHARP_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = G_4, .timeMs = 446},
-        {.note = G_1, .timeMs = 55},
-        {.note = B_1, .timeMs = 55},
-        {.note = D_2, .timeMs = 55},
-        {.note = F_2, .timeMs = 55},
-        {.note = G_2, .timeMs = 55},
-        {.note = B_2, .timeMs = 55},
-        {.note = D_3, .timeMs = 55},
-        {.note = G_3, .timeMs = 55},
-        {.note = D_3, .timeMs = 55},
-        {.note = B_2, .timeMs = 55},
-        {.note = G_2, .timeMs = 55},
-        {.note = F_2, .timeMs = 55},
-        {.note = D_2, .timeMs = 55},
-        {.note = B_1, .timeMs = 55},
-        {.note = G_1, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = F_4, .timeMs = 111},
-        {.note = SILENCE, .timeMs = 111},
-        {.note = C_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 167},
-        {.note = E_4, .timeMs = 111},
-        {.note = SILENCE, .timeMs = 111},
-        {.note = C_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 167},
-        {.note = A_SHARP_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 167},
-        {.note = C_4, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = G_3, .timeMs = 111},
-        {.note = A_SHARP_2, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = C_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = F_4, .timeMs = 223},
-        {.note = C_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 167},
-        {.note = E_4, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = C_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = A_SHARP_3, .timeMs = 111},
-        {.note = SILENCE, .timeMs = 111},
-        {.note = C_4, .timeMs = 60},
-        {.note = SILENCE, .timeMs = 51},
-        {.note = G_3, .timeMs = 223},
-        {.note = C_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = A_SHARP_2, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 167},
-        {.note = C_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 167},
-        {.note = G_3, .timeMs = 111},
-        {.note = SILENCE, .timeMs = 111},
-        {.note = G_SHARP_3, .timeMs = 111},
-        {.note = C_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 167},
-        {.note = G_SHARP_2, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 167},
-        {.note = C_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = G_SHARP_3, .timeMs = 111},
-        {.note = SILENCE, .timeMs = 111},
-        {.note = A_SHARP_3, .timeMs = 111},
-        {.note = D_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 167},
-        {.note = A_SHARP_2, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 167},
-        {.note = D_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = A_SHARP_3, .timeMs = 111},
-        {.note = SILENCE, .timeMs = 111},
-        {.note = G_SHARP_3, .timeMs = 111},
-        {.note = G_SHARP_2, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = F_2, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = G_SHARP_2, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = C_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = D_SHARP_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = G_SHARP_3, .timeMs = 167},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = A_SHARP_3, .timeMs = 111},
-        {.note = B_2, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = D_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = F_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = B_3, .timeMs = 111},
-        {.note = SILENCE, .timeMs = 334},
-        {.note = F_5, .timeMs = 111},
-        {.note = SILENCE, .timeMs = 111},
-        {.note = C_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = C_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = E_5, .timeMs = 111},
-        {.note = SILENCE, .timeMs = 111},
-        {.note = C_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = C_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = A_SHARP_4, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 167},
-        {.note = C_5, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = G_4, .timeMs = 111},
-        {.note = A_SHARP_2, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = C_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = E_5, .timeMs = 55},
-        {.note = F_5, .timeMs = 167},
-        {.note = C_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = C_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = E_5, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = C_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = A_SHARP_4, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = C_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = C_5, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = G_4, .timeMs = 223},
-        {.note = C_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = A_SHARP_2, .timeMs = 111},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = B_2, .timeMs = 55},
-        {.note = C_3, .timeMs = 111},
-        {.note = SILENCE, .timeMs = 111},
-        {.note = D_SHARP_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = E_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = F_5, .timeMs = 111},
-        {.note = SILENCE, .timeMs = 111},
-        {.note = C_SHARP_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = D_SHARP_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = D_SHARP_5, .timeMs = 111},
-        {.note = D_SHARP_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = D_SHARP_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 167},
-        {.note = A_SHARP_4, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = D_SHARP_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = C_5, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = G_4, .timeMs = 111},
-        {.note = C_SHARP_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = D_SHARP_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = F_5, .timeMs = 223},
-        {.note = D_SHARP_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = F_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = C_5, .timeMs = 111},
-        {.note = G_3, .timeMs = 55},
-        {.note = F_SHARP_5, .timeMs = 55},
-        {.note = G_5, .timeMs = 446},
-        {.note = G_3, .timeMs = 55},
-        {.note = D_3, .timeMs = 55},
-        {.note = G_2, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = B_2, .timeMs = 55},
-        {.note = D_3, .timeMs = 55},
-        {.note = G_2, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = D_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = G_2, .timeMs = 55},
-        {.note = D_3, .timeMs = 55},
-        {.note = B_2, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = G_2, .timeMs = 55},
-        {.note = D_3, .timeMs = 55},
-        {.note = C_3, .timeMs = 111},
-        {.note = SILENCE, .timeMs = 111},
-        {.note = A_5, .timeMs = 111},
-        {.note = C_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = G_5, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 167},
-        {.note = A_SHARP_2, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = C_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = E_5, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 167},
-        {.note = F_5, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = C_5, .timeMs = 111},
-        {.note = A_SHARP_2, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = C_3, .timeMs = 55},
-        {.note = G_5, .timeMs = 55},
-        {.note = G_SHARP_5, .timeMs = 223},
-        {.note = F_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = F_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = G_5, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = F_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = D_SHARP_5, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = G_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = F_5, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = A_SHARP_4, .timeMs = 223},
-        {.note = G_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 167},
-        {.note = F_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = C_5, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = G_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = D_SHARP_5, .timeMs = 446},
-        {.note = G_SHARP_2, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = G_SHARP_2, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 167},
-        {.note = G_SHARP_2, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 167},
-        {.note = G_SHARP_2, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = A_SHARP_2, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = A_SHARP_2, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 167},
-        {.note = A_SHARP_2, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 167},
-        {.note = A_SHARP_2, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = G_5, .timeMs = 111},
-        {.note = F_5, .timeMs = 111},
-        {.note = E_5, .timeMs = 111},
-        {.note = F_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = F_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = G_5, .timeMs = 111},
-        {.note = F_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = F_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = F_5, .timeMs = 111},
-        {.note = G_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = E_5, .timeMs = 111},
-        {.note = G_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 167},
-        {.note = G_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = C_5, .timeMs = 111},
-        {.note = G_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 167},
-        {.note = F_SHARP_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = F_3, .timeMs = 111},
-        {.note = SILENCE, .timeMs = 111},
-        {.note = F_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = C_4, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = D_SHARP_5, .timeMs = 111},
-        {.note = F_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 167},
-        {.note = F_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = D_5, .timeMs = 111},
-        {.note = F_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 167},
-        {.note = F_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = C_5, .timeMs = 111},
-        {.note = F_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 167},
-        {.note = A_SHARP_4, .timeMs = 111},
-        {.note = F_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = F_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = C_5, .timeMs = 111},
-        {.note = F_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = A_SHARP_4, .timeMs = 111},
-        {.note = F_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = C_5, .timeMs = 111},
-        {.note = A_4, .timeMs = 334},
-        {.note = F_3, .timeMs = 111},
-        {.note = G_SHARP_3, .timeMs = 111},
-        {.note = A_SHARP_3, .timeMs = 111},
-        {.note = C_4, .timeMs = 111},
-        {.note = A_4, .timeMs = 111},
-        {.note = A_SHARP_4, .timeMs = 111},
-        {.note = C_5, .timeMs = 111},
-        {.note = A_4, .timeMs = 111},
-        {.note = F_4, .timeMs = 111},
-        {.note = D_SHARP_5, .timeMs = 111},
-        {.note = C_5, .timeMs = 111},
-        {.note = A_4, .timeMs = 111},
-        {.note = G_5, .timeMs = 223},
-        {.note = F_3, .timeMs = 111},
-        {.note = F_5, .timeMs = 111},
-        {.note = D_SHARP_5, .timeMs = 111},
-        {.note = D_5, .timeMs = 111},
-        {.note = D_SHARP_5, .timeMs = 111},
-        {.note = D_5, .timeMs = 111},
-        {.note = C_5, .timeMs = 111},
-        {.note = A_SHARP_4, .timeMs = 111},
-        {.note = C_5, .timeMs = 111},
-        {.note = F_3, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = C_5, .timeMs = 111},
-        {.note = A_SHARP_4, .timeMs = 111},
-        {.note = SILENCE, .timeMs = 111},
-        {.note = C_5, .timeMs = 111},
-        {.note = F_3, .timeMs = 111},
-        {.note = A_4, .timeMs = 55},
-        {.note = A_SHARP_3, .timeMs = 55},
-        {.note = C_4, .timeMs = 111},
-        {.note = A_SHARP_3, .timeMs = 111},
-        {.note = G_SHARP_3, .timeMs = 111},
-        {.note = A_SHARP_3, .timeMs = 223},
-        {.note = G_SHARP_3, .timeMs = 111},
-        {.note = G_SHARP_4, .timeMs = 111},
-        {.note = A_4, .timeMs = 111},
-        {.note = A_SHARP_4, .timeMs = 223},
-        {.note = A_SHARP_2, .timeMs = 223},
-        {.note = G_SHARP_5, .timeMs = 111},
-        {.note = SILENCE, .timeMs = 111},
-        {.note = A_SHARP_2, .timeMs = 223},
-        {.note = G_5, .timeMs = 111},
-        {.note = SILENCE, .timeMs = 111},
-        {.note = G_SHARP_2, .timeMs = 111},
-        {.note = A_SHARP_2, .timeMs = 111},
-        {.note = F_5, .timeMs = 111},
-        {.note = A_SHARP_2, .timeMs = 111},
-        {.note = SILENCE, .timeMs = 111},
-        {.note = D_SHARP_5, .timeMs = 223},
-        {.note = A_SHARP_2, .timeMs = 111},
-        {.note = F_5, .timeMs = 111},
-        {.note = A_SHARP_2, .timeMs = 111},
-        {.note = D_SHARP_5, .timeMs = 111},
-        {.note = A_SHARP_2, .timeMs = 111},
-        {.note = F_5, .timeMs = 55},
-        {.note = SILENCE, .timeMs = 55},
-        {.note = D_5, .timeMs = 223},
-        {.note = A_SHARP_2, .timeMs = 111},
-        {.note = C_SHARP_3, .timeMs = 111},
-        {.note = D_SHARP_3, .timeMs = 111},
-        {.note = C_SHARP_3, .timeMs = 111},
-        {.note = A_SHARP_2, .timeMs = 111},
-        {.note = D_5, .timeMs = 111},
-        {.note = C_SHARP_5, .timeMs = 111},
-        {.note = C_5, .timeMs = 111},
-        {.note = G_SHARP_2, .timeMs = 111},
-        {.note = G_SHARP_4, .timeMs = 111},
-        {.note = D_SHARP_5, .timeMs = 111},
-        {.note = G_SHARP_2, .timeMs = 111},
-        {.note = C_5, .timeMs = 111},
-        {.note = G_SHARP_5, .timeMs = 334},
-        {.note = C_3, .timeMs = 111},
-        {.note = D_SHARP_3, .timeMs = 111},
-        {.note = G_SHARP_3, .timeMs = 111},
-        {.note = D_SHARP_3, .timeMs = 111},
-        {.note = C_3, .timeMs = 111},
-        {.note = A_4, .timeMs = 111},
-        {.note = A_SHARP_4, .timeMs = 111},
-        {.note = B_4, .timeMs = 92},
-        {.note = G_2, .timeMs = 111},
-        {.note = SILENCE, .timeMs = 18},
-        {.note = G_4, .timeMs = 111},
-        {.note = D_5, .timeMs = 111},
-        {.note = SILENCE, .timeMs = 111},
-        {.note = G_4, .timeMs = 111},
-        {.note = G_5, .timeMs = 334},
-        {.note = G_2, .timeMs = 111},
-        {.note = B_2, .timeMs = 111},
-        {.note = D_3, .timeMs = 111},
-        {.note = B_2, .timeMs = 111},
-        {.note = G_2, .timeMs = 111},
-        {.note = F_2, .timeMs = 111},
-        {.note = D_2, .timeMs = 111},
-        {.note = SILENCE, .timeMs = 111},
-
-    },
-    .numNotes = 464,
-    .shouldLoop = true
-};
-
-static const song_t the_lake =
+// A short flash added over the dance when a song starts playing
+static const led_t playFlashColor = {.r = 0xFF, .g = 0xFF, .b = 0xFF};
+static const ledKeyframe_t playFlashKeys[] =
 {
-    .notes =
-    {
-        {.note = A_6, .timeMs = 193},
-        {.note = D_6, .timeMs = 193},
-        {.note = A_SHARP_5, .timeMs = 193},
-        {.note = G_5, .timeMs = 193},
-        {.note = G_6, .timeMs = 193},
-        {.note = D_6, .timeMs = 193},
-        {.note = A_SHARP_5, .timeMs = 193},
-        {.note = G_5, .timeMs = 193},
-        {.note = F_SHARP_6, .timeMs = 193},
-        {.note = D_6, .timeMs = 193},
-        {.note = A_SHARP_5, .timeMs = 193},
-        {.note = G_5, .timeMs = 193},
-        {.note = G_6, .timeMs = 193},
-        {.note = D_6, .timeMs = 193},
-        {.note = A_SHARP_5, .timeMs = 193},
-        {.note = G_5, .timeMs = 193},
-        {.note = G_6, .timeMs = 193},
-        {.note = C_6, .timeMs = 193},
-        {.note = A_5, .timeMs = 193},
-        {.note = F_5, .timeMs = 193},
-        {.note = F_6, .timeMs = 193},
-        {.note = C_6, .timeMs = 193},
-        {.note = A_5, .timeMs = 193},
-        {.note = F_5, .timeMs = 193},
-        {.note = E_6, .timeMs = 193},
-        {.note = C_6, .timeMs = 193},
-        {.note = A_5, .timeMs = 193},
-        {.note = F_5, .timeMs = 193},
-        {.note = F_6, .timeMs = 193},
-        {.note = C_6, .timeMs = 193},
-        {.note = A_5, .timeMs = 193},
-        {.note = F_5, .timeMs = 193},
-        {.note = F_6, .timeMs = 193},
-        {.note = A_SHARP_5, .timeMs = 193},
-        {.note = G_5, .timeMs = 193},
-        {.note = E_5, .timeMs = 193},
-        {.note = E_6, .timeMs = 193},
-        {.note = A_SHARP_5, .timeMs = 193},
-        {.note = G_5, .timeMs = 193},
-        {.note = E_5, .timeMs = 193},
-        {.note = D_SHARP_6, .timeMs = 193},
-        {.note = A_SHARP_5, .timeMs = 193},
-        {.note = G_5, .timeMs = 193},
-        {.note = E_5, .timeMs = 193},
-        {.note = E_6, .timeMs = 193},
-        {.note = A_SHARP_5, .timeMs = 193},
-        {.note = G_5, .timeMs = 193},
-        {.note = E_5, .timeMs = 193},
-        {.note = E_6, .timeMs = 193},
-        {.note = A_5, .timeMs = 193},
-        {.note = F_5, .timeMs = 193},
-        {.note = D_5, .timeMs = 193},
-        {.note = D_6, .timeMs = 193},
-        {.note = A_5, .timeMs = 193},
-        {.note = F_5, .timeMs = 193},
-        {.note = D_5, .timeMs = 193},
-        {.note = C_SHARP_6, .timeMs = 193},
-        {.note = A_5, .timeMs = 193},
-        {.note = F_5, .timeMs = 193},
-        {.note = D_5, .timeMs = 193},
-        {.note = D_6, .timeMs = 193},
-        {.note = A_5, .timeMs = 193},
-        {.note = F_5, .timeMs = 193},
-        {.note = D_5, .timeMs = 193},
-        {.note = A_6, .timeMs = 193},
-        {.note = D_6, .timeMs = 193},
-        {.note = A_SHARP_5, .timeMs = 193},
-        {.note = G_5, .timeMs = 193},
-        {.note = G_6, .timeMs = 193},
-        {.note = D_6, .timeMs = 193},
-        {.note = A_SHARP_5, .timeMs = 193},
-        {.note = G_5, .timeMs = 193},
-        {.note = F_SHARP_6, .timeMs = 193},
-        {.note = D_6, .timeMs = 193},
-        {.note = A_SHARP_5, .timeMs = 193},
-        {.note = G_5, .timeMs = 193},
-        {.note = G_6, .timeMs = 193},
-        {.note = D_6, .timeMs = 193},
-        {.note = A_SHARP_5, .timeMs = 193},
-        {.note = G_5, .timeMs = 193},
-        {.note = A_SHARP_6, .timeMs = 193},
-        {.note = D_SHARP_6, .timeMs = 193},
-        {.note = C_6, .timeMs = 193},
-        {.note = A_5, .timeMs = 193},
-        {.note = A_6, .timeMs = 193},
-        {.note = D_SHARP_6, .timeMs = 193},
-        {.note = C_6, .timeMs = 193},
-        {.note = A_5, .timeMs = 193},
-        {.note = G_SHARP_6, .timeMs = 193},
-        {.note = D_SHARP_6, .timeMs = 193},
-        {.note = C_6, .timeMs = 193},
-        {.note = A_5, .timeMs = 193},
-        {.note = A_6, .timeMs = 193},
-        {.note = D_SHARP_6, .timeMs = 193},
-        {.note = C_6, .timeMs = 193},
-        {.note = A_5, .timeMs = 193},
-        {.note = C_7, .timeMs = 193},
-        {.note = D_6, .timeMs = 193},
-        {.note = A_SHARP_5, .timeMs = 193},
-        {.note = G_5, .timeMs = 193},
-        {.note = A_SHARP_6, .timeMs = 193},
-        {.note = D_6, .timeMs = 193},
-        {.note = A_SHARP_5, .timeMs = 193},
-        {.note = G_5, .timeMs = 193},
-        {.note = A_6, .timeMs = 193},
-        {.note = D_6, .timeMs = 193},
-        {.note = A_SHARP_5, .timeMs = 193},
-        {.note = G_5, .timeMs = 193},
-        {.note = A_SHARP_6, .timeMs = 193},
-        {.note = D_6, .timeMs = 193},
-        {.note = A_SHARP_5, .timeMs = 193},
-        {.note = G_5, .timeMs = 193},
-        {.note = A_6, .timeMs = 193},
-        {.note = A_SHARP_5, .timeMs = 193},
-        {.note = G_5, .timeMs = 193},
-        {.note = E_5, .timeMs = 193},
-        {.note = G_6, .timeMs = 193},
-        {.note = A_SHARP_5, .timeMs = 193},
-        {.note = G_5, .timeMs = 193},
-        {.note = E_5, .timeMs = 193},
-        {.note = F_6, .timeMs = 193},
-        {.note = A_SHARP_5, .timeMs = 193},
-        {.note = G_5, .timeMs = 193},
-        {.note = E_5, .timeMs = 193},
-        {.note = E_6, .timeMs = 193},
-        {.note = A_SHARP_5, .timeMs = 193},
-        {.note = G_5, .timeMs = 193},
-        {.note = E_5, .timeMs = 193},
-		{.note = A_SHARP_2, .timeMs = 125},
-        {.note = A_6, .timeMs = 125},
-        {.note = A_SHARP_3, .timeMs = 125},
-        {.note = D_6, .timeMs = 125},
-        {.note = D_4, .timeMs = 125},
-        {.note = A_SHARP_5, .timeMs = 125},
-        {.note = A_4, .timeMs = 125},
-        {.note = G_5, .timeMs = 125},
-        {.note = SILENCE, .timeMs = 125},
-        {.note = G_6, .timeMs = 125},
-        {.note = SILENCE, .timeMs = 125},
-        {.note = D_6, .timeMs = 125},
-        {.note = SILENCE, .timeMs = 125},
-        {.note = A_SHARP_5, .timeMs = 125},
-        {.note = SILENCE, .timeMs = 125},
-        {.note = G_5, .timeMs = 125},
-        {.note = SILENCE, .timeMs = 125},
-        {.note = F_SHARP_6, .timeMs = 125},
-        {.note = D_4, .timeMs = 125},
-        {.note = D_6, .timeMs = 125},
-        {.note = A_4, .timeMs = 125},
-        {.note = A_SHARP_5, .timeMs = 125},
-        {.note = G_4, .timeMs = 125},
-        {.note = G_5, .timeMs = 125},
-        {.note = C_5, .timeMs = 125},
-        {.note = G_6, .timeMs = 125},
-        {.note = A_4, .timeMs = 125},
-        {.note = D_6, .timeMs = 125},
-        {.note = G_4, .timeMs = 125},
-        {.note = A_SHARP_5, .timeMs = 125},
-        {.note = D_4, .timeMs = 125},
-        {.note = G_5, .timeMs = 125},
-        {.note = A_2, .timeMs = 125},
-        {.note = G_6, .timeMs = 125},
-        {.note = A_3, .timeMs = 125},
-        {.note = C_6, .timeMs = 125},
-        {.note = C_4, .timeMs = 125},
-        {.note = A_5, .timeMs = 125},
-        {.note = G_4, .timeMs = 125},
-        {.note = F_5, .timeMs = 125},
-        {.note = SILENCE, .timeMs = 125},
-        {.note = F_6, .timeMs = 125},
-        {.note = SILENCE, .timeMs = 125},
-        {.note = C_6, .timeMs = 125},
-        {.note = SILENCE, .timeMs = 125},
-        {.note = A_5, .timeMs = 125},
-        {.note = SILENCE, .timeMs = 125},
-        {.note = F_5, .timeMs = 125},
-        {.note = A_2, .timeMs = 125},
-        {.note = E_6, .timeMs = 125},
-        {.note = A_3, .timeMs = 125},
-        {.note = C_6, .timeMs = 125},
-        {.note = G_4, .timeMs = 125},
-        {.note = A_5, .timeMs = 125},
-        {.note = F_4, .timeMs = 125},
-        {.note = F_5, .timeMs = 125},
-        {.note = C_5, .timeMs = 125},
-        {.note = F_6, .timeMs = 125},
-        {.note = G_4, .timeMs = 125},
-        {.note = C_6, .timeMs = 125},
-        {.note = F_4, .timeMs = 125},
-        {.note = A_5, .timeMs = 125},
-        {.note = C_4, .timeMs = 125},
-        {.note = F_5, .timeMs = 125},
-        {.note = G_2, .timeMs = 125},
-        {.note = F_6, .timeMs = 125},
-        {.note = G_3, .timeMs = 125},
-        {.note = A_SHARP_5, .timeMs = 125},
-        {.note = A_SHARP_3, .timeMs = 125},
-        {.note = G_5, .timeMs = 125},
-        {.note = F_4, .timeMs = 125},
-        {.note = E_5, .timeMs = 125},
-        {.note = SILENCE, .timeMs = 125},
-        {.note = E_6, .timeMs = 125},
-        {.note = SILENCE, .timeMs = 125},
-        {.note = A_SHARP_5, .timeMs = 125},
-        {.note = SILENCE, .timeMs = 125},
-        {.note = G_5, .timeMs = 125},
-        {.note = SILENCE, .timeMs = 125},
-        {.note = E_5, .timeMs = 125},
-        {.note = G_2, .timeMs = 125},
-        {.note = D_SHARP_6, .timeMs = 125},
-        {.note = G_3, .timeMs = 125},
-        {.note = A_SHARP_5, .timeMs = 125},
-        {.note = F_4, .timeMs = 125},
-        {.note = G_5, .timeMs = 125},
-        {.note = E_4, .timeMs = 125},
-        {.note = E_5, .timeMs = 125},
-        {.note = G_4, .timeMs = 125},
-        {.note = E_6, .timeMs = 125},
-        {.note = E_4, .timeMs = 125},
-        {.note = A_SHARP_5, .timeMs = 125},
-        {.note = C_4, .timeMs = 125},
-        {.note = G_5, .timeMs = 125},
-        {.note = A_SHARP_3, .timeMs = 125},
-        {.note = E_5, .timeMs = 125},
-        {.note = F_2, .timeMs = 125},
-        {.note = E_6, .timeMs = 125},
-        {.note = F_3, .timeMs = 125},
-        {.note = A_5, .timeMs = 125},
-        {.note = A_3, .timeMs = 125},
-        {.note = F_5, .timeMs = 125},
-        {.note = E_4, .timeMs = 125},
-        {.note = D_5, .timeMs = 125},
-        {.note = SILENCE, .timeMs = 125},
-        {.note = D_6, .timeMs = 125},
-        {.note = SILENCE, .timeMs = 125},
-        {.note = A_5, .timeMs = 125},
-        {.note = SILENCE, .timeMs = 125},
-        {.note = F_5, .timeMs = 125},
-        {.note = SILENCE, .timeMs = 125},
-        {.note = D_5, .timeMs = 125},
-        {.note = F_2, .timeMs = 125},
-        {.note = C_SHARP_6, .timeMs = 125},
-        {.note = A_3, .timeMs = 125},
-        {.note = A_5, .timeMs = 125},
-        {.note = E_4, .timeMs = 125},
-        {.note = F_5, .timeMs = 125},
-        {.note = D_4, .timeMs = 125},
-        {.note = D_5, .timeMs = 125},
-        {.note = G_4, .timeMs = 125},
-        {.note = D_6, .timeMs = 125},
-        {.note = F_4, .timeMs = 125},
-        {.note = A_5, .timeMs = 125},
-        {.note = C_5, .timeMs = 125},
-        {.note = F_5, .timeMs = 125},
-        {.note = A_SHARP_4, .timeMs = 125},
-        {.note = D_5, .timeMs = 125},
-        {.note = A_SHARP_2, .timeMs = 125},
-        {.note = A_6, .timeMs = 125},
-        {.note = A_SHARP_3, .timeMs = 125},
-        {.note = D_6, .timeMs = 125},
-        {.note = D_4, .timeMs = 125},
-        {.note = A_SHARP_5, .timeMs = 125},
-        {.note = A_4, .timeMs = 125},
-        {.note = G_5, .timeMs = 125},
-        {.note = SILENCE, .timeMs = 125},
-        {.note = G_6, .timeMs = 125},
-        {.note = SILENCE, .timeMs = 125},
-        {.note = D_6, .timeMs = 125},
-        {.note = SILENCE, .timeMs = 125},
-        {.note = A_SHARP_5, .timeMs = 125},
-        {.note = SILENCE, .timeMs = 125},
-        {.note = G_5, .timeMs = 125},
-        {.note = A_SHARP_2, .timeMs = 125},
-        {.note = F_SHARP_6, .timeMs = 125},
-        {.note = A_SHARP_3, .timeMs = 125},
-        {.note = D_6, .timeMs = 125},
-        {.note = A_4, .timeMs = 125},
-        {.note = A_SHARP_5, .timeMs = 125},
-        {.note = G_4, .timeMs = 125},
-        {.note = G_5, .timeMs = 125},
-        {.note = D_5, .timeMs = 125},
-        {.note = G_6, .timeMs = 125},
-        {.note = A_4, .timeMs = 125},
-        {.note = D_6, .timeMs = 125},
-        {.note = G_4, .timeMs = 125},
-        {.note = A_SHARP_5, .timeMs = 125},
-        {.note = D_4, .timeMs = 125},
-        {.note = G_5, .timeMs = 125},
-        {.note = A_2, .timeMs = 125},
-        {.note = A_SHARP_6, .timeMs = 125},
-        {.note = A_3, .timeMs = 125},
-        {.note = D_SHARP_6, .timeMs = 125},
-        {.note = C_4, .timeMs = 125},
-        {.note = C_6, .timeMs = 125},
-        {.note = C_5, .timeMs = 125},
-        {.note = A_5, .timeMs = 125},
-        {.note = SILENCE, .timeMs = 125},
-        {.note = A_6, .timeMs = 125},
-        {.note = SILENCE, .timeMs = 125},
-        {.note = D_SHARP_6, .timeMs = 125},
-        {.note = SILENCE, .timeMs = 125},
-        {.note = C_6, .timeMs = 125},
-        {.note = SILENCE, .timeMs = 125},
-        {.note = A_5, .timeMs = 125},
-        {.note = D_3, .timeMs = 125},
-        {.note = G_SHARP_6, .timeMs = 125},
-        {.note = D_4, .timeMs = 125},
-        {.note = D_SHARP_6, .timeMs = 125},
-        {.note = C_5, .timeMs = 125},
-        {.note = C_6, .timeMs = 125},
-        {.note = A_4, .timeMs = 125},
-        {.note = A_5, .timeMs = 125},
-        {.note = D_SHARP_5, .timeMs = 125},
-        {.note = A_6, .timeMs = 125},
-        {.note = D_5, .timeMs = 125},
-        {.note = D_SHARP_6, .timeMs = 125},
-        {.note = C_5, .timeMs = 125},
-        {.note = C_6, .timeMs = 125},
-        {.note = A_4, .timeMs = 125},
-        {.note = A_5, .timeMs = 125},
-        {.note = G_2, .timeMs = 125},
-        {.note = C_7, .timeMs = 125},
-        {.note = A_SHARP_3, .timeMs = 125},
-        {.note = D_6, .timeMs = 125},
-        {.note = D_4, .timeMs = 125},
-        {.note = A_SHARP_5, .timeMs = 125},
-        {.note = A_SHARP_4, .timeMs = 125},
-        {.note = G_5, .timeMs = 125},
-        {.note = SILENCE, .timeMs = 125},
-        {.note = A_SHARP_6, .timeMs = 125},
-        {.note = SILENCE, .timeMs = 125},
-        {.note = D_6, .timeMs = 125},
-        {.note = SILENCE, .timeMs = 125},
-        {.note = A_SHARP_5, .timeMs = 125},
-        {.note = SILENCE, .timeMs = 125},
-        {.note = G_5, .timeMs = 125},
-        {.note = G_2, .timeMs = 125},
-        {.note = A_6, .timeMs = 125},
-        {.note = A_SHARP_3, .timeMs = 125},
-        {.note = D_6, .timeMs = 125},
-        {.note = A_SHARP_4, .timeMs = 125},
-        {.note = A_SHARP_5, .timeMs = 125},
-        {.note = A_4, .timeMs = 125},
-        {.note = G_5, .timeMs = 125},
-        {.note = C_5, .timeMs = 125},
-        {.note = A_SHARP_6, .timeMs = 125},
-        {.note = A_SHARP_4, .timeMs = 125},
-        {.note = D_6, .timeMs = 125},
-        {.note = G_4, .timeMs = 125},
-        {.note = A_SHARP_5, .timeMs = 125},
-        {.note = D_4, .timeMs = 125},
-        {.note = G_5, .timeMs = 125},
-        {.note = C_3, .timeMs = 125},
-        {.note = A_6, .timeMs = 125},
-        {.note = C_4, .timeMs = 125},
-        {.note = A_SHARP_5, .timeMs = 125},
-        {.note = G_4, .timeMs = 125},
-        {.note = G_5, .timeMs = 125},
-        {.note = A_SHARP_4, .timeMs = 125},
-        {.note = E_5, .timeMs = 125},
-        {.note = SILENCE, .timeMs = 125},
-        {.note = G_6, .timeMs = 125},
-        {.note = SILENCE, .timeMs = 125},
-        {.note = A_SHARP_5, .timeMs = 125},
-        {.note = SILENCE, .timeMs = 125},
-        {.note = G_5, .timeMs = 125},
-        {.note = SILENCE, .timeMs = 125},
-        {.note = E_5, .timeMs = 125},
-        {.note = C_3, .timeMs = 125},
-        {.note = F_6, .timeMs = 125},
-        {.note = C_4, .timeMs = 125},
-        {.note = A_SHARP_5, .timeMs = 125},
-        {.note = A_SHARP_4, .timeMs = 125},
-        {.note = G_5, .timeMs = 125},
-        {.note = G_4, .timeMs = 125},
-        {.note = E_5, .timeMs = 62},
-        {.note = SILENCE, .timeMs = 62},
-        {.note = E_5, .timeMs = 125},
-        {.note = E_6, .timeMs = 125},
-        {.note = D_5, .timeMs = 125},
-        {.note = A_SHARP_5, .timeMs = 125},
-        {.note = G_5, .timeMs = 62},
-        {.note = SILENCE, .timeMs = 62},
-        {.note = G_5, .timeMs = 125},
-        {.note = E_5, .timeMs = 62},
-        {.note = SILENCE, .timeMs = 62},
-        {.note = E_5, .timeMs = 125},
-        {.note = SILENCE, .timeMs = 193},
-
-    },
-    .numNotes = 388,
-    .shouldLoop = true
+    {.tUs = 0,      .level = 160},
+    {.tUs = 250000, .level = 0},
 };
-
-static const song_t herecomesthesun =
+static const ledEnvelope_t playFlashEnv =
 {
-    .notes =
-    {
-        {.note = A_2, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = E_3, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = C_SHARP_5, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = A_4, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = B_4, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = C_SHARP_5, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = A_2, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = A_4, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = A_2, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = E_3, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = C_SHARP_5, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = B_4, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = B_2, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = A_4, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = C_SHARP_3, .timeMs = 116},
-        {.note = E_4, .timeMs = 116},
-        {.note = F_SHARP_4, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = D_3, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = A_4, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = A_3, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = B_4, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = G_SHARP_3, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = A_4, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = F_SHARP_3, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = F_SHARP_4, .timeMs = 116},
-        {.note = E_3, .timeMs = 116},
-        {.note = G_SHARP_4, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = F_SHARP_4, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = G_SHARP_4, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = A_4, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = E_3, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = B_4, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 348},
-        {.note = B_4, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = A_2, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = E_3, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = C_SHARP_5, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = A_4, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = B_4, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = C_SHARP_5, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = A_2, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = A_4, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = A_2, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = E_3, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = C_SHARP_5, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = B_4, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = B_2, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = A_4, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = C_SHARP_3, .timeMs = 116},
-        {.note = E_4, .timeMs = 116},
-        {.note = F_SHARP_4, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = D_3, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = C_SHARP_5, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = A_3, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = B_4, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = G_SHARP_3, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = A_4, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = F_SHARP_3, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = G_SHARP_4, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = E_2, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = B_2, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = E_3, .timeMs = 58},
-        {.note = F_SHARP_3, .timeMs = 58},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = E_3, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 348},
-        {.note = E_2, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = E_2, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = E_2, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = A_2, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = E_3, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = C_SHARP_5, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = B_4, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = A_2, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = C_SHARP_5, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = E_3, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = A_4, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = A_2, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = E_3, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = C_SHARP_5, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = A_4, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = B_4, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = C_SHARP_5, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = B_2, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = C_SHARP_3, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = D_3, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = A_3, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = C_SHARP_5, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = B_4, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = D_3, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = C_SHARP_5, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = F_SHARP_3, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = A_4, .timeMs = 116},
-        {.note = E_3, .timeMs = 116},
-        {.note = D_SHARP_3, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = B_3, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = F_SHARP_3, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = A_4, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = B_4, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = B_2, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = A_4, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = F_SHARP_3, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = E_3, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = C_SHARP_5, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = A_3, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = B_4, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = A_2, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = A_4, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = C_SHARP_3, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = E_4, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = D_3, .timeMs = 58},
-        {.note = F_SHARP_4, .timeMs = 58},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = A_4, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = B_4, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = C_SHARP_3, .timeMs = 58},
-        {.note = E_4, .timeMs = 58},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = A_4, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = B_4, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = A_2, .timeMs = 58},
-        {.note = D_4, .timeMs = 58},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = A_4, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 58},
-        {.note = D_3, .timeMs = 58},
-        {.note = B_4, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = E_3, .timeMs = 58},
-        {.note = E_4, .timeMs = 58},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = A_4, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = B_4, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = E_3, .timeMs = 58},
-        {.note = A_4, .timeMs = 58},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = G_SHARP_4, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = E_2, .timeMs = 58},
-        {.note = F_SHARP_4, .timeMs = 58},
-        {.note = SILENCE, .timeMs = 116},
-        {.note = E_4, .timeMs = 116},
-        {.note = SILENCE, .timeMs = 116},
-
-    },
-    .numNotes = 244,
-    .shouldLoop = true
-};
-
-static const song_t bananaphone =
-{
-    .notes =
-    {
-        {.note = A_4, .timeMs = 157},
-        {.note = SILENCE, .timeMs = 157},
-        {.note = A_4, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_4, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = SILENCE, .timeMs = 39},
-        {.note = B_4, .timeMs = 19},
-        {.note = D_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = B_4, .timeMs = 19},
-        {.note = D_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = SILENCE, .timeMs = 39},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = SILENCE, .timeMs = 39},
-        {.note = B_4, .timeMs = 19},
-        {.note = D_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = B_4, .timeMs = 19},
-        {.note = D_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = SILENCE, .timeMs = 39},
-        {.note = A_4, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_4, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = SILENCE, .timeMs = 197},
-        {.note = E_4, .timeMs = 19},
-        {.note = G_SHARP_4, .timeMs = 19},
-        {.note = B_4, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = E_4, .timeMs = 19},
-        {.note = G_SHARP_4, .timeMs = 19},
-        {.note = B_4, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = E_4, .timeMs = 19},
-        {.note = G_SHARP_4, .timeMs = 19},
-        {.note = B_4, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = E_4, .timeMs = 19},
-        {.note = G_SHARP_4, .timeMs = 19},
-        {.note = B_4, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = SILENCE, .timeMs = 157},
-        {.note = E_4, .timeMs = 19},
-        {.note = G_SHARP_4, .timeMs = 19},
-        {.note = B_4, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = E_4, .timeMs = 19},
-        {.note = G_SHARP_4, .timeMs = 19},
-        {.note = B_4, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = E_4, .timeMs = 19},
-        {.note = G_SHARP_4, .timeMs = 19},
-        {.note = B_4, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = E_4, .timeMs = 19},
-        {.note = G_SHARP_4, .timeMs = 19},
-        {.note = B_4, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = E_4, .timeMs = 19},
-        {.note = G_SHARP_4, .timeMs = 19},
-        {.note = B_4, .timeMs = 19},
-        {.note = D_5, .timeMs = 19},
-        {.note = E_4, .timeMs = 19},
-        {.note = G_SHARP_4, .timeMs = 19},
-        {.note = B_4, .timeMs = 19},
-        {.note = D_5, .timeMs = 19},
-        {.note = E_4, .timeMs = 19},
-        {.note = G_SHARP_4, .timeMs = 19},
-        {.note = B_4, .timeMs = 19},
-        {.note = D_5, .timeMs = 19},
-        {.note = E_4, .timeMs = 19},
-        {.note = G_SHARP_4, .timeMs = 19},
-        {.note = B_4, .timeMs = 19},
-        {.note = D_5, .timeMs = 19},
-        {.note = SILENCE, .timeMs = 157},
-        {.note = A_4, .timeMs = 157},
-        {.note = SILENCE, .timeMs = 157},
-        {.note = A_4, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_4, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = SILENCE, .timeMs = 39},
-        {.note = B_4, .timeMs = 19},
-        {.note = D_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = B_4, .timeMs = 19},
-        {.note = D_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = SILENCE, .timeMs = 39},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = SILENCE, .timeMs = 39},
-        {.note = B_4, .timeMs = 19},
-        {.note = D_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = B_4, .timeMs = 19},
-        {.note = D_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = SILENCE, .timeMs = 39},
-        {.note = A_4, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_4, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = SILENCE, .timeMs = 197},
-        {.note = E_4, .timeMs = 19},
-        {.note = G_SHARP_4, .timeMs = 19},
-        {.note = B_4, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = E_4, .timeMs = 19},
-        {.note = G_SHARP_4, .timeMs = 19},
-        {.note = B_4, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = E_4, .timeMs = 19},
-        {.note = G_SHARP_4, .timeMs = 19},
-        {.note = B_4, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = E_4, .timeMs = 19},
-        {.note = G_SHARP_4, .timeMs = 19},
-        {.note = B_4, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = SILENCE, .timeMs = 157},
-        {.note = E_4, .timeMs = 19},
-        {.note = G_SHARP_4, .timeMs = 19},
-        {.note = B_4, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = E_4, .timeMs = 19},
-        {.note = G_SHARP_4, .timeMs = 19},
-        {.note = B_4, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = E_4, .timeMs = 19},
-        {.note = G_SHARP_4, .timeMs = 19},
-        {.note = B_4, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = E_4, .timeMs = 19},
-        {.note = G_SHARP_4, .timeMs = 19},
-        {.note = B_4, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = E_4, .timeMs = 19},
-        {.note = G_SHARP_4, .timeMs = 19},
-        {.note = B_4, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = E_4, .timeMs = 19},
-        {.note = G_SHARP_4, .timeMs = 19},
-        {.note = B_4, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = E_4, .timeMs = 19},
-        {.note = G_SHARP_4, .timeMs = 19},
-        {.note = B_4, .timeMs = 19},
-        {.note = E_5, .timeMs = 39},
-        {.note = G_SHARP_5, .timeMs = 39},
-        {.note = B_5, .timeMs = 39},
-        {.note = D_6, .timeMs = 39},
-        {.note = E_6, .timeMs = 39},
-        {.note = G_SHARP_6, .timeMs = 39},
-        {.note = B_6, .timeMs = 19},
-        // loop start
-        {.note = E_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = C_SHARP_6, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = C_SHARP_6, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = SILENCE, .timeMs = 157},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = C_SHARP_6, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = C_SHARP_6, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = SILENCE, .timeMs = 157},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = E_6, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = E_6, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = SILENCE, .timeMs = 157},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = E_6, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = E_6, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = SILENCE, .timeMs = 157},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = D_SHARP_6, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = D_SHARP_6, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = SILENCE, .timeMs = 157},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = D_SHARP_6, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = D_SHARP_6, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = SILENCE, .timeMs = 157},
-        {.note = F_5, .timeMs = 19},
-        {.note = B_5, .timeMs = 19},
-        {.note = D_6, .timeMs = 19},
-        {.note = F_5, .timeMs = 19},
-        {.note = B_5, .timeMs = 19},
-        {.note = D_6, .timeMs = 19},
-        {.note = F_5, .timeMs = 19},
-        {.note = B_5, .timeMs = 19},
-        {.note = SILENCE, .timeMs = 157},
-        {.note = E_5, .timeMs = 39},
-        {.note = F_SHARP_5, .timeMs = 39},
-        {.note = G_5, .timeMs = 39},
-        {.note = G_SHARP_5, .timeMs = 39},
-        {.note = A_5, .timeMs = 39},
-        {.note = A_SHARP_5, .timeMs = 39},
-        {.note = B_5, .timeMs = 39},
-        {.note = C_6, .timeMs = 39},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = C_SHARP_6, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = C_SHARP_6, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 78},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_4, .timeMs = 236},
-        {.note = A_4, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_4, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_4, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = E_4, .timeMs = 315},
-        {.note = SILENCE, .timeMs = 157},
-        {.note = A_4, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_4, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_4, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = SILENCE, .timeMs = 157},
-        {.note = A_4, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_4, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_4, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = B_4, .timeMs = 19},
-        {.note = D_SHARP_5, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = B_4, .timeMs = 19},
-        {.note = D_SHARP_5, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = B_4, .timeMs = 19},
-        {.note = D_SHARP_5, .timeMs = 19},
-        {.note = A_4, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_4, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_4, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = SILENCE, .timeMs = 157},
-        {.note = E_4, .timeMs = 315},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = C_SHARP_6, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = C_SHARP_6, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = SILENCE, .timeMs = 157},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = C_SHARP_6, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = C_SHARP_6, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = SILENCE, .timeMs = 157},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = E_6, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = E_6, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = SILENCE, .timeMs = 157},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = E_6, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = E_6, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = SILENCE, .timeMs = 157},
-        {.note = D_5, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = D_6, .timeMs = 19},
-        {.note = D_5, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = D_6, .timeMs = 19},
-        {.note = D_5, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = SILENCE, .timeMs = 157},
-        {.note = D_5, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = D_6, .timeMs = 19},
-        {.note = D_5, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = D_6, .timeMs = 19},
-        {.note = D_5, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = SILENCE, .timeMs = 157},
-        {.note = D_SHARP_5, .timeMs = 19},
-        {.note = G_SHARP_5, .timeMs = 19},
-        {.note = D_SHARP_6, .timeMs = 19},
-        {.note = D_SHARP_5, .timeMs = 19},
-        {.note = G_SHARP_5, .timeMs = 19},
-        {.note = D_SHARP_6, .timeMs = 19},
-        {.note = D_SHARP_5, .timeMs = 19},
-        {.note = G_SHARP_5, .timeMs = 19},
-        {.note = SILENCE, .timeMs = 473},
-        {.note = E_5, .timeMs = 19},
-        {.note = G_5, .timeMs = 19},
-        {.note = E_6, .timeMs = 19},
-        {.note = G_5, .timeMs = 19},
-        {.note = E_6, .timeMs = 19},
-        {.note = G_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = G_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = E_6, .timeMs = 19},
-        {.note = SILENCE, .timeMs = 39},
-        {.note = D_5, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = D_6, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = D_6, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = D_5, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = D_5, .timeMs = 19},
-        {.note = D_6, .timeMs = 19},
-        {.note = SILENCE, .timeMs = 197},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = C_SHARP_6, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = C_SHARP_6, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = C_SHARP_6, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = C_SHARP_6, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = C_SHARP_6, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = C_SHARP_6, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = C_SHARP_6, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = D_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = B_5, .timeMs = 19},
-        {.note = D_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = B_5, .timeMs = 19},
-        {.note = D_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = B_5, .timeMs = 19},
-        {.note = D_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = B_5, .timeMs = 19},
-        {.note = D_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = B_5, .timeMs = 19},
-        {.note = D_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = B_5, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = A_SHARP_5, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = A_SHARP_5, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = A_SHARP_5, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = A_SHARP_5, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = A_SHARP_5, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = A_SHARP_5, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = A_SHARP_5, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = SILENCE, .timeMs = 315},
-        {.note = F_SHARP_5, .timeMs = 78},
-        {.note = G_5, .timeMs = 78},
-        {.note = G_SHARP_5, .timeMs = 78},
-        {.note = A_5, .timeMs = 78},
-        {.note = A_SHARP_5, .timeMs = 78},
-        {.note = B_5, .timeMs = 394},
-        {.note = C_SHARP_6, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = C_SHARP_6, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = C_SHARP_6, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = C_SHARP_6, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = SILENCE, .timeMs = 78},
-        {.note = B_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = B_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = B_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = B_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = SILENCE, .timeMs = 78},
-        {.note = A_SHARP_5, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_SHARP_5, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_SHARP_5, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = A_SHARP_5, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = SILENCE, .timeMs = 78},
-        {.note = C_SHARP_6, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = F_5, .timeMs = 19},
-        {.note = C_SHARP_6, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = F_5, .timeMs = 19},
-        {.note = C_SHARP_6, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = F_5, .timeMs = 19},
-        {.note = C_SHARP_6, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = F_5, .timeMs = 98},
-        {.note = B_5, .timeMs = 59},
-        {.note = C_SHARP_6, .timeMs = 256},
-        {.note = B_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = F_5, .timeMs = 19},
-        {.note = B_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = F_5, .timeMs = 19},
-        {.note = B_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = F_5, .timeMs = 19},
-        {.note = B_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = F_5, .timeMs = 19},
-        {.note = B_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = F_5, .timeMs = 19},
-        {.note = B_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = F_5, .timeMs = 19},
-        {.note = B_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = F_5, .timeMs = 19},
-        {.note = B_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = F_5, .timeMs = 19},
-        {.note = B_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = F_5, .timeMs = 19},
-        {.note = B_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = F_5, .timeMs = 19},
-        {.note = B_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = SILENCE, .timeMs = 315},
-        {.note = B_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = B_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = B_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = B_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = SILENCE, .timeMs = 78},
-        {.note = A_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = SILENCE, .timeMs = 78},
-        {.note = G_SHARP_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = G_SHARP_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = G_SHARP_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = G_SHARP_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = SILENCE, .timeMs = 78},
-        {.note = B_5, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = B_5, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = B_5, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = B_5, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 98},
-        {.note = A_5, .timeMs = 59},
-        {.note = B_5, .timeMs = 256},
-        {.note = A_SHARP_5, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = A_SHARP_5, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = A_SHARP_5, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = A_SHARP_5, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = A_SHARP_5, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = A_SHARP_5, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = A_SHARP_5, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = A_SHARP_5, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = A_SHARP_5, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = A_SHARP_5, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = C_SHARP_5, .timeMs = 19},
-        {.note = A_SHARP_5, .timeMs = 19},
-        {.note = F_SHARP_5, .timeMs = 19},
-        {.note = SILENCE, .timeMs = 315},
-        {.note = A_5, .timeMs = 236},
-        {.note = SILENCE, .timeMs = 78},
-        {.note = F_5, .timeMs = 236},
-        {.note = SILENCE, .timeMs = 78},
-        {.note = D_5, .timeMs = 236},
-        {.note = SILENCE, .timeMs = 78},
-        {.note = A_5, .timeMs = 236},
-        {.note = SILENCE, .timeMs = 78},
-        {.note = F_5, .timeMs = 236},
-        {.note = C_SHARP_6, .timeMs = 315},
-        {.note = F_5, .timeMs = 157},
-        {.note = A_5, .timeMs = 236},
-        {.note = SILENCE, .timeMs = 78},
-        {.note = B_5, .timeMs = 19},
-        {.note = G_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = B_5, .timeMs = 19},
-        {.note = G_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = B_5, .timeMs = 19},
-        {.note = G_5, .timeMs = 19},
-        {.note = SILENCE, .timeMs = 157},
-        {.note = E_4, .timeMs = 315},
-        {.note = B_5, .timeMs = 19},
-        {.note = G_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = B_5, .timeMs = 19},
-        {.note = G_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = B_5, .timeMs = 19},
-        {.note = G_5, .timeMs = 19},
-        {.note = SILENCE, .timeMs = 157},
-        {.note = E_4, .timeMs = 315},
-        {.note = B_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = B_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = B_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = SILENCE, .timeMs = 78},
-        {.note = B_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = B_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = B_5, .timeMs = 19},
-        {.note = A_5, .timeMs = 19},
-        {.note = SILENCE, .timeMs = 157},
-        {.note = B_5, .timeMs = 19},
-        {.note = G_SHARP_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = B_5, .timeMs = 19},
-        {.note = G_SHARP_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = B_5, .timeMs = 19},
-        {.note = G_SHARP_5, .timeMs = 19},
-        {.note = SILENCE, .timeMs = 157},
-        {.note = C_6, .timeMs = 19},
-        {.note = G_SHARP_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = C_6, .timeMs = 19},
-        {.note = G_SHARP_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = C_6, .timeMs = 19},
-        {.note = G_SHARP_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = C_6, .timeMs = 19},
-        {.note = G_SHARP_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = C_6, .timeMs = 19},
-        {.note = G_SHARP_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = C_6, .timeMs = 19},
-        {.note = G_SHARP_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = C_6, .timeMs = 19},
-        {.note = G_SHARP_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = C_6, .timeMs = 19},
-        {.note = G_SHARP_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = C_6, .timeMs = 19},
-        {.note = G_SHARP_5, .timeMs = 19},
-        {.note = E_5, .timeMs = 19},
-        {.note = C_6, .timeMs = 39},
-        {.note = SILENCE, .timeMs = 19},
-
-    },
-    .numNotes = 726,
-    .loopStartNote = 175,
-    .shouldLoop = true
+    .keys = playFlashKeys,
+    .numKeys = lengthof(playFlashKeys),
+    .loop = false,
 };
 
 // Arrays
 static const jukeboxSong fighterMusic[] =
 {
-    {.name = "Battlefield", .song = &battlefield_music},
-    {.name = "Final Destination", .song = &final_dest_music},
+    {.name = "Battlefield", .fname = "battlefield_music.sng"},
+    {.name = "Final Destination", .fname = "final_dest_music.sng"},
 };
 
 static const jukeboxSong platformerMusic[] =
@@ -2561,9 +224,9 @@ static const jukeboxSong jumperMusic[] =
 
 static const jukeboxSong picrossMusic[] =
 {
-    {.name = "Game", .song = &picross_music_bg},
-    {.name = "Win", .song = &picross_music_win},
-    {.name = "Rick", .song = &picross_music_rick} // This must be last
+    {.name = "Game", .fname = "picross_music_bg.sng"},
+    {.name = "Win", .fname = "picross_music_win.sng"},
+    {.name = "Rick", .fname = "picross_music_rick.sng"} // This must be last
 };
 
 static const jukeboxSong tiltradsMusic[] =
@@ -2579,11 +242,11 @@ static const jukeboxSong paintMusic[] =
 
 static const jukeboxSong jukeboxMusic[] =
 {
-    {.name = "Hot Rod", .song = &hotrod},
-    {.name = "Fauxrio Kart", .song = &fauxrio_kart},
-    {.name = "The Lake", .song = &the_lake},
-    {.name = "Ya like jazz?", .song = &herecomesthesun},
-    {.name = "Banana", .song = &bananaphone},
+    {.name = "Hot Rod", .fname = "hotrod.sng"},
+    {.name = "Fauxrio Kart", .fname = "fauxrio_kart.sng"},
+    {.name = "The Lake", .fname = "the_lake.sng"},
+    {.name = "Ya like jazz?", .fname = "herecomesthesun.sng"},
+    {.name = "Banana", .fname = "bananaphone.sng"},
 };
 
 static const jukeboxSong creditsMusic[] =
@@ -2725,6 +388,11 @@ void  jukeboxEnterMode(display_t* disp)
 
     jukebox->portableDances = initPortableDance(NULL);
 
+    // Draw the dance under the play flash
+    ledCompositorInit(&jukebox->ledComp);
+    ledCompositorSetBlend(&jukebox->ledComp, LED_LAYER_OVERLAY, LED_BLEND_ADD, 255);
+    portableDanceSetCompositor(jukebox->portableDances, &jukebox->ledComp, LED_LAYER_BASE);
+
     // Disable Comet {R,G,B}, Rise {R,G,B}, Pulse {R,G,B}, and Fire {G,B}
     portableDanceDisableDance(jukebox->portableDances, "Comet R");
     portableDanceDisableDance(jukebox->portableDances, "Comet G");
@@ -2749,7 +417,8 @@ void  jukeboxEnterMode(display_t* disp)
  */
 void  jukeboxExitMode(void)
 {
-    stopNote();
+    // Stop the buzzer before freeing any song it's playing
+    jukeboxStop();
 
     freeFont(&jukebox->ibm_vga8);
     freeFont(&jukebox->radiostars);
@@ -2792,17 +461,27 @@ void  jukeboxButtonCallback(buttonEvt_t* evt)
                     {
                         if(jukebox->inMusicSubmode)
                         {
-                            buzzer_play_bgm(musicCategories[jukebox->categoryIdx].songs[jukebox->songIdx].song);
+                            const song_t* song = jukeboxGetSong(&musicCategories[jukebox->categoryIdx].songs[jukebox->songIdx]);
+                            if(NULL != song)
+                            {
+                                buzzer_play_bgm(song);
+                                jukeboxStartPlayFlash();
+                            }
                         }
                         else
                         {
-                            buzzer_play_sfx(sfxCategories[jukebox->categoryIdx].songs[jukebox->songIdx].song);
+                            const song_t* song = jukeboxGetSong(&sfxCategories[jukebox->categoryIdx].songs[jukebox->songIdx]);
+                            if(NULL != song)
+                            {
+                                buzzer_play_sfx(song);
+                                jukeboxStartPlayFlash();
+                            }
                         }
                         break;
                     }
                     case BTN_B:
                     {
-                        buzzer_stop();
+                        jukeboxStop();
                         break;
                     }
                     case SELECT:
@@ -2817,7 +496,7 @@ void  jukeboxButtonCallback(buttonEvt_t* evt)
                     }
                     case UP:
                     {
-                        buzzer_stop();
+                        jukeboxStop();
                         uint8_t length;
                         if(jukebox->inMusicSubmode)
                         {
@@ -2839,7 +518,7 @@ void  jukeboxButtonCallback(buttonEvt_t* evt)
                     }
                     case DOWN:
                     {
-                        buzzer_stop();
+                        jukeboxStop();
                         uint8_t length;
                         if(jukebox->inMusicSubmode)
                         {
@@ -2857,7 +536,7 @@ void  jukeboxButtonCallback(buttonEvt_t* evt)
                     }
                     case LEFT:
                     {
-                        buzzer_stop();
+                        jukeboxStop();
                         uint8_t length;
                         if(jukebox->inMusicSubmode)
                         {
@@ -2883,7 +562,7 @@ void  jukeboxButtonCallback(buttonEvt_t* evt)
                     }
                     case RIGHT:
                     {
-                        buzzer_stop();
+                        jukeboxStop();
                         uint8_t length;
                         if(jukebox->inMusicSubmode)
                         {
@@ -2949,6 +628,8 @@ void  jukeboxMainLoop(int64_t elapsedUs)
         case JUKEBOX_PLAYER:
         {
             portableDanceMainLoop(jukebox->portableDances, elapsedUs);
+            jukeboxUpdatePlayFlash(elapsedUs);
+            ledCompositorRender(&jukebox->ledComp);
 
             //fillDisplayArea(jukebox->disp, 0, 0, jukebox->disp->w, jukebox->disp->h, c010);
 
@@ -3127,7 +808,7 @@ void  jukeboxMainLoop(int64_t elapsedUs)
 
 void setJukeboxMainMenu(bool resetPos)
 {
-    buzzer_stop();
+    jukeboxStop();
 
     resetMeleeMenu(jukebox->menu, str_jukebox, jukeboxMainMenuCb);
     addRowToMeleeMenu(jukebox->menu, str_bgm);
@@ -3201,6 +882,73 @@ void jukeboxBackgroundDrawCb(display_t* disp, int16_t x, int16_t y,
     }
 }
 
+/**
+ * @brief Get a song to play, loading it from SPIFFS if it isn't compiled in.
+ * The buzzer is stopped and any previously loaded song is freed first
+ *
+ * @param jSong The jukebox entry to get a song for
+ * @return The song, or NULL if it couldn't be loaded
+ */
+static const song_t* jukeboxGetSong(const jukeboxSong* jSong)
+{
+    jukeboxStop();
+
+    if(NULL != jSong->song)
+    {
+        return jSong->song;
+    }
+
+    jukebox->loadedSong = loadSong(jSong->fname);
+    return jukebox->loadedSong;
+}
+
+/**
+ * @brief Stop the buzzer and free the song loaded from SPIFFS, if there is one
+ */
+static void jukeboxStop(void)
+{
+    buzzer_stop();
+    if(NULL != jukebox->loadedSong)
+    {
+        freeSong(jukebox->loadedSong);
+        jukebox->loadedSong = NULL;
+    }
+    ledCompositorEnableLayer(&jukebox->ledComp, LED_LAYER_OVERLAY, false);
+}
+
+/**
+ * Start flashing the LEDs over the dance, to show a song started playing
+ */
+static void jukeboxStartPlayFlash(void)
+{
+    jukebox->playFlashUs = 0;
+    ledCompositorEnableLayer(&jukebox->ledComp, LED_LAYER_OVERLAY, true);
+}
+
+/**
+ * Fade out the play flash, and stop drawing it when it's done
+ *
+ * @param elapsedUs The time since the last frame
+ */
+static void jukeboxUpdatePlayFlash(int64_t elapsedUs)
+{
+    if(!jukebox->ledComp.layers[LED_LAYER_OVERLAY].enabled)
+    {
+        return;
+    }
+
+    const ledKeyframe_t* lastKey = &playFlashEnv.keys[playFlashEnv.numKeys - 1];
+    if(jukebox->playFlashUs >= lastKey->tUs)
+    {
+        ledCompositorEnableLayer(&jukebox->ledComp, LED_LAYER_OVERLAY, false);
+        return;
+    }
+
+    ledCompositorFillLayer(&jukebox->ledComp, LED_LAYER_OVERLAY, playFlashColor,
+                           ledEnvelopeEval(&playFlashEnv, jukebox->playFlashUs));
+    jukebox->playFlashUs += elapsedUs;
+}
+
 /**
  * @return true if Rick was unlocked, false if it was not
  */
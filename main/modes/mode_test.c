@@ -9,6 +9,7 @@
 
 #include "settingsManager.h"
 #include "embeddedout.h"
+#include "audio_analysis.h"
 #include "bresenham.h"
 #include "musical_buzzer.h"
 #include "led_util.h"
@@ -62,7 +63,7 @@ typedef enum
 void testEnterMode(display_t* disp);
 void testExitMode(void);
 void testMainLoop(int64_t elapsedUs);
-void testAudioCb(uint16_t* samples, uint32_t sampleCnt);
+void testAudioAnalysisCb(const embeddednf_data* end, const dft32_data* dd);
 void testButtonCb(buttonEvt_t* evt);
 void testTouchCb(touch_event_t* evt);
 void testAccelerometerCallback(accel_t* accel);
@@ -82,10 +83,8 @@ typedef struct
     uint64_t tSpriteElapsedUs;
     uint8_t spriteFrame;
     // Microphone test
-    dft32_data dd;
-    embeddednf_data end;
+    const embeddednf_data* end;
     embeddedout_data eod;
-    uint8_t samplesProcessed;
     uint16_t maxValue;
     // Button
     testButtonState_t buttonStates[8];
@@ -118,7 +117,8 @@ swadgeMode modeTest =
     .fnEspNowRecvCb = NULL,
     .fnEspNowSendCb = NULL,
     .fnAccelerometerCallback = testAccelerometerCallback,
-    .fnAudioCallback = testAudioCb,
+    .fnAudioCallback = NULL,
+    .fnAudioAnalysisCallback = testAudioAnalysisCb,
     .fnTemperatureCallback = NULL,
     .overrideUsb = false
 };
@@ -181,8 +181,8 @@ void testEnterMode(display_t* disp)
     loadWsg("kid0.wsg", &test->kd_idle0);
     loadWsg("kid1.wsg", &test->kd_idle1);
 
-    // Init CC
-    InitColorChord(&test->end, &test->dd);
+    // The DFT and note finder are run by the shared audio analysis
+    test->end = getAudioAnalysisNotes();
     test->maxValue = 1;
 
     // Set the mic to listen
@@ -237,9 +237,9 @@ void testMainLoop(int64_t elapsedUs __attribute__((unused)))
     // Find the max value
     for(uint16_t i = 0; i < FIXBINS; i++)
     {
-        if(test->end.fuzzed_bins[i] > test->maxValue)
+        if(test->end->fuzzed_bins[i] > test->maxValue)
         {
-            test->maxValue = test->end.fuzzed_bins[i];
+            test->maxValue = test->end->fuzzed_bins[i];
         }
     }
 
@@ -247,8 +247,8 @@ void testMainLoop(int64_t elapsedUs __attribute__((unused)))
     int32_t energy = 0;
     for(uint16_t i = 0; i < FIXBINS; i++)
     {
-        energy += test->end.fuzzed_bins[i];
-        uint8_t height = ((test->disp->h / 2) * test->end.fuzzed_bins[i]) /
+        energy += test->end->fuzzed_bins[i];
+        uint8_t height = ((test->disp->h / 2) * test->end->fuzzed_bins[i]) /
                          test->maxValue;
         paletteColor_t color = test->bzrMicPassed ? c050 : c500; //paletteHsvToHex((i * 256) / FIXBINS, 255, 255);
         int16_t x0 = binMargin + (i * binWidth);
@@ -633,44 +633,14 @@ void testTouchCb(touch_event_t* evt)
 }
 
 /**
- * @brief Audio callback. Take the samples and pass them to test
+ * @brief Audio analysis callback. Save the note finder output to draw the spectrogram
  *
- * @param samples The samples to process
- * @param sampleCnt The number of samples to process
+ * @param end The note finder output
+ * @param dd The DFT state, unused
  */
-void testAudioCb(uint16_t* samples, uint32_t sampleCnt)
+void testAudioAnalysisCb(const embeddednf_data* end, const dft32_data* dd __attribute__((unused)))
 {
-    // For each sample
-    for(uint32_t idx = 0; idx < sampleCnt; idx++)
-    {
-        // Push to test
-        PushSample32(&test->dd, samples[idx]);
-
-        // If 128 samples have been pushed
-        test->samplesProcessed++;
-        if(test->samplesProcessed >= 128)
-        {
-            // Update LEDs
-            test->samplesProcessed = 0;
-            HandleFrameInfo(&test->end, &test->dd);
-
-            // Keep track of max value for the spectrogram
-            int16_t maxVal = 0;
-            for(uint16_t i = 0; i < FIXBINS; i++)
-            {
-                if(test->end.fuzzed_bins[i] > maxVal)
-                {
-                    maxVal = test->end.fuzzed_bins[i];
-                }
-            }
-
-            // If already passed, just return
-            if(true == test->bzrMicPassed)
-            {
-                return;
-            }
-        }
-    }
+    test->end = end;
 }
 
 /**
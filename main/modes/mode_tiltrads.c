@@ -22,6 +22,7 @@
 #include "nvs_manager.h" // Saving and loading high scores and last scores
 #include "musical_buzzer.h" // Music and SFX
 #include "led_util.h" // LEDs
+#include "led_compositor.h" // LED FX layers and envelopes
 
 // NOTES:
 // Decided not to handle cascade clears that result from falling tetrads after clears. Closer to target behavior.
@@ -60,8 +61,10 @@
 // Time info
 #define MS_TO_US_FACTOR 1000
 #define S_TO_MS_FACTOR 1000
+#ifdef DEBUG
 #define US_TO_MS_FACTOR 0.001
 #define MS_TO_S_FACTOR 0.001
+#endif
 
 // Useful display
 #define DISPLAY_HALF_HEIGHT 120
@@ -128,7 +131,7 @@
 #define LINE_CLEARS_PER_LEVEL 5
 
 // LED FX
-#define MODE_LED_BRIGHTNESS 0.125 // Factor that decreases overall brightness of LEDs since they are a little distracting at full brightness.
+#define MODE_LED_BRIGHTNESS 32 // Out of 255, decreases overall brightness of LEDs since they are a little distracting at full brightness.
 
 // Music and SFX
 #define NUM_LAND_FX 16
@@ -1440,6 +1443,7 @@ typedef struct
 
     // LED FX vars
     led_t leds[NUM_LEDS];
+    ledCompositor_t ledComp;
 
     // Display pointer
     display_t* disp;
@@ -1578,13 +1582,13 @@ bool checkCollision(coord_t newPos, uint8_t tetradCols, uint8_t tetradRows,
                     uint32_t selfGridValue);
 
 // LED FX functions
-void singlePulseLEDs(uint8_t numLEDs, led_t fxColor, double progress);
+void singlePulseLEDs(uint8_t numLEDs, led_t fxColor, int64_t timer, int64_t time);
 void blinkLEDs(uint8_t numLEDs, led_t fxColor, uint32_t time);
 void alternatingPulseLEDS(uint8_t numLEDs, led_t fxColor, uint32_t time);
 void dancingLEDs(uint8_t numLEDs, led_t fxColor, uint32_t time);
-void countdownLEDs(uint8_t numLEDs, led_t fxColor, double progress);
+void countdownLEDs(uint8_t numLEDs, led_t fxColor, int64_t progress, int64_t total);
 void clearLEDs(uint8_t numLEDs);
-void applyLEDBrightness(uint8_t numLEDs, double brightness);
+void showLEDs(void);
 
 // Mode struct hook
 swadgeMode modeTiltrads =
@@ -1599,6 +1603,7 @@ swadgeMode modeTiltrads =
     .fnEspNowRecvCb = NULL,
     .fnEspNowSendCb = NULL,
     .fnAccelerometerCallback = ttAccelerometerCallback,
+    .accelerometerFifo = true,
     .fnAudioCallback = NULL,
     .fnTemperatureCallback = NULL,
     .overrideUsb = false
@@ -1612,6 +1617,10 @@ void ttInit(display_t* disp)
     // Save the display pointer.
     tiltrads->disp = disp;
 
+    // The LEDs are dimmed by the opacity of the base layer
+    ledCompositorInit(&(tiltrads->ledComp));
+    ledCompositorSetBlend(&(tiltrads->ledComp), LED_LAYER_BASE, LED_BLEND_REPLACE, MODE_LED_BRIGHTNESS);
+
     // Load some fonts.
     loadFont("ibm_vga8.font", &(tiltrads->ibm_vga8));
     loadFont("radiostars.font", &(tiltrads->radiostars));
@@ -1707,10 +1716,11 @@ void ttTouchCallback(touch_event_t* evt)
 
 void ttAccelerometerCallback(accel_t* accel)
 {
-    // Set the accelerometer values.
-    tiltrads->ttAccel.x = accel->x;
-    tiltrads->ttAccel.y = accel->y;
-    tiltrads->ttAccel.z = accel->z;
+    // Samples arrive evenly spaced from the accelerometer's FIFO, so smooth
+    // them to take the jitter out of gradual tilts.
+    tiltrads->ttAccel.x += (accel->x - tiltrads->ttAccel.x) / 2;
+    tiltrads->ttAccel.y += (accel->y - tiltrads->ttAccel.y) / 2;
+    tiltrads->ttAccel.z += (accel->z - tiltrads->ttAccel.z) / 2;
 }
 
 static void ttUpdate(int64_t elapsedUs __attribute__((unused)))
@@ -1816,6 +1826,9 @@ static void ttUpdate(int64_t elapsedUs __attribute__((unused)))
             break;
     };
 
+    // Send any LED FX which changed this frame.
+    ledCompositorRender(&(tiltrads->ledComp));
+
     // Guidelines
     //plotLine(tiltrads->disp, 0, 0, 0, 240, c200, 5);
     //plotLine(tiltrads->disp, 140, 0, 140, 240, c200, 5);
@@ -2039,8 +2052,7 @@ void ttGameUpdate(void)
         {
             tiltrads->clearTimer += tiltrads->deltaTime;
 
-            double clearProgress = (double)tiltrads->clearTimer / (double)tiltrads->clearTime;
-            singlePulseLEDs(NUM_LEDS, clearColor, clearProgress);
+            singlePulseLEDs(NUM_LEDS, clearColor, tiltrads->clearTimer, tiltrads->clearTime);
 
             if (tiltrads->clearTimer >= tiltrads->clearTime)
             {
@@ -2072,17 +2084,16 @@ void ttGameUpdate(void)
             //double dropProgress = (double)tiltrads->dropTimer / (double)tiltrads->dropTime;
 
             // Progress is how close it is to landing on the floor. (Too nebulous or unhelpful?)
-            double totalFallTime = (GRID_ROWS - 1) * tiltrads->dropTime;
+            int64_t totalFallTime = (GRID_ROWS - 1) * tiltrads->dropTime;
             int32_t fallDistance = getFallDistance(&(tiltrads->activeTetrad), GRID_COLS, GRID_ROWS, tiltrads->tetradsGrid);
 
-            double totalFallProgress = totalFallTime - (((fallDistance + 1) * tiltrads->dropTime) - tiltrads->dropTimer);
-            double countdownProgress = totalFallProgress / totalFallTime;
+            int64_t totalFallProgress = totalFallTime - (((fallDistance + 1) * tiltrads->dropTime) - tiltrads->dropTimer);
 
             // NOTE: this check is here because under unknown circumstances the math above can produce bad countdownProgress values, causing a slight flicker when a tetrad lands.
             // Ideally the math above should be fixed, but this is an acceptable fix for now.
-            if (countdownProgress >= 0.0 && countdownProgress <= 1.0)
+            if (totalFallTime > 0 && totalFallProgress >= 0 && totalFallProgress <= totalFallTime)
             {
-                countdownLEDs(NUM_LEDS, tetradColors[tiltrads->activeTetrad.type - 1], countdownProgress);
+                countdownLEDs(NUM_LEDS, tetradColors[tiltrads->activeTetrad.type - 1], totalFallProgress, totalFallTime);
             }
 
             if (tiltrads->dropTimer >= tiltrads->dropTime)
@@ -2695,7 +2706,7 @@ void ttGameoverDisplay(void)
         drawText(tiltrads->disp, &(tiltrads->ibm_vga8), c540, str_restart, tiltrads->disp->w - rightWindowXMargin - textWidth(&(tiltrads->ibm_vga8), str_restart) - controlTextXPadding, controlTextYOffset);
     }
 
-    tiltrads->gameoverLEDAnimCycle = ((double)tiltrads->stateTime * US_TO_MS_FACTOR) / DISPLAY_REFRESH_MS;
+    tiltrads->gameoverLEDAnimCycle = (tiltrads->stateTime / 1000) / DISPLAY_REFRESH_MS;
 
     // Flash the active tetrad that was the killing tetrad.
     if (tiltrads->gameoverLEDAnimCycle % 2 == 0) 
@@ -2815,7 +2826,7 @@ void ttChangeState(tiltradsState_t newState)
             x1 = tiltrads->disp->w - x0;
             snprintf(uiStr, sizeof(uiStr), str_d_format, tiltrads->score);
             tiltrads->gameoverScoreX = getCenteredTextX(&(tiltrads->ibm_vga8), uiStr, x0, x1);
-            tiltrads->gameoverLEDAnimCycle = ((double)tiltrads->stateTime * US_TO_MS_FACTOR) / DISPLAY_REFRESH_MS;
+            tiltrads->gameoverLEDAnimCycle = (tiltrads->stateTime / 1000) / DISPLAY_REFRESH_MS;
 
             clearLEDs(NUM_LEDS);
 
@@ -3912,7 +3923,7 @@ void startClearAnimation(int32_t numLineClears __attribute__((unused)))
     tiltrads->clearTimer = 0;
     tiltrads->clearTime = CLEAR_LINES_ANIM_TIME;
 
-    singlePulseLEDs(NUM_LEDS, clearColor, 0.0);
+    singlePulseLEDs(NUM_LEDS, clearColor, 0, 1);
 }
 
 void stopClearAnimation()
@@ -3921,7 +3932,7 @@ void stopClearAnimation()
     tiltrads->clearTimer = 0;
     tiltrads->clearTime = 0;
 
-    singlePulseLEDs(NUM_LEDS, clearColor, 1.0);
+    singlePulseLEDs(NUM_LEDS, clearColor, 1, 1);
 }
 
 int64_t getDropTime(int64_t level)
@@ -4221,70 +4232,68 @@ bool checkCollision(coord_t newPos, uint8_t tetradCols, uint8_t tetradRows __att
 }
 
 // A color is puled all LEDs according to the type of clear.
-void singlePulseLEDs(uint8_t numLEDs, led_t fxColor, double progress)
+void singlePulseLEDs(uint8_t numLEDs, led_t fxColor, int64_t timer, int64_t time)
 {
-    double lightness = 1.0 - (progress * progress);
-
-    for (int32_t i = 0; i < numLEDs; i++)
+    // Lightness falls off with the square of the progress.
+    uint8_t lightness = 0;
+    if (time > 0 && timer < time)
     {
-        tiltrads->leds[i].r = (uint8_t)((double)fxColor.r * lightness);
-        tiltrads->leds[i].g = (uint8_t)((double)fxColor.g * lightness);
-        tiltrads->leds[i].b = (uint8_t)((double)fxColor.b * lightness);
+        lightness = 255 - ((255 * timer * timer) / (time * time));
     }
 
-    applyLEDBrightness(numLEDs, MODE_LED_BRIGHTNESS);
-    setLeds(tiltrads->leds, NUM_LEDS);
+    ledCompositorFillLayer(&(tiltrads->ledComp), LED_LAYER_BASE, fxColor, lightness);
 }
 
 // Blink red in sync with OLED gameover FX.
 void blinkLEDs(uint8_t numLEDs, led_t fxColor, uint32_t time)
 {
     // TODO: there are instances where the red flashes on the opposite of the fill draw, how to ensure this does not happen?
-    uint32_t animCycle = ((double)time * US_TO_MS_FACTOR) / DISPLAY_REFRESH_MS;
+    uint32_t animCycle = (time / 1000) / DISPLAY_REFRESH_MS;
     bool lightActive = animCycle % 2 == 0;
 
-    for (int32_t i = 0; i < numLEDs; i++)
-    {
-        tiltrads->leds[i].r = lightActive ? fxColor.r : 0x00;
-        tiltrads->leds[i].g = lightActive ? fxColor.g : 0x00;
-        tiltrads->leds[i].b = lightActive ? fxColor.b : 0x00;
-    }
-
-    applyLEDBrightness(numLEDs, MODE_LED_BRIGHTNESS);
-    setLeds(tiltrads->leds, NUM_LEDS);
+    ledCompositorFillLayer(&(tiltrads->ledComp), LED_LAYER_BASE, fxColor, lightActive ? 255 : 0);
 }
 
 // Alternate lit up like a bulb sign.
 void alternatingPulseLEDS(uint8_t numLEDs, led_t fxColor, uint32_t time)
 {
-    double timeS = (double)time * US_TO_MS_FACTOR * MS_TO_S_FACTOR;
-    double risingProgress = (sin(timeS * 4.0) + 1.0) / 2.0;
-    double fallingProgress = 1.0 - risingProgress;
-
-    double risingR = risingProgress * (double)fxColor.r;
-    double risingG = risingProgress * (double)fxColor.g;
-    double risingB = risingProgress * (double)fxColor.b;
+    // (sin(4t) + 1) / 2, sampled every eighth of a period.
+    static const ledKeyframe_t sineKeys[] =
+    {
+        {.tUs = 0,       .level = 128},
+        {.tUs = 196350,  .level = 219},
+        {.tUs = 392699,  .level = 255},
+        {.tUs = 589049,  .level = 219},
+        {.tUs = 785398,  .level = 128},
+        {.tUs = 981748,  .level = 37},
+        {.tUs = 1178097, .level = 0},
+        {.tUs = 1374447, .level = 37},
+        {.tUs = 1570796, .level = 128},
+    };
+    static const ledEnvelope_t sineEnv =
+    {
+        .keys = sineKeys,
+        .numKeys = sizeof(sineKeys) / sizeof(sineKeys[0]),
+        .loop = true,
+    };
 
-    double fallingR = fallingProgress * (double)fxColor.r;
-    double fallingG = fallingProgress * (double)fxColor.g;
-    double fallingB = fallingProgress * (double)fxColor.b;
+    uint8_t risingProgress = ledEnvelopeEval(&sineEnv, time);
+    led_t rising = ledScale(fxColor, risingProgress);
+    led_t falling = ledScale(fxColor, 255 - risingProgress);
 
     for (int32_t i = 0; i < numLEDs; i++)
     {
         bool risingLED = i % 2 == 0;
-        tiltrads->leds[i].r = risingLED ? (uint8_t)risingR : (uint8_t)fallingR;
-        tiltrads->leds[i].g = risingLED ? (uint8_t)risingG : (uint8_t)fallingG;
-        tiltrads->leds[i].b = risingLED ? (uint8_t)risingB : (uint8_t)fallingB;
+        tiltrads->leds[i] = risingLED ? rising : falling;
     }
 
-    applyLEDBrightness(numLEDs, MODE_LED_BRIGHTNESS);
-    setLeds(tiltrads->leds, NUM_LEDS);
+    showLEDs();
 }
 
 // Radial wanderers.
 void dancingLEDs(uint8_t numLEDs, led_t fxColor, uint32_t time)
 {
-    uint32_t animCycle = ((double)time * US_TO_MS_FACTOR * 2.0) / DISPLAY_REFRESH_MS;
+    uint32_t animCycle = ((time / 1000) * 2) / DISPLAY_REFRESH_MS;
     int32_t firstIndex = animCycle % numLEDs;
     int32_t secondIndex = (firstIndex + (numLEDs / 2)) % numLEDs;
 
@@ -4295,37 +4304,29 @@ void dancingLEDs(uint8_t numLEDs, led_t fxColor, uint32_t time)
         tiltrads->leds[i].b = i == firstIndex || i == secondIndex ? fxColor.b : 0x00;
     }
 
-    applyLEDBrightness(numLEDs, MODE_LED_BRIGHTNESS);
-    setLeds(tiltrads->leds, NUM_LEDS);
+    showLEDs();
 }
 
-void countdownLEDs(uint8_t numLEDs, led_t fxColor, double progress)
+void countdownLEDs(uint8_t numLEDs, led_t fxColor, int64_t progress, int64_t total)
 {
     // Reverse the direction of progress.
-    progress = 1.0 - progress;
+    int64_t remaining = total - progress;
 
     // How many LEDs will be fully lit.
-    uint8_t numLitLEDs = progress * numLEDs;
+    uint8_t numLitLEDs = (remaining * numLEDs) / total;
 
-    // Get the length of each segment of progress.
-    double segment = 1.0 / numLEDs;
-    double segmentProgress = numLitLEDs * segment;
     // Find the amount that the leading LED should be partially lit.
-    double modProgress = (progress - segmentProgress) / segment;
+    uint8_t modProgress = (((remaining * numLEDs) % total) * 255) / total;
 
     for (int32_t i = 0; i < numLEDs; i++)
     {
         if (i < numLitLEDs)
         {
-            tiltrads->leds[i].r = fxColor.r;
-            tiltrads->leds[i].g = fxColor.g;
-            tiltrads->leds[i].b = fxColor.b;
+            tiltrads->leds[i] = fxColor;
         }
         else if (i == numLitLEDs)
         {
-            tiltrads->leds[i].r = (uint8_t)((double)fxColor.r * modProgress);
-            tiltrads->leds[i].g = (uint8_t)((double)fxColor.g * modProgress);
-            tiltrads->leds[i].b = (uint8_t)((double)fxColor.b * modProgress);
+            tiltrads->leds[i] = ledScale(fxColor, modProgress);
         }
         else
         {
@@ -4335,8 +4336,7 @@ void countdownLEDs(uint8_t numLEDs, led_t fxColor, double progress)
         }
     }
 
-    applyLEDBrightness(numLEDs, MODE_LED_BRIGHTNESS);
-    setLeds(tiltrads->leds, NUM_LEDS);
+    showLEDs();
 }
 
 void clearLEDs(uint8_t numLEDs)
@@ -4348,17 +4348,11 @@ void clearLEDs(uint8_t numLEDs)
         tiltrads->leds[i].b = 0x00;
     }
 
-    setLeds(tiltrads->leds, NUM_LEDS);
+    showLEDs();
 }
 
-void applyLEDBrightness(uint8_t numLEDs, double brightness)
+// LEDs are dimmed and sent by the compositor at the end of the frame.
+void showLEDs(void)
 {
-    // Best way would be to convert to HSV and then set, is this factor method ok?
-
-    for (int32_t i = 0; i < numLEDs; i++)
-    {
-        tiltrads->leds[i].r = (uint8_t)((double)tiltrads->leds[i].r * brightness);
-        tiltrads->leds[i].g = (uint8_t)((double)tiltrads->leds[i].g * brightness);
-        tiltrads->leds[i].b = (uint8_t)((double)tiltrads->leds[i].b * brightness);
-    }
+    ledCompositorSetLayer(&(tiltrads->ledComp), LED_LAYER_BASE, tiltrads->leds);
 }
@@ -20,6 +20,7 @@
 #include "display.h"
 #include "embeddednf.h"
 #include "embeddedout.h"
+#include "audio_analysis.h"
 #include "esp_timer.h"
 #include "led_util.h"
 #include "linked_list.h"
@@ -117,10 +118,8 @@ typedef struct
     uint32_t bpmButtonStartUs;
     uint32_t bpmButtonAccumulatedUs;
 
-    dft32_data dd;
-    embeddednf_data end;
+    const embeddednf_data* end;
     embeddedout_data eod;
-    int audioSamplesProcessed;
     uint32_t intensities_filt[NUM_LEDS];
     int32_t diffs_filt[NUM_LEDS];
 
@@ -161,7 +160,7 @@ void tunernomeExitMode(void);
 void switchToSubmode(tnMode);
 void tunernomeButtonCallback(buttonEvt_t* evt);
 void modifyBpm(int16_t bpmMod);
-void tunernomeSampleHandler(uint16_t* samples, uint32_t sampleCnt);
+void tunernomeAnalysisHandler(const embeddednf_data* end, const dft32_data* dd);
 void recalcMetronome(void);
 void plotInstrumentNameAndNotes(const char* instrumentName, const char* const* instrumentNotes,
                                 uint16_t numNotes);
@@ -192,7 +191,8 @@ swadgeMode modeTunernome =
     .fnEspNowRecvCb = NULL,
     .fnEspNowSendCb = NULL,
     .fnAccelerometerCallback = NULL,
-    .fnAudioCallback = tunernomeSampleHandler,
+    .fnAudioCallback = NULL,
+    .fnAudioAnalysisCallback = tunernomeAnalysisHandler,
     .overrideUsb = false
 };
 
@@ -419,7 +419,8 @@ void tunernomeEnterMode(display_t* disp)
 
     switchToSubmode(TN_TUNER);
 
-    InitColorChord(&tunernome->end, &tunernome->dd);
+    // The DFT and note finder are run by the shared audio analysis
+    tunernome->end = getAudioAnalysisNotes();
 
     tunernome->blinkStartUs = 0;
     tunernome->blinkAccumulatedUs = 0;
@@ -505,7 +506,7 @@ void tunernomeExitMode(void)
  */
 static inline int16_t getMagnitude(uint16_t idx)
 {
-    return tunernome->end.fuzzed_bins[idx];
+    return tunernome->end->fuzzed_bins[idx];
 }
 
 /**
@@ -536,7 +537,7 @@ static inline int16_t getSemiMagnitude(int16_t idx)
     {
         idx -= FIXBPERO;
     }
-    return tunernome->end.folded_bins[idx];
+    return tunernome->end->folded_bins[idx];
 }
 
 /**
@@ -1262,153 +1263,139 @@ void modifyBpm(int16_t bpmMod)
 }
 
 /**
- * This function is called whenever audio samples are read from the
- * microphone (ADC) and are ready for processing. Samples are read at 8KHz.
+ * This function is called whenever the shared audio analysis has processed
+ * another 128 samples from the microphone. Samples are read at 8KHz.
  *
- * @param samples A pointer to 12 bit audio samples
- * @param sampleCnt The number of samples read
+ * @param end The note finder output, also saved in tunernome->end
+ * @param dd The DFT state, unused
  */
-void tunernomeSampleHandler(uint16_t* samples, uint32_t sampleCnt)
+void tunernomeAnalysisHandler(const embeddednf_data* end __attribute__((unused)),
+                              const dft32_data* dd __attribute__((unused)))
 {
     if(tunernome->mode == TN_TUNER)
     {
-        for(uint32_t i = 0; i < sampleCnt; i++)
-        {
-            PushSample32( &tunernome->dd, samples[i] );
-        }
-        tunernome->audioSamplesProcessed += sampleCnt;
+        led_t colors[NUM_LEDS] = {{0}};
 
-        // If at least 128 samples have been processed
-        if( tunernome->audioSamplesProcessed >= 128 )
+        switch(tunernome->curTunerMode)
         {
-            // Colorchord magic
-            HandleFrameInfo(&tunernome->end, &tunernome->dd);
-
-            led_t colors[NUM_LEDS] = {{0}};
-
-            switch(tunernome->curTunerMode)
+            case GUITAR_TUNER:
             {
-                case GUITAR_TUNER:
-                {
-                    instrumentTunerMagic(freqBinIdxsGuitar, NUM_GUITAR_STRINGS, colors, sixNoteStringIdxToLedIdx);
-                    break;
-                }
-                case VIOLIN_TUNER:
-                {
-                    instrumentTunerMagic(freqBinIdxsViolin, NUM_VIOLIN_STRINGS, colors, fourNoteStringIdxToLedIdx);
-                    break;
-                }
-                case UKULELE_TUNER:
+                instrumentTunerMagic(freqBinIdxsGuitar, NUM_GUITAR_STRINGS, colors, sixNoteStringIdxToLedIdx);
+                break;
+            }
+            case VIOLIN_TUNER:
+            {
+                instrumentTunerMagic(freqBinIdxsViolin, NUM_VIOLIN_STRINGS, colors, fourNoteStringIdxToLedIdx);
+                break;
+            }
+            case UKULELE_TUNER:
+            {
+                instrumentTunerMagic(freqBinIdxsUkulele, NUM_UKULELE_STRINGS, colors, fourNoteStringIdxToLedIdx);
+                break;
+            }
+            case BANJO_TUNER:
+            {
+                instrumentTunerMagic(freqBinIdxsBanjo, NUM_BANJO_STRINGS, colors, fiveNoteStringIdxToLedIdx);
+                break;
+            }
+            case MAX_GUITAR_MODES:
+                break;
+            case SEMITONE_0:
+            case SEMITONE_1:
+            case SEMITONE_2:
+            case SEMITONE_3:
+            case SEMITONE_4:
+            case SEMITONE_5:
+            case SEMITONE_6:
+            case SEMITONE_7:
+            case SEMITONE_8:
+            case SEMITONE_9:
+            case SEMITONE_10:
+            case SEMITONE_11:
+            case LISTENING:
+            default:
+            {
+                for(uint8_t semitone = 0; semitone < NUM_SEMITONES; semitone++)
                 {
-                    instrumentTunerMagic(freqBinIdxsUkulele, NUM_UKULELE_STRINGS, colors, fourNoteStringIdxToLedIdx);
-                    break;
+                    // uint8_t semitoneIdx = (tunernome->curTunerMode - SEMITONE_0) * 2;
+                    uint8_t semitoneIdx = semitone * 2;
+                    // Pick out the current magnitude and filter it
+                    tunernome->semitone_intensity_filt[semitone] = (getSemiMagnitude(semitoneIdx + CHROMATIC_OFFSET) +
+                            tunernome->semitone_intensity_filt[semitone]) -
+                            (tunernome->semitone_intensity_filt[semitone] >> 5);
+
+                    // Pick out the difference around current magnitude and filter it too
+                    tunernome->semitone_diff_filt[semitone] = (getSemiDiffAround(semitoneIdx + CHROMATIC_OFFSET) +
+                            tunernome->semitone_diff_filt[semitone]) -
+                            (tunernome->semitone_diff_filt[semitone] >> 5);
+
+
+                    // This is the magnitude of the target frequency bin, cleaned up
+                    tunernome->intensity[semitone] = (tunernome->semitone_intensity_filt[semitone] >> SENSITIVITY) -
+                                                     40; // drop a baseline.
+                    tunernome->intensity[semitone] = CLAMP(tunernome->intensity[semitone], 0, 255);
+
+                    //This is the tonal difference. You "calibrate" out the intensity.
+                    tunernome->tonalDiff[semitone] = (tunernome->semitone_diff_filt[semitone] >> SENSITIVITY) * 200 /
+                                                     (tunernome->intensity[semitone] + 1);
                 }
-                case BANJO_TUNER:
+
+                // tonal diff is -32768 to 32767. if its within -10 to 10 (now defined as TONAL_DIFF_IN_TUNE_DEVIATION), it's in tune.
+                // positive means too sharp, negative means too flat
+                // intensity is how 'loud' that frequency is, 0 to 255. you'll have to play around with values
+                int32_t red, grn, blu;
+                // Is the note in tune, i.e. is the magnitude difference in surrounding bins small?
+                if( (ABS(tunernome->tonalDiff[tunernome->curTunerMode - SEMITONE_0]) < TONAL_DIFF_IN_TUNE_DEVIATION) )
                 {
-                    instrumentTunerMagic(freqBinIdxsBanjo, NUM_BANJO_STRINGS, colors, fiveNoteStringIdxToLedIdx);
-                    break;
+                    // Note is in tune, make it white
+                    red = 255;
+                    grn = 255;
+                    blu = 255;
                 }
-                case MAX_GUITAR_MODES:
-                    break;
-                case SEMITONE_0:
-                case SEMITONE_1:
-                case SEMITONE_2:
-                case SEMITONE_3:
-                case SEMITONE_4:
-                case SEMITONE_5:
-                case SEMITONE_6:
-                case SEMITONE_7:
-                case SEMITONE_8:
-                case SEMITONE_9:
-                case SEMITONE_10:
-                case SEMITONE_11:
-                case LISTENING:
-                default:
+                else
                 {
-                    for(uint8_t semitone = 0; semitone < NUM_SEMITONES; semitone++)
-                    {
-                        // uint8_t semitoneIdx = (tunernome->curTunerMode - SEMITONE_0) * 2;
-                        uint8_t semitoneIdx = semitone * 2;
-                        // Pick out the current magnitude and filter it
-                        tunernome->semitone_intensity_filt[semitone] = (getSemiMagnitude(semitoneIdx + CHROMATIC_OFFSET) +
-                                tunernome->semitone_intensity_filt[semitone]) -
-                                (tunernome->semitone_intensity_filt[semitone] >> 5);
-
-                        // Pick out the difference around current magnitude and filter it too
-                        tunernome->semitone_diff_filt[semitone] = (getSemiDiffAround(semitoneIdx + CHROMATIC_OFFSET) +
-                                tunernome->semitone_diff_filt[semitone]) -
-                                (tunernome->semitone_diff_filt[semitone] >> 5);
-
-
-                        // This is the magnitude of the target frequency bin, cleaned up
-                        tunernome->intensity[semitone] = (tunernome->semitone_intensity_filt[semitone] >> SENSITIVITY) -
-                                                         40; // drop a baseline.
-                        tunernome->intensity[semitone] = CLAMP(tunernome->intensity[semitone], 0, 255);
-
-                        //This is the tonal difference. You "calibrate" out the intensity.
-                        tunernome->tonalDiff[semitone] = (tunernome->semitone_diff_filt[semitone] >> SENSITIVITY) * 200 /
-                                                         (tunernome->intensity[semitone] + 1);
-                    }
-
-                    // tonal diff is -32768 to 32767. if its within -10 to 10 (now defined as TONAL_DIFF_IN_TUNE_DEVIATION), it's in tune.
-                    // positive means too sharp, negative means too flat
-                    // intensity is how 'loud' that frequency is, 0 to 255. you'll have to play around with values
-                    int32_t red, grn, blu;
-                    // Is the note in tune, i.e. is the magnitude difference in surrounding bins small?
-                    if( (ABS(tunernome->tonalDiff[tunernome->curTunerMode - SEMITONE_0]) < TONAL_DIFF_IN_TUNE_DEVIATION) )
+                    // Check if the note is sharp or flat
+                    if( tunernome->tonalDiff[tunernome->curTunerMode - SEMITONE_0] > 0 )
                     {
-                        // Note is in tune, make it white
+                        // Note too sharp, make it red
                         red = 255;
-                        grn = 255;
-                        blu = 255;
+                        grn = blu = 255 - (tunernome->tonalDiff[tunernome->curTunerMode - SEMITONE_0] - TONAL_DIFF_IN_TUNE_DEVIATION) * 15;
                     }
                     else
                     {
-                        // Check if the note is sharp or flat
-                        if( tunernome->tonalDiff[tunernome->curTunerMode - SEMITONE_0] > 0 )
-                        {
-                            // Note too sharp, make it red
-                            red = 255;
-                            grn = blu = 255 - (tunernome->tonalDiff[tunernome->curTunerMode - SEMITONE_0] - TONAL_DIFF_IN_TUNE_DEVIATION) * 15;
-                        }
-                        else
-                        {
-                            // Note too flat, make it blue
-                            blu = 255;
-                            grn = red = 255 - (-(tunernome->tonalDiff[tunernome->curTunerMode - SEMITONE_0] + TONAL_DIFF_IN_TUNE_DEVIATION)) * 15;
-                        }
-
-                        // Make sure LED output isn't more than 255
-                        red = CLAMP(red, INT_MIN, 255);
-                        grn = CLAMP(grn, INT_MIN, 255);
-                        blu = CLAMP(blu, INT_MIN, 255);
+                        // Note too flat, make it blue
+                        blu = 255;
+                        grn = red = 255 - (-(tunernome->tonalDiff[tunernome->curTunerMode - SEMITONE_0] + TONAL_DIFF_IN_TUNE_DEVIATION)) * 15;
                     }
 
-                    // Scale each LED's brightness by the filtered intensity for that bin
-                    red = (red >> 3 ) * ( tunernome->intensity[tunernome->curTunerMode - SEMITONE_0] >> 3);
-                    grn = (grn >> 3 ) * ( tunernome->intensity[tunernome->curTunerMode - SEMITONE_0] >> 3);
-                    blu = (blu >> 3 ) * ( tunernome->intensity[tunernome->curTunerMode - SEMITONE_0] >> 3);
+                    // Make sure LED output isn't more than 255
+                    red = CLAMP(red, INT_MIN, 255);
+                    grn = CLAMP(grn, INT_MIN, 255);
+                    blu = CLAMP(blu, INT_MIN, 255);
+                }
 
-                    // Set the LED, ensure each channel is between 0 and 255
-                    uint32_t i;
-                    for (i = 0; i < NUM_GUITAR_STRINGS; i++)
-                    {
-                        colors[i].r = CLAMP(red, 0, 255);
-                        colors[i].g = CLAMP(grn, 0, 255);
-                        colors[i].b = CLAMP(blu, 0, 255);
-                    }
+                // Scale each LED's brightness by the filtered intensity for that bin
+                red = (red >> 3 ) * ( tunernome->intensity[tunernome->curTunerMode - SEMITONE_0] >> 3);
+                grn = (grn >> 3 ) * ( tunernome->intensity[tunernome->curTunerMode - SEMITONE_0] >> 3);
+                blu = (blu >> 3 ) * ( tunernome->intensity[tunernome->curTunerMode - SEMITONE_0] >> 3);
 
-                    break;
-                } // default:
-            } // switch(tunernome->curTunerMode)
+                // Set the LED, ensure each channel is between 0 and 255
+                uint32_t i;
+                for (i = 0; i < NUM_GUITAR_STRINGS; i++)
+                {
+                    colors[i].r = CLAMP(red, 0, 255);
+                    colors[i].g = CLAMP(grn, 0, 255);
+                    colors[i].b = CLAMP(blu, 0, 255);
+                }
 
-            if(LISTENING != tunernome->curTunerMode)
-            {
-                // Draw the LEDs
-                setLeds(colors, NUM_LEDS);
-            }
-            // Reset the sample count
-            tunernome->audioSamplesProcessed = 0;
+                break;
+            } // default:
+        } // switch(tunernome->curTunerMode)
+
+        if(LISTENING != tunernome->curTunerMode)
+        {
+            // Draw the LEDs
+            setLeds(colors, NUM_LEDS);
         }
     } // if(tunernome-> mode == TN_TUNER)
 }
@@ -19,7 +19,7 @@
 #include "picross_select.h"
 #include "bresenham.h"
 
-#include "picross_music.h"
+#include "spiffs_song.h"
 // #include "picross_consts.h"
 
 //==============================================================================
@@ -27,6 +27,8 @@
 //==============================================================================
 void picrossUserInput(int64_t elapsedUs);
 void picrossCheckLevel(void);
+void picrossRecountLevel(void);
+bool spaceIsWrong(uint8_t x, uint8_t y);
 void picrossSetupPuzzle(bool cont);
 void picrossCalculateHoverHint(void);
 void setCompleteLevelFromWSG(wsg_t* puzz);
@@ -48,6 +50,7 @@ void enterSpace(uint8_t x,uint8_t y,picrossSpaceType_t newSpace);
 bool toggleTentativeMark(uint8_t x,uint8_t y);
 bool setTentativeMark(uint8_t x,uint8_t y, bool mark);
 void picrossVictoryLEDs(uint32_t tElapsedUs, uint32_t arg, bool reset);
+void picrossPlayBgm(const char* fname);
 //==============================================================================
 // Variables
 //==============================================================================
@@ -68,6 +71,9 @@ void picrossStartGame(display_t* disp, font_t* mmFont, picrossLevelDef_t* select
 {
     //calloc is 0'd and malloc leaves memory uninitialized. I dont know which to use so im not gonna touch it, and doing things once on load can be slower.
     p = calloc(1, sizeof(picrossGame_t));
+    //make sure the level's images are loaded before copying it. Nothing else is loaded while the game runs, so they won't be freed.
+    getPicrossPuzzleWsg(selectedLevel);
+    getPicrossSolvedWsg(selectedLevel);
     p->selectedLevel =*selectedLevel;
     p->currentPhase = PICROSS_SOLVING;
     p->d = disp;
@@ -155,8 +161,7 @@ void picrossStartGame(display_t* disp, font_t* mmFont, picrossLevelDef_t* select
 
 
     //BG music
-    buzzer_stop();
-    buzzer_play_bgm(&picross_music_bg);
+    picrossPlayBgm("picross_music_bg.sng");
 
     //Setup level
     picrossSetupPuzzle(cont);
@@ -251,6 +256,7 @@ void picrossSetupPuzzle(bool cont)
     //fontShiftLeft = p->hont_font->w
 
     //Check the level immediately, in case there are any empty rows or columns whose hints we need to gray out at the start
+    picrossRecountLevel();
     picrossCheckLevel();
 }
 
@@ -298,6 +304,7 @@ picrossHint_t newHintFromPuzzle(uint8_t index, bool isRow, picrossSpaceType_t so
     t.complete = false;
     t.filledIn = false;
     t.correct = false;
+    t.needsCheck = true;
     t.isRow = isRow;
     t.index = index;
     
@@ -420,11 +427,10 @@ void picrossGameLoop(int64_t elapsedUs)
     //You won! Only called once, since you cant go from win->solving without resetting everything (ie: menu and back)
     if(p->previousPhase == PICROSS_SOLVING && p->currentPhase == PICROSS_YOUAREWIN)
     {
-        buzzer_stop();
         if(p->selectedLevel.index == 29){
-            buzzer_play_bgm(&picross_music_rick);
+            picrossPlayBgm("picross_music_rick.sng");
         }else{
-            buzzer_play_bgm(&picross_music_win);
+            picrossPlayBgm("picross_music_win.sng");
         }
 
         //Unsave progress. Hides "current" in the main menu. we dont need to zero-out the actual data that will just happen when we load a new level.
@@ -447,37 +453,26 @@ void picrossGameLoop(int64_t elapsedUs)
 void picrossCheckLevel()
 {
     //Update if the puzzle is filled in, which we use to grey-out hints when drawing them.
-    //if performance is bad, lets just cut this feature.
+    //Only the rows and columns that changed since the last check need to be looked at again.
     for(int i = 0;i<p->puzzle->height;i++)
     {
-        hintIsFilledIn(&p->puzzle->rowHints[i]);
+        if(p->puzzle->rowHints[i].needsCheck)
+        {
+            hintIsFilledIn(&p->puzzle->rowHints[i]);
+        }
     }
     for(int i = 0;i<p->puzzle->width;i++)
     {
-        hintIsFilledIn(&p->puzzle->colHints[i]);
+        if(p->puzzle->colHints[i].needsCheck)
+        {
+            hintIsFilledIn(&p->puzzle->colHints[i]);
+        }
     }
 
-    //we only need to do this if the puzzle is completely filled in, and we already checked that above. 
-
-    //check if the puzzle is correctly completed.
-    for(int c = 0;c<p->puzzle->width;c++)
+    //check if the puzzle is correctly completed. enterSpace keeps count of the wrong spaces, so we don't have to compare the whole grid.
+    if(p->puzzle->wrongSpaces > 0)
     {
-        for(int r = 0;r<p->puzzle->height;r++)//flipped
-        {
-            if(p->puzzle->level[c][r] == SPACE_EMPTY || p->puzzle->level[c][r] == SPACE_MARKEMPTY)
-            {
-                if(p->puzzle->completeLevel[c][r] != SPACE_EMPTY)
-                {
-                    return;
-                }
-            }else//if space == SPACE_FILLED (we aren't using filled-hints so lets not bother specific if for now)
-            {
-                if(p->puzzle->completeLevel[c][r] != SPACE_FILLED)
-                {
-                    return;
-                }
-            }
-        }
+        return;
     }
 
     //Check level by clues.
@@ -510,6 +505,44 @@ void picrossCheckLevel()
     
 }
 
+//Counts the wrong spaces in the whole level, and marks every hint to be checked.
+//Call this after the level is set without enterSpace, like when it's cleared or loaded.
+void picrossRecountLevel()
+{
+    p->puzzle->wrongSpaces = 0;
+    for(int c = 0;c<p->puzzle->width;c++)
+    {
+        for(int r = 0;r<p->puzzle->height;r++)//flipped
+        {
+            if(spaceIsWrong(c,r))
+            {
+                p->puzzle->wrongSpaces++;
+            }
+        }
+    }
+
+    for(int i = 0;i<p->puzzle->height;i++)
+    {
+        p->puzzle->rowHints[i].needsCheck = true;
+    }
+    for(int i = 0;i<p->puzzle->width;i++)
+    {
+        p->puzzle->colHints[i].needsCheck = true;
+    }
+}
+
+//Returns true if a space in the level doesn't match the solution. Marked-empty spaces count as empty.
+bool spaceIsWrong(uint8_t x, uint8_t y)
+{
+    if(p->puzzle->level[x][y] == SPACE_EMPTY || p->puzzle->level[x][y] == SPACE_MARKEMPTY)
+    {
+        return p->puzzle->completeLevel[x][y] != SPACE_EMPTY;
+    }else//if space == SPACE_FILLED (we aren't using filled-hints so lets not bother specific if for now)
+    {
+        return p->puzzle->completeLevel[x][y] != SPACE_FILLED;
+    }
+}
+
 // bool hintsMatch(picrossHint_t a, picrossHint_t b)
 // {
 //     for(int i = 0;i<PICROSS_MAX_HINTCOUNT;i++)
@@ -565,6 +598,7 @@ bool hintIsFilledIn(picrossHint_t* hint)
         }
     }
     hint->filledIn = isFilledIn;
+    hint->needsCheck = false;
 
     uint8_t skippedHints = 0;
     for (uint8_t hintIndex = 0; hintIndex < PICROSS_MAX_HINTCOUNT; hintIndex++)
@@ -983,7 +1017,21 @@ bool setTentativeMark(uint8_t x, uint8_t y, bool mark){
     //this gets called frequently even if newSpace is current. 
     if(p->puzzle->level[x][y] != newSpace)
     {
+        //keep the count of wrong spaces up to date, so checking for a win doesn't need the whole grid
+        bool wasWrong = spaceIsWrong(x,y);
         p->puzzle->level[x][y] = newSpace;
+        if(wasWrong != spaceIsWrong(x,y))
+        {
+            if(wasWrong)
+            {
+                p->puzzle->wrongSpaces--;
+            }else
+            {
+                p->puzzle->wrongSpaces++;
+            }
+        }
+        p->puzzle->rowHints[y].needsCheck = true;
+        p->puzzle->colHints[x].needsCheck = true;
         //if SHOW HINTS is active
         //showing hints for the "mark as empty" felt wrong. its a note, not a commitment, and you can use it to remember locations too.
         if(newSpace == SPACE_FILLED && newSpace != p->puzzle->completeLevel[x][y])
@@ -1598,6 +1646,12 @@ void picrossExitGame(void)
         //set LED's to off.
         setLeds(p->offLEDS, NUM_LEDS);
 
+        //The buzzer is stopped, so the music can be freed
+        if(NULL != p->bgm)
+        {
+            freeSong(p->bgm);
+        }
+
         freeFont(&(p->hintFont));
         freeFont(&(p->UIFont));
         free(p->input);
@@ -1607,6 +1661,26 @@ void picrossExitGame(void)
     }    
 }
 
+/**
+ * @brief Stop the current music, free it, and play a song from SPIFFS
+ * 
+ * @param fname The song to load and play
+ */
+void picrossPlayBgm(const char* fname)
+{
+    buzzer_stop();
+    if(NULL != p->bgm)
+    {
+        freeSong(p->bgm);
+    }
+
+    p->bgm = loadSong(fname);
+    if(NULL != p->bgm)
+    {
+        buzzer_play_bgm(p->bgm);
+    }
+}
+
 ///=====
 // SAVING AND LOADING
 //===========
@@ -5,6 +5,7 @@
 #include "aabb_utils.h"
 #include "picross_select.h"
 #include "led_util.h"
+#include "musical_buzzer.h"
 
 typedef enum
 {
@@ -80,6 +81,7 @@ typedef struct
     bool filledIn;
     bool correct;
     bool complete;
+    bool needsCheck;//set when a space in this row or column changes, cleared by hintIsFilledIn
     bool isRow;
     uint8_t index;
     uint8_t hints[PICROSS_MAX_HINTCOUNT];//have to deal with 'flexible array member'
@@ -93,6 +95,7 @@ typedef struct
     picrossHint_t colHints[PICROSS_MAX_LEVELSIZE];
     picrossSpaceType_t completeLevel[PICROSS_MAX_LEVELSIZE][PICROSS_MAX_LEVELSIZE]; 
     picrossSpaceType_t level[PICROSS_MAX_LEVELSIZE][PICROSS_MAX_LEVELSIZE]; 
+    uint16_t wrongSpaces;//how many spaces in level don't match completeLevel. Kept up to date by enterSpace, so the puzzle is solved when this is 0.
 } picrossPuzzle_t;
 
 typedef struct
@@ -129,6 +132,7 @@ typedef struct
     uint8_t ledAnimCount;//victory dance
     uint32_t animtAccumulated;//victory dance
     bool tentativeMarks[PICROSS_MAX_LEVELSIZE][PICROSS_MAX_LEVELSIZE];
+    song_t* bgm;
 } picrossGame_t;
 
 void picrossStartGame(display_t* disp, font_t* mmFont, picrossLevelDef_t* selectedLevel, bool cont);
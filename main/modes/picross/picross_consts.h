@@ -3,6 +3,9 @@
 #define PICROSS_LEVEL_COUNT 30
 #define PICROSS_MAX_LEVELSIZE 15
 #define PICROSS_MAX_HINTCOUNT 8
+#define PICROSS_SELECT_COLS 5 // Levels per row on the level select screen.
+#define PICROSS_SELECT_ROWS_ON_SCREEN 4 // Rows shown at once on the level select screen. It scrolls to show the rest.
+#define PICROSS_MAX_RESIDENT_LEVELS (PICROSS_SELECT_COLS * PICROSS_SELECT_ROWS_ON_SCREEN + 1) // Levels whose images may be loaded at once. Enough for the levels on the level select screen, and the level being played.
 #define PICROSS_EXTRA_PADDING 10 // actually double the padding we want around.
 #define PICROSS_BORDER_COLOR c333
 #define PICROSS_MOD5_COLOR c541//c441 is yellow. c541 is dark orange.
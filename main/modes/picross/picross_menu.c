@@ -15,7 +15,6 @@
 #include "mode_main_menu.h"
 #include "picross_tutorial.h"
 #include "picross_consts.h"
-#include "picross_music.h"
 //==============================================================================
 // Enums & Structs
 //==============================================================================
@@ -40,6 +39,8 @@ typedef struct
     uint16_t mainMenuPos;
     uint16_t settingsPos;
     int32_t options;//bit 0: hints
+    uint32_t levelUseFrame;//incremented every frame, to track when a level's images were last used
+    uint8_t residentLevels;//how many levels have images loaded
 } picrossMenu_t;
 //==============================================================================
 // Function Prototypes
@@ -53,6 +54,9 @@ void picrossTouchCb(touch_event_t* evt);
 void loadLevels(void);
 void picrossMainMenuCb(const char* opt);
 void picrossMenuOptionsCb(const char* opt);
+void usePicrossLevel(picrossLevelDef_t* level);
+void loadPicrossLevelWsg(picrossLevelDef_t* level, char* name, wsg_t* wsg);
+void freePicrossLevelWsgs(picrossLevelDef_t* level);
 
 //==============================================================================
 // Variables
@@ -168,9 +172,7 @@ void picrossExitMode(void)
     //Free WSG's
     for(int i = 0;i<PICROSS_LEVEL_COUNT;i++)
     {
-        freeWsg(&pm->levels[i].levelWSG);
-        freeWsg(&pm->levels[i].completedWSG);
-
+        freePicrossLevelWsgs(&pm->levels[i]);
     }
     picrossExitLevelSelect();//this doesnt actually get called as we go in and out of levelselect (because it breaks everything), so lets call it now
     deinitMeleeMenu(pm->menu);
@@ -180,7 +182,8 @@ void picrossExitMode(void)
 }
 
 /**
- * @brief Loads in all of the level files. Each level is made up of a black/white data file, and a completed color version.
+ * @brief Sets up all of the levels. Each level is made up of a black/white data file, and a completed color version.
+ * The files aren't loaded here, they are loaded when they are first used by getPicrossPuzzleWsg() and getPicrossSolvedWsg().
  * The black.white version can be white or transparent for empty spaces, and any other pixel value for filled spaces.
  * Clues and level size is determined by the images, but only 10x10 is currently supported. It will completely break if it's not 10x10 right now.
  * I would like to support any size that is <=15, including non-square puzzles. First is getting them to render and not write out of bounds, second is scaling and placing the puzzle on screen correctly.
@@ -191,134 +194,131 @@ void loadLevels()
     //LEVEL SETUP AREA
     //DACVAK JUST SEARCH FOR "DACVAK" TO FIND THIS
 
-    //Todo: we can cut our memory use down by about 2/3 if we use a naming convention and the titles to pull the wsg names.
-    //snprint into loadWsg, i think. Make sure it all works with, say, apostophes and spaces.
-
     // pm->levels[0].title = "Test";
-    // loadWsg("TEMP.wsg", &pm->levels[0].levelWSG);
-    // loadWsg("TEMP.wsg", &pm->levels[0].completedWSG);
+    // pm->levels[0].puzzleFile = "TEMP.wsg";
+    // pm->levels[0].solvedFile = "TEMP.wsg";
 
     // any entry with lowercase names is testing data. CamelCase names are good to go. This is not convention, just nature of dac sending me files vs. my testing ones.
     pm->levels[0].title = "Pi";
-    loadWsg("Pi_PZL.wsg", &pm->levels[0].levelWSG);//5x5
-    loadWsg("Pi_SLV.wsg", &pm->levels[0].completedWSG);
+    pm->levels[0].puzzleFile = "Pi_PZL.wsg";//5x5
+    pm->levels[0].solvedFile = "Pi_SLV.wsg";
 
     pm->levels[1].title = "Penguin";
-    loadWsg("Penguin_PZL.wsg", &pm->levels[1].levelWSG);//5x5
-    loadWsg("Penguin_SLV.wsg", &pm->levels[1].completedWSG);
+    pm->levels[1].puzzleFile = "Penguin_PZL.wsg";//5x5
+    pm->levels[1].solvedFile = "Penguin_SLV.wsg";
 
     pm->levels[2].title = "Twenty Years";
-    loadWsg("Twenty_PZL.wsg", &pm->levels[2].levelWSG);//5x7
-    loadWsg("Twenty_SLV.wsg", &pm->levels[2].completedWSG);
+    pm->levels[2].puzzleFile = "Twenty_PZL.wsg";//5x7
+    pm->levels[2].solvedFile = "Twenty_SLV.wsg";
 
     pm->levels[3].title = "A Lie";
-    loadWsg("Cake_PZL.wsg", &pm->levels[3].levelWSG);//5x10
-    loadWsg("Cake_SLV.wsg", &pm->levels[3].completedWSG);
+    pm->levels[3].puzzleFile = "Cake_PZL.wsg";//5x10
+    pm->levels[3].solvedFile = "Cake_SLV.wsg";
 
     pm->levels[4].title = "XP Bliss";
-    loadWsg("Bliss.wsg", &pm->levels[4].levelWSG);//5x10
-    loadWsg("Bliss_c.wsg", &pm->levels[4].completedWSG);
+    pm->levels[4].puzzleFile = "Bliss.wsg";//5x10
+    pm->levels[4].solvedFile = "Bliss_c.wsg";
 
     pm->levels[5].title = "Discord Notification";
-    loadWsg("Discord_PZL.wsg", &pm->levels[5].levelWSG);//10x10
-    loadWsg("Discord_SLV.wsg", &pm->levels[5].completedWSG);
+    pm->levels[5].puzzleFile = "Discord_PZL.wsg";//10x10
+    pm->levels[5].solvedFile = "Discord_SLV.wsg";
 
     pm->levels[6].title = "Snare Drum";
-    loadWsg("Snare_Drum_PZL.wsg", &pm->levels[6].levelWSG);//10x10
-    loadWsg("Snare_Drum_SLV.wsg", &pm->levels[6].completedWSG);
+    pm->levels[6].puzzleFile = "Snare_Drum_PZL.wsg";//10x10
+    pm->levels[6].solvedFile = "Snare_Drum_SLV.wsg";
 
     pm->levels[7].title = "Sus";//"Sus" or just "Among Us"
-    loadWsg("Among_PZL.wsg", &pm->levels[7].levelWSG);//5x5
-    loadWsg("Among_SLV.wsg", &pm->levels[7].completedWSG);
+    pm->levels[7].puzzleFile = "Among_PZL.wsg";//5x5
+    pm->levels[7].solvedFile = "Among_SLV.wsg";
 
     pm->levels[8].title = "Danny";
-    loadWsg("Danny_PZL.wsg", &pm->levels[8].levelWSG);//10x10
-    loadWsg("Danny_SLV.wsg", &pm->levels[8].completedWSG);
+    pm->levels[8].puzzleFile = "Danny_PZL.wsg";//10x10
+    pm->levels[8].solvedFile = "Danny_SLV.wsg";
 
     pm->levels[9].title = "Controller";
-    loadWsg("Controller_PZL.wsg", &pm->levels[9].levelWSG);//10x10
-    loadWsg("Controller_SLV.wsg", &pm->levels[9].completedWSG);
+    pm->levels[9].puzzleFile = "Controller_PZL.wsg";//10x10
+    pm->levels[9].solvedFile = "Controller_SLV.wsg";
 
     pm->levels[10].title = "Cat";
-    loadWsg("Cat_PZL.wsg", &pm->levels[10].levelWSG);//10x10
-    loadWsg("Cat_SLV.wsg", &pm->levels[10].completedWSG);
+    pm->levels[10].puzzleFile = "Cat_PZL.wsg";//10x10
+    pm->levels[10].solvedFile = "Cat_SLV.wsg";
 
     pm->levels[11].title = "Pear";//todo: move this lower, it can be tricky ish.
-    loadWsg("Pear_PZL.wsg", &pm->levels[11].levelWSG);//10x10
-    loadWsg("Pear_SLV.wsg", &pm->levels[11].completedWSG);
+    pm->levels[11].puzzleFile = "Pear_PZL.wsg";//10x10
+    pm->levels[11].solvedFile = "Pear_SLV.wsg";
     
     pm->levels[12].title = "Cherry";
-    loadWsg("Cherry_PZL.wsg", &pm->levels[12].levelWSG);//10x10
-    loadWsg("Cherry_SLV.wsg", &pm->levels[12].completedWSG);
+    pm->levels[12].puzzleFile = "Cherry_PZL.wsg";//10x10
+    pm->levels[12].solvedFile = "Cherry_SLV.wsg";
 
     pm->levels[13].title = "Magnet";
-    loadWsg("Magnet_PZL.wsg", &pm->levels[13].levelWSG);//10x10
-    loadWsg("Magnet_SLV.wsg", &pm->levels[13].completedWSG);
+    pm->levels[13].puzzleFile = "Magnet_PZL.wsg";//10x10
+    pm->levels[13].solvedFile = "Magnet_SLV.wsg";
 
     pm->levels[14].title = "Strawberry";
-    loadWsg("Strawberry_PZL.wsg", &pm->levels[14].levelWSG);//10x10
-    loadWsg("Strawberry_SLV.wsg", &pm->levels[14].completedWSG);
+    pm->levels[14].puzzleFile = "Strawberry_PZL.wsg";//10x10
+    pm->levels[14].solvedFile = "Strawberry_SLV.wsg";
 
     pm->levels[15].title = "Frog";
-    loadWsg("Frog_PZL.wsg", &pm->levels[15].levelWSG);
-    loadWsg("Frog_SLV.wsg", &pm->levels[15].completedWSG);
+    pm->levels[15].puzzleFile = "Frog_PZL.wsg";
+    pm->levels[15].solvedFile = "Frog_SLV.wsg";
 
     pm->levels[16].title = "Galaga Bug";
-    loadWsg("Galaga_PZL.wsg", &pm->levels[16].levelWSG);//10x10
-    loadWsg("Galaga_SLV.wsg", &pm->levels[16].completedWSG);
+    pm->levels[16].puzzleFile = "Galaga_PZL.wsg";//10x10
+    pm->levels[16].solvedFile = "Galaga_SLV.wsg";
 
     pm->levels[17].title = "Green Shell";
-    loadWsg("GreenShell_PZL.wsg", &pm->levels[17].levelWSG);//10x10
-    loadWsg("GreenShell_SLV.wsg", &pm->levels[17].completedWSG);
+    pm->levels[17].puzzleFile = "GreenShell_PZL.wsg";//10x10
+    pm->levels[17].solvedFile = "GreenShell_SLV.wsg";
 
     pm->levels[18].title = "Zelda";
-    loadWsg("Link_PZL.wsg", &pm->levels[18].levelWSG);//10x10
-    loadWsg("Link_SLV.wsg", &pm->levels[18].completedWSG);
+    pm->levels[18].puzzleFile = "Link_PZL.wsg";//10x10
+    pm->levels[18].solvedFile = "Link_SLV.wsg";
 
     pm->levels[19].title = "Lil' B";
-    loadWsg("LilB_PZL.wsg", &pm->levels[19].levelWSG);//15x15
-    loadWsg("LilB_SLV.wsg", &pm->levels[19].completedWSG);
+    pm->levels[19].puzzleFile = "LilB_PZL.wsg";//15x15
+    pm->levels[19].solvedFile = "LilB_SLV.wsg";
 
     pm->levels[20].title = "Goomba";
-    loadWsg("Goomba_PZL.wsg", &pm->levels[20].levelWSG);//15x15
-    loadWsg("Goomba_SLV.wsg", &pm->levels[20].completedWSG);
+    pm->levels[20].puzzleFile = "Goomba_PZL.wsg";//15x15
+    pm->levels[20].solvedFile = "Goomba_SLV.wsg";
 
     pm->levels[21].title = "Mouse";
-    loadWsg("Mouse_PZL.wsg", &pm->levels[21].levelWSG);//15x15
-    loadWsg("Mouse_SLV.wsg", &pm->levels[21].completedWSG);
+    pm->levels[21].puzzleFile = "Mouse_PZL.wsg";//15x15
+    pm->levels[21].solvedFile = "Mouse_SLV.wsg";
 
     pm->levels[22].title = "Note";
-    loadWsg("Note_PZL.wsg", &pm->levels[22].levelWSG);//15x15
-    loadWsg("Note_SLV.wsg", &pm->levels[22].completedWSG);
+    pm->levels[22].puzzleFile = "Note_PZL.wsg";//15x15
+    pm->levels[22].solvedFile = "Note_SLV.wsg";
 
     pm->levels[23].title = "Big Mouth Billy";
-    loadWsg("bass_PZL.wsg", &pm->levels[23].levelWSG);//15x15
-    loadWsg("bass_SLV.wsg", &pm->levels[23].completedWSG);
+    pm->levels[23].puzzleFile = "bass_PZL.wsg";//15x15
+    pm->levels[23].solvedFile = "bass_SLV.wsg";
 
     pm->levels[24].title = "Fountain Pen";
-    loadWsg("Fountain_Pen_PZL.wsg", &pm->levels[24].levelWSG);//15x15
-    loadWsg("Fountain_Pen_SLV.wsg", &pm->levels[24].completedWSG);
+    pm->levels[24].puzzleFile = "Fountain_Pen_PZL.wsg";//15x15
+    pm->levels[24].solvedFile = "Fountain_Pen_SLV.wsg";
 
     pm->levels[25].title = "Power Plug";
-    loadWsg("Plug_PZL.wsg", &pm->levels[25].levelWSG);//15x15 - This one is on the harder side of things.
-    loadWsg("Plug_SLV.wsg", &pm->levels[25].completedWSG);
+    pm->levels[25].puzzleFile = "Plug_PZL.wsg";//15x15 - This one is on the harder side of things.
+    pm->levels[25].solvedFile = "Plug_SLV.wsg";
 
     pm->levels[26].title = "Blender";
-    loadWsg("Blender_PZL.wsg", &pm->levels[26].levelWSG);//15x15
-    loadWsg("Blender_SLV.wsg", &pm->levels[26].completedWSG);
+    pm->levels[26].puzzleFile = "Blender_PZL.wsg";//15x15
+    pm->levels[26].solvedFile = "Blender_SLV.wsg";
 
     pm->levels[27].title = "Nintendo 64";
-    loadWsg("N64_PZL.wsg", &pm->levels[27].levelWSG);//15x15
-    loadWsg("N64_SLV.wsg", &pm->levels[27].completedWSG);
+    pm->levels[27].puzzleFile = "N64_PZL.wsg";//15x15
+    pm->levels[27].solvedFile = "N64_SLV.wsg";
 
     pm->levels[28].title = "Rocket League";
-    loadWsg("RocketLeague_PZL.wsg", &pm->levels[28].levelWSG);//15x15 - This one is on the harder side of things.
-    loadWsg("RocketLeague_SLV.wsg", &pm->levels[28].completedWSG);
+    pm->levels[28].puzzleFile = "RocketLeague_PZL.wsg";//15x15 - This one is on the harder side of things.
+    pm->levels[28].solvedFile = "RocketLeague_SLV.wsg";
 
     //this has to be the last puzzle.
     pm->levels[29].title = "Never Gonna";//give you up, but title too long for single line.
-    loadWsg("RR_PZL.wsg", &pm->levels[29].levelWSG);//15/15
-    loadWsg("RR_SLV.wsg", &pm->levels[29].completedWSG);
+    pm->levels[29].puzzleFile = "RR_PZL.wsg";//15/15
+    pm->levels[29].solvedFile = "RR_SLV.wsg";
 
     //dont forget to update PICROSS_LEVEL_COUNT (in #define in picross_consts.h) when adding levels.
 
@@ -336,6 +336,7 @@ void loadLevels()
  */
 void picrossMainLoop(int64_t elapsedUs)
 {
+    pm->levelUseFrame++;
     switch(pm->screen)
     {
         case PICROSS_OPTIONS:
@@ -705,6 +706,114 @@ void selectPicrossLevel(picrossLevelDef_t* selectedLevel)
     picrossStartGame(pm->disp, &pm->mmFont, selectedLevel, false);
 }
 
+/**
+ * @brief Get a level's puzzle image, loading it if it isn't loaded yet. The image may be freed the next time
+ * another level's images are loaded, if too many levels are loaded.
+ *
+ * @param level The level to get the puzzle of
+ * @return The puzzle image. Its px is NULL if it couldn't be loaded.
+ */
+wsg_t* getPicrossPuzzleWsg(picrossLevelDef_t* level)
+{
+    usePicrossLevel(level);
+    if(NULL == level->levelWSG.px)
+    {
+        loadPicrossLevelWsg(level, level->puzzleFile, &level->levelWSG);
+    }
+    return &level->levelWSG;
+}
+
+/**
+ * @brief Get a level's solved image, loading it if it isn't loaded yet. The image may be freed the next time
+ * another level's images are loaded, if too many levels are loaded.
+ *
+ * @param level The level to get the solved image of
+ * @return The solved image. Its px is NULL if it couldn't be loaded.
+ */
+wsg_t* getPicrossSolvedWsg(picrossLevelDef_t* level)
+{
+    usePicrossLevel(level);
+    if(NULL == level->completedWSG.px)
+    {
+        loadPicrossLevelWsg(level, level->solvedFile, &level->completedWSG);
+    }
+    return &level->completedWSG;
+}
+
+/**
+ * @brief Note that a level's images are being used. If the level has nothing loaded and too many levels do,
+ * the images of the level that was used longest ago are freed to make room. Levels are drawn top to bottom, so of
+ * the levels last used in the same frame, the last one drawn is freed first. It is the one most likely to have
+ * scrolled off screen.
+ *
+ * @param level The level being used
+ */
+void usePicrossLevel(picrossLevelDef_t* level)
+{
+    level->lastUsed = pm->levelUseFrame;
+
+    if(NULL != level->levelWSG.px || NULL != level->completedWSG.px)
+    {
+        //already resident
+        return;
+    }
+
+    if(pm->residentLevels >= PICROSS_MAX_RESIDENT_LEVELS)
+    {
+        picrossLevelDef_t* oldest = NULL;
+        for(int i = 0;i<PICROSS_LEVEL_COUNT;i++)
+        {
+            picrossLevelDef_t* l = &pm->levels[i];
+            if((NULL != l->levelWSG.px || NULL != l->completedWSG.px) && (NULL == oldest || l->lastUsed <= oldest->lastUsed))
+            {
+                oldest = l;
+            }
+        }
+        freePicrossLevelWsgs(oldest);
+    }
+}
+
+/**
+ * @brief Load one of a level's images. The level is only counted as resident once an image actually loads
+ *
+ * @param level The level the image belongs to
+ * @param name The filename of the image
+ * @param wsg The level's image to load into
+ */
+void loadPicrossLevelWsg(picrossLevelDef_t* level, char* name, wsg_t* wsg)
+{
+    bool wasResident = (NULL != level->levelWSG.px || NULL != level->completedWSG.px);
+    if(loadWsg(name, wsg) && !wasResident)
+    {
+        pm->residentLevels++;
+    }
+}
+
+/**
+ * @brief Free a level's images, if they are loaded
+ *
+ * @param level The level to free the images of. May be NULL
+ */
+void freePicrossLevelWsgs(picrossLevelDef_t* level)
+{
+    if(NULL == level || (NULL == level->levelWSG.px && NULL == level->completedWSG.px))
+    {
+        return;
+    }
+
+    if(NULL != level->levelWSG.px)
+    {
+        freeWsg(&level->levelWSG);
+        level->levelWSG.px = NULL;
+    }
+    if(NULL != level->completedWSG.px)
+    {
+        freeWsg(&level->completedWSG);
+        level->completedWSG.px = NULL;
+    }
+    pm->residentLevels--;
+}
+
 // void returnToLevelSelect()//todo: rename
 // {
 //     //todo: abstract this to function
@@ -21,4 +21,6 @@ void picrossSetSaveFlag(int pos, bool on);
 bool picrossGetSaveFlag(int pos);
 bool picrossGetLoadedSaveFlag(int pos);
 void continueGame(void);
+wsg_t* getPicrossPuzzleWsg(picrossLevelDef_t* level);
+wsg_t* getPicrossSolvedWsg(picrossLevelDef_t* level);
 #endif
\ No newline at end of file
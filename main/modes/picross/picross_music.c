@@ -1,603 +0,0 @@
-#include "picross_music.h"
-
-const song_t picross_music_rick =
-{
-    .notes =
-    {
-        {.note = SILENCE, .timeMs = 663},
-        {.note = B_0, .timeMs = 66},
-        {.note = SILENCE, .timeMs = 66},
-        {.note = A_0, .timeMs = 66},
-        {.note = SILENCE, .timeMs = 199},
-        {.note = B_0, .timeMs = 66},
-        {.note = SILENCE, .timeMs = 66},
-        {.note = A_0, .timeMs = 66},
-        {.note = SILENCE, .timeMs = 66},
-        {.note = F_SHARP_0, .timeMs = 66},
-        {.note = SILENCE, .timeMs = 331},
-        {.note = A_0, .timeMs = 66},
-        {.note = SILENCE, .timeMs = 66},
-        {.note = F_SHARP_0, .timeMs = 66},
-        {.note = SILENCE, .timeMs = 66},
-        {.note = E_0, .timeMs = 66},
-        {.note = SILENCE, .timeMs = 66},
-        {.note = C_SHARP_4, .timeMs = 265},
-        {.note = D_SHARP_2, .timeMs = 265},
-        {.note = C_SHARP_4, .timeMs = 132},
-        {.note = D_SHARP_2, .timeMs = 132},
-        {.note = D_SHARP_4, .timeMs = 265},
-        {.note = G_SHARP_2, .timeMs = 265},
-        {.note = D_SHARP_4, .timeMs = 265},
-        {.note = G_SHARP_3, .timeMs = 265},
-        {.note = F_SHARP_2, .timeMs = 265},
-        {.note = D_SHARP_4, .timeMs = 265},
-        {.note = F_2, .timeMs = 265},
-        {.note = D_SHARP_4, .timeMs = 132},
-        {.note = C_3, .timeMs = 132},
-        {.note = F_4, .timeMs = 265},
-        {.note = A_SHARP_2, .timeMs = 265},
-        {.note = A_SHARP_1, .timeMs = 265},
-        {.note = G_SHARP_4, .timeMs = 132},
-        {.note = F_SHARP_4, .timeMs = 132},
-        {.note = F_4, .timeMs = 265},
-        {.note = C_SHARP_4, .timeMs = 265},
-        {.note = D_SHARP_2, .timeMs = 265},
-        {.note = C_SHARP_4, .timeMs = 132},
-        {.note = D_SHARP_2, .timeMs = 132},
-        {.note = D_SHARP_4, .timeMs = 265},
-        {.note = G_SHARP_2, .timeMs = 265},
-        {.note = D_SHARP_4, .timeMs = 265},
-        {.note = G_SHARP_3, .timeMs = 265},
-        {.note = F_SHARP_2, .timeMs = 265},
-        {.note = G_SHARP_3, .timeMs = 265},
-        {.note = F_2, .timeMs = 66},
-        {.note = SILENCE, .timeMs = 66},
-        {.note = F_2, .timeMs = 66},
-        {.note = SILENCE, .timeMs = 66},
-        {.note = F_2, .timeMs = 132},
-        {.note = C_3, .timeMs = 132},
-        {.note = A_SHARP_2, .timeMs = 265},
-        {.note = SILENCE, .timeMs = 265},
-        {.note = G_SHARP_3, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 33},
-        {.note = G_SHARP_3, .timeMs = 99},
-        {.note = SILENCE, .timeMs = 33},
-        {.note = G_SHARP_3, .timeMs = 132},
-        {.note = A_SHARP_3, .timeMs = 132},
-        {.note = C_SHARP_4, .timeMs = 132},
-        {.note = A_SHARP_3, .timeMs = 132},
-        {.note = C_SHARP_4, .timeMs = 265},
-        {.note = D_SHARP_2, .timeMs = 265},
-        {.note = C_SHARP_4, .timeMs = 132},
-        {.note = D_SHARP_2, .timeMs = 132},
-        {.note = D_SHARP_4, .timeMs = 265},
-        {.note = G_SHARP_2, .timeMs = 265},
-        {.note = D_SHARP_4, .timeMs = 265},
-        {.note = G_SHARP_3, .timeMs = 265},
-        {.note = F_SHARP_2, .timeMs = 265},
-        {.note = D_SHARP_4, .timeMs = 265},
-        {.note = F_2, .timeMs = 265},
-        {.note = D_SHARP_4, .timeMs = 132},
-        {.note = C_3, .timeMs = 132},
-        {.note = F_4, .timeMs = 265},
-        {.note = A_SHARP_2, .timeMs = 265},
-        {.note = SILENCE, .timeMs = 265},
-        {.note = G_SHARP_4, .timeMs = 132},
-        {.note = F_SHARP_4, .timeMs = 132},
-        {.note = F_4, .timeMs = 265},
-        {.note = C_SHARP_4, .timeMs = 265},
-        {.note = D_SHARP_2, .timeMs = 265},
-        {.note = C_SHARP_4, .timeMs = 132},
-        {.note = D_SHARP_2, .timeMs = 132},
-        {.note = D_SHARP_4, .timeMs = 265},
-        {.note = G_SHARP_2, .timeMs = 199},
-        {.note = SILENCE, .timeMs = 66},
-        {.note = D_SHARP_4, .timeMs = 265},
-        {.note = G_SHARP_3, .timeMs = 265},
-        {.note = F_SHARP_2, .timeMs = 265},
-        {.note = G_SHARP_3, .timeMs = 265},
-        {.note = F_2, .timeMs = 66},
-        {.note = SILENCE, .timeMs = 66},
-        {.note = F_2, .timeMs = 66},
-        {.note = SILENCE, .timeMs = 66},
-        {.note = F_2, .timeMs = 132},
-        {.note = C_3, .timeMs = 132},
-        {.note = A_SHARP_2, .timeMs = 265},
-        {.note = A_SHARP_0, .timeMs = 66},
-        {.note = SILENCE, .timeMs = 66},
-        {.note = G_SHARP_0, .timeMs = 66},
-        {.note = SILENCE, .timeMs = 331},
-        {.note = A_SHARP_0, .timeMs = 66},
-        {.note = SILENCE, .timeMs = 66},
-        {.note = G_SHARP_0, .timeMs = 66},
-        {.note = SILENCE, .timeMs = 331},
-        {.note = A_SHARP_1, .timeMs = 265},
-        {.note = F_SHARP_2, .timeMs = 132},
-        {.note = C_SHARP_3, .timeMs = 132},
-        {.note = A_SHARP_3, .timeMs = 265},
-        {.note = C_4, .timeMs = 265},
-        {.note = C_SHARP_4, .timeMs = 132},
-        {.note = A_SHARP_1, .timeMs = 132},
-        {.note = C_SHARP_4, .timeMs = 132},
-        {.note = A_SHARP_2, .timeMs = 132},
-        {.note = D_SHARP_4, .timeMs = 265},
-        {.note = C_4, .timeMs = 265},
-        {.note = G_SHARP_1, .timeMs = 132},
-        {.note = A_SHARP_3, .timeMs = 132},
-        {.note = G_SHARP_3, .timeMs = 265},
-        {.note = D_SHARP_2, .timeMs = 132},
-        {.note = C_3, .timeMs = 132},
-        {.note = SILENCE, .timeMs = 265},
-        {.note = D_SHARP_3, .timeMs = 132},
-        {.note = F_3, .timeMs = 132},
-        {.note = D_SHARP_3, .timeMs = 132},
-        {.note = C_3, .timeMs = 132},
-        {.note = A_SHARP_2, .timeMs = 132},
-        {.note = C_3, .timeMs = 132},
-        {.note = G_SHARP_2, .timeMs = 132},
-        {.note = A_1, .timeMs = 132},
-        {.note = A_SHARP_1, .timeMs = 132},
-        {.note = F_SHARP_2, .timeMs = 132},
-        {.note = A_SHARP_3, .timeMs = 132},
-        {.note = C_SHARP_3, .timeMs = 132},
-        {.note = A_SHARP_3, .timeMs = 265},
-        {.note = C_4, .timeMs = 265},
-        {.note = C_SHARP_4, .timeMs = 265},
-        {.note = A_SHARP_3, .timeMs = 132},
-        {.note = A_SHARP_1, .timeMs = 132},
-        {.note = F_SHARP_2, .timeMs = 132},
-        {.note = A_1, .timeMs = 132},
-        {.note = G_SHARP_3, .timeMs = 132},
-        {.note = E_2, .timeMs = 132},
-        {.note = G_SHARP_4, .timeMs = 66},
-        {.note = G_SHARP_1, .timeMs = 199},
-        {.note = D_SHARP_2, .timeMs = 132},
-        {.note = C_3, .timeMs = 132},
-        {.note = G_SHARP_4, .timeMs = 132},
-        {.note = G_SHARP_3, .timeMs = 132},
-        {.note = D_SHARP_4, .timeMs = 265},
-        {.note = G_1, .timeMs = 132},
-        {.note = D_2, .timeMs = 132},
-        {.note = G_2, .timeMs = 132},
-        {.note = G_SHARP_1, .timeMs = 132},
-        {.note = D_SHARP_2, .timeMs = 132},
-        {.note = G_SHARP_2, .timeMs = 132},
-        {.note = A_1, .timeMs = 132},
-        {.note = E_2, .timeMs = 132},
-        {.note = A_SHARP_1, .timeMs = 132},
-        {.note = F_SHARP_2, .timeMs = 132},
-        {.note = A_SHARP_3, .timeMs = 132},
-        {.note = C_SHARP_3, .timeMs = 132},
-        {.note = A_SHARP_3, .timeMs = 265},
-        {.note = C_4, .timeMs = 265},
-        {.note = C_SHARP_4, .timeMs = 132},
-        {.note = A_SHARP_1, .timeMs = 132},
-        {.note = A_SHARP_3, .timeMs = 132},
-        {.note = A_SHARP_2, .timeMs = 132},
-        {.note = C_SHARP_4, .timeMs = 265},
-        {.note = D_SHARP_4, .timeMs = 265},
-        {.note = G_SHARP_1, .timeMs = 132},
-        {.note = D_SHARP_2, .timeMs = 132},
-        {.note = C_4, .timeMs = 132},
-        {.note = G_SHARP_2, .timeMs = 132},
-        {.note = A_SHARP_3, .timeMs = 132},
-        {.note = C_3, .timeMs = 132},
-        {.note = G_SHARP_3, .timeMs = 265},
-        {.note = D_SHARP_3, .timeMs = 132},
-        {.note = F_3, .timeMs = 132},
-        {.note = D_SHARP_3, .timeMs = 132},
-        {.note = C_3, .timeMs = 132},
-        {.note = A_SHARP_2, .timeMs = 132},
-        {.note = C_3, .timeMs = 132},
-        {.note = G_SHARP_2, .timeMs = 132},
-        {.note = A_1, .timeMs = 132},
-        {.note = A_SHARP_1, .timeMs = 132},
-        {.note = F_SHARP_2, .timeMs = 132},
-        {.note = A_SHARP_3, .timeMs = 132},
-        {.note = C_SHARP_3, .timeMs = 132},
-        {.note = A_SHARP_3, .timeMs = 265},
-        {.note = C_4, .timeMs = 265},
-        {.note = C_SHARP_4, .timeMs = 265},
-        {.note = A_SHARP_3, .timeMs = 132},
-        {.note = A_SHARP_1, .timeMs = 132},
-        {.note = G_SHARP_3, .timeMs = 132},
-        {.note = F_SHARP_2, .timeMs = 132},
-        {.note = A_1, .timeMs = 132},
-        {.note = E_2, .timeMs = 132},
-        {.note = D_SHARP_4, .timeMs = 66},
-        {.note = G_SHARP_1, .timeMs = 199},
-        {.note = D_SHARP_2, .timeMs = 132},
-        {.note = C_3, .timeMs = 132},
-        {.note = D_SHARP_4, .timeMs = 132},
-        {.note = G_SHARP_3, .timeMs = 132},
-        {.note = F_4, .timeMs = 132},
-        {.note = SILENCE, .timeMs = 132},
-        {.note = D_SHARP_4, .timeMs = 132},
-        {.note = F_SHARP_2, .timeMs = 132},
-        {.note = C_SHARP_3, .timeMs = 132},
-        {.note = F_SHARP_3, .timeMs = 132},
-        {.note = F_2, .timeMs = 132},
-        {.note = C_3, .timeMs = 132},
-        {.note = E_2, .timeMs = 132},
-        {.note = B_2, .timeMs = 132},
-        {.note = C_SHARP_4, .timeMs = 265},
-        {.note = D_SHARP_2, .timeMs = 132},
-        {.note = A_SHARP_2, .timeMs = 66},
-        {.note = C_SHARP_4, .timeMs = 66},
-        {.note = F_3, .timeMs = 132},
-        {.note = F_SHARP_3, .timeMs = 132},
-        {.note = F_3, .timeMs = 66},
-        {.note = C_SHARP_4, .timeMs = 66},
-        {.note = A_SHARP_2, .timeMs = 132},
-        {.note = D_SHARP_2, .timeMs = 132},
-        {.note = D_SHARP_1, .timeMs = 132},
-        {.note = D_SHARP_4, .timeMs = 265},
-        {.note = F_4, .timeMs = 265},
-        {.note = C_SHARP_4, .timeMs = 265},
-        {.note = D_SHARP_4, .timeMs = 132},
-        {.note = F_2, .timeMs = 132},
-        {.note = D_SHARP_4, .timeMs = 132},
-        {.note = C_SHARP_3, .timeMs = 132},
-        {.note = D_SHARP_4, .timeMs = 132},
-        {.note = G_SHARP_3, .timeMs = 132},
-        {.note = F_4, .timeMs = 265},
-        {.note = D_SHARP_4, .timeMs = 132},
-        {.note = C_SHARP_3, .timeMs = 132},
-        {.note = F_2, .timeMs = 132},
-        {.note = F_1, .timeMs = 132},
-        {.note = G_SHARP_3, .timeMs = 132},
-        {.note = F_1, .timeMs = 132},
-        {.note = C_2, .timeMs = 132},
-        {.note = G_SHARP_1, .timeMs = 132},
-        {.note = F_SHARP_1, .timeMs = 265},
-        {.note = C_SHARP_2, .timeMs = 132},
-        {.note = G_SHARP_2, .timeMs = 265},
-        {.note = C_SHARP_2, .timeMs = 132},
-        {.note = F_SHARP_1, .timeMs = 265},
-        {.note = A_SHARP_3, .timeMs = 265},
-        {.note = C_4, .timeMs = 265},
-        {.note = C_SHARP_4, .timeMs = 265},
-        {.note = A_SHARP_3, .timeMs = 265},
-        {.note = G_SHARP_1, .timeMs = 265},
-        {.note = D_SHARP_4, .timeMs = 132},
-        {.note = G_SHARP_1, .timeMs = 132},
-        {.note = F_4, .timeMs = 132},
-        {.note = G_SHARP_1, .timeMs = 132},
-        {.note = D_SHARP_4, .timeMs = 530},
-        {.note = G_SHARP_1, .timeMs = 66},
-        {.note = SILENCE, .timeMs = 66},
-        {.note = G_SHARP_1, .timeMs = 66},
-        {.note = SILENCE, .timeMs = 66},
-        {.note = G_SHARP_3, .timeMs = 132},
-        {.note = A_SHARP_3, .timeMs = 132},
-        {.note = C_SHARP_4, .timeMs = 132},
-        {.note = A_SHARP_3, .timeMs = 132},
-        {.note = F_4, .timeMs = 132},
-        {.note = D_SHARP_2, .timeMs = 66},
-        {.note = SILENCE, .timeMs = 66},
-        {.note = D_SHARP_1, .timeMs = 132},
-        {.note = F_4, .timeMs = 132},
-        {.note = D_SHARP_2, .timeMs = 66},
-        {.note = G_2, .timeMs = 66},
-        {.note = D_SHARP_3, .timeMs = 66},
-        {.note = A_SHARP_2, .timeMs = 66},
-        {.note = D_SHARP_4, .timeMs = 265},
-        {.note = G_SHARP_1, .timeMs = 66},
-        {.note = D_SHARP_2, .timeMs = 66},
-        {.note = G_SHARP_2, .timeMs = 66},
-        {.note = SILENCE, .timeMs = 66},
-        {.note = G_SHARP_3, .timeMs = 66},
-        {.note = SILENCE, .timeMs = 199},
-        {.note = G_SHARP_3, .timeMs = 132},
-        {.note = A_SHARP_3, .timeMs = 132},
-        {.note = C_SHARP_4, .timeMs = 66},
-        {.note = F_SHARP_2, .timeMs = 66},
-        {.note = A_SHARP_3, .timeMs = 132},
-        {.note = D_SHARP_4, .timeMs = 132},
-        {.note = F_2, .timeMs = 66},
-        {.note = SILENCE, .timeMs = 66},
-        {.note = F_1, .timeMs = 132},
-        {.note = D_SHARP_4, .timeMs = 132},
-        {.note = A_2, .timeMs = 66},
-        {.note = SILENCE, .timeMs = 66},
-        {.note = A_1, .timeMs = 132},
-        {.note = C_SHARP_4, .timeMs = 132},
-        {.note = A_SHARP_2, .timeMs = 66},
-        {.note = A_SHARP_1, .timeMs = 66},
-        {.note = C_SHARP_2, .timeMs = 66},
-        {.note = A_SHARP_2, .timeMs = 66},
-        {.note = C_4, .timeMs = 132},
-        {.note = A_SHARP_3, .timeMs = 265},
-        {.note = G_SHARP_3, .timeMs = 132},
-        {.note = A_SHARP_3, .timeMs = 132},
-        {.note = C_SHARP_4, .timeMs = 132},
-        {.note = A_SHARP_3, .timeMs = 132},
-        {.note = C_SHARP_4, .timeMs = 132},
-        {.note = D_SHARP_2, .timeMs = 66},
-        {.note = SILENCE, .timeMs = 66},
-        {.note = D_SHARP_1, .timeMs = 66},
-        {.note = SILENCE, .timeMs = 66},
-        {.note = D_SHARP_2, .timeMs = 66},
-        {.note = D_SHARP_3, .timeMs = 66},
-        {.note = D_SHARP_4, .timeMs = 132},
-        {.note = D_SHARP_2, .timeMs = 132},
-        {.note = C_4, .timeMs = 265},
-        {.note = G_SHARP_2, .timeMs = 66},
-        {.note = SILENCE, .timeMs = 66},
-        {.note = A_SHARP_3, .timeMs = 132},
-        {.note = G_SHARP_3, .timeMs = 132},
-        {.note = G_SHARP_2, .timeMs = 66},
-        {.note = SILENCE, .timeMs = 66},
-        {.note = G_SHARP_1, .timeMs = 66},
-        {.note = SILENCE, .timeMs = 66},
-        {.note = F_SHARP_2, .timeMs = 66},
-        {.note = F_SHARP_1, .timeMs = 66},
-        {.note = G_SHARP_3, .timeMs = 265},
-        {.note = D_SHARP_4, .timeMs = 132},
-        {.note = F_1, .timeMs = 66},
-        {.note = F_2, .timeMs = 66},
-        {.note = A_2, .timeMs = 132},
-        {.note = SILENCE, .timeMs = 132},
-        {.note = C_SHARP_4, .timeMs = 530},
-        {.note = A_SHARP_0, .timeMs = 66},
-        {.note = F_1, .timeMs = 66},
-        {.note = A_SHARP_1, .timeMs = 66},
-        {.note = D_2, .timeMs = 66},
-        {.note = A_SHARP_2, .timeMs = 66},
-        {.note = SILENCE, .timeMs = 199},
-        {.note = G_SHARP_3, .timeMs = 132},
-        {.note = A_SHARP_3, .timeMs = 132},
-        {.note = C_SHARP_4, .timeMs = 132},
-        {.note = A_SHARP_3, .timeMs = 132},
-        {.note = F_4, .timeMs = 132},
-        {.note = D_SHARP_2, .timeMs = 66},
-        {.note = SILENCE, .timeMs = 66},
-        {.note = D_SHARP_1, .timeMs = 132},
-        {.note = F_4, .timeMs = 132},
-        {.note = D_SHARP_2, .timeMs = 66},
-        {.note = SILENCE, .timeMs = 66},
-        {.note = D_SHARP_3, .timeMs = 66},
-        {.note = A_SHARP_2, .timeMs = 66},
-        {.note = D_SHARP_4, .timeMs = 265},
-        {.note = G_SHARP_1, .timeMs = 66},
-        {.note = A_SHARP_1, .timeMs = 66},
-        {.note = C_SHARP_2, .timeMs = 66},
-        {.note = D_SHARP_2, .timeMs = 66},
-        {.note = G_SHARP_2, .timeMs = 66},
-        {.note = C_3, .timeMs = 66},
-        {.note = D_SHARP_3, .timeMs = 66},
-        {.note = F_SHARP_3, .timeMs = 66},
-        {.note = G_SHARP_3, .timeMs = 132},
-        {.note = A_SHARP_3, .timeMs = 132},
-        {.note = C_SHARP_4, .timeMs = 66},
-        {.note = F_SHARP_2, .timeMs = 66},
-        {.note = A_SHARP_3, .timeMs = 132},
-        {.note = G_SHARP_4, .timeMs = 132},
-        {.note = F_2, .timeMs = 66},
-        {.note = SILENCE, .timeMs = 66},
-        {.note = F_1, .timeMs = 132},
-        {.note = SILENCE, .timeMs = 132},
-        {.note = C_4, .timeMs = 132},
-        {.note = A_2, .timeMs = 66},
-        {.note = A_1, .timeMs = 66},
-        {.note = C_SHARP_4, .timeMs = 132},
-        {.note = A_SHARP_2, .timeMs = 66},
-        {.note = A_SHARP_0, .timeMs = 66},
-        {.note = A_SHARP_1, .timeMs = 66},
-        {.note = A_SHARP_2, .timeMs = 66},
-        {.note = C_4, .timeMs = 132},
-        {.note = A_SHARP_3, .timeMs = 265},
-        {.note = G_SHARP_3, .timeMs = 132},
-        {.note = A_SHARP_3, .timeMs = 132},
-        {.note = C_SHARP_4, .timeMs = 132},
-        {.note = A_SHARP_3, .timeMs = 132},
-        {.note = C_SHARP_4, .timeMs = 132},
-        {.note = D_SHARP_2, .timeMs = 66},
-        {.note = SILENCE, .timeMs = 66},
-        {.note = D_SHARP_1, .timeMs = 66},
-        {.note = SILENCE, .timeMs = 66},
-        {.note = D_SHARP_2, .timeMs = 66},
-        {.note = SILENCE, .timeMs = 66},
-        {.note = D_SHARP_4, .timeMs = 132},
-        {.note = D_SHARP_3, .timeMs = 66},
-        {.note = A_SHARP_2, .timeMs = 66},
-        {.note = C_4, .timeMs = 265},
-        {.note = G_SHARP_2, .timeMs = 66},
-        {.note = D_SHARP_3, .timeMs = 66},
-        {.note = A_SHARP_3, .timeMs = 132},
-        {.note = G_SHARP_3, .timeMs = 132},
-        {.note = G_SHARP_2, .timeMs = 66},
-        {.note = SILENCE, .timeMs = 66},
-        {.note = D_SHARP_3, .timeMs = 66},
-        {.note = G_SHARP_1, .timeMs = 66},
-        {.note = D_SHARP_2, .timeMs = 66},
-        {.note = G_SHARP_2, .timeMs = 66},
-        {.note = G_SHARP_3, .timeMs = 265},
-        {.note = D_SHARP_4, .timeMs = 132},
-        {.note = A_2, .timeMs = 66},
-        {.note = F_1, .timeMs = 66},
-        {.note = A_2, .timeMs = 66},
-        {.note = F_3, .timeMs = 66},
-        {.note = SILENCE, .timeMs = 132},
-        {.note = C_SHARP_4, .timeMs = 530},
-        {.note = A_SHARP_1, .timeMs = 265},
-        {.note = A_SHARP_0, .timeMs = 265},
-
-    },
-    .numNotes = 418,
-    .shouldLoop = true
-};
-
-const song_t picross_music_bg =
-{
-    .notes =
-    {
-        {.note = A_SHARP_4, .timeMs = 150},
-        {.note = C_3, .timeMs = 150},
-        {.note = D_5, .timeMs = 150},
-        {.note = G_3, .timeMs = 150},
-        {.note = D_SHARP_5, .timeMs = 150},
-        {.note = C_4, .timeMs = 75},
-        {.note = D_4, .timeMs = 75},
-        {.note = A_SHARP_5, .timeMs = 150},
-        {.note = C_4, .timeMs = 150},
-        {.note = G_5, .timeMs = 150},
-        {.note = G_4, .timeMs = 150},
-        {.note = D_4, .timeMs = 150},
-        {.note = A_SHARP_5, .timeMs = 150},
-        {.note = C_4, .timeMs = 150},
-        {.note = G_3, .timeMs = 150},
-        {.note = A_5, .timeMs = 150},
-        {.note = F_SHARP_3, .timeMs = 150},
-        {.note = F_2, .timeMs = 150},
-        {.note = C_3, .timeMs = 150},
-        {.note = D_SHARP_3, .timeMs = 150},
-        {.note = A_3, .timeMs = 150},
-        {.note = A_5, .timeMs = 150},
-        {.note = G_5, .timeMs = 150},
-        {.note = SILENCE, .timeMs = 150},
-        {.note = A_5, .timeMs = 150},
-        {.note = SILENCE, .timeMs = 150},
-        {.note = G_5, .timeMs = 150},
-        {.note = F_5, .timeMs = 150},
-        {.note = A_SHARP_2, .timeMs = 150},
-        {.note = A_SHARP_3, .timeMs = 150},
-        {.note = B_2, .timeMs = 150},
-        {.note = B_3, .timeMs = 150},
-        {.note = C_3, .timeMs = 150},
-        {.note = C_4, .timeMs = 150},
-        {.note = A_SHARP_4, .timeMs = 150},
-        {.note = D_5, .timeMs = 150},
-        {.note = G_3, .timeMs = 150},
-        {.note = D_SHARP_5, .timeMs = 150},
-        {.note = C_4, .timeMs = 75},
-        {.note = D_4, .timeMs = 75},
-        {.note = A_SHARP_5, .timeMs = 150},
-        {.note = C_4, .timeMs = 150},
-        {.note = G_5, .timeMs = 150},
-        {.note = G_4, .timeMs = 150},
-        {.note = D_4, .timeMs = 150},
-        {.note = C_6, .timeMs = 75},
-        {.note = D_6, .timeMs = 75},
-        {.note = C_4, .timeMs = 150},
-        {.note = G_3, .timeMs = 150},
-        {.note = C_6, .timeMs = 150},
-        {.note = F_3, .timeMs = 150},
-        {.note = D_SHARP_2, .timeMs = 150},
-        {.note = A_SHARP_2, .timeMs = 150},
-        {.note = C_SHARP_3, .timeMs = 150},
-        {.note = G_3, .timeMs = 150},
-        {.note = C_6, .timeMs = 150},
-        {.note = A_SHARP_5, .timeMs = 150},
-        {.note = SILENCE, .timeMs = 150},
-        {.note = C_6, .timeMs = 150},
-        {.note = SILENCE, .timeMs = 150},
-        {.note = A_SHARP_5, .timeMs = 150},
-        {.note = G_SHARP_5, .timeMs = 150},
-        {.note = F_3, .timeMs = 150},
-        {.note = D_SHARP_3, .timeMs = 150},
-        {.note = A_SHARP_5, .timeMs = 150},
-        {.note = A_SHARP_2, .timeMs = 150},
-        {.note = D_SHARP_2, .timeMs = 150},
-        {.note = G_5, .timeMs = 150},
-        {.note = G_SHARP_2, .timeMs = 150},
-        {.note = D_SHARP_3, .timeMs = 150},
-        {.note = B_5, .timeMs = 75},
-        {.note = C_6, .timeMs = 75},
-        {.note = B_3, .timeMs = 75},
-        {.note = C_4, .timeMs = 75},
-        {.note = D_SHARP_6, .timeMs = 150},
-        {.note = F_6, .timeMs = 150},
-        {.note = D_SHARP_4, .timeMs = 150},
-        {.note = G_6, .timeMs = 150},
-        {.note = C_4, .timeMs = 150},
-        {.note = F_6, .timeMs = 150},
-        {.note = D_SHARP_6, .timeMs = 150},
-        {.note = G_3, .timeMs = 150},
-        {.note = E_6, .timeMs = 75},
-        {.note = F_6, .timeMs = 75},
-        {.note = D_SHARP_3, .timeMs = 150},
-        {.note = D_6, .timeMs = 150},
-        {.note = G_2, .timeMs = 150},
-        {.note = D_3, .timeMs = 150},
-        {.note = A_SHARP_3, .timeMs = 150},
-        {.note = C_6, .timeMs = 150},
-        {.note = A_3, .timeMs = 150},
-        {.note = F_3, .timeMs = 150},
-        {.note = D_6, .timeMs = 150},
-        {.note = D_3, .timeMs = 150},
-        {.note = G_5, .timeMs = 150},
-        {.note = G_2, .timeMs = 150},
-        {.note = D_3, .timeMs = 150},
-        {.note = A_SHARP_3, .timeMs = 150},
-        {.note = SILENCE, .timeMs = 150},
-        {.note = C_4, .timeMs = 150},
-        {.note = A_3, .timeMs = 150},
-        {.note = F_3, .timeMs = 150},
-        {.note = F_2, .timeMs = 150},
-        {.note = C_3, .timeMs = 150},
-        {.note = D_SHARP_3, .timeMs = 150},
-        {.note = B_5, .timeMs = 75},
-        {.note = C_6, .timeMs = 75},
-        {.note = G_SHARP_3, .timeMs = 75},
-        {.note = A_3, .timeMs = 75},
-        {.note = D_SHARP_6, .timeMs = 150},
-        {.note = F_6, .timeMs = 150},
-        {.note = C_4, .timeMs = 150},
-        {.note = G_6, .timeMs = 150},
-        {.note = A_3, .timeMs = 150},
-        {.note = F_6, .timeMs = 150},
-        {.note = D_SHARP_6, .timeMs = 150},
-        {.note = E_3, .timeMs = 150},
-        {.note = F_SHARP_6, .timeMs = 75},
-        {.note = G_6, .timeMs = 75},
-        {.note = C_3, .timeMs = 150},
-        {.note = F_6, .timeMs = 150},
-        {.note = A_SHARP_2, .timeMs = 150},
-        {.note = F_3, .timeMs = 150},
-        {.note = G_SHARP_3, .timeMs = 150},
-        {.note = D_4, .timeMs = 150},
-        {.note = D_6, .timeMs = 150},
-        {.note = D_SHARP_6, .timeMs = 150},
-        {.note = C_SHARP_3, .timeMs = 150},
-        {.note = B_3, .timeMs = 150},
-        {.note = F_6, .timeMs = 150},
-        {.note = F_4, .timeMs = 150},
-        {.note = SILENCE, .timeMs = 150},
-        {.note = F_6, .timeMs = 150},
-        {.note = SILENCE, .timeMs = 150},
-        {.note = F_6, .timeMs = 150},
-        {.note = D_SHARP_5, .timeMs = 150},
-        {.note = C_5, .timeMs = 143},
-
-    },
-    .numNotes = 137,
-    .shouldLoop = true
-};
-
-const song_t picross_music_win =
-{
-    .notes =
-    {
-        {A_SHARP_2,  224/*, 0.5000000 */},
-        {F_3,  224/*, 0.5000000 */},
-        {A_SHARP_3,  224/*, 0.5000000 */},
-        {F_4,  224/*, 0.5000000 */},
-        {D_5,  300/*, 0.5000000 */},
-        {SILENCE,  150/*, 0.5000000 */},
-        {C_3,  224/*, 0.5000000 */},
-        {G_3,  224/*, 0.5000000 */},
-        {C_4,  224/*, 0.5000000 */},
-        {G_4,  224/*, 0.5000000 */},
-        {E_5,  300/*, 0.5000000 */},
-        {SILENCE,  150/*, 0.5000000 */},
-        {D_3,  75/*, 0.5000000 */},
-        {A_3,  75/*, 0.5000000 */},
-        {D_4,  75/*, 0.5000000 */},
-        {A_4,  75/*, 0.5000000 */},
-        {F_SHARP_5,  924/*, 0.5000000 */},
-
-    },
-    .numNotes = 17,
-    .shouldLoop = false
-};
\ No newline at end of file
@@ -1,5 +0,0 @@
-#include "musical_buzzer.h"
-
-extern const song_t picross_music_rick;
-extern const song_t picross_music_bg;
-extern const song_t picross_music_win;
\ No newline at end of file
@@ -30,6 +30,7 @@ void levelSelectInput(void);
 void drawLevelSelectScreen(display_t* d,font_t* font);
 void drawPicrossLevelWSG(display_t* disp, wsg_t* wsg, int16_t xOff, int16_t yOff, bool highlight);
 void drawPicrossPreviewWindow(display_t* d, wsg_t* wsg);
+void drawPicrossScrollArrow(display_t* d, int16_t y, bool up);
 //====
 // Functions
 //====
@@ -59,9 +60,9 @@ void picrossStartLevelSelect(display_t* disp, font_t* bigFont, picrossLevelDef_t
             levels[i].completed = false;
             ls->allLevelsComplete = false;
         }
-
-        ls->levels[i] = levels[i];
     }
+    //images are loaded when they are drawn, so only completed levels need them.
+    ls->levels = levels;
     
     ls->hoverX = 0;
     ls->hoverY = 0;
@@ -71,10 +72,13 @@ void picrossStartLevelSelect(display_t* disp, font_t* bigFont, picrossLevelDef_t
     ls->btnState = 0;
 
     //visual settings
-    ls->cols = 5;
+    ls->cols = PICROSS_SELECT_COLS;
     //rows*cols should = picrossLevelCount. If it doesn't, the UI will break lol. I can add a check for it, but i dont want to unless we need it.
     //The goal is just to make the correct amount of puzzles, and replace this line with a concretely set rows. Or replace rows/cols with a #DEFINE.
     ls->rows = (PICROSS_LEVEL_COUNT+(ls->cols-1)) / ls->cols;
+    //only this many rows are drawn, and so only their levels' images are loaded. The grid scrolls to follow the cursor.
+    ls->rowsOnScreen = (ls->rows < PICROSS_SELECT_ROWS_ON_SCREEN) ? ls->rows : PICROSS_SELECT_ROWS_ON_SCREEN;
+    ls->topRow = 0;
     ls->paddingLeft = 10;
     ls->paddingTop = 20;
     ls->gap = 5;
@@ -159,6 +163,16 @@ void levelSelectInput()
         }
     }
 
+    //scroll the grid to keep the cursor on screen
+    if(ls->hoverY < ls->topRow)
+    {
+        ls->topRow = ls->hoverY;
+    }
+    else if(ls->hoverY >= ls->topRow + ls->rowsOnScreen)
+    {
+        ls->topRow = ls->hoverY - ls->rowsOnScreen + 1;
+    }
+
     ls->hoverLevelIndex = ls->hoverY*ls->cols+ls->hoverX;
     ls->prevBtnState = ls->btnState;
 }
@@ -174,9 +188,16 @@ void drawLevelSelectScreen(display_t* d,font_t* font)
     drawText(d, font, c555, "Puzzle", 190, 30); 
     drawText(d, font, c555, "Select", 190, 60);   
     
-    for(int i=0;i<PICROSS_LEVEL_COUNT;i++)
+    //only draw the rows on screen, so levels scrolled off screen can have their images freed
+    int firstLevel = ls->topRow * ls->cols;
+    int lastLevel = (ls->topRow + ls->rowsOnScreen) * ls->cols;
+    if(lastLevel > PICROSS_LEVEL_COUNT)
+    {
+        lastLevel = PICROSS_LEVEL_COUNT;
+    }
+    for(int i=firstLevel;i<lastLevel;i++)
     {
-        y = i / ls->cols;
+        y = i / ls->cols - ls->topRow;
         x = 0;
         if(i!=0){
             x = (i%ls->cols);
@@ -185,7 +206,7 @@ void drawLevelSelectScreen(display_t* d,font_t* font)
         y = y * s + ls->paddingTop + ls->gap*y;
         if(ls->levels[i].completed)
         {
-            drawPicrossLevelWSG(d,&ls->levels[i].completedWSG,x,y,false);
+            drawPicrossLevelWSG(d,getPicrossSolvedWsg(&ls->levels[i]),x,y,false);
         }else
         {
             //Draw ? sprite
@@ -197,7 +218,8 @@ void drawLevelSelectScreen(display_t* d,font_t* font)
     {
     //Draw the current level difficulty at the bottom left.
     char textBuffer[13];
-    snprintf(textBuffer, sizeof(textBuffer) - 1, "%dx%d", (int)ls->levels[ls->hoverLevelIndex].levelWSG.w,(int)ls->levels[ls->hoverLevelIndex].levelWSG.h);
+    wsg_t* hoverPuzzle = getPicrossPuzzleWsg(&ls->levels[ls->hoverLevelIndex]);
+    snprintf(textBuffer, sizeof(textBuffer) - 1, "%dx%d", (int)hoverPuzzle->w,(int)hoverPuzzle->h);
     int16_t t = textWidth(&ls->smallFont,textBuffer)/2;
     drawText(d, &ls->smallFont, c555, textBuffer, (d->w)-54-t,(d->h)-28);
     }
@@ -205,7 +227,7 @@ void drawLevelSelectScreen(display_t* d,font_t* font)
     //
         //draw level choose input
         x = ls->hoverX;
-        y = ls->hoverY;
+        y = ls->hoverY - ls->topRow;
         
         box_t inputBox =
         {
@@ -219,7 +241,7 @@ void drawLevelSelectScreen(display_t* d,font_t* font)
             //if completed, show victory image and green hover
             //only do error bounds checking on the window to prevent crashing. Cursor showing out of bounds is less confusing than cursor vanishing
             if(ls->hoverLevelIndex < PICROSS_LEVEL_COUNT){//This doesnt actually work because the index goes off into pointer-land
-                drawPicrossPreviewWindow(d,&ls->levels[ls->hoverLevelIndex].completedWSG);
+                drawPicrossPreviewWindow(d,getPicrossSolvedWsg(&ls->levels[ls->hoverLevelIndex]));
             }
             drawBox(d,inputBox,c151,false,0);
         }else{
@@ -234,6 +256,16 @@ void drawLevelSelectScreen(display_t* d,font_t* font)
         }
     
 
+    //show which way there are more levels
+    if(ls->topRow > 0)
+    {
+        drawPicrossScrollArrow(d, ls->paddingTop - 12, true);
+    }
+    if(ls->topRow + ls->rowsOnScreen < ls->rows)
+    {
+        drawPicrossScrollArrow(d, ls->paddingTop + ls->rowsOnScreen*(s+ls->gap) + 2, false);
+    }
+
     if(ls->allLevelsComplete)
     {
         drawText(d,ls->game_font,c000,str_win,53,103);
@@ -362,4 +394,12 @@ void drawPicrossPreviewWindow(display_t* d, wsg_t* wsg)
     }
 }
 
-
+//Draw an arrow centered over the level grid, to show there are more levels above or below it.
+void drawPicrossScrollArrow(display_t* d, int16_t y, bool up)
+{
+    int16_t cx = ls->paddingLeft + (ls->cols*(ls->gridScale+ls->gap) - ls->gap)/2;
+    int16_t tipY = up ? y : y+8;
+    int16_t baseY = up ? y+8 : y;
+    plotLine(d, cx-8, baseY, cx, tipY, c555, 0);
+    plotLine(d, cx, tipY, cx+8, baseY, c555, 0);
+}
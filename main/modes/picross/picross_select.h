@@ -7,10 +7,13 @@
 
 typedef struct {
     int8_t index;
-    wsg_t levelWSG;
-    wsg_t completedWSG;
+    wsg_t levelWSG;//loaded on demand, use getPicrossPuzzleWsg()
+    wsg_t completedWSG;//loaded on demand, use getPicrossSolvedWsg()
     bool completed;
     char* title;
+    char* puzzleFile;
+    char* solvedFile;
+    uint32_t lastUsed;//the frame this level's images were last used, to pick which to free first
 } picrossLevelDef_t;
 
 typedef struct
@@ -25,6 +28,8 @@ typedef struct
     int8_t hoverY;
     uint8_t rows;
     uint8_t cols;
+    uint8_t rowsOnScreen;
+    uint8_t topRow;//the first row on screen
     uint16_t prevBtnState;
     uint16_t btnState;
     uint8_t paddingTop;
@@ -33,7 +38,7 @@ typedef struct
     int32_t currentIndex;//s32bit because its stored i an nvs
     wsg_t unknownPuzzle;
     bool allLevelsComplete;
-    picrossLevelDef_t levels[PICROSS_LEVEL_COUNT];   
+    picrossLevelDef_t* levels;//PICROSS_LEVEL_COUNT levels, owned by the picross menu
 } picrossLevelSelect_t;
 
 void picrossStartLevelSelect(display_t* disp, font_t* mmFont, picrossLevelDef_t levels[]);
@@ -217,7 +217,8 @@ void p2pStartConnection(p2pInfo* p2p)
 }
 
 /**
- * Stop up all timers
+ * Stop and delete all timers. p2pInitialize() must be called before the
+ * connection is used again
  *
  * @param p2p The p2pInfo struct with all the state information
  */
@@ -231,6 +232,16 @@ void p2pDeinit(p2pInfo* p2p)
         esp_timer_stop(p2p->tmr.TxRetry);
         esp_timer_stop(p2p->tmr.Reinit);
         esp_timer_stop(p2p->tmr.TxAllRetries);
+
+        esp_timer_delete(p2p->tmr.Connection);
+        esp_timer_delete(p2p->tmr.TxRetry);
+        esp_timer_delete(p2p->tmr.Reinit);
+        esp_timer_delete(p2p->tmr.TxAllRetries);
+
+        p2p->tmr.Connection = NULL;
+        p2p->tmr.TxRetry = NULL;
+        p2p->tmr.Reinit = NULL;
+        p2p->tmr.TxAllRetries = NULL;
     }
 }
 
@@ -10,6 +10,7 @@
 #include "touch_sensor.h"
 #include "display.h"
 #include "espNowUtils.h"
+#include "embeddednf.h"
 
 #define NUM_LEDS 8
 
@@ -37,7 +38,9 @@ typedef struct _swadgeMode
 
     /**
      * This function is called when the mode is exited. It should clean up
-     * anything that shouldn't happen when the mode is not active
+     * anything that shouldn't happen when the mode is not active.
+     * Modes are usually switched without rebooting, so this must stop any
+     * timers the mode started and free all memory the mode allocated
      */
     void (*fnExitMode)(void);
 
@@ -69,12 +72,27 @@ typedef struct _swadgeMode
 
     /**
      * This function is called periodically with the current acceleration
-     * vector.
+     * vector. By default this is once per frame, right before fnMainLoop()
      *
      * @param accel A struct with 10 bit signed X, Y, and Z accel vectors
      */
     void (*fnAccelerometerCallback)(accel_t* accel);
 
+    /**
+     * How often to call fnAccelerometerCallback, in microseconds. If this is
+     * 0, it is called once per frame
+     */
+    uint32_t accelerometerPeriodUs;
+
+    /**
+     * If true, the accelerometer buffers samples at its own steady rate and
+     * fnAccelerometerCallback is called once for each of them, oldest first,
+     * after every frame. They are read with one burst read while the main loop
+     * would otherwise wait. accelerometerPeriodUs is ignored. The emulator has
+     * no FIFO, so it calls fnAccelerometerCallback once per frame instead
+     */
+    bool accelerometerFifo;
+
     /**
      * This function is called whenever audio samples are read from the
      * microphone (ADC) and are ready for processing. Samples are read at 8KHz
@@ -85,6 +103,22 @@ typedef struct _swadgeMode
      */
     void (*fnAudioCallback)(uint16_t* samples, uint32_t sampleCnt);
 
+    /**
+     * This function is called whenever the shared audio analysis has a new
+     * frame, every 128 samples. The system runs the DFT and note finder once
+     * for the mode and any other subscribers, so modes which only need bins or
+     * notes should use this rather than running their own in fnAudioCallback.
+     * This may be used with or without fnAudioCallback. Either one starts the
+     * microphone. Code outside the mode can get the same frames with
+     * audioAnalysisSubscribe(), but only while the current mode uses the
+     * microphone.
+     * This cannot be used at the same time as fnBatteryCallback
+     *
+     * @param end The note finder output, including folded and fuzzed bins and notes
+     * @param dd The DFT state, including the raw embeddedbins32
+     */
+    void (*fnAudioAnalysisCallback)(const embeddednf_data* end, const dft32_data* dd);
+
     /**
      * This function is called periodically with the current temperature
      *
@@ -94,7 +128,8 @@ typedef struct _swadgeMode
 
     /**
      * This function is called periodically with the current battery level
-     * This cannot be used at the same time as fnAudioCallback
+     * This cannot be used at the same time as fnAudioCallback or
+     * fnAudioAnalysisCallback
      *
      * @param vBatt the battery voltage
      */
@@ -146,7 +181,8 @@ typedef struct _swadgeMode
 
     /**
      * If this is false, then the tiny USB driver will be installed
-     * If this is true, then the swadge mode can do whatever it wants with USB
+     * If this is true, then the swadge mode can do whatever it wants with USB.
+     * The swadge reboots when switching to or from a mode which overrides USB
      */
     bool overrideUsb;
 
@@ -1,10 +1,14 @@
 #include <stdio.h>
 #include <unistd.h>
+#include <inttypes.h>
 
 #include "sdkconfig.h"
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#if !defined(EMU)
+    #include "freertos/semphr.h"
+#endif
 
 #include "esp_system.h"
 #include "esp_spi_flash.h"
@@ -58,6 +62,9 @@
 #include "display.h"
 
 #include "advanced_usb_control.h"
+#include "audio_analysis.h"
+#include "boot_timeline.h"
+#include "mode_arena.h"
 
 #include "mode_main_menu.h"
 #include "jumper_menu.h"
@@ -72,6 +79,8 @@
 #if defined(EMU)
     #include "emu_esp.h"
     #include "emu_main.h"
+    #include "emu_alloc.h"
+    #include "emu_sound.h"
 #else
     #include "soc/dport_access.h"
     #include "soc/periph_defs.h"
@@ -89,6 +98,17 @@
 #endif
 
 #define EXIT_TIME_US 1000000
+#define DEFAULT_FRAME_RATE_US 33333
+// The longest the emulator sleeps, so its window stays responsive
+#define EMU_MAX_SLEEP_US 100000
+// The most accelerometer samples drained from the FIFO at once
+#define ACCEL_FIFO_SAMPLES 32
+// What countModeResources() counts
+#if defined(EMU)
+    #define MODE_RESOURCES "timers"
+#else
+    #define MODE_RESOURCES "tasks"
+#endif
 
 //==============================================================================
 // Enums
@@ -111,6 +131,24 @@ void swadgeModeEspNowRecvCb(const uint8_t* mac_addr, const char* data,
                             uint8_t len, int8_t rssi);
 void swadgeModeEspNowSendCb(const uint8_t* mac_addr, esp_now_send_status_t status);
 void simulateBtn(void (*fnButtonCallback)(buttonEvt_t* evt), buttonBit_t btn, uint16_t state);
+static bool swadgeModeUsesMic(const swadgeMode* mode);
+static void initModePeripherals(const swadgeMode* mode);
+static void deinitModePeripherals(const swadgeMode* nextMode);
+static bool canSoftSwitchMode(const swadgeMode* from, const swadgeMode* to);
+static void softSwitchSwadgeMode(display_t* disp);
+static int32_t countModeResources(void);
+static void initTftDisplay(display_t* disp);
+static void frameTimerCb(void* arg);
+static void pollAccelerometer(void);
+static void drainAccelerometerFifo(void);
+#if !defined(EMU)
+static TickType_t getMainLoopWaitTicks(void);
+#else
+static int64_t getEmuLoopSleepUs(void);
+#endif
+#if !defined(EMU)
+static void tftInitTask(void* arg);
+#endif
 
 //==============================================================================
 // Variables
@@ -144,13 +182,41 @@ uint8_t fuzzTouchCount = 5;
 static RTC_DATA_ATTR swadgeMode* pendingSwadgeMode = NULL;
 static swadgeMode* cSwadgeMode = &modeMainMenu;
 static bool isSandboxMode = false;
-static uint32_t frameRateUs = 33333;
+static uint32_t frameRateUs = DEFAULT_FRAME_RATE_US;
+// Timers or tasks which existed before the current mode was entered
+static int32_t preModeResources = 0;
 
 // For monitoring Start+Select
 static startSelState_t sst = NONE_PRESSED;
 static int64_t dblBtnTmr = -1;
 static uint16_t lastBtnState = 0;
 
+// Peripherals which are initialized depending on the current mode
+static bool micInit = false;
+static bool batteryAdcInit = false;
+static bool i2cInit = false;
+static bool accelInitialized = false;
+static bool accelFifoEnabled = false;
+static bool wifiInit = false;
+static bool randomEnabled = false;
+static bool temperatureInit = false;
+
+#if !defined(EMU)
+// Given by tftInitTask() when the TFT is ready to draw
+static SemaphoreHandle_t tftInitDone = NULL;
+// Notified whenever the main loop has something to do
+static TaskHandle_t mainTaskHandle = NULL;
+#endif
+
+// Fires every frameRateUs to draw a frame and call fnMainLoop()
+static esp_timer_handle_t frameTimer = NULL;
+static volatile bool frameDue = false;
+
+// Time since the accelerometer was polled, if the mode sets accelerometerPeriodUs
+static uint32_t tAccumAccel = 0;
+// Set when a frame is drawn, so the accelerometer FIFO is drained before waiting
+static bool accelFifoDrainDue = false;
+
 //==============================================================================
 // Functions
 //==============================================================================
@@ -323,7 +389,9 @@ void app_main(void)
     ESP_LOGD("MAIN", "Reset Reason: %d", rr );
 
     /* Initialize internal NVS. Do this first to get test mode status and crashwrap */
+    int8_t bt = bootTimelineStart("nvs");
     initNvs(true);
+    bootTimelineEnd(bt);
 
     esp_log_set_vprintf( advanced_usb_write_log_printf );
     checkAndInstallCrashwrap();
@@ -401,20 +469,40 @@ void mainSwadgeTask(void* arg __attribute((unused)))
     }
 #endif
 
+    /* Initialize SPI peripherals. The TFT spends most of its init time waiting
+     * for the panel to reset, so on hardware do it in parallel with the other
+     * peripherals */
+    display_t tftDisp;
+#if defined(EMU)
+    initTftDisplay(&tftDisp);
+#else
+    tftInitDone = xSemaphoreCreateBinary();
+    if(pdPASS != xTaskCreate(tftInitTask, "tftInit", 4096, &tftDisp,
+                             uxTaskPriorityGet(NULL), NULL))
+    {
+        ESP_LOGE("MAIN", "Couldn't create tftInit task");
+        initTftDisplay(&tftDisp);
+        xSemaphoreGive(tftInitDone);
+    }
+#endif
+
     /* If the mode isn't overriding USB */
+    int8_t bt = bootTimelineStart("usb");
     if(!cSwadgeMode->overrideUsb)
     {
         /* Initialize USB peripheral */
         tinyusb_config_t tusb_cfg = {};
         tinyusb_driver_install(&tusb_cfg);
     }
+    bootTimelineEnd(bt);
 
     /* Initialize SPIFFS */
+    bt = bootTimelineStart("spiffs");
     initSpiffs();
-
-    initTemperatureSensor();
+    bootTimelineEnd(bt);
 
     /* Initialize non-i2c hardware peripherals */
+    bt = bootTimelineStart("buttons");
 #if defined(CONFIG_SWADGE_DEVKIT)
     initButtons(TIMER_GROUP_0, TIMER_0,
                 8,
@@ -438,12 +526,9 @@ void mainSwadgeTask(void* arg __attribute((unused)))
                 GPIO_NUM_8,
                 GPIO_NUM_5);
 #endif
+    bootTimelineEnd(bt);
 
-    // Same for CONFIG_SWADGE_DEVKIT and CONFIG_SWADGE_PROTOTYPE
-    // Make sure to use a different timer than initButtons()
-    buzzer_init(GPIO_NUM_40, LEDC_TIMER_3, LEDC_CHANNEL_0,
-        TIMER_GROUP_1, TIMER_0, getBgmIsMuted(), getSfxIsMuted());
-
+    bt = bootTimelineStart("touch");
 #if defined(CONFIG_SWADGE_DEVKIT)
     initTouchSensor(0.2f, true, 6,
                     TOUCH_PAD_NUM9,   // GPIO_NUM_9
@@ -460,138 +545,82 @@ void mainSwadgeTask(void* arg __attribute((unused)))
                     TOUCH_PAD_NUM12,  // GPIO_NUM_12
                     TOUCH_PAD_NUM13); // GPIO_NUM_13
 #endif
+    bootTimelineEnd(bt);
 
     // Same for CONFIG_SWADGE_DEVKIT and CONFIG_SWADGE_PROTOTYPE
+    bt = bootTimelineStart("leds");
     initLeds(GPIO_NUM_39, GPIO_NUM_18, RMT_CHANNEL_0, NUM_LEDS, getLedBrightness());
-
-    bool adcInit = false;
-    if(NULL != cSwadgeMode->fnAudioCallback
-#if defined(EMU)
-            || true // Always init audio for the emulator
-#endif
-      )
-    {
-        /* Since the ADC2 is shared with the WIFI module, which has higher
-         * priority, reading operation of adc2_get_raw() will fail between
-         * esp_wifi_start() and esp_wifi_stop(). Use the return code to see
-         * whether the reading is successful.
-         */
-#if defined(CONFIG_SWADGE_DEVKIT)
-        static uint16_t adc1_chan_mask = BIT(2);
-        static uint16_t adc2_chan_mask = 0;
-        static adc_channel_t channel[] = {ADC1_CHANNEL_7}; // GPIO_NUM_8
-#elif defined(CONFIG_SWADGE_PROTOTYPE)
-        static uint16_t adc1_chan_mask = BIT(6);
-        static uint16_t adc2_chan_mask = 0;
-        static adc_channel_t channel[] = {(adc_channel_t)ADC1_CHANNEL_6}; // GPIO_NUM_7
-#endif
-        continuous_adc_init(adc1_chan_mask, adc2_chan_mask, channel, sizeof(channel) / sizeof(adc_channel_t));
-        continuous_adc_start();
-        adcInit = true;
-    }
-    else if (NULL != cSwadgeMode->fnBatteryCallback)
-    {
-#if defined(CONFIG_SWADGE_PROTOTYPE)
-        // If the continuous ADC isn't set up, set up the one-shot one
-        oneshot_adc_init(ADC_UNIT_1, ADC1_CHANNEL_5); /*!< ADC1 channel 5 is GPIO6  */
-        adcInit = true;
-#endif
-    }
-
-    bool accelInitialized = false;
-#if !defined(EMU)
-    if(NULL != cSwadgeMode->fnAccelerometerCallback)
-#endif
-    {
-        /* Initialize i2c peripherals */
-#if defined(CONFIG_SWADGE_DEVKIT)
-        i2c_master_init(
-            GPIO_NUM_17, // SDA
-            GPIO_NUM_18, // SCL
-            GPIO_PULLUP_DISABLE, 1000000);
-#elif defined(CONFIG_SWADGE_PROTOTYPE)
-        i2c_master_init(
-            GPIO_NUM_3,  // SDA
-            GPIO_NUM_41, // SCL
-            GPIO_PULLUP_DISABLE, 1000000);
-#endif
-
-#if defined(QMA6981)
-        accelInitialized = QMA6981_setup();
-#elif defined(QMA7981)
-        accelInitialized = (ESP_OK == qma7981_init());
-#endif
-    }
+    bootTimelineEnd(bt);
 
 #ifdef OLED_ENABLED
     display_t oledDisp;
     initOLED(&oledDisp, true, GPIO_NUM_21);
 #endif
 
-    /* Initialize SPI peripherals */
-    display_t tftDisp;
-#if defined(CONFIG_SWADGE_DEVKIT)
-    initTFT(&tftDisp,
-            SPI2_HOST,
-            GPIO_NUM_36, // sclk
-            GPIO_NUM_37, // mosi
-            GPIO_NUM_21, // dc
-            GPIO_NUM_34, // cs
-            GPIO_NUM_38, // rst
-            GPIO_NUM_7,  // backlight (dummy GPIO for now)
-            false);      // binary backlight
-#elif defined(CONFIG_SWADGE_PROTOTYPE)
-    initTFT(&tftDisp,
-            SPI2_HOST,
-            GPIO_NUM_36, // sclk
-            GPIO_NUM_37, // mosi
-            GPIO_NUM_21, // dc
-            GPIO_NUM_34, // cs
-            GPIO_NUM_38, // rst
-            GPIO_NUM_35, // backlight
-            true);       // PWM backlight
+#if !defined(EMU)
+    /* Wait for the TFT to be ready before drawing anything. This must also
+     * happen before buzzer_init(), because the TFT backlight and the buzzer
+     * both configure the LEDC peripheral, and the LEDC driver isn't safe to
+     * configure from two tasks at once */
+    xSemaphoreTake(tftInitDone, portMAX_DELAY);
+    vSemaphoreDelete(tftInitDone);
+    tftInitDone = NULL;
 #endif
 
+    // Same for CONFIG_SWADGE_DEVKIT and CONFIG_SWADGE_PROTOTYPE
+    // Make sure to use a different timer than initButtons()
+    bt = bootTimelineStart("buzzer");
+    buzzer_init(GPIO_NUM_40, LEDC_TIMER_3, LEDC_CHANNEL_0,
+        TIMER_GROUP_1, TIMER_0, getBgmIsMuted(), getSfxIsMuted());
+    bootTimelineEnd(bt);
+
     // Set the brightness from settings on boot
     setTFTBacklight(getTftIntensity());
 
-    /* Initialize Wifi peripheral */
-    bool wifiInit = false;
-#if defined(EMU)
-    // Always init on emu b/c it will never be called again
-    if(true)
-#else
-    // Only init wifi on actual hardware if requested (saves power)
-    if(NO_WIFI != cSwadgeMode->wifiMode)
-#endif
-    {
-        if(cSwadgeMode->overrideUsb)
-        {
-            // This can communicate over wifi or UART
-            espNowInit(&swadgeModeEspNowRecvCb, &swadgeModeEspNowSendCb,
-                GPIO_NUM_19, GPIO_NUM_20, UART_NUM_1, cSwadgeMode->wifiMode);
-        }
-        else
-        {
-            // This can communicate over wifi only
-            espNowInit(&swadgeModeEspNowRecvCb, &swadgeModeEspNowSendCb,
-                GPIO_NUM_NC, GPIO_NUM_NC, UART_NUM_MAX, cSwadgeMode->wifiMode);
-        }
-        wifiInit = true;
-    }
+    /* Initialize the ADC, accelerometer, and wifi as the mode requires */
+    bt = bootTimelineStart("mode peripherals");
+    initModePeripherals(cSwadgeMode);
+    bootTimelineEnd(bt);
 
-    // If both wifi and ADC aren't used
-    if(false == adcInit && false == wifiInit)
-    {
-        // enable this entropy source
-        bootloader_random_enable();
-    }
+    /* Set up the shared audio analysis for the swadge mode */
+    initAudioAnalysis();
+    audioAnalysisSetModeCb(cSwadgeMode->fnAudioAnalysisCallback);
 
     /* Enter the swadge mode */
+    bt = bootTimelineStart("enter mode");
+#if defined(EMU)
+    emuAllocModeEnter(cSwadgeMode);
+#endif
+    preModeResources = countModeResources();
     if(NULL != cSwadgeMode->fnEnterMode)
     {
         cSwadgeMode->fnEnterMode(&tftDisp);
     }
+    bootTimelineEnd(bt);
+
+    // Finished when the first frame is drawn
+    int8_t btFirstFrame = bootTimelineStart("first frame");
+
+#if !defined(EMU)
+    /* The main loop blocks until one of these has something for it.
+     * This must be set before frameTimer starts, since it notifies this task */
+    mainTaskHandle = xTaskGetCurrentTaskHandle();
+    setButtonNotifyTask(mainTaskHandle);
+    setTouchNotifyTask(mainTaskHandle);
+    espNowSetNotifyTask(mainTaskHandle);
+#endif
+
+    /* Frames are drawn when this timer fires */
+    esp_timer_create_args_t frameTimerArgs =
+    {
+        .callback = frameTimerCb,
+        .arg = NULL,
+        .dispatch_method = ESP_TIMER_TASK,
+        .name = "frame",
+        .skip_unhandled_events = true,
+    };
+    esp_timer_create(&frameTimerArgs, &frameTimer);
+    setFrameRateUs(frameRateUs);
 
     int64_t time_exit_pressed = 0;
 
@@ -611,28 +640,24 @@ void mainSwadgeTask(void* arg __attribute((unused)))
             int64_t tElapsedUs = tNowUs - tLastLoopUs;
             tLastLoopUs = tNowUs;
 
+            // Commit NVS writes once the mode stops making them
+            checkNvsWriteBack();
+
             // Process ESP NOW.  For immediate mode, do not process RX queue, but we might be using serial.
             if(NO_WIFI != cSwadgeMode->wifiMode)
             {
                 checkEspNowRxQueue();
             }
 
-            // Process Accelerometer
-            if(accelInitialized && NULL != cSwadgeMode->fnAccelerometerCallback)
+            // Process Accelerometer, if the mode wants it at its own rate
+            if(!accelFifoEnabled && (0 != cSwadgeMode->accelerometerPeriodUs))
             {
-                accel_t accel = {0};
-#if defined(QMA6981)
-                QMA6981_poll(&accel);
-#elif defined(QMA7981)
-                qma7981_get_acce_int(&accel.x, &accel.y, &accel.z);
-#endif
-                cSwadgeMode->fnAccelerometerCallback(&accel);
-            }
-
-            // Process temperature sensor
-            if(NULL != cSwadgeMode->fnTemperatureCallback)
-            {
-                cSwadgeMode->fnTemperatureCallback(readTemperatureSensor());
+                tAccumAccel += tElapsedUs;
+                if(tAccumAccel >= cSwadgeMode->accelerometerPeriodUs)
+                {
+                    tAccumAccel %= cSwadgeMode->accelerometerPeriodUs;
+                    pollAccelerometer();
+                }
             }
 
             // Check the timer for pressing Start + Select simultaneously
@@ -836,7 +861,8 @@ void mainSwadgeTask(void* arg __attribute((unused)))
             }
 
             // Process ADC samples
-            if(NULL != cSwadgeMode->fnAudioCallback)
+            bool audioAnalysisActive = audioAnalysisHasSubscribers();
+            if(micInit && ((NULL != cSwadgeMode->fnAudioCallback) || audioAnalysisActive))
             {
                 uint16_t micAmp = getMicAmplitude();
                 uint16_t adcSamps[BYTES_PER_READ / sizeof(adc_digi_output_data_t)];
@@ -857,12 +883,21 @@ void mainSwadgeTask(void* arg __attribute((unused)))
 
                         adcSamps[i] = newsamp;
                     }
-                    cSwadgeMode->fnAudioCallback(adcSamps, sampleCnt);
+                    if(NULL != cSwadgeMode->fnAudioCallback)
+                    {
+                        cSwadgeMode->fnAudioCallback(adcSamps, sampleCnt);
+                    }
+
+                    // Run the DFT and note finder once for everything listening
+                    if(audioAnalysisActive)
+                    {
+                        audioAnalysisPushSamples(adcSamps, sampleCnt);
+                    }
                 }
             }
 
             // Track time between battery reads
-            if((NULL == cSwadgeMode->fnAudioCallback) &&
+            if(!swadgeModeUsesMic(cSwadgeMode) &&
                (NULL != cSwadgeMode->fnBatteryCallback))
             {
                 static uint64_t tAccumBatt = 10000000;
@@ -875,13 +910,27 @@ void mainSwadgeTask(void* arg __attribute((unused)))
                 }
             }
 
-            // Track the elapsed time between draw + fnMainLoop() calls
-            static uint64_t tAccumDraw = 0;
-            tAccumDraw += tElapsedUs;
-            if(tAccumDraw >= frameRateUs)
+            // Draw and call fnMainLoop() each time the frame timer fires
+            if(frameDue || (0 == frameRateUs))
             {
-                // Decrement the accumulation
-                tAccumDraw -= frameRateUs;
+                frameDue = false;
+
+                // Samples buffered in the accelerometer's FIFO are read after
+                // the frame, otherwise process the accelerometer once per frame
+                if(accelFifoEnabled)
+                {
+                    accelFifoDrainDue = true;
+                }
+                else if(0 == cSwadgeMode->accelerometerPeriodUs)
+                {
+                    pollAccelerometer();
+                }
+
+                // Process temperature sensor
+                if(NULL != cSwadgeMode->fnTemperatureCallback)
+                {
+                    cSwadgeMode->fnTemperatureCallback(readTemperatureSensor());
+                }
 
                 // Call the mode's main loop
                 if(NULL != cSwadgeMode->fnMainLoop)
@@ -932,6 +981,14 @@ void mainSwadgeTask(void* arg __attribute((unused)))
                 oledDisp.drawDisplay(&oledDisp, true, cSwadgeMode->fnBackgroundDrawCallback);
 #endif
                 tftDisp.drawDisplay(&tftDisp, true, cSwadgeMode->fnBackgroundDrawCallback);
+
+                // Log how long booting took once the first frame is drawn
+                if(BOOT_TIMELINE_FULL != btFirstFrame)
+                {
+                    bootTimelineEnd(btFirstFrame);
+                    bootTimelinePrint();
+                    btFirstFrame = BOOT_TIMELINE_FULL;
+                }
             }
 
 #if defined(EMU)
@@ -945,37 +1002,25 @@ void mainSwadgeTask(void* arg __attribute((unused)))
             {
                 time_exit_pressed = 0;
 #if defined(EMU)
-                int force_soft = 1;
+                bool forceSoft = true;
 #else
-                int force_soft = 0;
+                bool forceSoft = false;
 #endif
-                if( force_soft || isSandboxMode )
+                if(forceSoft || isSandboxMode || canSoftSwitchMode(cSwadgeMode, pendingSwadgeMode))
                 {
-                    // Exit the current mode
-                    if(NULL != cSwadgeMode->fnExitMode)
-                    {
-                        cSwadgeMode->fnExitMode();
-                    }
-
-                    buzzer_stop();
-
-                    // Switch the mode IDX
-                    cSwadgeMode = pendingSwadgeMode;
-                    pendingSwadgeMode = NULL;
-
-                    // Enter the next mode
-                    if(NULL != cSwadgeMode->fnEnterMode)
-                    {
-                        cSwadgeMode->fnEnterMode(&tftDisp);
-                    }
+                    softSwitchSwadgeMode(&tftDisp);
                 }
                 else
                 {
-                    // Deep sleep, wake up, and switch to pendingSwadgeMode
+                    // USB can't be reconfigured at runtime, so deep sleep,
+                    // wake up, and switch to pendingSwadgeMode
 
                     // We have to do this otherwise the backlight can glitch
                     disableTFTBacklight();
 
+                    // The mode doesn't exit, so commit its NVS writes before RAM is lost
+                    flushNvs();
+
 #ifndef EMU
                     // Prevent bootloader on reboot if rebooting from originally bootloaded instance
                     REG_WRITE(RTC_CNTL_OPTION1_REG, 0);
@@ -992,10 +1037,47 @@ void mainSwadgeTask(void* arg __attribute((unused)))
             }
         }
 
-        // Yield to let the rest of the RTOS run
-        taskYIELD();
+        // Send LED colors which were set while the last ones were sending
+        flushLeds();
+
+        // Read the samples buffered during the last frame now, while the main
+        // loop would be waiting for the next one anyway
+        if(accelFifoDrainDue)
+        {
+            accelFifoDrainDue = false;
+            drainAccelerometerFifo();
+        }
+
+#if defined(EMU)
+        // Sleep until the next timer, including the frame timer, or note is
+        // due, rather than drawing the window and checking every millisecond
+        int64_t tSleepUs = getEmuLoopSleepUs();
+        if(0 == tSleepUs)
+        {
+            // Yield to let the rest of the RTOS run
+            taskYIELD();
+        }
+        else
+        {
+            emu_loop();
+            usleep(tSleepUs);
+        }
+#else
+        // Sleep until the frame timer, a button, a touch, or a received packet
+        // wakes this task up, or until something needs to be polled
+        TickType_t waitTicks = getMainLoopWaitTicks();
+        if(0 == waitTicks)
+        {
+            // Yield to let the rest of the RTOS run
+            taskYIELD();
+        }
+        else
+        {
+            ulTaskNotifyTake(pdTRUE, waitTicks);
+        }
         // Note, the RTOS tick rate can be changed in idf.py menuconfig
         // (100hz by default)
+#endif
     }
 }
 
@@ -1005,20 +1087,30 @@ void mainSwadgeTask(void* arg __attribute((unused)))
  */
 void cleanupOnExit(void)
 {
-    if(NULL != cSwadgeMode->fnAudioCallback)
+    if(micInit)
     {
-        continuous_adc_stop();
         continuous_adc_deinit();
+        micInit = false;
     }
 
     if(NULL != cSwadgeMode->fnExitMode)
     {
         cSwadgeMode->fnExitMode();
     }
+    // Commit anything the mode wrote to NVS, including while exiting
+    flushNvs();
+    modeArenaReset();
+#if defined(EMU)
+    emuAllocModeExit();
+#endif
 
     deinitButtons();
 
-    espNowDeinit();
+    if(wifiInit)
+    {
+        espNowDeinit();
+        wifiInit = false;
+    }
 
     deinitSpiffs();
 
@@ -1072,6 +1164,350 @@ void overrideToSwadgeMode( swadgeMode* mode )
     isSandboxMode = true;
 }
 
+/**
+ * @brief Check if a swadge mode needs the microphone
+ *
+ * @param mode The mode to check
+ * @return true if the mode has an audio or audio analysis callback
+ */
+static bool swadgeModeUsesMic(const swadgeMode* mode)
+{
+    return (NULL != mode->fnAudioCallback) || (NULL != mode->fnAudioAnalysisCallback);
+}
+
+/**
+ * @brief Initialize the peripherals which a swadge mode needs and which aren't
+ * already initialized. This covers the microphone and battery ADCs, the
+ * accelerometer, the temperature sensor, ESP-NOW, and the bootloader entropy
+ * source. It is called on
+ * boot and when softly switching modes, after deinitModePeripherals()
+ *
+ * @param mode The mode to initialize peripherals for
+ */
+static void initModePeripherals(const swadgeMode* mode)
+{
+#if defined(EMU)
+    // Always init everything for the emulator
+    bool needMic = true;
+    bool needAccel = true;
+    bool needWifi = true;
+#else
+    bool needMic = swadgeModeUsesMic(mode);
+    // Only init the accelerometer and wifi on actual hardware if requested (saves power)
+    bool needAccel = (NULL != mode->fnAccelerometerCallback);
+    bool needWifi = (NO_WIFI != mode->wifiMode);
+#endif
+
+#if defined(CONFIG_SWADGE_PROTOTYPE)
+    // The prototype can measure the battery with the one-shot ADC
+    bool needBatteryAdc = !needMic && (NULL != mode->fnBatteryCallback);
+#else
+    bool needBatteryAdc = false;
+#endif
+
+    // The entropy source uses the ADC, so it must be disabled before the ADC
+    // or wifi are used
+    if(randomEnabled && (needMic || needBatteryAdc || needWifi))
+    {
+        bootloader_random_disable();
+        randomEnabled = false;
+    }
+
+    if(needMic && !micInit)
+    {
+        /* Since the ADC2 is shared with the WIFI module, which has higher
+         * priority, reading operation of adc2_get_raw() will fail between
+         * esp_wifi_start() and esp_wifi_stop(). Use the return code to see
+         * whether the reading is successful.
+         */
+#if defined(CONFIG_SWADGE_DEVKIT)
+        static uint16_t adc1_chan_mask = BIT(2);
+        static uint16_t adc2_chan_mask = 0;
+        static adc_channel_t channel[] = {ADC1_CHANNEL_7}; // GPIO_NUM_8
+#elif defined(CONFIG_SWADGE_PROTOTYPE)
+        static uint16_t adc1_chan_mask = BIT(6);
+        static uint16_t adc2_chan_mask = 0;
+        static adc_channel_t channel[] = {(adc_channel_t)ADC1_CHANNEL_6}; // GPIO_NUM_7
+#endif
+        continuous_adc_init(adc1_chan_mask, adc2_chan_mask, channel, sizeof(channel) / sizeof(adc_channel_t));
+        continuous_adc_start();
+        micInit = true;
+    }
+    else if(needBatteryAdc && !batteryAdcInit)
+    {
+        // If the continuous ADC isn't set up, set up the one-shot one
+        oneshot_adc_init(ADC_UNIT_1, ADC1_CHANNEL_5); /*!< ADC1 channel 5 is GPIO6  */
+        batteryAdcInit = true;
+    }
+
+    if(needAccel && !accelInitialized)
+    {
+        /* Initialize i2c peripherals. The driver is never uninstalled, so only
+         * do this once */
+        if(!i2cInit)
+        {
+#if defined(CONFIG_SWADGE_DEVKIT)
+            i2c_master_init(
+                GPIO_NUM_17, // SDA
+                GPIO_NUM_18, // SCL
+                GPIO_PULLUP_DISABLE, 1000000);
+#elif defined(CONFIG_SWADGE_PROTOTYPE)
+            i2c_master_init(
+                GPIO_NUM_3,  // SDA
+                GPIO_NUM_41, // SCL
+                GPIO_PULLUP_DISABLE, 1000000);
+#endif
+            i2cInit = true;
+        }
+
+#if defined(QMA6981)
+        accelInitialized = QMA6981_setup();
+#elif defined(QMA7981)
+        accelInitialized = (ESP_OK == qma7981_init());
+#endif
+    }
+
+#if defined(QMA7981)
+    // Let the sensor buffer samples if the mode wants every one of them. The
+    // emulator has no FIFO, so it keeps polling
+    bool needAccelFifo = accelInitialized && mode->accelerometerFifo &&
+                         (NULL != mode->fnAccelerometerCallback);
+    if(needAccelFifo && !accelFifoEnabled)
+    {
+        accelFifoEnabled = (ESP_OK == qma7981_set_fifo(true));
+    }
+    else if(!needAccelFifo && accelFifoEnabled)
+    {
+        qma7981_set_fifo(false);
+        accelFifoEnabled = false;
+    }
+#endif
+    accelFifoDrainDue = false;
+
+    // No modes read the temperature at the moment, so only set it up if asked
+    if((NULL != mode->fnTemperatureCallback) && !temperatureInit)
+    {
+        initTemperatureSensor();
+        temperatureInit = true;
+    }
+
+    /* Initialize Wifi peripheral */
+    if(needWifi && !wifiInit)
+    {
+        if(mode->overrideUsb)
+        {
+            // This can communicate over wifi or UART
+            espNowInit(&swadgeModeEspNowRecvCb, &swadgeModeEspNowSendCb,
+                GPIO_NUM_19, GPIO_NUM_20, UART_NUM_1, mode->wifiMode);
+        }
+        else
+        {
+            // This can communicate over wifi only
+            espNowInit(&swadgeModeEspNowRecvCb, &swadgeModeEspNowSendCb,
+                GPIO_NUM_NC, GPIO_NUM_NC, UART_NUM_MAX, mode->wifiMode);
+        }
+        wifiInit = true;
+    }
+
+    // If both wifi and ADC aren't used
+    if(!micInit && !batteryAdcInit && !wifiInit && !randomEnabled)
+    {
+        // enable this entropy source
+        bootloader_random_enable();
+        randomEnabled = true;
+    }
+}
+
+/**
+ * @brief Deinitialize the peripherals which were initialized for the current
+ * mode, but which the next mode doesn't need or needs configured differently.
+ * This is called after the current mode's fnExitMode()
+ *
+ * ESP-NOW is always torn down so that packets for the current mode aren't
+ * delivered to the next one. The accelerometer is left running because it
+ * costs little, and the i2c driver is never uninstalled.
+ *
+ * @param nextMode The mode which will be entered next
+ */
+static void deinitModePeripherals(const swadgeMode* nextMode)
+{
+    // Stop all sounds from the current mode
+    buzzer_stop();
+
+    // Turn off any LEDs the current mode left on
+    led_t leds[NUM_LEDS] = {0};
+    setLeds(leds, NUM_LEDS);
+
+    if(wifiInit)
+    {
+        espNowDeinit();
+        wifiInit = false;
+    }
+
+#if !defined(EMU)
+    // The emulator always keeps the microphone running
+    if(micInit && !swadgeModeUsesMic(nextMode))
+    {
+        continuous_adc_deinit();
+        micInit = false;
+    }
+#endif
+
+    // The one-shot ADC shares the ADC1 configuration with the continuous ADC
+    // and the entropy source, so always configure it again if it's needed
+    batteryAdcInit = false;
+}
+
+/**
+ * @brief Check if the swadge can switch modes without rebooting. This is
+ * possible unless either mode overrides USB, because the TinyUSB driver can't
+ * be uninstalled or reconfigured after it has been installed
+ *
+ * @param from The current mode
+ * @param to The mode to switch to
+ * @return true if the mode may be switched in place, false if a reboot is needed
+ */
+static bool canSoftSwitchMode(const swadgeMode* from, const swadgeMode* to)
+{
+    return !from->overrideUsb && !to->overrideUsb;
+}
+
+/**
+ * @brief Switch from cSwadgeMode to pendingSwadgeMode without rebooting.
+ *
+ * The current mode's fnExitMode() must stop any timers it started and free
+ * everything it allocated, just as when the swadge shuts down. A warning is
+ * logged if it leaves timers (emulator) or tasks (hardware) behind. After that,
+ * shared peripherals are torn down or reinitialized for the next mode, and
+ * state the main loop keeps for the mode is reset to what it would be after a
+ * reboot.
+ *
+ * @param disp The display to pass to the next mode
+ */
+static void softSwitchSwadgeMode(display_t* disp)
+{
+    // Exit the current mode
+    if(NULL != cSwadgeMode->fnExitMode)
+    {
+        cSwadgeMode->fnExitMode();
+    }
+    // Commit anything the mode wrote to NVS, including while exiting
+    flushNvs();
+
+    // Timers and tasks would keep running in the next mode
+    int32_t leaked = countModeResources() - preModeResources;
+    if(leaked > 0)
+    {
+        ESP_LOGW("MAIN", "%s left %" PRId32 " " MODE_RESOURCES " behind", cSwadgeMode->modeName, leaked);
+    }
+
+    deinitModePeripherals(pendingSwadgeMode);
+
+    // Free everything the mode allocated from the arena
+    modeArenaReset();
+#if defined(EMU)
+    emuAllocModeExit();
+#endif
+
+    // Switch the mode IDX
+    cSwadgeMode = pendingSwadgeMode;
+    pendingSwadgeMode = NULL;
+
+    // Reset state the main loop keeps for the mode
+    setFrameRateUs(DEFAULT_FRAME_RATE_US);
+    tAccumAccel = 0;
+    sst = NONE_PRESSED;
+    dblBtnTmr = -1;
+
+    initModePeripherals(cSwadgeMode);
+
+    // Reset the shared audio analysis for the next mode
+    initAudioAnalysis();
+    audioAnalysisSetModeCb(cSwadgeMode->fnAudioAnalysisCallback);
+
+    // Don't pass input from the last mode to the next one, but keep track of
+    // which buttons and pads are held
+    buttonEvt_t bEvt = {0};
+    while(checkButtonQueue(&bEvt))
+    {
+        lastBtnState = bEvt.state;
+    }
+    drainTouchSensor();
+
+    // Enter the next mode
+#if defined(EMU)
+    emuAllocModeEnter(cSwadgeMode);
+#endif
+    preModeResources = countModeResources();
+    if(NULL != cSwadgeMode->fnEnterMode)
+    {
+        cSwadgeMode->fnEnterMode(disp);
+    }
+}
+
+/**
+ * @brief Count the resources a mode must release in fnExitMode() which can be
+ * counted. The emulator has timers but no tasks, and the IDF can't count
+ * timers, so this counts whichever is available
+ *
+ * @return The number of timers or tasks which exist
+ */
+static int32_t countModeResources(void)
+{
+#if defined(EMU)
+    return count_esp_timers();
+#else
+    return (int32_t)uxTaskGetNumberOfTasks();
+#endif
+}
+
+/**
+ * @brief Initialize the TFT display
+ *
+ * @param disp The display to initialize
+ */
+static void initTftDisplay(display_t* disp)
+{
+    int8_t bt = bootTimelineStart("tft");
+#if defined(CONFIG_SWADGE_DEVKIT)
+    initTFT(disp,
+            SPI2_HOST,
+            GPIO_NUM_36, // sclk
+            GPIO_NUM_37, // mosi
+            GPIO_NUM_21, // dc
+            GPIO_NUM_34, // cs
+            GPIO_NUM_38, // rst
+            GPIO_NUM_7,  // backlight (dummy GPIO for now)
+            false);      // binary backlight
+#elif defined(CONFIG_SWADGE_PROTOTYPE)
+    initTFT(disp,
+            SPI2_HOST,
+            GPIO_NUM_36, // sclk
+            GPIO_NUM_37, // mosi
+            GPIO_NUM_21, // dc
+            GPIO_NUM_34, // cs
+            GPIO_NUM_38, // rst
+            GPIO_NUM_35, // backlight
+            true);       // PWM backlight
+#endif
+    bootTimelineEnd(bt);
+}
+
+#if !defined(EMU)
+/**
+ * @brief A short lived task which initializes the TFT while the main task
+ * initializes other peripherals, then signals tftInitDone
+ *
+ * @param arg The display_t to initialize
+ */
+static void tftInitTask(void* arg)
+{
+    initTftDisplay((display_t*)arg);
+    xSemaphoreGive(tftInitDone);
+    vTaskDelete(NULL);
+}
+#endif
+
 /**
  * Set the frame rate for all displays
  *
@@ -1080,7 +1516,177 @@ void overrideToSwadgeMode( swadgeMode* mode )
 void setFrameRateUs(uint32_t frameRate)
 {
     frameRateUs = frameRate;
+
+    // Restart the frame timer with the new period. A period of 0 draws as
+    // fast as possible, which doesn't need a timer
+    if(NULL != frameTimer)
+    {
+        esp_timer_stop(frameTimer);
+        if(0 != frameRateUs)
+        {
+            esp_timer_start_periodic(frameTimer, frameRateUs);
+        }
+    }
+}
+
+/**
+ * @brief Called every frameRateUs to wake the main loop to draw a frame
+ *
+ * @param arg unused
+ */
+static void frameTimerCb(void* arg __attribute__((unused)))
+{
+    frameDue = true;
+#if !defined(EMU)
+    if(NULL != mainTaskHandle)
+    {
+        xTaskNotifyGive(mainTaskHandle);
+    }
+#endif
+}
+
+/**
+ * @brief Read the accelerometer and pass the reading to the current mode, if
+ * it wants it
+ */
+static void pollAccelerometer(void)
+{
+    if(accelInitialized && NULL != cSwadgeMode->fnAccelerometerCallback)
+    {
+        accel_t accel = {0};
+#if defined(QMA6981)
+        QMA6981_poll(&accel);
+#elif defined(QMA7981)
+        qma7981_get_acce_int(&accel.x, &accel.y, &accel.z);
+#endif
+        cSwadgeMode->fnAccelerometerCallback(&accel);
+    }
+}
+
+/**
+ * @brief Read every sample the accelerometer buffered since the last drain with
+ * one burst read, and pass them to the current mode oldest first
+ */
+static void drainAccelerometerFifo(void)
+{
+#if defined(QMA7981)
+    if(accelInitialized && NULL != cSwadgeMode->fnAccelerometerCallback)
+    {
+        int16_t xyz[3 * ACCEL_FIFO_SAMPLES];
+        uint8_t numSamples = 0;
+        qma7981_get_acce_fifo(xyz, ACCEL_FIFO_SAMPLES, &numSamples);
+        for(uint8_t i = 0; i < numSamples; i++)
+        {
+            accel_t accel =
+            {
+                .x = xyz[3 * i],
+                .y = xyz[(3 * i) + 1],
+                .z = xyz[(3 * i) + 2],
+            };
+            cSwadgeMode->fnAccelerometerCallback(&accel);
+        }
+    }
+#endif
+}
+
+#if !defined(EMU)
+/**
+ * @brief Figure out how long the main loop may block before it has to poll
+ * something which can't wake it up
+ *
+ * @return The number of ticks to block for, which may be portMAX_DELAY, or 0
+ *         to only yield
+ */
+static TickType_t getMainLoopWaitTicks(void)
+{
+    // Drawing as fast as possible
+    if(0 == frameRateUs)
+    {
+        return 0;
+    }
+
+    // The ADC DMA has no completion callback, but it buffers 64ms of samples,
+    // so read it every tick while anything is listening
+    if(micInit && ((NULL != cSwadgeMode->fnAudioCallback) || audioAnalysisHasSubscribers()))
+    {
+        return 1;
+    }
+
+    // Packets received over serial aren't notified
+    if(wifiInit && espNowIsSerial())
+    {
+        return 1;
+    }
+
+    // Wake up in time to poll the accelerometer at the mode's rate
+    if(!accelFifoEnabled && (0 != cSwadgeMode->accelerometerPeriodUs))
+    {
+        uint32_t tUntilPollUs = 0;
+        if(tAccumAccel < cSwadgeMode->accelerometerPeriodUs)
+        {
+            tUntilPollUs = cSwadgeMode->accelerometerPeriodUs - tAccumAccel;
+        }
+        uint32_t usPerTick = portTICK_PERIOD_MS * 1000;
+        return (tUntilPollUs + usPerTick - 1) / usPerTick;
+    }
+
+    // Otherwise the frame timer will wake up the main loop
+    return portMAX_DELAY;
+}
+#else
+/**
+ * @brief Find how long the emulator's main loop can sleep before something
+ * needs it. Timers, including the frame timer, and notes are scheduled, but
+ * packets still need to be polled for
+ *
+ * @return The time to sleep in microseconds, or 0 to only yield
+ */
+static int64_t getEmuLoopSleepUs(void)
+{
+    // Drawing as fast as possible
+    if(0 == frameRateUs)
+    {
+        return 0;
+    }
+
+    // Packets aren't scheduled, so keep checking for them every millisecond
+    if(NO_WIFI != cSwadgeMode->wifiMode)
+    {
+        return 1000;
+    }
+
+    int64_t tWakeUs = esp_timer_get_next_alarm();
+    int64_t tNoteUs = emuSoundGetNextNoteTime();
+    if(tNoteUs < tWakeUs)
+    {
+        tWakeUs = tNoteUs;
+    }
+
+    int64_t tSleepUs = EMU_MAX_SLEEP_US;
+    int64_t tNowUs = esp_timer_get_time();
+    if(tWakeUs - tNowUs < tSleepUs)
+    {
+        tSleepUs = tWakeUs - tNowUs;
+    }
+
+    // Wake up in time to poll the accelerometer at the mode's rate
+    if(!accelFifoEnabled && (0 != cSwadgeMode->accelerometerPeriodUs))
+    {
+        int64_t tUntilPollUs = 0;
+        if(tAccumAccel < cSwadgeMode->accelerometerPeriodUs)
+        {
+            tUntilPollUs = cSwadgeMode->accelerometerPeriodUs - tAccumAccel;
+        }
+        if(tUntilPollUs < tSleepUs)
+        {
+            tSleepUs = tUntilPollUs;
+        }
+    }
+
+    // Something is already due, so just yield
+    return (tSleepUs > 0) ? tSleepUs : 0;
 }
+#endif
 
 /**
  * @brief Simulate a button event. This is used to generate
@@ -1098,7 +1704,8 @@ void simulateBtn(void (*fnButtonCallback)(buttonEvt_t* evt), buttonBit_t btn, ui
         {
             .button = btn,
             .down = true,
-            .state = state | btn
+            .state = state | btn,
+            .time = esp_timer_get_time()
         };
         fnButtonCallback(&evt);
     }
@@ -0,0 +1,252 @@
+/*
+ * The LED compositor lets dances and mode effects draw into separate layers,
+ * which are blended with integer math and sent with a single setLeds() call
+ * when something changed.
+ */
+
+//==============================================================================
+// Includes
+//==============================================================================
+
+#include <string.h>
+
+#include "led_compositor.h"
+
+//==============================================================================
+// Function prototypes
+//==============================================================================
+
+static inline uint8_t scale8(uint8_t a, uint8_t b);
+static inline uint8_t blend8(uint8_t below, uint8_t above, ledBlend_t blend, uint8_t opacity);
+
+//==============================================================================
+// Functions
+//==============================================================================
+
+/**
+ * @brief Initialize a compositor. The base layer is enabled and replaces the
+ * black background, the other layers are disabled
+ *
+ * @param comp The compositor to initialize
+ */
+void ledCompositorInit(ledCompositor_t* comp)
+{
+    memset(comp, 0, sizeof(ledCompositor_t));
+    for(uint8_t i = 0; i < MAX_LED_LAYERS; i++)
+    {
+        comp->layers[i].blend = LED_BLEND_REPLACE;
+        comp->layers[i].opacity = 255;
+    }
+    comp->layers[LED_LAYER_BASE].enabled = true;
+    comp->dirty = true;
+}
+
+/**
+ * @brief Set every LED in a layer
+ *
+ * @param comp The compositor
+ * @param layer The layer to set
+ * @param leds NUM_LEDS colors to copy into the layer
+ */
+void ledCompositorSetLayer(ledCompositor_t* comp, uint8_t layer, const led_t* leds)
+{
+    memcpy(comp->layers[layer].leds, leds, sizeof(comp->layers[layer].leds));
+    comp->dirty = true;
+}
+
+/**
+ * @brief Set every LED in a layer to the same color
+ *
+ * @param comp The compositor
+ * @param layer The layer to fill
+ * @param color The color to fill with
+ * @param level The brightness to scale the color by, 0 to 255
+ */
+void ledCompositorFillLayer(ledCompositor_t* comp, uint8_t layer, led_t color, uint8_t level)
+{
+    led_t scaled = ledScale(color, level);
+    for(uint8_t i = 0; i < NUM_LEDS; i++)
+    {
+        comp->layers[layer].leds[i] = scaled;
+    }
+    comp->dirty = true;
+}
+
+/**
+ * @brief Set every LED in a layer to black
+ *
+ * @param comp The compositor
+ * @param layer The layer to clear
+ */
+void ledCompositorClearLayer(ledCompositor_t* comp, uint8_t layer)
+{
+    memset(comp->layers[layer].leds, 0, sizeof(comp->layers[layer].leds));
+    comp->dirty = true;
+}
+
+/**
+ * @brief Set how a layer is combined with the layers below it
+ *
+ * @param comp The compositor
+ * @param layer The layer to set
+ * @param blend The blend mode
+ * @param opacity How much effect the layer has, 0 to 255
+ */
+void ledCompositorSetBlend(ledCompositor_t* comp, uint8_t layer, ledBlend_t blend, uint8_t opacity)
+{
+    comp->layers[layer].blend = blend;
+    comp->layers[layer].opacity = opacity;
+    comp->dirty = true;
+}
+
+/**
+ * @brief Enable or disable a layer
+ *
+ * @param comp The compositor
+ * @param layer The layer to enable or disable
+ * @param enable true to enable the layer, false to skip it
+ */
+void ledCompositorEnableLayer(ledCompositor_t* comp, uint8_t layer, bool enable)
+{
+    if(comp->layers[layer].enabled != enable)
+    {
+        comp->layers[layer].enabled = enable;
+        comp->dirty = true;
+    }
+}
+
+/**
+ * @brief Blend all enabled layers and send them to the LEDs. Nothing is sent
+ * if no layer changed since the last render. This should be called once per
+ * frame, after all layers are updated
+ *
+ * @param comp The compositor to render
+ */
+void ledCompositorRender(ledCompositor_t* comp)
+{
+    if(!comp->dirty)
+    {
+        return;
+    }
+    comp->dirty = false;
+
+    led_t out[NUM_LEDS] = {{0}};
+    for(uint8_t l = 0; l < MAX_LED_LAYERS; l++)
+    {
+        const ledLayer_t* layer = &comp->layers[l];
+        if(!layer->enabled || (0 == layer->opacity))
+        {
+            continue;
+        }
+
+        for(uint8_t i = 0; i < NUM_LEDS; i++)
+        {
+            out[i].r = blend8(out[i].r, layer->leds[i].r, layer->blend, layer->opacity);
+            out[i].g = blend8(out[i].g, layer->leds[i].g, layer->blend, layer->opacity);
+            out[i].b = blend8(out[i].b, layer->leds[i].b, layer->blend, layer->opacity);
+        }
+    }
+
+    setLeds(out, NUM_LEDS);
+}
+
+/**
+ * @brief Scale a color's brightness
+ *
+ * @param color The color to scale
+ * @param level The brightness, 0 (black) to 255 (unchanged)
+ * @return The scaled color
+ */
+led_t ledScale(led_t color, uint8_t level)
+{
+    led_t scaled =
+    {
+        .r = scale8(color.r, level),
+        .g = scale8(color.g, level),
+        .b = scale8(color.b, level),
+    };
+    return scaled;
+}
+
+/**
+ * @brief Get an envelope's level at a point in time
+ *
+ * @param env The envelope to evaluate
+ * @param tUs The time since the envelope started, in microseconds
+ * @return The level at that time, 0 to 255. Before the first keyframe this is
+ *         the first keyframe's level, and after the last keyframe of an
+ *         envelope which doesn't loop this is the last keyframe's level
+ */
+uint8_t ledEnvelopeEval(const ledEnvelope_t* env, uint32_t tUs)
+{
+    if(0 == env->numKeys)
+    {
+        return 0;
+    }
+
+    const ledKeyframe_t* last = &env->keys[env->numKeys - 1];
+    if(env->loop && (0 != last->tUs))
+    {
+        tUs %= last->tUs;
+    }
+
+    if(tUs <= env->keys[0].tUs)
+    {
+        return env->keys[0].level;
+    }
+
+    for(uint8_t i = 1; i < env->numKeys; i++)
+    {
+        const ledKeyframe_t* k0 = &env->keys[i - 1];
+        const ledKeyframe_t* k1 = &env->keys[i];
+        if(tUs < k1->tUs)
+        {
+            int32_t dLevel = (int32_t)k1->level - (int32_t)k0->level;
+            return k0->level + (int32_t)(((int64_t)dLevel * (tUs - k0->tUs)) / (k1->tUs - k0->tUs));
+        }
+    }
+    return last->level;
+}
+
+/**
+ * @brief Multiply two values in 0-255 as if they were fractions of 255
+ *
+ * @param a A value
+ * @param b Another value
+ * @return a * b / 255, where 255 * b is b
+ */
+static inline uint8_t scale8(uint8_t a, uint8_t b)
+{
+    return (uint8_t)(((uint16_t)a * b + 255) >> 8);
+}
+
+/**
+ * @brief Blend one channel of a layer with the channel below it
+ *
+ * @param below The channel from the layers below
+ * @param above The channel from this layer
+ * @param blend How to blend the channels
+ * @param opacity How much effect this layer has
+ * @return The blended channel
+ */
+static inline uint8_t blend8(uint8_t below, uint8_t above, ledBlend_t blend, uint8_t opacity)
+{
+    switch(blend)
+    {
+        case LED_BLEND_ADD:
+        {
+            uint16_t sum = below + scale8(above, opacity);
+            return (sum > 255) ? 255 : sum;
+        }
+        case LED_BLEND_MAX:
+        {
+            uint8_t scaled = scale8(above, opacity);
+            return (scaled > below) ? scaled : below;
+        }
+        case LED_BLEND_REPLACE:
+        default:
+        {
+            return below + (((int32_t)above - below) * opacity) / 255;
+        }
+    }
+}
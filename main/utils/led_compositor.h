@@ -0,0 +1,99 @@
+#ifndef _LED_COMPOSITOR_H_
+#define _LED_COMPOSITOR_H_
+
+//==============================================================================
+// Includes
+//==============================================================================
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "led_util.h"
+#include "swadgeMode.h"
+
+//==============================================================================
+// Defines
+//==============================================================================
+
+/// The bottom layer, usually a dance or a mode's main LED effect
+#define LED_LAYER_BASE    0
+/// The layer drawn over the base, usually a short mode effect
+#define LED_LAYER_OVERLAY 1
+/// The number of layers in a compositor
+#define MAX_LED_LAYERS    2
+
+//==============================================================================
+// Enums
+//==============================================================================
+
+/**
+ * How a layer is combined with the layers below it. The layer's opacity scales
+ * its effect in every mode
+ */
+typedef enum
+{
+    LED_BLEND_REPLACE, ///< Fade from the layers below to this one
+    LED_BLEND_ADD,     ///< Add this layer to the layers below, saturating
+    LED_BLEND_MAX,     ///< Keep the brighter of this layer and the layers below
+} ledBlend_t;
+
+//==============================================================================
+// Structs
+//==============================================================================
+
+/**
+ * A point in an envelope. Levels are linearly interpolated between keyframes
+ */
+typedef struct
+{
+    uint32_t tUs;  ///< The time of this keyframe, from the start of the envelope
+    uint8_t level; ///< The level at this time, 0 to 255
+} ledKeyframe_t;
+
+/**
+ * A brightness curve over time, made of keyframes in increasing time order.
+ * These are usually const and shared
+ */
+typedef struct
+{
+    const ledKeyframe_t* keys; ///< The keyframes
+    uint8_t numKeys;           ///< The number of keyframes
+    bool loop;                 ///< true to repeat after the last keyframe
+} ledEnvelope_t;
+
+/**
+ * One layer of LED colors in a compositor
+ */
+typedef struct
+{
+    led_t leds[NUM_LEDS]; ///< This layer's colors
+    ledBlend_t blend;     ///< How this layer is combined with the ones below
+    uint8_t opacity;      ///< How much effect this layer has, 0 to 255
+    bool enabled;         ///< false to skip this layer
+} ledLayer_t;
+
+/**
+ * A stack of LED layers which are blended into one setLeds() call per frame
+ */
+typedef struct
+{
+    ledLayer_t layers[MAX_LED_LAYERS]; ///< The layers, bottom first
+    bool dirty;                        ///< Set when a layer changed since the last render
+} ledCompositor_t;
+
+//==============================================================================
+// Functions
+//==============================================================================
+
+void ledCompositorInit(ledCompositor_t* comp);
+void ledCompositorSetLayer(ledCompositor_t* comp, uint8_t layer, const led_t* leds);
+void ledCompositorFillLayer(ledCompositor_t* comp, uint8_t layer, led_t color, uint8_t level);
+void ledCompositorClearLayer(ledCompositor_t* comp, uint8_t layer);
+void ledCompositorSetBlend(ledCompositor_t* comp, uint8_t layer, ledBlend_t blend, uint8_t opacity);
+void ledCompositorEnableLayer(ledCompositor_t* comp, uint8_t layer, bool enable);
+void ledCompositorRender(ledCompositor_t* comp);
+
+led_t ledScale(led_t color, uint8_t level);
+uint8_t ledEnvelopeEval(const ledEnvelope_t* env, uint32_t tUs);
+
+#endif
@@ -0,0 +1,240 @@
+/*
+ * The mode arena holds memory which lives exactly as long as the current swadge
+ * mode. Allocations are bumped out of large chunks, and every chunk is freed at
+ * once when the mode exits, so modes don't need to free anything they allocate
+ * from it.
+ */
+
+//==============================================================================
+// Includes
+//==============================================================================
+
+#include <stdbool.h>
+#include <string.h>
+
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+
+#include "mode_arena.h"
+
+//==============================================================================
+// Defines
+//==============================================================================
+
+/// All allocations are aligned to this many bytes
+#define ARENA_ALIGN 8
+#define ARENA_ROUND_UP(x) (((x) + (ARENA_ALIGN - 1)) & ~((size_t)ARENA_ALIGN - 1))
+
+//==============================================================================
+// Structs
+//==============================================================================
+
+/// A chunk of memory, followed by its data
+typedef struct arenaChunk
+{
+    struct arenaChunk* next;
+    size_t size;
+    size_t used;
+} arenaChunk_t;
+
+typedef struct
+{
+    uint32_t caps;         ///< The capabilities to allocate chunks with
+    size_t chunkSize;      ///< The usual size of a chunk's data
+    arenaChunk_t* chunks;  ///< All chunks. The first is the one being bumped
+    size_t used;           ///< The total bytes allocated from this region
+} arena_t;
+
+//==============================================================================
+// Variables
+//==============================================================================
+
+static arena_t arenas[NUM_ARENA_REGIONS] =
+{
+    [ARENA_INTERNAL] =
+    {
+        .caps = MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT,
+        .chunkSize = 4 * 1024,
+    },
+    [ARENA_SPIRAM] =
+    {
+        .caps = MALLOC_CAP_SPIRAM,
+        .chunkSize = 32 * 1024,
+    },
+};
+
+/// Incremented each time the arena is reset, so pools know when to empty
+static uint32_t arenaGeneration = 1;
+
+//==============================================================================
+// Functions
+//==============================================================================
+
+/**
+ * @brief Allocate zeroed memory which is freed automatically when the current
+ * mode exits. Do not free() it.
+ *
+ * @param region The kind of memory to allocate
+ * @param size The number of bytes to allocate
+ * @return A pointer to the memory, or NULL if it couldn't be allocated
+ */
+void* modeArenaAlloc(arenaRegion_t region, size_t size)
+{
+    arena_t* arena = &arenas[region];
+    size = ARENA_ROUND_UP(size);
+
+    arenaChunk_t* chunk = arena->chunks;
+    if((NULL == chunk) || (chunk->size - chunk->used < size))
+    {
+        // Big allocations get their own chunk so they don't waste the rest of
+        // the current one
+        bool dedicated = (size > arena->chunkSize / 4);
+        size_t dataSize = dedicated ? size : arena->chunkSize;
+
+        size_t chunkSize = ARENA_ROUND_UP(sizeof(arenaChunk_t)) + dataSize;
+        chunk = heap_caps_malloc(chunkSize, arena->caps);
+        if((NULL == chunk) && (ARENA_SPIRAM == region))
+        {
+            // Not every swadge has SPI RAM
+            chunk = heap_caps_malloc(chunkSize, MALLOC_CAP_8BIT);
+        }
+        if(NULL == chunk)
+        {
+            ESP_LOGE("ARENA", "Couldn't allocate %d bytes", (int)size);
+            return NULL;
+        }
+        chunk->size = dataSize;
+        chunk->used = 0;
+
+        if(dedicated && (NULL != arena->chunks))
+        {
+            // Keep bumping the current chunk
+            chunk->next = arena->chunks->next;
+            arena->chunks->next = chunk;
+        }
+        else
+        {
+            chunk->next = arena->chunks;
+            arena->chunks = chunk;
+        }
+    }
+
+    uint8_t* mem = ((uint8_t*)chunk) + ARENA_ROUND_UP(sizeof(arenaChunk_t)) + chunk->used;
+    chunk->used += size;
+    arena->used += size;
+
+    memset(mem, 0, size);
+    return mem;
+}
+
+/**
+ * @brief Free everything allocated from the arena. This is called by the
+ * system after the current mode's fnExitMode(), modes shouldn't call it
+ */
+void modeArenaReset(void)
+{
+    for(uint8_t r = 0; r < NUM_ARENA_REGIONS; r++)
+    {
+        arenaChunk_t* chunk = arenas[r].chunks;
+        while(NULL != chunk)
+        {
+            arenaChunk_t* next = chunk->next;
+            heap_caps_free(chunk);
+            chunk = next;
+        }
+        arenas[r].chunks = NULL;
+        arenas[r].used = 0;
+    }
+    arenaGeneration++;
+}
+
+/**
+ * @brief Get the number of bytes allocated from an arena region
+ *
+ * @param region The region to check
+ * @return The number of bytes allocated, including alignment padding
+ */
+size_t modeArenaUsed(arenaRegion_t region)
+{
+    return arenas[region].used;
+}
+
+/**
+ * @brief Initialize a pool of fixed size objects. No memory is allocated until
+ * the first object is
+ *
+ * @param pool The pool to initialize
+ * @param region The kind of memory to allocate objects from
+ * @param objSize The size of each object
+ * @param objsPerBlock The number of objects to allocate from the arena at a time
+ */
+void modePoolInit(modePool_t* pool, arenaRegion_t region, size_t objSize, uint16_t objsPerBlock)
+{
+    if(objSize < sizeof(void*))
+    {
+        objSize = sizeof(void*);
+    }
+
+    pool->region = region;
+    pool->objSize = ARENA_ROUND_UP(objSize);
+    pool->objsPerBlock = (0 == objsPerBlock) ? 1 : objsPerBlock;
+    pool->freeList = NULL;
+    pool->generation = arenaGeneration;
+}
+
+/**
+ * @brief Allocate a zeroed object from a pool. It may be returned with
+ * modePoolFree(), and is freed automatically when the current mode exits
+ *
+ * @param pool The pool to allocate from
+ * @return A pointer to the object, or NULL if it couldn't be allocated
+ */
+void* modePoolAlloc(modePool_t* pool)
+{
+    // The arena was reset since the pool was used, so its objects are gone
+    if(pool->generation != arenaGeneration)
+    {
+        pool->freeList = NULL;
+        pool->generation = arenaGeneration;
+    }
+
+    if(NULL == pool->freeList)
+    {
+        uint8_t* block = modeArenaAlloc(pool->region, pool->objSize * pool->objsPerBlock);
+        if(NULL == block)
+        {
+            return NULL;
+        }
+
+        // Link every object in the block into the free list
+        for(uint16_t i = 0; i < pool->objsPerBlock; i++)
+        {
+            void* obj = &block[i * pool->objSize];
+            *(void**)obj = pool->freeList;
+            pool->freeList = obj;
+        }
+    }
+
+    void* obj = pool->freeList;
+    pool->freeList = *(void**)obj;
+    memset(obj, 0, pool->objSize);
+    return obj;
+}
+
+/**
+ * @brief Return an object to its pool so it can be allocated again
+ *
+ * @param pool The pool the object was allocated from
+ * @param obj The object to return
+ */
+void modePoolFree(modePool_t* pool, void* obj)
+{
+    // Objects from before the arena was reset are already gone
+    if((NULL == obj) || (pool->generation != arenaGeneration))
+    {
+        return;
+    }
+
+    *(void**)obj = pool->freeList;
+    pool->freeList = obj;
+}
@@ -0,0 +1,55 @@
+#ifndef _MODE_ARENA_H_
+#define _MODE_ARENA_H_
+
+//==============================================================================
+// Includes
+//==============================================================================
+
+#include <stddef.h>
+#include <stdint.h>
+
+//==============================================================================
+// Enums
+//==============================================================================
+
+/**
+ * The kinds of memory the mode arena can allocate from
+ */
+typedef enum
+{
+    ARENA_INTERNAL, ///< Internal RAM, for small or frequently accessed data
+    ARENA_SPIRAM,   ///< SPI RAM, for large buffers. Falls back to internal RAM
+    NUM_ARENA_REGIONS
+} arenaRegion_t;
+
+//==============================================================================
+// Structs
+//==============================================================================
+
+/**
+ * A pool of fixed size objects, allocated from the mode arena in blocks.
+ * Freed objects are reused by the next allocation. A pool may be static, it is
+ * emptied automatically when the arena is reset.
+ */
+typedef struct
+{
+    arenaRegion_t region;  ///< The region to allocate blocks from
+    size_t objSize;        ///< The size of each object, rounded up for alignment
+    uint16_t objsPerBlock; ///< The number of objects to allocate at a time
+    void* freeList;        ///< Objects which are ready to be allocated
+    uint32_t generation;   ///< The arena generation the free list belongs to
+} modePool_t;
+
+//==============================================================================
+// Functions
+//==============================================================================
+
+void* modeArenaAlloc(arenaRegion_t region, size_t size);
+void modeArenaReset(void);
+size_t modeArenaUsed(arenaRegion_t region);
+
+void modePoolInit(modePool_t* pool, arenaRegion_t region, size_t objSize, uint16_t objsPerBlock);
+void* modePoolAlloc(modePool_t* pool);
+void modePoolFree(modePool_t* pool, void* obj);
+
+#endif
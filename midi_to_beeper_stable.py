@@ -1,10 +1,12 @@
 # Convert MIDI to song_t structs for Super-2023-Swadge-FW
-# Outputs to stdout
+# Outputs to stdout, or to an encoded .sng file for SPIFFS with -o
+# Existing song_t structs in C files can also be converted to .sng files
 
 from dataclasses import dataclass, field
 from typing import List
+import argparse
+import re
 import sys
-from mido import MidiFile
 
 pitch_to_str = {
     0: 'SILENCE',
@@ -118,6 +120,32 @@ pitch_to_str = {
     119: 'B_8',
 }
 
+# Names of the notes in an octave, in noteFrequency_t order
+note_names = ['C', 'C_SHARP', 'D', 'D_SHARP', 'E', 'F', 'F_SHARP', 'G', 'G_SHARP', 'A', 'A_SHARP', 'B']
+
+# MIDI note numbers of every noteFrequency_t name, C_0 through B_10
+str_to_pitch = {'SILENCE': 0}
+for octave in range(11):
+    for idx, name in enumerate(note_names):
+        str_to_pitch[f"{name}_{octave}"] = 12 * (octave + 1) + idx
+
+# Must match song_cursor.h
+SONG_MAGIC = b'SNG'
+SONG_VERSION = 1
+SONG_FLAG_LOOP = 0x01
+
+def varint(value):
+    """Encode a number seven bits at a time, least significant group first"""
+    out = bytearray()
+    while True:
+        byte = value & 0x7F
+        value >>= 7
+        if value:
+            out.append(byte | 0x80)
+        else:
+            out.append(byte)
+            return bytes(out)
+
 @dataclass
 class Note:
     note: str
@@ -132,6 +160,7 @@ class Song:
     notes: List['Note']
     numNotes: int = field(init=False)
     shouldLoop: bool
+    loopStartNote: int = 0
 
     def __post_init__(self):
         self.numNotes = len(self.notes)
@@ -149,13 +178,21 @@ class Song:
 }};
 """.format(name, "        ".join([f"{note},\n" for note in self.notes]), self.numNotes, str(self.shouldLoop).lower())
 
-def main():
-    if len(sys.argv) < 2:
-        print(f"Format: python {sys.argv[0]} <input.mid> > <output.c>", file=sys.stderr)
-        print(f"This program outputs to the terminal (stdout), so you can write it to a file as shown above.", file=sys.stderr)
-        sys.exit()
+    def to_sng(self):
+        """Encode the song for loadSong(). Each note is a MIDI note number and a varint duration"""
+        out = bytearray(SONG_MAGIC)
+        out.append(SONG_VERSION)
+        out.append(SONG_FLAG_LOOP if self.shouldLoop else 0)
+        out += varint(self.numNotes)
+        out += varint(self.loopStartNote)
+        for note in self.notes:
+            out.append(str_to_pitch[note.note])
+            out += varint(int(note.timeMs))
+        return bytes(out)
 
-    mid = MidiFile(sys.argv[1])
+def parse_midi(fname):
+    from mido import MidiFile
+    mid = MidiFile(fname)
 
     notes = []
 
@@ -192,9 +229,63 @@ def main():
         else:
             last_note_event_delta += msg.time
 
-    song = Song(notes=notes, shouldLoop=True)
+    return Song(notes=notes, shouldLoop=True)
+
+def parse_c(fname, name):
+    """Read a song_t struct named name from a C file"""
+    with open(fname) as f:
+        src = f.read()
+
+    match = re.search(r"song_t\s+" + re.escape(name) + r"\s*=\s*\{(.*?)\n\};", src, re.DOTALL)
+    if match is None:
+        raise SystemExit(f"Couldn't find song_t {name} in {fname}")
+    body = match.group(1)
+
+    notes = [Note(note=n, timeMs=int(t), dutyCyclePct=0.5) for n, t in
+             re.findall(r"\{\s*(?:\.note\s*=\s*)?(\w+)\s*,\s*(?:\.timeMs\s*=\s*)?(\d+)", body)]
+
+    def field_value(key, default):
+        m = re.search(r"\." + key + r"\s*=\s*(\w+)", body)
+        if m is None:
+            return default
+        if m.group(1) in ('true', 'false'):
+            return m.group(1) == 'true'
+        return int(m.group(1))
+
+    song = Song(notes=notes, shouldLoop=bool(field_value('shouldLoop', 0)),
+                loopStartNote=field_value('loopStartNote', 0))
+    if song.numNotes != field_value('numNotes', song.numNotes):
+        print(f"Warning: {name} has {song.numNotes} notes but numNotes is {field_value('numNotes', 0)}", file=sys.stderr)
+    return song
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Convert a MIDI file, or a song_t in a C file, to a song for the swadge. "
+                    "Without -o a song_t struct is written to the terminal (stdout).")
+    parser.add_argument('input', help="a .mid file, or a .c file with --song")
+    parser.add_argument('-o', '--output', help="write an encoded .sng file for the spiffs assets instead")
+    parser.add_argument('--song', help="the name of the song_t to read from a .c file")
+    parser.add_argument('--loop-start', type=int, help="the note to loop back to")
+    parser.add_argument('--no-loop', action='store_true', help="play the song once")
+    args = parser.parse_args()
+
+    if args.input.endswith('.c'):
+        if args.song is None:
+            parser.error("--song is required for .c files")
+        song = parse_c(args.input, args.song)
+    else:
+        song = parse_midi(args.input)
+
+    if args.no_loop:
+        song.shouldLoop = False
+    if args.loop_start is not None:
+        song.loopStartNote = args.loop_start
 
-    print(song.to_struct(name='song'))
+    if args.output:
+        with open(args.output, 'wb') as f:
+            f.write(song.to_sng())
+    else:
+        print(song.to_struct(name='song'))
 
 
 if __name__ == '__main__':
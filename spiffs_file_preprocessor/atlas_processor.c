@@ -0,0 +1,241 @@
+/* scandir() and strdup() aren't part of C99 */
+#define _DEFAULT_SOURCE
+
+#include <dirent.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "atlas_processor.h"
+#include "image_processor.h"
+#include "heatshrink_encoder.h"
+#include "fileUtils.h"
+
+/* Must match the display code which loads the atlas */
+#define ATLAS_MAGIC   "ATL"
+#define ATLAS_VERSION 1
+
+/**
+ * @brief Only pack PNGs which aren't fonts into an atlas
+ *
+ * @param ent A directory entry
+ * @return nonzero if the entry should be packed
+ */
+static int isAtlasImage(const struct dirent *ent)
+{
+    size_t len = strlen(ent->d_name);
+    if(len < 4 || 0 != strcmp(&ent->d_name[len - 4], ".png"))
+    {
+        return 0;
+    }
+    if(len >= 9 && 0 == strcmp(&ent->d_name[len - 9], ".font.png"))
+    {
+        return 0;
+    }
+    return 1;
+}
+
+/**
+ * @brief Compare two region names with strcmp(), for qsort()
+ *
+ * @param a A pointer to the first name
+ * @param b A pointer to the second name
+ * @return <0, 0 or >0 like strcmp()
+ */
+static int cmpRegionNames(const void *a, const void *b)
+{
+    return strcmp(*(char * const *)a, *(char * const *)b);
+}
+
+/**
+ * @brief Pack every PNG in a directory into one compressed atlas, so a mode can
+ * load all of its sprites with one file read and one decoder. The directory
+ * "name.atlas" becomes "name.atl".
+ *
+ * The decompressed atlas is:
+ *   'A' 'T' 'L' ATLAS_VERSION
+ *   two byte number of regions
+ *   for each region, the PNG's name without ".png" and a NUL, then a two byte
+ *   width and two byte height
+ *   for each region, its width * height palette indices
+ *
+ * Regions are sorted by their names with strcmp(), after ".png" is removed.
+ * getAtlasIndex() binary searches the names with strcmp(), so it depends on
+ * this exact order. It also keeps indices stable when files are added
+ * elsewhere. Numbers are big endian like a WSG's.
+ *
+ * @param indir The directory of PNGs to pack
+ * @param outdir The directory to write the atlas to
+ */
+void process_atlas(const char *indir, const char *outdir)
+{
+    /* Determine if the output file already exists */
+    char outFilePath[128] = {0};
+    strcat(outFilePath, outdir);
+    strcat(outFilePath, "/");
+    strcat(outFilePath, get_filename(indir));
+
+    /* Change the extension from .atlas to .atl */
+    char * dotptr = strrchr(outFilePath, '.');
+    dotptr[4] = 0;
+
+    if(doesFileExist(outFilePath))
+    {
+        printf("Output for %s already exists\n", indir);
+        return;
+    }
+
+    /* List the PNGs */
+    struct dirent **ents;
+    int numEnts = scandir(indir, &ents, isAtlasImage, NULL);
+    if(numEnts <= 0)
+    {
+        if(0 == numEnts)
+        {
+            free(ents);
+        }
+        fprintf(stderr, "%s has no images to pack\n", indir);
+        remove(outFilePath);
+        return;
+    }
+
+    /* Strip ".png" and sort the names the same way getAtlasIndex() compares them */
+    char **names = calloc(numEnts, sizeof(char *));
+    for(int i = 0; i < numEnts; i++)
+    {
+        names[i] = strdup(ents[i]->d_name);
+        names[i][strlen(names[i]) - 4] = 0;
+        free(ents[i]);
+    }
+    free(ents);
+    qsort(names, numEnts, sizeof(char *), cmpRegionNames);
+
+    /* Load every image, and add up the size of the table and pixels */
+    unsigned char **pixels = calloc(numEnts, sizeof(unsigned char *));
+    int *widths = calloc(numEnts, sizeof(int));
+    int *heights = calloc(numEnts, sizeof(int));
+    uint32_t tableSize = 6;
+    uint32_t pixelsSize = 0;
+    bool loaded = true;
+    for(int i = 0; i < numEnts; i++)
+    {
+        char inFilePath[512];
+        snprintf(inFilePath, sizeof(inFilePath), "%s/%s.png", indir, names[i]);
+        pixels[i] = load_palette_image(inFilePath, outFilePath, &widths[i], &heights[i]);
+        if(NULL == pixels[i] || widths[i] > 0xFFFF || heights[i] > 0xFFFF)
+        {
+            fprintf(stderr, "Couldn't load %s\n", inFilePath);
+            loaded = false;
+            break;
+        }
+        /* Name, NUL, width, height */
+        tableSize += strlen(names[i]) + 1 + 4;
+        pixelsSize += widths[i] * heights[i];
+    }
+
+    /* Lay out the decompressed atlas */
+    uint32_t inputSize = tableSize + pixelsSize;
+    uint8_t *input = NULL;
+    if(loaded)
+    {
+        input = malloc(inputSize);
+        uint32_t tIdx = 0;
+        uint32_t pIdx = tableSize;
+        memcpy(&input[tIdx], ATLAS_MAGIC, 3);
+        tIdx += 3;
+        input[tIdx++] = ATLAS_VERSION;
+        input[tIdx++] = HI_BYTE(numEnts);
+        input[tIdx++] = LO_BYTE(numEnts);
+        for(int i = 0; i < numEnts; i++)
+        {
+            size_t nameLen = strlen(names[i]);
+            memcpy(&input[tIdx], names[i], nameLen);
+            tIdx += nameLen;
+            input[tIdx++] = 0;
+            input[tIdx++] = HI_BYTE(widths[i]);
+            input[tIdx++] = LO_BYTE(widths[i]);
+            input[tIdx++] = HI_BYTE(heights[i]);
+            input[tIdx++] = LO_BYTE(heights[i]);
+
+            memcpy(&input[pIdx], pixels[i], widths[i] * heights[i]);
+            pIdx += widths[i] * heights[i];
+        }
+    }
+
+    /* Free the images and their names */
+    for(int i = 0; i < numEnts; i++)
+    {
+        free(pixels[i]);
+        free(names[i]);
+    }
+    free(names);
+    free(pixels);
+    free(widths);
+    free(heights);
+
+    if(!loaded)
+    {
+        remove(outFilePath);
+        return;
+    }
+
+    /* Heatshrink may grow data which doesn't compress */
+    uint32_t outputSize = inputSize + (inputSize / 2) + 16;
+    uint8_t *output = malloc(outputSize);
+    uint32_t outputIdx = 0;
+    uint32_t inputIdx = 0;
+    size_t copied = 0;
+
+    /* Create the encoder, with the same parameters as WSGs */
+    heatshrink_encoder *hse = heatshrink_encoder_alloc(8, 4);
+    heatshrink_encoder_reset(hse);
+
+    /* Stream the data in chunks */
+    while(inputIdx < inputSize)
+    {
+        /* Pass bytes to the encoder for compression */
+        copied = 0;
+        heatshrink_encoder_sink(hse, &input[inputIdx], inputSize - inputIdx, &copied);
+        inputIdx += copied;
+
+        /* Save compressed data */
+        HSE_poll_res pres;
+        do
+        {
+            copied = 0;
+            pres = heatshrink_encoder_poll(hse, &output[outputIdx], outputSize - outputIdx, &copied);
+            outputIdx += copied;
+        } while(HSER_POLL_MORE == pres);
+    }
+
+    /* Mark all input as processed and flush the last bits of output */
+    while(HSER_FINISH_MORE == heatshrink_encoder_finish(hse))
+    {
+        copied = 0;
+        heatshrink_encoder_poll(hse, &output[outputIdx], outputSize - outputIdx, &copied);
+        outputIdx += copied;
+    }
+
+    /* Free the encoder and input */
+    heatshrink_encoder_free(hse);
+    free(input);
+
+    /* Write the compressed atlas, decompressed size first */
+    FILE *atlFile = fopen(outFilePath, "wb");
+    putc(HI_BYTE(HI_WORD(inputSize)), atlFile);
+    putc(LO_BYTE(HI_WORD(inputSize)), atlFile);
+    putc(HI_BYTE(LO_WORD(inputSize)), atlFile);
+    putc(LO_BYTE(LO_WORD(inputSize)), atlFile);
+    fwrite(output, outputIdx, 1, atlFile);
+    fclose(atlFile);
+
+    free(output);
+
+    /* Print results */
+    printf("%s:\n  Images packed: %d\n  ATL   file size: %ld\n",
+           indir,
+           numEnts,
+           getFileSize(outFilePath));
+}
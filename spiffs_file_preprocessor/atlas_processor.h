@@ -0,0 +1,6 @@
+#ifndef _ATLAS_PROCESSOR_H_
+#define _ATLAS_PROCESSOR_H_
+
+void process_atlas(const char * indir, const char * outdir);
+
+#endif /* _ATLAS_PROCESSOR_H_ */
@@ -103,31 +103,19 @@ void spreadError(pixel_t **img, int x, int y, int w, int h,
 }
 
 /**
- * @brief TODO
+ * @brief Load a PNG and reduce it to the 216 color palette, with the invalid
+ * index 216 for transparent pixels
  *
- * @param infile
- * @param outdir
+ * @param infile The PNG to load
+ * @param outFilePath The file being made from this PNG. If WRITE_DITHERED_PNG
+ *                    is defined, the reduced image is written next to it
+ * @param wOut Written with the width of the image
+ * @param hOut Written with the height of the image
+ * @return A buffer of w * h palette indices which must be freed, or NULL if the
+ *         PNG couldn't be loaded
  */
-void process_image(const char *infile, const char *outdir)
+unsigned char * load_palette_image(const char *infile, const char *outFilePath __attribute__((unused)), int *wOut, int *hOut)
 {
-	/* Determine if the output file already exists */
-	char outFilePath[128] = {0};
-	strcat(outFilePath, outdir);
-	strcat(outFilePath, "/");
-	strcat(outFilePath, get_filename(infile));
-
-	/* Change the file extension */
-	char * dotptr = strrchr(outFilePath, '.');
-	dotptr[1] = 'w';
-	dotptr[2] = 's';
-	dotptr[3] = 'g';
-
-	if(doesFileExist(outFilePath))
-	{
-		printf("Output for %s already exists\n", infile);
-		return;
-	}
-
 	/* Load the source PNG */
 	int w,h,n;
 	unsigned char *data = stbi_load(infile, &w, &h, &n, 4);
@@ -267,6 +255,47 @@ void process_image(const char *infile, const char *outdir)
 		}
 		free(image8b);
 
+		*wOut = w;
+		*hOut = h;
+		return paletteBuf;
+	}
+	return NULL;
+}
+
+/**
+ * @brief TODO
+ *
+ * @param infile
+ * @param outdir
+ */
+void process_image(const char *infile, const char *outdir)
+{
+	/* Determine if the output file already exists */
+	char outFilePath[128] = {0};
+	strcat(outFilePath, outdir);
+	strcat(outFilePath, "/");
+	strcat(outFilePath, get_filename(infile));
+
+	/* Change the file extension */
+	char * dotptr = strrchr(outFilePath, '.');
+	dotptr[1] = 'w';
+	dotptr[2] = 's';
+	dotptr[3] = 'g';
+
+	if(doesFileExist(outFilePath))
+	{
+		printf("Output for %s already exists\n", infile);
+		return;
+	}
+
+	/* Load the source PNG as palette indices */
+	int w,h;
+	unsigned char * paletteBuf = load_palette_image(infile, outFilePath, &w, &h);
+
+	if (NULL != paletteBuf)
+	{
+		uint32_t paletteBufSize = sizeof(unsigned char) * w * h;
+
 		/* Compress the palette-ized image */
 		uint32_t outputSize = sizeof(uint8_t) * (4 + paletteBufSize);
 		uint8_t * output = malloc(outputSize);
@@ -2,5 +2,6 @@
 #define _IMAGE_PROCESSOR_H_
 
 void process_image(const char * infile, const char * outdir);
+unsigned char * load_palette_image(const char *infile, const char *outFilePath, int *wOut, int *hOut);
 
 #endif /* _IMAGE_PROCESSOR_H_ */
\ No newline at end of file
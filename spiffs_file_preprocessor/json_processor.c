@@ -1,3 +1,4 @@
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -8,6 +9,335 @@
 #include "heatshrink_encoder.h"
 #include "fileUtils.h"
 
+#define FTR_MAX_SPRITES 256
+
+/* A growable buffer for the compiled fighter */
+typedef struct
+{
+    uint8_t *data;
+    uint32_t len;
+} ftrBuf_t;
+
+/* The table of sprite names referenced by the compiled fighter */
+typedef struct
+{
+    char names[FTR_MAX_SPRITES][FTR_BIN_SPR_NAME_LEN];
+    uint32_t numSprites;
+} ftrSprites_t;
+
+/* Attack types, in the order of attackOrder_t */
+static const char *ftrAttackTypes[FTR_BIN_NUM_ATTACKS] =
+{
+    "up_gnd",
+    "down_gnd",
+    "dash_gnd",
+    "front_gnd",
+    "neutral_gnd",
+    "neutral_air",
+    "front_air",
+    "back_air",
+    "up_air",
+    "down_air",
+};
+
+/**
+ * @brief Reserve space at the end of the buffer
+ *
+ * @param buf The buffer to grow
+ * @param len The number of bytes to reserve, zeroed
+ * @return The offset of the reserved space
+ */
+static uint32_t ftrBufReserve(ftrBuf_t *buf, uint32_t len)
+{
+    uint32_t offset = buf->len;
+    buf->data = realloc(buf->data, buf->len + len);
+    memset(&buf->data[offset], 0, len);
+    buf->len += len;
+    return offset;
+}
+
+/**
+ * @brief Get an integer from a JSON object
+ *
+ * @param obj The JSON object
+ * @param key The key to get
+ * @return The integer, or 0 if the key doesn't exist
+ */
+static int32_t ftrGetInt(const cJSON *obj, const char *key)
+{
+    const cJSON *item = cJSON_GetObjectItemCaseSensitive(obj, key);
+    return cJSON_IsNumber(item) ? item->valueint : 0;
+}
+
+/**
+ * @brief Get a time from a JSON object, converted from milliseconds to frames
+ *
+ * @param obj The JSON object
+ * @param key The key to get
+ * @param atLeastOne true if a time which exists must be at least one frame
+ * @return The number of frames, or 0 if the key doesn't exist
+ */
+static int32_t ftrGetFrames(const cJSON *obj, const char *key, bool atLeastOne)
+{
+    if(NULL == cJSON_GetObjectItemCaseSensitive(obj, key))
+    {
+        return 0;
+    }
+
+    int32_t frames = ftrGetInt(obj, key) / FTR_BIN_FRAME_TIME_MS;
+    if(atLeastOne && 0 == frames)
+    {
+        frames = 1;
+    }
+    return frames;
+}
+
+/**
+ * @brief Get the index of a sprite name in the sprite table, adding it if it isn't there yet
+ *
+ * @param sprites The sprite table
+ * @param name The sprite name
+ * @return The index of the sprite, or FTR_BIN_NO_SPRITE if it couldn't be added
+ */
+static int32_t ftrGetSpriteIdx(ftrSprites_t *sprites, const char *name)
+{
+    for(uint32_t idx = 0; idx < sprites->numSprites; idx++)
+    {
+        if(0 == strcmp(sprites->names[idx], name))
+        {
+            return idx;
+        }
+    }
+
+    if(sprites->numSprites >= FTR_MAX_SPRITES || strlen(name) >= FTR_BIN_SPR_NAME_LEN)
+    {
+        fprintf(stderr, "Can't add sprite %s\n", name);
+        return FTR_BIN_NO_SPRITE;
+    }
+
+    strcpy(sprites->names[sprites->numSprites], name);
+    return sprites->numSprites++;
+}
+
+/**
+ * @brief Compile an offset sprite object
+ *
+ * @param obj The JSON object, may be NULL
+ * @param sprites The sprite table
+ * @param os The compiled offset sprite
+ */
+static void ftrCompileSprite(const cJSON *obj, ftrSprites_t *sprites, ftrBinSprite_t *os)
+{
+    os->spriteIdx = FTR_BIN_NO_SPRITE;
+    const cJSON *name = cJSON_GetObjectItemCaseSensitive(obj, "sprite");
+    if(cJSON_IsString(name))
+    {
+        os->spriteIdx = ftrGetSpriteIdx(sprites, name->valuestring);
+    }
+    os->offsetX = ftrGetInt(obj, "off_x");
+    os->offsetY = ftrGetInt(obj, "off_y");
+}
+
+/**
+ * @brief Compile an attack hitbox object
+ *
+ * @param obj The JSON object
+ * @param sprites The sprite table
+ * @param hbx The compiled hitbox
+ */
+static void ftrCompileHitbox(const cJSON *obj, ftrSprites_t *sprites, ftrBinHitbox_t *hbx)
+{
+    hbx->posX = ftrGetInt(obj, "relativePos_x") << FTR_BIN_SF;
+    hbx->posY = ftrGetInt(obj, "relativePos_y") << FTR_BIN_SF;
+    hbx->sizeX = ftrGetInt(obj, "size_x") << FTR_BIN_SF;
+    hbx->sizeY = ftrGetInt(obj, "size_y") << FTR_BIN_SF;
+    hbx->knockbackX = ftrGetInt(obj, "knockback_x");
+    hbx->knockbackY = ftrGetInt(obj, "knockback_y");
+    hbx->damage = ftrGetInt(obj, "damage");
+    /* Allow 0 frames hitstun */
+    hbx->hitstun = ftrGetFrames(obj, "hitstun", false);
+    ftrCompileSprite(cJSON_GetObjectItemCaseSensitive(obj, "projectileSprite"), sprites, &hbx->projSprite);
+    hbx->projVeloX = ftrGetInt(obj, "projectileVelo_x");
+    hbx->projVeloY = ftrGetInt(obj, "projectileVelo_y");
+    hbx->projAccelX = ftrGetInt(obj, "projectileAccel_x");
+    hbx->projAccelY = ftrGetInt(obj, "projectileAccel_y");
+    hbx->projDuration = ftrGetFrames(obj, "projectileDuration", true);
+    hbx->isProjectile = cJSON_IsTrue(cJSON_GetObjectItemCaseSensitive(obj, "isProjectile"));
+    hbx->projPassThru = cJSON_IsTrue(cJSON_GetObjectItemCaseSensitive(obj, "projectilePassThru"));
+}
+
+/**
+ * @brief Compile an attack frame object. Hitboxes are appended to the buffer
+ *
+ * @param obj The JSON object
+ * @param sprites The sprite table
+ * @param buf The buffer to append hitboxes to
+ * @param frmOffset The offset of the compiled attack frame in the buffer
+ */
+static void ftrCompileAttackFrame(const cJSON *obj, ftrSprites_t *sprites, ftrBuf_t *buf, uint32_t frmOffset)
+{
+    ftrBinAttackFrame_t frm = {0};
+    ftrCompileSprite(cJSON_GetObjectItemCaseSensitive(obj, "atkSpr"), sprites, &frm.sprite);
+    frm.hurtboxOffsetX = ftrGetInt(obj, "hurtbox_offset_x");
+    frm.hurtboxOffsetY = ftrGetInt(obj, "hurtbox_offset_y");
+    frm.hurtboxSizeX = ftrGetInt(obj, "hurtbox_size_x");
+    frm.hurtboxSizeY = ftrGetInt(obj, "hurtbox_size_y");
+    frm.veloX = ftrGetInt(obj, "velo_x");
+    frm.veloY = ftrGetInt(obj, "velo_y");
+    frm.duration = ftrGetFrames(obj, "duration", true);
+    frm.iFrames = ftrGetFrames(obj, "iframe_timer", false);
+
+    const cJSON *hitboxes = cJSON_GetObjectItemCaseSensitive(obj, "hitboxes");
+    frm.numHitboxes = cJSON_GetArraySize(hitboxes);
+    frm.hitboxesOffset = ftrBufReserve(buf, frm.numHitboxes * sizeof(ftrBinHitbox_t));
+
+    uint32_t hbxIdx = 0;
+    const cJSON *hitbox = NULL;
+    cJSON_ArrayForEach(hitbox, hitboxes)
+    {
+        ftrBinHitbox_t hbx = {0};
+        ftrCompileHitbox(hitbox, sprites, &hbx);
+        memcpy(&buf->data[frm.hitboxesOffset + (hbxIdx++ * sizeof(ftrBinHitbox_t))], &hbx, sizeof(hbx));
+    }
+
+    memcpy(&buf->data[frmOffset], &frm, sizeof(frm));
+}
+
+/**
+ * @brief Compile an attack object. Attack frames are appended to the buffer
+ *
+ * @param obj The JSON object
+ * @param sprites The sprite table
+ * @param buf The buffer to append attack frames to
+ * @param atk The compiled attack
+ */
+static void ftrCompileAttack(const cJSON *obj, ftrSprites_t *sprites, ftrBuf_t *buf, ftrBinAttack_t *atk)
+{
+    ftrCompileSprite(cJSON_GetObjectItemCaseSensitive(obj, "startupLagSpr"), sprites, &atk->startupLagSprite);
+    ftrCompileSprite(cJSON_GetObjectItemCaseSensitive(obj, "endLagSpr"), sprites, &atk->endLagSprite);
+    atk->startupLag = ftrGetFrames(obj, "startupLag", true);
+    atk->endLag = ftrGetFrames(obj, "endLag", true);
+    atk->landingLag = ftrGetFrames(obj, "landing_lag", true);
+    atk->iFrames = ftrGetFrames(obj, "iframe_timer", false);
+    atk->onlyFirstHit = cJSON_IsTrue(cJSON_GetObjectItemCaseSensitive(obj, "onlyFirstHit"));
+
+    /* Reserve all the frames first so they're contiguous */
+    const cJSON *frames = cJSON_GetObjectItemCaseSensitive(obj, "attack_frames");
+    atk->numAttackFrames = cJSON_GetArraySize(frames);
+    atk->attackFramesOffset = ftrBufReserve(buf, atk->numAttackFrames * sizeof(ftrBinAttackFrame_t));
+
+    uint32_t frmIdx = 0;
+    const cJSON *frame = NULL;
+    cJSON_ArrayForEach(frame, frames)
+    {
+        ftrCompileAttackFrame(frame, sprites, buf,
+                              atk->attackFramesOffset + (frmIdx++ * sizeof(ftrBinAttackFrame_t)));
+    }
+}
+
+/**
+ * @brief Compile a fighter JSON object into a binary file which can be loaded
+ * without any parsing
+ *
+ * @param root The fighter JSON object
+ * @param outFilePath The file to write
+ * @return true if the fighter was compiled, false if there was an error
+ */
+static bool compileFighter(const cJSON *root, const char *outFilePath)
+{
+    ftrBuf_t buf = {0};
+    ftrSprites_t *sprites = calloc(1, sizeof(ftrSprites_t));
+    ftrBinFighter_t ftr = {0};
+
+    /* Reserve space for the fighter, it's written last */
+    ftrBufReserve(&buf, sizeof(ftrBinFighter_t));
+
+    memcpy(ftr.magic, FTR_BIN_MAGIC, sizeof(ftr.magic));
+    ftr.version = FTR_BIN_VERSION;
+    ftr.frameTimeMs = FTR_BIN_FRAME_TIME_MS;
+
+    ftr.gravity = ftrGetInt(root, "gravity");
+    if(NULL != cJSON_GetObjectItemCaseSensitive(root, "weight"))
+    {
+        /* Weight is stored inverted, as a knockback scalar */
+        ftr.weight = ftrGetInt(root, "weight");
+        if(0 < ftr.weight && ftr.weight < 2048)
+        {
+            ftr.weight = 2048 - ftr.weight;
+        }
+        else
+        {
+            ftr.weight = 1024;
+        }
+    }
+    ftr.jumpVelo = ftrGetInt(root, "jump_velo");
+    ftr.runAccel = ftrGetInt(root, "run_accel");
+    ftr.runDecel = ftrGetInt(root, "run_decel");
+    ftr.runMaxVelo = ftrGetInt(root, "run_max_velo");
+    ftr.sizeX = ftrGetInt(root, "size_x") << FTR_BIN_SF;
+    ftr.sizeY = ftrGetInt(root, "size_y") << FTR_BIN_SF;
+    ftr.numJumps = ftrGetInt(root, "nJumps");
+    ftr.landingLag = ftrGetFrames(root, "landing_lag", true);
+
+    ftr.stockIconIdx = FTR_BIN_NO_SPRITE;
+    const cJSON *stockIcon = cJSON_GetObjectItemCaseSensitive(root, "stock_icn");
+    if(cJSON_IsString(stockIcon))
+    {
+        ftr.stockIconIdx = ftrGetSpriteIdx(sprites, stockIcon->valuestring);
+    }
+
+    ftrCompileSprite(cJSON_GetObjectItemCaseSensitive(root, "idle_spr_0"), sprites, &ftr.idleSprite0);
+    ftrCompileSprite(cJSON_GetObjectItemCaseSensitive(root, "idle_spr_1"), sprites, &ftr.idleSprite1);
+    ftrCompileSprite(cJSON_GetObjectItemCaseSensitive(root, "run_spr_0"), sprites, &ftr.runSprite0);
+    ftrCompileSprite(cJSON_GetObjectItemCaseSensitive(root, "run_spr_1"), sprites, &ftr.runSprite1);
+    ftrCompileSprite(cJSON_GetObjectItemCaseSensitive(root, "jump_spr"), sprites, &ftr.jumpSprite);
+    ftrCompileSprite(cJSON_GetObjectItemCaseSensitive(root, "duck_spr"), sprites, &ftr.duckSprite);
+    ftrCompileSprite(cJSON_GetObjectItemCaseSensitive(root, "land_lag_spr"), sprites, &ftr.landingLagSprite);
+    ftrCompileSprite(cJSON_GetObjectItemCaseSensitive(root, "hitstun_ground_sprite"), sprites, &ftr.hitstunGroundSprite);
+    ftrCompileSprite(cJSON_GetObjectItemCaseSensitive(root, "hitstun_air_sprite"), sprites, &ftr.hitstunAirSprite);
+
+    /* Attacks without data are left empty */
+    bool ok = true;
+    const cJSON *attack = NULL;
+    cJSON_ArrayForEach(attack, cJSON_GetObjectItemCaseSensitive(root, "attacks"))
+    {
+        const cJSON *type = cJSON_GetObjectItemCaseSensitive(attack, "type");
+        int32_t atkIdx = 0;
+        for(atkIdx = 0; atkIdx < FTR_BIN_NUM_ATTACKS; atkIdx++)
+        {
+            if(cJSON_IsString(type) && 0 == strcmp(type->valuestring, ftrAttackTypes[atkIdx]))
+            {
+                break;
+            }
+        }
+
+        if(FTR_BIN_NUM_ATTACKS == atkIdx)
+        {
+            fprintf(stderr, "Unknown attack type\n");
+            ok = false;
+            continue;
+        }
+        ftrCompileAttack(attack, sprites, &buf, &ftr.attacks[atkIdx]);
+    }
+
+    /* Write the sprite table and fighter */
+    ftr.numSprites = sprites->numSprites;
+    ftr.spriteNamesOffset = ftrBufReserve(&buf, sprites->numSprites * FTR_BIN_SPR_NAME_LEN);
+    memcpy(&buf.data[ftr.spriteNamesOffset], sprites->names, sprites->numSprites * FTR_BIN_SPR_NAME_LEN);
+    memcpy(buf.data, &ftr, sizeof(ftr));
+
+    if(ok)
+    {
+        FILE *outFile = fopen(outFilePath, "wb");
+        fwrite(buf.data, buf.len, 1, outFile);
+        fclose(outFile);
+    }
+
+    free(sprites);
+    free(buf.data);
+    return ok;
+}
+
 void process_json(const char *infile, const char *outdir)
 {
     /* Determine if the output file already exists */
@@ -41,6 +371,22 @@ void process_json(const char *infile, const char *outdir)
     jsonInStr[sz] = 0;
     fclose(fp);
 
+    /* Fighters are compiled to a binary file rather than parsed at runtime */
+    cJSON* jsonRoot = cJSON_Parse(jsonInStr);
+    if(NULL != cJSON_GetObjectItemCaseSensitive(jsonRoot, "idle_spr_0"))
+    {
+        char * dotptr = strrchr(outFilePath, '.');
+        strcpy(&dotptr[1], "ftr");
+
+        if(!compileFighter(jsonRoot, outFilePath))
+        {
+            fprintf(stderr, "Failed to compile fighter %s\n", infile);
+        }
+        cJSON_Delete(jsonRoot);
+        return;
+    }
+    cJSON_Delete(jsonRoot);
+
 #ifndef JSON_COMPRESSION
     /* Write input directly to output */
     FILE* outFile = fopen(outFilePath, "wb");
@@ -1,6 +1,9 @@
 #ifndef _JSON_PROCESSOR_H_
 #define _JSON_PROCESSOR_H_
 
+/* The compiled fighter layout is shared with the firmware */
+#include "fighter_bin.h"
+
 void process_json(const char *infile, const char *outdir);
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,107 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sng_processor.h"
+#include "heatshrink_encoder.h"
+#include "fileUtils.h"
+
+/**
+ * @brief Compress a song from midi_to_beeper_stable.py with heatshrink. The
+ * output has the same four byte decompressed size header as a WSG, and the
+ * song is checked on the badge when it's loaded
+ *
+ * @param infile The encoded song to compress
+ * @param outdir The directory to write the compressed song to
+ */
+void process_sng(const char *infile, const char *outdir)
+{
+    /* Determine if the output file already exists */
+    char outFilePath[128] = {0};
+    strcat(outFilePath, outdir);
+    strcat(outFilePath, "/");
+    strcat(outFilePath, get_filename(infile));
+
+    if(doesFileExist(outFilePath))
+    {
+        printf("Output for %s already exists\n", infile);
+        return;
+    }
+
+    /* Read input file */
+    FILE *fp = fopen(infile, "rb");
+    fseek(fp, 0L, SEEK_END);
+    long sz = ftell(fp);
+    fseek(fp, 0L, SEEK_SET);
+    uint8_t *input = malloc(sz);
+    fread(input, sz, 1, fp);
+    fclose(fp);
+
+    if(sz < 4 || 0 != memcmp(input, "SNG", 3))
+    {
+        fprintf(stderr, "%s is not an encoded song\n", infile);
+        free(input);
+        remove(outFilePath);
+        return;
+    }
+
+    /* Heatshrink may grow data which doesn't compress */
+    uint32_t outputSize = sz + (sz / 2) + 16;
+    uint8_t *output = malloc(outputSize);
+    uint32_t outputIdx = 0;
+    uint32_t inputIdx = 0;
+    size_t copied = 0;
+
+    /* Create the encoder */
+    heatshrink_encoder *hse = heatshrink_encoder_alloc(8, 4);
+    heatshrink_encoder_reset(hse);
+
+    /* Stream the data in chunks */
+    while(inputIdx < sz)
+    {
+        /* Pass bytes to the encoder for compression */
+        copied = 0;
+        heatshrink_encoder_sink(hse, &input[inputIdx], sz - inputIdx, &copied);
+        inputIdx += copied;
+
+        /* Save compressed data */
+        HSE_poll_res pres;
+        do
+        {
+            copied = 0;
+            pres = heatshrink_encoder_poll(hse, &output[outputIdx], outputSize - outputIdx, &copied);
+            outputIdx += copied;
+        } while(HSER_POLL_MORE == pres);
+    }
+
+    /* Mark all input as processed and flush the last bits of output */
+    while(HSER_FINISH_MORE == heatshrink_encoder_finish(hse))
+    {
+        copied = 0;
+        heatshrink_encoder_poll(hse, &output[outputIdx], outputSize - outputIdx, &copied);
+        outputIdx += copied;
+    }
+
+    /* Free the encoder and input */
+    heatshrink_encoder_free(hse);
+    free(input);
+
+    /* Write the compressed song, decompressed size first */
+    FILE *sngFile = fopen(outFilePath, "wb");
+    putc(HI_BYTE(HI_WORD(inputIdx)), sngFile);
+    putc(LO_BYTE(HI_WORD(inputIdx)), sngFile);
+    putc(HI_BYTE(LO_WORD(inputIdx)), sngFile);
+    putc(LO_BYTE(LO_WORD(inputIdx)), sngFile);
+    fwrite(output, outputIdx, 1, sngFile);
+    fclose(sngFile);
+
+    free(output);
+
+    /* Print results */
+    printf("%s:\n  Source file size: %ld\n  SNG   file size: %ld\n",
+           infile,
+           getFileSize(infile),
+           getFileSize(outFilePath));
+}
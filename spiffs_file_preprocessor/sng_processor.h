@@ -0,0 +1,6 @@
+#ifndef _SNG_PROCESSOR_H_
+#define _SNG_PROCESSOR_H_
+
+void process_sng(const char * infile, const char * outdir);
+
+#endif /* _SNG_PROCESSOR_H_ */
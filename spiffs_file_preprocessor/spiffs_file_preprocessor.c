@@ -15,6 +15,8 @@
 #include "json_processor.h"
 #include "bin_processor.h"
 #include "txt_processor.h"
+#include "sng_processor.h"
+#include "atlas_processor.h"
 
 const char * outDirName = NULL;
 
@@ -57,7 +59,12 @@ static int processFile(const char * fpath, const struct stat * st __attribute__(
     switch(tflag) {
     case FTW_F: // file
         {
-            if(endsWith(fpath, ".font.png"))
+            if(NULL != strstr(fpath, ".atlas/"))
+            {
+                // Packed when the atlas directory is visited
+                break;
+            }
+            else if(endsWith(fpath, ".font.png"))
             {
                 process_font(fpath, outDirName);
             }
@@ -77,10 +84,18 @@ static int processFile(const char * fpath, const struct stat * st __attribute__(
             {
                 process_txt(fpath, outDirName);
             }
+            else if(endsWith(fpath, ".sng"))
+            {
+                process_sng(fpath, outDirName);
+            }
             break;
         }
     case FTW_D: // directory
         {
+            if(endsWith(fpath, ".atlas"))
+            {
+                process_atlas(fpath, outDirName);
+            }
             break;
         }
     default:
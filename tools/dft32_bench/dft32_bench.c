@@ -0,0 +1,188 @@
+//==============================================================================
+// Includes
+//==============================================================================
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "embeddednf.h"
+#include "DFT32.h"
+
+//==============================================================================
+// Defines
+//==============================================================================
+
+// One second of audio at the mic's sample rate
+#define NUM_SAMPLES DFREQ
+
+// The mic delivers blocks of up to this many samples
+#define MAX_BLOCK_LEN 512
+
+// How many times to push the same audio when measuring throughput
+#define BENCH_ITERATIONS 200
+
+//==============================================================================
+// Functions
+//==============================================================================
+
+/**
+ * @brief Generate a tone with some noise, like the mic would produce
+ *
+ * @param samples The buffer to fill
+ * @param numSamples The number of samples to generate
+ * @param freq The frequency of the tone, or 0 for only noise
+ * @param amplitude The amplitude of the tone, at most 4095
+ */
+static void generateTone(int16_t* samples, int numSamples, float freq, int amplitude)
+{
+    for(int i = 0; i < numSamples; i++)
+    {
+        float tone = amplitude * sinf(2 * M_PI * freq * i / DFREQ);
+        int noise = (rand() % 64) - 32;
+        int sample = (int)tone + noise;
+        if(sample > 4095)
+        {
+            sample = 4095;
+        }
+        else if(sample < -4095)
+        {
+            sample = -4095;
+        }
+        samples[i] = sample;
+    }
+}
+
+/**
+ * @brief Get a monotonic time in seconds
+ *
+ * @return The time
+ */
+static double getTimeS(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + (ts.tv_nsec / 1e9);
+}
+
+/**
+ * @brief Push samples one at a time and in random sized blocks, then check that
+ * the DFT state and output bins match exactly
+ *
+ * @param samples The samples to push
+ * @param numSamples The number of samples
+ * @return true if the outputs match, false if they do not
+ */
+static bool checkAccuracy(const int16_t* samples, int numSamples)
+{
+    static embeddednf_data ed;
+    static dft32_data ref;
+    static dft32_data blk;
+    InitColorChord(&ed, &ref);
+    InitColorChord(&ed, &blk);
+
+    int idx = 0;
+    while(idx < numSamples)
+    {
+        int blockLen = 1 + (rand() % MAX_BLOCK_LEN);
+        if(blockLen > numSamples - idx)
+        {
+            blockLen = numSamples - idx;
+        }
+
+        for(int i = 0; i < blockLen; i++)
+        {
+            PushSample32(&ref, samples[idx + i]);
+        }
+        PushSamples32(&blk, &samples[idx], blockLen);
+        idx += blockLen;
+
+        UpdateOutputBins32(&ref);
+        UpdateOutputBins32(&blk);
+
+        if(0 != memcmp(ref.embeddedbins32, blk.embeddedbins32, sizeof(ref.embeddedbins32)))
+        {
+            printf("  embeddedbins32 differs after %d samples\n", idx);
+            return false;
+        }
+        if(0 != memcmp(&ref, &blk, sizeof(ref)))
+        {
+            printf("  DFT state differs after %d samples\n", idx);
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Measure how many samples per second each implementation can process
+ *
+ * @param samples The samples to push
+ * @param numSamples The number of samples
+ */
+static void measureThroughput(const int16_t* samples, int numSamples)
+{
+    static embeddednf_data ed;
+    static dft32_data dd;
+
+    InitColorChord(&ed, &dd);
+    double start = getTimeS();
+    for(int it = 0; it < BENCH_ITERATIONS; it++)
+    {
+        for(int i = 0; i < numSamples; i++)
+        {
+            PushSample32(&dd, samples[i]);
+        }
+    }
+    double perSample = getTimeS() - start;
+
+    InitColorChord(&ed, &dd);
+    start = getTimeS();
+    for(int it = 0; it < BENCH_ITERATIONS; it++)
+    {
+        for(int i = 0; i < numSamples; i += MAX_BLOCK_LEN)
+        {
+            int blockLen = (numSamples - i < MAX_BLOCK_LEN) ? (numSamples - i) : MAX_BLOCK_LEN;
+            PushSamples32(&dd, &samples[i], blockLen);
+        }
+    }
+    double block = getTimeS() - start;
+
+    double totalSamples = (double)numSamples * BENCH_ITERATIONS;
+    printf("PushSample32:  %12.0f samples/s\n", totalSamples / perSample);
+    printf("PushSamples32: %12.0f samples/s (%.2fx)\n", totalSamples / block, perSample / block);
+}
+
+/**
+ * @brief Compare the block DFT to the per-sample DFT for a few tones, then
+ * measure throughput
+ *
+ * @return 0 if all tones matched, 1 if any did not
+ */
+int main(void)
+{
+    // Tones across the octaves, plus silence and a full scale tone
+    const float freqs[] = {0, 55, 110, 220, 440, 880, 1760, 3000};
+    const int amplitudes[] = {0, 2000, 2000, 2000, 2000, 2000, 4000, 1000};
+
+    static int16_t samples[NUM_SAMPLES];
+    bool allOk = true;
+
+    srand(1);
+    for(unsigned int i = 0; i < sizeof(freqs) / sizeof(freqs[0]); i++)
+    {
+        generateTone(samples, NUM_SAMPLES, freqs[i], amplitudes[i]);
+        bool ok = checkAccuracy(samples, NUM_SAMPLES);
+        printf("%6.0f Hz: %s\n", freqs[i], ok ? "match" : "MISMATCH");
+        allOk = allOk && ok;
+    }
+
+    generateTone(samples, NUM_SAMPLES, 440, 2000);
+    measureThroughput(samples, NUM_SAMPLES);
+
+    return allOk ? 0 : 1;
+}
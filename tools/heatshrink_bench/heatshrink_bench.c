@@ -0,0 +1,274 @@
+//==============================================================================
+// Includes
+//==============================================================================
+
+#include <dirent.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "heatshrink_decoder.h"
+
+//==============================================================================
+// Defines
+//==============================================================================
+
+// The settings every asset is compressed with by spiffs_file_preprocessor
+#define WINDOW_SZ2    8
+#define LOOKAHEAD_SZ2 4
+#define INPUT_BUF_SZ  256
+
+// How many times to decode every asset when measuring throughput
+#define BENCH_ITERATIONS 50
+
+// The most assets to load
+#define MAX_ASSETS 1024
+
+//==============================================================================
+// Structs
+//==============================================================================
+
+typedef struct
+{
+    char name[64];
+    uint8_t* compressed;   ///< The file without its size header
+    size_t compressedSize;
+    uint32_t decompressedSize;
+} asset_t;
+
+//==============================================================================
+// Functions
+//==============================================================================
+
+/**
+ * @brief heatshrink_decoder_alloc() allocates from SPI RAM on the badge
+ */
+void* heap_caps_malloc(size_t size, uint32_t caps)
+{
+    (void)caps;
+    return malloc(size);
+}
+
+/**
+ * @brief Get a monotonic time in seconds
+ *
+ * @return The time
+ */
+static double getTimeS(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + (ts.tv_nsec / 1e9);
+}
+
+/**
+ * @brief Only benchmark files which are heatshrink compressed with a size header
+ *
+ * @param name A filename
+ * @return true if the file is a compressed asset
+ */
+static bool isCompressedAsset(const char* name)
+{
+    const char* exts[] = {".wsg", ".sng", ".atl"};
+    size_t len = strlen(name);
+    for(unsigned int i = 0; i < sizeof(exts) / sizeof(exts[0]); i++)
+    {
+        if(len > 4 && 0 == strcmp(&name[len - 4], exts[i]))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Decode an asset the way the firmware used to, sinking and polling
+ * through a decoder's input buffer
+ *
+ * @param asset The asset to decode
+ * @param out A buffer of at least asset->decompressedSize bytes
+ * @return The number of bytes decoded
+ */
+static size_t decodeStreaming(const asset_t* asset, uint8_t* out)
+{
+    size_t copied = 0;
+    heatshrink_decoder* hsd = heatshrink_decoder_alloc(INPUT_BUF_SZ, WINDOW_SZ2, LOOKAHEAD_SZ2);
+    heatshrink_decoder_reset(hsd);
+
+    size_t inputIdx = 0;
+    size_t outputIdx = 0;
+    while(inputIdx < asset->compressedSize)
+    {
+        copied = 0;
+        heatshrink_decoder_sink(hsd, &asset->compressed[inputIdx], asset->compressedSize - inputIdx, &copied);
+        inputIdx += copied;
+
+        copied = 0;
+        heatshrink_decoder_poll(hsd, &out[outputIdx], asset->decompressedSize - outputIdx, &copied);
+        outputIdx += copied;
+    }
+    heatshrink_decoder_finish(hsd);
+
+    copied = 0;
+    heatshrink_decoder_poll(hsd, &out[outputIdx], asset->decompressedSize - outputIdx, &copied);
+    outputIdx += copied;
+
+    heatshrink_decoder_free(hsd);
+    return outputIdx;
+}
+
+/**
+ * @brief Decode an asset with the whole buffer decoder
+ *
+ * @param asset The asset to decode
+ * @param out A buffer of at least asset->decompressedSize bytes
+ * @return The number of bytes decoded
+ */
+static size_t decodeBuffer(const asset_t* asset, uint8_t* out)
+{
+    size_t outputSize = 0;
+    heatshrink_decode_buffer(asset->compressed, asset->compressedSize, out, asset->decompressedSize, &outputSize,
+                             WINDOW_SZ2, LOOKAHEAD_SZ2);
+    return outputSize;
+}
+
+/**
+ * @brief Load every compressed asset in a directory
+ *
+ * @param dirName The directory to load from
+ * @param assets The array to load to, MAX_ASSETS long
+ * @return The number of assets loaded
+ */
+static int loadAssets(const char* dirName, asset_t* assets)
+{
+    DIR* d = opendir(dirName);
+    if(NULL == d)
+    {
+        return 0;
+    }
+
+    int numAssets = 0;
+    struct dirent* dir;
+    while(numAssets < MAX_ASSETS && NULL != (dir = readdir(d)))
+    {
+        if(!isCompressedAsset(dir->d_name))
+        {
+            continue;
+        }
+
+        char path[512];
+        snprintf(path, sizeof(path), "%s/%s", dirName, dir->d_name);
+        FILE* fp = fopen(path, "rb");
+        if(NULL == fp)
+        {
+            continue;
+        }
+        fseek(fp, 0L, SEEK_END);
+        long sz = ftell(fp);
+        fseek(fp, 0L, SEEK_SET);
+        uint8_t* buf = malloc(sz);
+        size_t read = fread(buf, 1, sz, fp);
+        fclose(fp);
+        if(sz < 4 || read != (size_t)sz)
+        {
+            free(buf);
+            continue;
+        }
+
+        asset_t* asset = &assets[numAssets++];
+        snprintf(asset->name, sizeof(asset->name), "%s", dir->d_name);
+        asset->decompressedSize = (buf[0] << 24) | (buf[1] << 16) | (buf[2] << 8) | (buf[3]);
+        asset->compressedSize = sz - 4;
+        asset->compressed = malloc(asset->compressedSize);
+        memcpy(asset->compressed, &buf[4], asset->compressedSize);
+        free(buf);
+    }
+    closedir(d);
+    return numAssets;
+}
+
+/**
+ * @brief Decode every asset both ways and check the outputs match, then
+ * measure the throughput of each decoder
+ *
+ * @param argc The number of arguments
+ * @param argv The directory of assets to decode, usually spiffs_image
+ * @return 0 if every asset matched, 1 if any did not
+ */
+int main(int argc, char** argv)
+{
+    const char* dirName = (argc > 1) ? argv[1] : "../../spiffs_image";
+
+    static asset_t assets[MAX_ASSETS];
+    int numAssets = loadAssets(dirName, assets);
+    if(0 == numAssets)
+    {
+        printf("No compressed assets in %s, build the SPIFFS image first\n", dirName);
+        return 1;
+    }
+
+    uint32_t maxSize = 0;
+    uint64_t totalBytes = 0;
+    for(int i = 0; i < numAssets; i++)
+    {
+        if(assets[i].decompressedSize > maxSize)
+        {
+            maxSize = assets[i].decompressedSize;
+        }
+        totalBytes += assets[i].decompressedSize;
+    }
+    uint8_t* ref = malloc(maxSize);
+    uint8_t* fast = malloc(maxSize);
+
+    // Check every asset decodes the same both ways
+    bool allOk = true;
+    for(int i = 0; i < numAssets; i++)
+    {
+        memset(ref, 0xAA, maxSize);
+        memset(fast, 0x55, maxSize);
+        size_t refSize = decodeStreaming(&assets[i], ref);
+        size_t fastSize = decodeBuffer(&assets[i], fast);
+        if(refSize != fastSize || 0 != memcmp(ref, fast, refSize))
+        {
+            printf("%s: MISMATCH (%zu vs %zu bytes)\n", assets[i].name, refSize, fastSize);
+            allOk = false;
+        }
+    }
+    printf("%d assets, %.1f KB decompressed: %s\n", numAssets, totalBytes / 1024.0, allOk ? "match" : "MISMATCH");
+
+    // Measure each decoder
+    double start = getTimeS();
+    for(int it = 0; it < BENCH_ITERATIONS; it++)
+    {
+        for(int i = 0; i < numAssets; i++)
+        {
+            decodeStreaming(&assets[i], ref);
+        }
+    }
+    double streaming = getTimeS() - start;
+
+    start = getTimeS();
+    for(int it = 0; it < BENCH_ITERATIONS; it++)
+    {
+        for(int i = 0; i < numAssets; i++)
+        {
+            decodeBuffer(&assets[i], fast);
+        }
+    }
+    double buffer = getTimeS() - start;
+
+    double totalMB = (double)totalBytes * BENCH_ITERATIONS / (1024 * 1024);
+    printf("heatshrink_decoder_poll:  %8.1f MB/s\n", totalMB / streaming);
+    printf("heatshrink_decode_buffer: %8.1f MB/s (%.2fx)\n", totalMB / buffer, streaming / buffer);
+
+    for(int i = 0; i < numAssets; i++)
+    {
+        free(assets[i].compressed);
+    }
+    free(ref);
+    free(fast);
+    return allOk ? 0 : 1;
+}